@@ -0,0 +1,101 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2022 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+// Libraries
+#include <string>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <cstdint>
+
+/// Reactphysics3D namespace
+namespace reactphysics3d {
+
+// Class Benchmark
+/**
+ * This abstract class represents a micro-benchmark. To create a benchmark, you simply
+ * need to create a class that inherits from the Benchmark class, override the run() method
+ * and use the getTime() and report() methods to measure and print the results.
+ */
+class Benchmark {
+
+    private :
+
+        // ---------- Attributes ---------- //
+
+        /// Name of the benchmark
+        std::string mName;
+
+    protected :
+
+        // ---------- Methods ---------- //
+
+        /// Return the current time (in seconds)
+        static double getTime() {
+            return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+
+        /// Print the result of a case of the benchmark
+        void report(const std::string& caseName, uint64_t nbIterations, double elapsedTime, uint64_t nbContactPoints) const {
+
+            std::cout << std::left << std::setw(48) << (mName + " / " + caseName) << std::right
+                      << std::setw(10) << nbIterations << " iterations"
+                      << std::setw(12) << std::fixed << std::setprecision(3) << (elapsedTime * 1000.0 / nbIterations) << " ms/iteration"
+                      << std::setw(14) << std::setprecision(0) << (nbContactPoints / elapsedTime) << " contacts/s" << std::endl;
+        }
+
+    public :
+
+        // ---------- Methods ---------- //
+
+        /// Constructor
+        Benchmark(const std::string& name) : mName(name) {
+
+        }
+
+        /// Destructor
+        virtual ~Benchmark() = default;
+
+        /// Deleted copy-constructor
+        Benchmark(const Benchmark& benchmark) = delete;
+
+        /// Deleted assignment operator
+        Benchmark& operator=(const Benchmark& benchmark) = delete;
+
+        /// Return the name of the benchmark
+        const std::string& getName() const {
+            return mName;
+        }
+
+        /// Run the benchmark
+        virtual void run()=0;
+};
+
+}
+
+#endif
@@ -0,0 +1,243 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2022 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef CONTACT_CREATION_BENCHMARK_H
+#define CONTACT_CREATION_BENCHMARK_H
+
+// Libraries
+#include "Benchmark.h"
+#include <reactphysics3d/reactphysics3d.h>
+#include <vector>
+
+/// Reactphysics3D namespace
+namespace reactphysics3d {
+
+// Class ContactPointsCounter
+/**
+ * Event listener (and collision callback) that counts the reported contact points
+ */
+class ContactPointsCounter : public EventListener {
+
+    public:
+
+        /// Number of reported contact points
+        uint64_t nbContactPoints = 0;
+
+        /// Called when some contacts occur
+        virtual void onContact(const CollisionCallback::CallbackData& callbackData) override {
+
+            for (uint32 p=0; p < callbackData.getNbContactPairs(); p++) {
+                nbContactPoints += callbackData.getContactPair(p).getNbContactPoints();
+            }
+        }
+};
+
+// Class ContactCreationBenchmark
+/**
+ * Micro-benchmark of the contact creation throughput of the collision detection (narrow-phase,
+ * potential contacts processing and contact manifolds reduction). Each scene is measured with
+ * full world updates (contacts creation for the solver) and with the testCollision() method.
+ */
+class ContactCreationBenchmark : public Benchmark {
+
+    private :
+
+        // ---------- Constants ---------- //
+
+        /// Number of steps to let the bodies come to rest before the measure
+        static const int NB_WARMUP_STEPS = 60;
+
+        /// Number of measured world updates
+        static const int NB_UPDATE_STEPS = 300;
+
+        /// Number of measured testCollision() calls
+        static const int NB_TEST_COLLISION_CALLS = 300;
+
+        /// Time step of the simulation
+        static constexpr decimal TIME_STEP = decimal(1.0) / decimal(60.0);
+
+        /// Number of cells of the triangle mesh in each direction
+        static const int MESH_RESOLUTION = 64;
+
+        // ---------- Attributes ---------- //
+
+        /// Physics common object
+        PhysicsCommon mPhysicsCommon;
+
+        /// Vertices of the terrain triangle mesh
+        std::vector<float> mMeshVertices;
+
+        /// Indices of the terrain triangle mesh
+        std::vector<int> mMeshIndices;
+
+        // ---------- Methods ---------- //
+
+        /// Return the settings of the worlds of the benchmark
+        static PhysicsWorld::WorldSettings getWorldSettings() {
+
+            // The sleeping is disabled because the contacts of sleeping bodies are not computed
+            PhysicsWorld::WorldSettings settings;
+            settings.isSleepingEnabled = false;
+            return settings;
+        }
+
+        /// Create a static ground box
+        void createGround(PhysicsWorld* world) {
+
+            RigidBody* ground = world->createRigidBody(Transform(Vector3(0, -1, 0), Quaternion::identity()));
+            ground->setType(BodyType::STATIC);
+            ground->addCollider(mPhysicsCommon.createBoxShape(Vector3(50, 1, 50)), Transform::identity());
+        }
+
+        /// Create a static ground triangle mesh and return its vertex array
+        TriangleVertexArray* createGroundMesh(PhysicsWorld* world) {
+
+            const int nbVertices = MESH_RESOLUTION + 1;
+            const float cellSize = 100.0f / MESH_RESOLUTION;
+            mMeshVertices.clear();
+            mMeshIndices.clear();
+            for (int i=0; i < nbVertices; i++) {
+                for (int j=0; j < nbVertices; j++) {
+                    mMeshVertices.push_back(-50.0f + i * cellSize);
+                    mMeshVertices.push_back(0.0f);
+                    mMeshVertices.push_back(-50.0f + j * cellSize);
+                }
+            }
+            for (int i=0; i < MESH_RESOLUTION; i++) {
+                for (int j=0; j < MESH_RESOLUTION; j++) {
+                    const int v = i * nbVertices + j;
+                    mMeshIndices.insert(mMeshIndices.end(), {v, v + 1, v + nbVertices, v + 1, v + nbVertices + 1, v + nbVertices});
+                }
+            }
+
+            TriangleVertexArray* vertexArray = new TriangleVertexArray(static_cast<uint32>(mMeshVertices.size() / 3), mMeshVertices.data(),
+                                                                       3 * sizeof(float), static_cast<uint32>(mMeshIndices.size() / 3),
+                                                                       mMeshIndices.data(), 3 * sizeof(int),
+                                                                       TriangleVertexArray::VertexDataType::VERTEX_FLOAT_TYPE,
+                                                                       TriangleVertexArray::IndexDataType::INDEX_INTEGER_TYPE);
+            TriangleMesh* triangleMesh = mPhysicsCommon.createTriangleMesh();
+            triangleMesh->addSubpart(vertexArray);
+
+            RigidBody* ground = world->createRigidBody(Transform::identity());
+            ground->setType(BodyType::STATIC);
+            ground->addCollider(mPhysicsCommon.createConcaveMeshShape(triangleMesh), Transform::identity());
+
+            return vertexArray;
+        }
+
+        /// Measure the contact creation of a scene with world updates and with testCollision() calls
+        void measure(const std::string& sceneName, PhysicsWorld* world) {
+
+            ContactPointsCounter updateCounter;
+            world->setEventListener(&updateCounter);
+
+            // Let the bodies come to rest
+            for (int i=0; i < NB_WARMUP_STEPS; i++) {
+                world->update(TIME_STEP);
+            }
+            updateCounter.nbContactPoints = 0;
+
+            double startTime = getTime();
+            for (int i=0; i < NB_UPDATE_STEPS; i++) {
+                world->update(TIME_STEP);
+            }
+            report(sceneName + " (update)", NB_UPDATE_STEPS, getTime() - startTime, updateCounter.nbContactPoints);
+
+            world->setEventListener(nullptr);
+
+            ContactPointsCounter testCollisionCounter;
+            startTime = getTime();
+            for (int i=0; i < NB_TEST_COLLISION_CALLS; i++) {
+                world->testCollision(testCollisionCounter);
+            }
+            report(sceneName + " (testCollision)", NB_TEST_COLLISION_CALLS, getTime() - startTime, testCollisionCounter.nbContactPoints);
+        }
+
+        /// Scene with stacks of boxes resting on a static box
+        void runBoxStacks() {
+
+            PhysicsWorld* world = mPhysicsCommon.createPhysicsWorld(getWorldSettings());
+            createGround(world);
+
+            BoxShape* boxShape = mPhysicsCommon.createBoxShape(Vector3(0.5, 0.5, 0.5));
+            for (int i=0; i < 10; i++) {
+                for (int j=0; j < 10; j++) {
+                    for (int k=0; k < 10; k++) {
+                        RigidBody* body = world->createRigidBody(Transform(Vector3(-20 + i * 4, decimal(0.5) + k, -20 + j * 4), Quaternion::identity()));
+                        body->addCollider(boxShape, Transform::identity());
+                    }
+                }
+            }
+
+            measure("Box stacks", world);
+
+            mPhysicsCommon.destroyPhysicsWorld(world);
+        }
+
+        /// Scene with spheres and boxes resting on a static triangle mesh
+        void runBodiesOnMesh() {
+
+            PhysicsWorld* world = mPhysicsCommon.createPhysicsWorld(getWorldSettings());
+            TriangleVertexArray* vertexArray = createGroundMesh(world);
+
+            SphereShape* sphereShape = mPhysicsCommon.createSphereShape(decimal(0.5));
+            BoxShape* boxShape = mPhysicsCommon.createBoxShape(Vector3(0.5, 0.5, 0.5));
+            for (int i=0; i < 30; i++) {
+                for (int j=0; j < 30; j++) {
+                    RigidBody* body = world->createRigidBody(Transform(Vector3(-45 + i * 3, decimal(0.5), -45 + j * 3), Quaternion::identity()));
+                    if ((i + j) % 2 == 0) {
+                        body->addCollider(sphereShape, Transform::identity());
+                    }
+                    else {
+                        body->addCollider(boxShape, Transform::identity());
+                    }
+                }
+            }
+
+            measure("Bodies on mesh", world);
+
+            mPhysicsCommon.destroyPhysicsWorld(world);
+            delete vertexArray;
+        }
+
+    public :
+
+        // ---------- Methods ---------- //
+
+        /// Constructor
+        ContactCreationBenchmark(const std::string& name) : Benchmark(name) {
+
+        }
+
+        /// Run the benchmark
+        virtual void run() override {
+            runBoxStacks();
+            runBodiesOnMesh();
+        }
+};
+
+}
+
+#endif
@@ -138,6 +138,12 @@ class RigidBody : public CollisionBody {
         /// Set the variable to know if the gravity is applied to this rigid body
         void enableGravity(bool isEnabled);
 
+        /// Return true if continuous collision detection is enabled for this rigid body
+        bool isContinuousCollisionDetectionEnabled() const;
+
+        /// Set the variable to know if continuous collision detection is enabled for this rigid body
+        void enableContinuousCollisionDetection(bool isEnabled);
+
         /// Set the variable to know whether or not the body is sleeping
         void setIsSleeping(bool isSleeping);
 
@@ -131,16 +131,22 @@ class Collider {
         bool raycast(const Ray& ray, RaycastInfo& raycastInfo);
 
         /// Return the collision bits mask
-        unsigned short getCollideWithMaskBits() const;
+        uint64 getCollideWithMaskBits() const;
 
         /// Set the collision bits mask
-        void setCollideWithMaskBits(unsigned short collideWithMaskBits);
+        void setCollideWithMaskBits(uint64 collideWithMaskBits);
 
         /// Return the collision category bits
-        unsigned short getCollisionCategoryBits() const;
+        uint64 getCollisionCategoryBits() const;
 
         /// Set the collision category bits
-        void setCollisionCategoryBits(unsigned short collisionCategoryBits);
+        void setCollisionCategoryBits(uint64 collisionCategoryBits);
+
+        /// Return the collision group
+        int32 getCollisionGroup() const;
+
+        /// Set the collision group
+        void setCollisionGroup(int32 collisionGroup);
 
         /// Return the broad-phase id
         int getBroadPhaseId() const;
@@ -46,9 +46,10 @@ struct ContactManifoldInfo {
         // -------------------- Attributes -------------------- //
 
         /// Number of potential contact points
-        uint8 nbPotentialContactPoints;
+        uint16 nbPotentialContactPoints;
 
-        /// Indices of the contact points in the mPotentialContactPoints array
+        /// Indices of the contact points in the mPotentialContactPoints array (only the first
+        /// nbPotentialContactPoints indices are initialized)
         uint32 potentialContactPointsIndices[NB_MAX_CONTACT_POINTS_IN_POTENTIAL_MANIFOLD];
 
 
@@ -58,7 +59,7 @@ struct ContactManifoldInfo {
         // -------------------- Methods -------------------- //
 
         /// Constructor
-        ContactManifoldInfo(uint64 pairId) : nbPotentialContactPoints(0), potentialContactPointsIndices{0}, pairId(pairId) {
+        ContactManifoldInfo(uint64 pairId) : nbPotentialContactPoints(0), pairId(pairId) {
 
         }
 
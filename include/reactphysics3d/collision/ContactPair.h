@@ -42,6 +42,11 @@ struct ContactPair {
 
     public:
 
+        // -------------------- Constants -------------------- //
+
+        /// Invalid index of a contact pair
+        static constexpr uint32 INVALID_INDEX = -1;
+
         // -------------------- Attributes -------------------- //
 
         /// Overlapping pair Id
@@ -71,6 +76,10 @@ struct ContactPair {
         /// Index of the contact pair in the array of pairs
         uint32 contactPairIndex;
 
+        /// Index of the contact pair of the same overlapping pair in the array of pairs of the previous
+        /// frame (INVALID_INDEX if the colliders were not colliding in the previous frame)
+        uint32 previousContactPairIndex;
+
         /// Index of the first contact manifold in the array
         uint32 contactManifoldsIndex;
 
@@ -94,9 +103,9 @@ struct ContactPair {
         /// Constructor
         ContactPair(uint64 pairId, Entity body1Entity, Entity body2Entity, Entity collider1Entity,
                     Entity collider2Entity, uint32 contactPairIndex, bool collidingInPreviousFrame, bool isTrigger)
-            : pairId(pairId), nbPotentialContactManifolds(0), potentialContactManifoldsIndices{0}, body1Entity(body1Entity), body2Entity(body2Entity),
+            : pairId(pairId), nbPotentialContactManifolds(0), body1Entity(body1Entity), body2Entity(body2Entity),
               collider1Entity(collider1Entity), collider2Entity(collider2Entity),
-              isAlreadyInIsland(false), contactPairIndex(contactPairIndex), contactManifoldsIndex(0), nbContactManifolds(0),
+              isAlreadyInIsland(false), contactPairIndex(contactPairIndex), previousContactPairIndex(INVALID_INDEX), contactManifoldsIndex(0), nbContactManifolds(0),
               contactPointsIndex(0), nbToTalContactPoints(0), collidingInPreviousFrame(collidingInPreviousFrame), isTrigger(isTrigger) {
 
         }
@@ -0,0 +1,231 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2022 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef REACTPHYSICS3D_CONVEX_HULL_BUILDER_H
+#define REACTPHYSICS3D_CONVEX_HULL_BUILDER_H
+
+// Libraries
+#include <reactphysics3d/mathematics/mathematics.h>
+#include <reactphysics3d/containers/Array.h>
+#include <reactphysics3d/containers/Map.h>
+
+namespace reactphysics3d {
+
+// Class ConvexHullBuilder
+/**
+ * This class computes the convex hull of a cloud of points using the Quickhull
+ * algorithm. The points closer than a small distance relative to the size of the
+ * cloud are first welded together. The farthest point outside of the current hull is always added
+ * first, so the construction can be stopped when the hull reaches a given number
+ * of vertices and still gives a good approximation of the full hull. At the end,
+ * the adjacent triangles that are coplanar are merged into polygon faces and the
+ * vertices that are not needed anymore are removed. The result is a list of
+ * vertices and polygon faces (counter-clockwise when seen from the outside) that
+ * can be used to create a PolyhedronMesh.
+ */
+class ConvexHullBuilder {
+
+    private:
+
+        // -------------------- Structures -------------------- //
+
+        /// Triangle face of the hull during the construction
+        struct HullFace {
+
+            /// Indices of the three vertices (in the array of input points)
+            uint32 vertices[3];
+
+            /// Unit normal pointing outside of the hull
+            Vector3 normal;
+
+            /// Distance of the plane of the face from the origin
+            decimal offset;
+
+            /// True if the face is part of the current hull
+            bool isValid;
+
+            /// True if the area of the face is too small for its normal to be meaningful
+            bool isDegenerate;
+
+            /// Constructor
+            HullFace(uint32 v1, uint32 v2, uint32 v3, const Vector3& faceNormal, decimal faceOffset, bool isFaceDegenerate)
+                : vertices{v1, v2, v3}, normal(faceNormal), offset(faceOffset), isValid(true), isDegenerate(isFaceDegenerate) {
+
+            }
+
+            /// Return the signed distance of a point to the plane of the face
+            decimal getDistance(const Vector3& point) const {
+                return normal.dot(point) - offset;
+            }
+        };
+
+        // -------------------- Constants -------------------- //
+
+        /// Distance (relative to the diagonal of the bounding box of the points) under which two points are welded
+        static const decimal WELD_RELATIVE_DISTANCE;
+
+        // -------------------- Attributes -------------------- //
+
+        /// Memory allocator
+        MemoryAllocator& mAllocator;
+
+        /// Input points after welding the points that are too close to each other
+        Array<Vector3> mWeldedPoints;
+
+        /// Pointer to the array of (welded) input points
+        const Vector3* mPoints;
+
+        /// Number of (welded) input points
+        uint32 mNbPoints;
+
+        /// Distance under which a point is considered to be on the plane of a face
+        decimal mTolerance;
+
+        /// Distance under which two input points are welded
+        decimal mWeldDistance;
+
+        /// Triangle faces of the hull (removed faces are marked as invalid)
+        Array<HullFace> mFaces;
+
+        /// For each input point, index of the face whose outside set contains the point (-1 if none)
+        Array<int32> mPointsFace;
+
+        /// For each input point, distance to the face whose outside set contains the point
+        Array<decimal> mPointsDistance;
+
+        /// For each input point, number of valid faces using this point as a vertex
+        Array<uint32> mPointsNbFaces;
+
+        /// Number of input points that are currently vertices of the hull
+        uint32 mNbHullVertices;
+
+        /// Map a directed edge (see computeEdgeKey()) to the face it belongs to
+        Map<uint64, uint32> mMapEdgeToFace;
+
+        /// Vertices of the resulting hull
+        Array<Vector3> mVertices;
+
+        /// Vertex indices of the polygon faces of the resulting hull (one face after the other)
+        Array<uint32> mFacesVertices;
+
+        /// Number of vertices of each polygon face of the resulting hull
+        Array<uint32> mFacesNbVertices;
+
+        // -------------------- Methods -------------------- //
+
+        /// Weld the input points that are closer than a distance relative to the size of the cloud
+        void weldPoints(const Vector3* points, uint32 nbPoints);
+
+        /// Compute the initial tetrahedron of the hull
+        bool computeInitialTetrahedron();
+
+        /// Add a new triangle face to the hull and return its index
+        uint32 addFace(uint32 v1, uint32 v2, uint32 v3);
+
+        /// Remove a triangle face from the hull
+        void removeFace(uint32 faceIndex);
+
+        /// Return the face on the other side of an edge of a face
+        uint32 getAdjacentFace(uint32 faceIndex, uint32 edgeIndex) const;
+
+        /// Assign a point to the outside set of the farthest face among some faces
+        void assignPointToFaces(uint32 pointIndex, const Array<uint32>& faces);
+
+        /// Add a point to the hull
+        void addPointToHull(uint32 pointIndex);
+
+        /// Merge the coplanar faces and compute the resulting vertices and polygon faces
+        void computeHullPolygons();
+
+        /// Return the key of a directed edge from vertex v1 to vertex v2
+        static uint64 computeEdgeKey(uint32 v1, uint32 v2);
+
+        /// Return the key of a cell of the welding grid
+        static uint64 computeCellKey(uint32 x, uint32 y, uint32 z);
+
+    public:
+
+        // -------------------- Methods -------------------- //
+
+        /// Constructor
+        ConvexHullBuilder(MemoryAllocator& allocator);
+
+        /// Destructor
+        ~ConvexHullBuilder() = default;
+
+        /// Compute the convex hull of a cloud of points
+        bool computeHull(const Vector3* points, uint32 nbPoints, uint32 maxNbVertices = 0);
+
+        /// Return the vertices of the hull
+        const Array<Vector3>& getVertices() const;
+
+        /// Return the vertex indices of the polygon faces of the hull
+        const Array<uint32>& getFacesVertices() const;
+
+        /// Return the number of vertices of each polygon face of the hull
+        const Array<uint32>& getFacesNbVertices() const;
+};
+
+// Return the key of a directed edge from vertex v1 to vertex v2
+RP3D_FORCE_INLINE uint64 ConvexHullBuilder::computeEdgeKey(uint32 v1, uint32 v2) {
+    return (static_cast<uint64>(v1) << 32) | static_cast<uint64>(v2);
+}
+
+// Return the key of a cell of the welding grid
+/// The cell coordinates are smaller than 2^21 because the size of the cells is a fraction of the
+/// size of the cloud of points
+RP3D_FORCE_INLINE uint64 ConvexHullBuilder::computeCellKey(uint32 x, uint32 y, uint32 z) {
+    return (static_cast<uint64>(x) << 42) | (static_cast<uint64>(y) << 21) | static_cast<uint64>(z);
+}
+
+// Return the vertices of the hull
+/**
+ * @return The array with the vertices of the hull
+ */
+RP3D_FORCE_INLINE const Array<Vector3>& ConvexHullBuilder::getVertices() const {
+    return mVertices;
+}
+
+// Return the vertex indices of the polygon faces of the hull
+/**
+ * @return The indices (in the array of vertices of the hull) of the vertices of all
+ *         the faces. The vertices of a face are stored counter-clockwise (when seen from
+ *         outside) and the faces are stored one after the other.
+ */
+RP3D_FORCE_INLINE const Array<uint32>& ConvexHullBuilder::getFacesVertices() const {
+    return mFacesVertices;
+}
+
+// Return the number of vertices of each polygon face of the hull
+/**
+ * @return The array with the number of vertices of each face of the hull
+ */
+RP3D_FORCE_INLINE const Array<uint32>& ConvexHullBuilder::getFacesNbVertices() const {
+    return mFacesNbVertices;
+}
+
+}
+
+#endif
@@ -64,11 +64,21 @@ class PolyhedronMesh {
         /// Centroid of the polyhedron
         Vector3 mCentroid;
 
+        /// Memory block with the polygon vertex array, vertices, indices and faces of the mesh
+        /// when the mesh owns its data (convex hull) or null otherwise
+        void* mOwnedData;
+
+        /// Size (in bytes) of the owned data memory block
+        size_t mOwnedDataSize;
+
         // -------------------- Methods -------------------- //
 
         /// Constructor
         PolyhedronMesh(PolygonVertexArray* polygonVertexArray, MemoryAllocator& allocator);
 
+        /// Initialize the mesh and return true if the mesh is valid
+        bool init();
+
         /// Create the half-edge structure of the mesh
         bool createHalfEdgeStructure();
 
@@ -84,6 +94,10 @@ class PolyhedronMesh {
         /// Static factory method to create a polyhedron mesh
         static PolyhedronMesh* create(PolygonVertexArray* polygonVertexArray, MemoryAllocator& polyhedronMeshAllocator, MemoryAllocator& dataAllocator);
 
+        /// Static factory method to create a polyhedron mesh from the convex hull of a cloud of points
+        static PolyhedronMesh* createConvexHull(const Vector3* points, uint32 nbPoints, uint32 maxNbVertices,
+                                                MemoryAllocator& polyhedronMeshAllocator, MemoryAllocator& dataAllocator);
+
     public:
 
         // -------------------- Methods -------------------- //
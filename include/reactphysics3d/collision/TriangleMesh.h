@@ -72,6 +72,7 @@ class TriangleMesh {
         // ---------- Friendship ---------- //
 
         friend class PhysicsCommon;
+        friend class ConcaveMeshData;
 };
 
 // Add a subpart of the mesh
@@ -71,8 +71,9 @@ class TriangleVertexArray {
         /// values in the array
         uint32 mVerticesStride;
 
-        /// Pointer to the first vertex normal value in the array
-        const uchar* mVerticesNormalsStart;
+        /// Pointer to the first vertex normal value in the array (null until the
+        /// normals are computed when they are not provided by the user)
+        mutable const uchar* mVerticesNormalsStart;
 
         /// Stride (number of bytes) between the beginning of two vertex normals
         /// values in the array
@@ -102,7 +103,7 @@ class TriangleVertexArray {
         // -------------------- Methods -------------------- //
 
         /// Compute the vertices normals when they are not provided by the user
-        void computeVerticesNormals();
+        void computeVerticesNormals() const;
 
     public:
 
@@ -162,6 +163,9 @@ class TriangleVertexArray {
         /// Return the pointer to the start of the indices array
         const void* getIndicesStart() const;
 
+        /// Return true if the vertices normals are provided by the user or have already been computed
+        bool areVerticesNormalsAvailable() const;
+
         /// Return the vertices coordinates of a triangle
         void getTriangleVertices(uint32 triangleIndex, Vector3* outTriangleVertices) const;
 
@@ -255,6 +259,12 @@ RP3D_FORCE_INLINE const void* TriangleVertexArray::getVerticesStart() const {
  * @return A pointer to the start of the normals data in the array
  */
 RP3D_FORCE_INLINE const void* TriangleVertexArray::getVerticesNormalsStart() const {
+
+    // Compute the vertices normals the first time they are needed
+    if (mVerticesNormalsStart == nullptr) {
+        computeVerticesNormals();
+    }
+
     return mVerticesNormalsStart;
 }
 
@@ -266,6 +276,15 @@ RP3D_FORCE_INLINE const void* TriangleVertexArray::getIndicesStart() const {
     return mIndicesStart;
 }
 
+// Return true if the vertices normals are provided by the user or have already been computed
+/// This method does not trigger the computation of the normals.
+/**
+ * @return True if the vertices normals are available without being computed
+ */
+RP3D_FORCE_INLINE bool TriangleVertexArray::areVerticesNormalsAvailable() const {
+    return mVerticesNormalsStart != nullptr;
+}
+
 }
 
 #endif
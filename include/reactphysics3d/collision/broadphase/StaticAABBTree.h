@@ -0,0 +1,294 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2022 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef REACTPHYSICS3D_STATIC_AABB_TREE_H
+#define REACTPHYSICS3D_STATIC_AABB_TREE_H
+
+// Libraries
+#include <reactphysics3d/configuration.h>
+#include <reactphysics3d/collision/shapes/AABB.h>
+#include <reactphysics3d/containers/Array.h>
+
+/// Namespace ReactPhysics3D
+namespace reactphysics3d {
+
+// Declarations
+class DynamicAABBTreeRaycastCallback;
+class MemoryAllocator;
+class Profiler;
+struct Ray;
+
+// Structure StaticTreeNode
+/**
+ * This structure represents a node of the static AABB tree. A node always has two
+ * children and stores the quantized AABBs of both children. A child is either another
+ * node of the tree or a leaf that directly refers to an object of the tree. The size of
+ * a node is 32 bytes so that two nodes fit into a single cache line.
+ */
+struct StaticTreeNode {
+
+    // -------------------- Constants -------------------- //
+
+    /// Bit set in a child value if the child is a leaf (the other bits are the object index)
+    const static uint32 LEAF_BIT;
+
+    // -------------------- Attributes -------------------- //
+
+    /// Quantized minimum coordinates of the AABBs of the two children
+    uint16 childrenMin[2][3];
+
+    /// Quantized maximum coordinates of the AABBs of the two children
+    uint16 childrenMax[2][3];
+
+    /// Index of the child node or index of the object (with the LEAF_BIT) for each child
+    uint32 children[2];
+};
+
+// Class StaticAABBTree
+/**
+ * This class implements an immutable AABB tree for a set of static objects (the triangles
+ * of a concave mesh for instance). All the objects are first added to the tree and then the tree
+ * is built once using the Surface Area Heuristic (SAH) with binning. The nodes are stored in
+ * depth-first order in a single array (the first child node of a node is always the next node
+ * in the array) and the AABBs of the children are quantized on 16 bits relative to the
+ * AABB of the whole tree. The quantized AABBs are always conservative (they contain the
+ * actual AABBs of the objects). A tree can also be initialized with the nodes of a tree
+ * that has been built before (cooked data for instance). In this case, the nodes are not
+ * copied and must remain valid during the lifetime of the tree.
+ */
+class StaticAABBTree {
+
+    private:
+
+        // -------------------- Constants -------------------- //
+
+        /// Maximum value of a quantized coordinate
+        const static decimal QUANTIZATION_MAX;
+
+        /// Number of bins used to evaluate the Surface Area Heuristic
+        const static uint32 NB_SAH_BINS = 16;
+
+        // -------------------- Structures -------------------- //
+
+        /// A range of objects for which a node has to be created during the build of the tree
+        struct BuildTask {
+
+            /// Index of the first object of the range
+            uint32 start;
+
+            /// Index after the last object of the range
+            uint32 end;
+
+            /// Index of the parent node
+            uint32 parentNode;
+
+            /// Index of the child in the parent node
+            uint32 parentChild;
+        };
+
+        // -------------------- Attributes -------------------- //
+
+        /// Memory allocator
+        MemoryAllocator& mAllocator;
+
+        /// Array with the nodes of the tree (in depth-first order) when the tree is built
+        Array<StaticTreeNode> mNodes;
+
+        /// Two pieces of data for each object of the tree when the tree is built
+        Array<int32> mObjectsData;
+
+        /// Pointer to the first node of the tree (in mNodes or in external memory)
+        const StaticTreeNode* mNodesData;
+
+        /// Pointer to the data of the first object of the tree (in mObjectsData or in external memory)
+        const int32* mObjectsDataPointer;
+
+        /// AABBs of the objects (only used to build the tree)
+        Array<AABB> mObjectsAABBs;
+
+        /// Number of objects in the tree
+        uint32 mNbObjects;
+
+        /// AABB of the whole tree (not quantized)
+        AABB mRootAABB;
+
+        /// Scale factor to convert a coordinate relative to the minimum of the root AABB into a quantized coordinate
+        Vector3 mQuantizationScale;
+
+        /// Scale factor to convert a quantized coordinate into a coordinate relative to the minimum of the root AABB
+        Vector3 mQuantizationScaleInverse;
+
+#ifdef IS_RP3D_PROFILING_ENABLED
+
+        /// Pointer to the profiler
+        Profiler* mProfiler;
+
+#endif
+
+        // -------------------- Methods -------------------- //
+
+        /// Compute the quantization scale factors from the AABB of the whole tree
+        void computeQuantizationScales();
+
+        /// Quantize an AABB (the result contains the AABB)
+        void quantize(const AABB& aabb, uint16* outMin, uint16* outMax) const;
+
+        /// Return the dequantized AABB of a child of a node
+        AABB dequantize(const StaticTreeNode& node, uint32 childIndex) const;
+
+        /// Set the quantized AABB and the value of a child of a node
+        void setChild(uint32 nodeIndex, uint32 childIndex, uint32 child, const AABB& aabb);
+
+        /// Split a range of objects in two using the Surface Area Heuristic
+        uint32 splitObjects(Array<uint32>& objectsIndices, const Array<Vector3>& centers, uint32 start, uint32 end,
+                            AABB& outLeftAABB, AABB& outRightAABB) const;
+
+        /// Return half the surface area of an AABB
+        static decimal computeHalfSurfaceArea(const AABB& aabb);
+
+        /// Return true if a quantized AABB overlaps with the quantized AABB of a child of a node
+        static bool testOverlap(const uint16* min, const uint16* max, const StaticTreeNode& node, uint32 childIndex);
+
+    public:
+
+        // -------------------- Methods -------------------- //
+
+        /// Constructor
+        StaticAABBTree(MemoryAllocator& allocator);
+
+        /// Destructor
+        ~StaticAABBTree() = default;
+
+        /// Deleted copy-constructor
+        StaticAABBTree(const StaticAABBTree& tree) = delete;
+
+        /// Deleted assignment operator
+        StaticAABBTree& operator=(const StaticAABBTree& tree) = delete;
+
+        /// Add an object to be inserted into the tree when it is built
+        void addObject(const AABB& aabb, int32 data1, int32 data2);
+
+        /// Build the tree with all the objects that have been added
+        void build();
+
+        /// Initialize the tree with the nodes and objects data of a tree built before
+        void initFromData(const StaticTreeNode* nodes, const int32* objectsData, uint32 nbObjects, const AABB& rootAABB);
+
+        /// Return the number of nodes of the tree
+        uint32 getNbNodes() const;
+
+        /// Return a pointer to the first node of the tree
+        const StaticTreeNode* getNodes() const;
+
+        /// Return a pointer to the data of the first object of the tree
+        const int32* getObjectsData() const;
+
+        /// Return the number of objects of the tree
+        uint32 getNbObjects() const;
+
+        /// Return the two pieces of data of an object
+        const int32* getObjectDataInt(int32 objectIndex) const;
+
+        /// Return the AABB of the whole tree
+        const AABB& getRootAABB() const;
+
+        /// Return the number of bytes of memory allocated by the tree
+        size_t getSizeInBytes() const;
+
+        /// Return the indices of all the objects in the depth-first order of the leaves of the tree
+        void getObjectsInDepthFirstOrder(Array<uint32>& outObjects) const;
+
+        /// Report all the objects whose quantized AABB overlaps with the AABB in parameter
+        void reportAllShapesOverlappingWithAABB(const AABB& aabb, Array<int32>& overlappingObjects) const;
+
+        /// Ray casting method
+        void raycast(const Ray& ray, DynamicAABBTreeRaycastCallback& callback) const;
+
+#ifdef IS_RP3D_PROFILING_ENABLED
+
+        /// Set the profiler
+        void setProfiler(Profiler* profiler);
+
+#endif
+
+};
+
+// Return the number of objects of the tree
+RP3D_FORCE_INLINE uint32 StaticAABBTree::getNbObjects() const {
+    return mNbObjects;
+}
+
+// Return the number of nodes of the tree (a tree with a single object does not have any node)
+RP3D_FORCE_INLINE uint32 StaticAABBTree::getNbNodes() const {
+    return mNbObjects > 1 ? mNbObjects - 1 : 0;
+}
+
+// Return a pointer to the first node of the tree
+RP3D_FORCE_INLINE const StaticTreeNode* StaticAABBTree::getNodes() const {
+    return mNodesData;
+}
+
+// Return a pointer to the data of the first object of the tree
+RP3D_FORCE_INLINE const int32* StaticAABBTree::getObjectsData() const {
+    return mObjectsDataPointer;
+}
+
+// Return the number of bytes of memory allocated by the tree
+/// The nodes and objects data of a tree initialized from external data are not allocated by the tree
+RP3D_FORCE_INLINE size_t StaticAABBTree::getSizeInBytes() const {
+    return sizeof(StaticAABBTree) + mNodes.capacity() * sizeof(StaticTreeNode) + mObjectsData.capacity() * sizeof(int32) +
+           mObjectsAABBs.capacity() * sizeof(AABB);
+}
+
+// Return the two pieces of data of an object
+RP3D_FORCE_INLINE const int32* StaticAABBTree::getObjectDataInt(int32 objectIndex) const {
+    assert(objectIndex >= 0 && static_cast<uint32>(objectIndex) < mNbObjects);
+    return mObjectsDataPointer + objectIndex * 2;
+}
+
+// Return the AABB of the whole tree
+RP3D_FORCE_INLINE const AABB& StaticAABBTree::getRootAABB() const {
+    return mRootAABB;
+}
+
+// Return true if a quantized AABB overlaps with the quantized AABB of a child of a node
+RP3D_FORCE_INLINE bool StaticAABBTree::testOverlap(const uint16* min, const uint16* max, const StaticTreeNode& node, uint32 childIndex) {
+    return min[0] <= node.childrenMax[childIndex][0] && max[0] >= node.childrenMin[childIndex][0] &&
+           min[1] <= node.childrenMax[childIndex][1] && max[1] >= node.childrenMin[childIndex][1] &&
+           min[2] <= node.childrenMax[childIndex][2] && max[2] >= node.childrenMin[childIndex][2];
+}
+
+#ifdef IS_RP3D_PROFILING_ENABLED
+
+// Set the profiler
+RP3D_FORCE_INLINE void StaticAABBTree::setProfiler(Profiler* profiler) {
+    mProfiler = profiler;
+}
+
+#endif
+
+}
+
+#endif
@@ -0,0 +1,124 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2022 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef REACTPHYSICS3D_BOX_VS_BOX_ALGORITHM_H
+#define	REACTPHYSICS3D_BOX_VS_BOX_ALGORITHM_H
+
+// Libraries
+#include <reactphysics3d/collision/narrowphase/NarrowPhaseAlgorithm.h>
+#include <reactphysics3d/mathematics/Matrix3x3.h>
+#include <reactphysics3d/mathematics/Transform.h>
+
+/// Namespace ReactPhysics3D
+namespace reactphysics3d {
+
+// Declarations
+class BoxShape;
+struct NarrowPhaseInfoBatch;
+struct LastFrameCollisionInfo;
+
+// Class BoxVsBoxAlgorithm
+/**
+ * This class is used to compute the narrow-phase collision detection
+ * between two boxes. Instead of iterating over the half-edge structures as
+ * in the generic convex polyhedron vs convex polyhedron algorithm, we test the
+ * 15 possible separating axes of two boxes (3 face normals of each box and the
+ * 9 cross products of their edges) in closed form in the local-space of the first
+ * box. The contact points are then computed by clipping the incident face against
+ * the side planes of the reference face, which are axis-aligned in the local-space
+ * of the reference box.
+ */
+class BoxVsBoxAlgorithm : public NarrowPhaseAlgorithm {
+
+    protected :
+
+        // -------------------- Constants -------------------- //
+
+        /// Number of candidate separating axes between two boxes
+        static const uint32 NB_SEPARATING_AXES = 15;
+
+        /// Maximum number of vertices of the incident face after clipping
+        static const uint32 NB_MAX_CLIPPED_VERTICES = 8;
+
+        /// Relative and absolute bias used to prefer the face normals of the first box over
+        /// those of the second box and the face normals over the edges cross products when
+        /// the penetration depths are almost the same (see SATAlgorithm)
+        static const decimal SEPARATING_AXIS_RELATIVE_TOLERANCE;
+        static const decimal SEPARATING_AXIS_ABSOLUTE_TOLERANCE;
+
+        /// Minimum square length of the cross product of two edges for it to be used as a separating axis
+        static const decimal PARALLEL_EDGES_EPSILON;
+
+        // -------------------- Methods -------------------- //
+
+        /// Compute the penetration depth of the two boxes along a given candidate separating axis
+        decimal computeAxisPenetrationDepth(uint32 axisIndex, const Vector3& halfExtents1, const Vector3& halfExtents2,
+                                            const Matrix3x3& box2ToBox1Orientation, const Matrix3x3& absBox2ToBox1Orientation,
+                                            const Vector3& box2CenterBox1Space, Vector3& outAxisBox1Space) const;
+
+        /// Compute the contact points between a reference face and an incident face of the two boxes
+        bool computeFaceContactPoints(uint32 axisIndex, const BoxShape* box1, const BoxShape* box2,
+                                      const Transform& box2ToBox1, NarrowPhaseInfoBatch& narrowPhaseInfoBatch,
+                                      uint32 batchIndex) const;
+
+        /// Compute the contact point between two edges of the two boxes
+        void computeEdgeContactPoint(const BoxShape* box1, const BoxShape* box2, uint32 edge1Index, uint32 edge2Index,
+                                     const Vector3& axisBox1Space, decimal penetrationDepth, const Transform& box2ToBox1,
+                                     NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint32 batchIndex) const;
+
+        /// Clip a polygon against the plane "sign * x[axis] = offset" and keep the part below it
+        uint32 clipPolygonWithAxisAlignedPlane(const Vector3* inputVertices, uint32 nbInputVertices, Vector3* outputVertices,
+                                               int axis, decimal sign, decimal offset) const;
+
+        /// Save the minimum separating axis into the last frame collision info
+        void saveSeparatingAxis(LastFrameCollisionInfo* lastFrameCollisionInfo, uint32 axisIndex) const;
+
+        /// Return the separating axis saved in the last frame collision info
+        uint32 getPreviousSeparatingAxis(const LastFrameCollisionInfo* lastFrameCollisionInfo) const;
+
+    public :
+
+        // -------------------- Methods -------------------- //
+
+        /// Constructor
+        BoxVsBoxAlgorithm() = default;
+
+        /// Destructor
+        virtual ~BoxVsBoxAlgorithm() override = default;
+
+        /// Deleted copy-constructor
+        BoxVsBoxAlgorithm(const BoxVsBoxAlgorithm& algorithm) = delete;
+
+        /// Deleted assignment operator
+        BoxVsBoxAlgorithm& operator=(const BoxVsBoxAlgorithm& algorithm) = delete;
+
+        /// Compute the narrow-phase collision detection between two boxes
+        bool testCollision(NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint32 batchStartIndex, uint32 batchNbItems,
+                           bool clipWithPreviousAxisIfStillColliding, MemoryAllocator& memoryAllocator);
+};
+
+}
+
+#endif
@@ -0,0 +1,123 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2022 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef REACTPHYSICS3D_BOX_VS_TRIANGLE_ALGORITHM_H
+#define	REACTPHYSICS3D_BOX_VS_TRIANGLE_ALGORITHM_H
+
+// Libraries
+#include <reactphysics3d/collision/narrowphase/NarrowPhaseAlgorithm.h>
+#include <reactphysics3d/mathematics/Transform.h>
+
+/// Namespace ReactPhysics3D
+namespace reactphysics3d {
+
+// Declarations
+struct TriangleNarrowPhaseInfoBatch;
+
+// Class BoxVsTriangleAlgorithm
+/**
+ * This class is used to compute the narrow-phase collision detection
+ * between a box and the triangles of a concave shape (triangle mesh or
+ * height field). The triangles are read directly from the vertices arrays
+ * of the batch. As in the BoxVsBoxAlgorithm class, we test the 13 possible
+ * separating axes (the triangle face normal, the 3 face normals of the box and
+ * the 9 cross products of their edges) in the local-space of the box. The contact
+ * points are then computed by clipping the incident face against the side planes
+ * of the reference face (triangle face or box face) and the smooth mesh normal
+ * is used for the contacts on the internal edges of the mesh.
+ */
+class BoxVsTriangleAlgorithm : public NarrowPhaseAlgorithm {
+
+    protected :
+
+        // -------------------- Constants -------------------- //
+
+        /// Number of candidate separating axes between a box and a triangle
+        static const uint32 NB_SEPARATING_AXES = 13;
+
+        /// Maximum number of vertices of the incident face after clipping
+        static const uint32 NB_MAX_CLIPPED_VERTICES = 8;
+
+        /// Relative and absolute bias used to prefer the triangle face normal over the face
+        /// normals of the box and the face normals over the edges cross products when the
+        /// penetration depths are almost the same (see SATAlgorithm)
+        static const decimal SEPARATING_AXIS_RELATIVE_TOLERANCE;
+        static const decimal SEPARATING_AXIS_ABSOLUTE_TOLERANCE;
+
+        /// Minimum square length of the cross product of two edges for it to be used as a separating axis
+        static const decimal PARALLEL_EDGES_EPSILON;
+
+        // -------------------- Methods -------------------- //
+
+        /// Compute the penetration depth of the box and the triangle along a given candidate separating axis
+        static decimal computeAxisPenetrationDepth(const Vector3& axis, const Vector3& halfExtents, const Vector3* triangleVertices,
+                                                   Vector3& outAxisBoxToTriangle);
+
+        /// Compute the contact points between the triangle face and the incident face of the box
+        bool computeTriangleFaceContactPoints(const Vector3& halfExtents, const Vector3* triangleVertices, const Vector3& triangleNormal,
+                                              const Vector3& axisBoxToTriangle, bool isBoxShape1, const Transform& boxToWorldTransform,
+                                              const Transform& boxToTriangleTransform, TriangleNarrowPhaseInfoBatch& narrowPhaseInfoBatch,
+                                              uint32 batchIndex) const;
+
+        /// Compute the contact points between a face of the box and the triangle
+        bool computeBoxFaceContactPoints(int faceAxis, const Vector3& halfExtents, const Vector3* triangleVertices,
+                                         const Vector3& triangleNormal, const Vector3& axisBoxToTriangle, bool isBoxShape1,
+                                         const Transform& boxToWorldTransform, const Transform& boxToTriangleTransform,
+                                         TriangleNarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint32 batchIndex) const;
+
+        /// Add a contact point between the box and a triangle using the smooth mesh normal
+        void addSmoothContactPoint(const Vector3& normalBoxToTriangle, decimal penetrationDepth, const Vector3& contactPointBox,
+                                   const Vector3& contactPointTriangle, const Vector3* triangleVertices, const Vector3& triangleNormal,
+                                   bool isBoxShape1, const Transform& boxToWorldTransform, const Transform& boxToTriangleTransform,
+                                   TriangleNarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint32 batchIndex) const;
+
+        /// Clip a polygon against a plane and keep the part below it
+        static uint32 clipPolygonWithPlane(const Vector3* inputVertices, uint32 nbInputVertices, Vector3* outputVertices,
+                                           const Vector3& planePoint, const Vector3& planeNormal);
+
+    public :
+
+        // -------------------- Methods -------------------- //
+
+        /// Constructor
+        BoxVsTriangleAlgorithm() = default;
+
+        /// Destructor
+        virtual ~BoxVsTriangleAlgorithm() override = default;
+
+        /// Deleted copy-constructor
+        BoxVsTriangleAlgorithm(const BoxVsTriangleAlgorithm& algorithm) = delete;
+
+        /// Deleted assignment operator
+        BoxVsTriangleAlgorithm& operator=(const BoxVsTriangleAlgorithm& algorithm) = delete;
+
+        /// Compute the narrow-phase collision detection between a box and triangles
+        bool testCollision(TriangleNarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint32 batchStartIndex,
+                           uint32 batchNbItems, MemoryAllocator& memoryAllocator);
+};
+
+}
+
+#endif
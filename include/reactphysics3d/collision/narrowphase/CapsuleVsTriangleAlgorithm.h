@@ -0,0 +1,94 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2022 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef REACTPHYSICS3D_CAPSULE_VS_TRIANGLE_ALGORITHM_H
+#define	REACTPHYSICS3D_CAPSULE_VS_TRIANGLE_ALGORITHM_H
+
+// Libraries
+#include <reactphysics3d/collision/narrowphase/NarrowPhaseAlgorithm.h>
+#include <reactphysics3d/mathematics/Vector3.h>
+
+/// Namespace ReactPhysics3D
+namespace reactphysics3d {
+
+// Declarations
+struct TriangleNarrowPhaseInfoBatch;
+
+// Class CapsuleVsTriangleAlgorithm
+/**
+ * This class is used to compute the narrow-phase collision detection
+ * between a capsule and the triangles of a concave shape (triangle mesh or
+ * height field). The triangles are read directly from the vertices arrays
+ * of the batch. We compute the closest points between the inner segment of
+ * the capsule and the triangle. When the segment is above the triangle face,
+ * the segment is clipped against the side planes of the triangle to get up
+ * to two contact points along the face normal. Otherwise, a single contact
+ * point is created at the closest points and the smooth mesh normal is used.
+ */
+class CapsuleVsTriangleAlgorithm : public NarrowPhaseAlgorithm {
+
+    protected :
+
+        // -------------------- Constants -------------------- //
+
+        /// Tolerance on the penetration depth used to prefer the face contacts over the
+        /// contact at the closest points between the capsule segment and the triangle
+        static const decimal FACE_CONTACT_TOLERANCE;
+
+        // -------------------- Methods -------------------- //
+
+        /// Compute the closest points between a segment and a triangle and return their square distance
+        static decimal computeClosestPointsSegmentTriangle(const Vector3& segmentPointA, const Vector3& segmentPointB,
+                                                           const Vector3* triangleVertices, const Vector3& triangleNormal,
+                                                           Vector3& outClosestPointSegment, Vector3& outClosestPointTriangle);
+
+        /// Clip a segment against the side planes of a triangle
+        static bool clipSegmentWithTriangleSidePlanes(const Vector3* triangleVertices, const Vector3& triangleNormal,
+                                                      Vector3& segmentPointA, Vector3& segmentPointB);
+
+    public :
+
+        // -------------------- Methods -------------------- //
+
+        /// Constructor
+        CapsuleVsTriangleAlgorithm() = default;
+
+        /// Destructor
+        virtual ~CapsuleVsTriangleAlgorithm() override = default;
+
+        /// Deleted copy-constructor
+        CapsuleVsTriangleAlgorithm(const CapsuleVsTriangleAlgorithm& algorithm) = delete;
+
+        /// Deleted assignment operator
+        CapsuleVsTriangleAlgorithm& operator=(const CapsuleVsTriangleAlgorithm& algorithm) = delete;
+
+        /// Compute the narrow-phase collision detection between a capsule and triangles
+        bool testCollision(TriangleNarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint32 batchStartIndex,
+                           uint32 batchNbItems, MemoryAllocator& memoryAllocator);
+};
+
+}
+
+#endif
@@ -33,6 +33,11 @@
 #include <reactphysics3d/collision/narrowphase/CapsuleVsCapsuleAlgorithm.h>
 #include <reactphysics3d/collision/narrowphase/CapsuleVsConvexPolyhedronAlgorithm.h>
 #include <reactphysics3d/collision/narrowphase/ConvexPolyhedronVsConvexPolyhedronAlgorithm.h>
+#include <reactphysics3d/collision/narrowphase/BoxVsBoxAlgorithm.h>
+#include <reactphysics3d/collision/narrowphase/SphereVsTriangleAlgorithm.h>
+#include <reactphysics3d/collision/narrowphase/CapsuleVsTriangleAlgorithm.h>
+#include <reactphysics3d/collision/narrowphase/BoxVsTriangleAlgorithm.h>
+#include <reactphysics3d/collision/narrowphase/GenericConvexAlgorithm.h>
 #include <reactphysics3d/collision/shapes/CollisionShape.h>
 
 namespace reactphysics3d {
@@ -46,7 +51,12 @@ enum class NarrowPhaseAlgorithmType {
     CapsuleVsCapsule,
     SphereVsConvexPolyhedron,
     CapsuleVsConvexPolyhedron,
-    ConvexPolyhedronVsConvexPolyhedron
+    ConvexPolyhedronVsConvexPolyhedron,
+    BoxVsBox,
+    SphereVsTriangle,
+    CapsuleVsTriangle,
+    BoxVsTriangle,
+    GenericConvex
 };
 
 // Class CollisionDispatch
@@ -80,6 +90,21 @@ class CollisionDispatch {
         /// True if the convex polyhedron vs convex polyhedron algorithm is the default one
         bool mIsConvexPolyhedronVsConvexPolyhedronDefault = true;
 
+        /// True if the box vs box algorithm is the default one
+        bool mIsBoxVsBoxDefault = true;
+
+        /// True if the sphere vs triangle algorithm is the default one
+        bool mIsSphereVsTriangleDefault = true;
+
+        /// True if the capsule vs triangle algorithm is the default one
+        bool mIsCapsuleVsTriangleDefault = true;
+
+        /// True if the box vs triangle algorithm is the default one
+        bool mIsBoxVsTriangleDefault = true;
+
+        /// True if the generic convex algorithm is the default one
+        bool mIsGenericConvexDefault = true;
+
         /// Sphere vs Sphere collision algorithm
         SphereVsSphereAlgorithm* mSphereVsSphereAlgorithm;
 
@@ -98,6 +123,21 @@ class CollisionDispatch {
         /// Convex Polyhedron vs Convex Polyhedron collision algorithm
         ConvexPolyhedronVsConvexPolyhedronAlgorithm* mConvexPolyhedronVsConvexPolyhedronAlgorithm;
 
+        /// Box vs Box collision algorithm
+        BoxVsBoxAlgorithm* mBoxVsBoxAlgorithm;
+
+        /// Sphere vs Triangle (of a concave shape) collision algorithm
+        SphereVsTriangleAlgorithm* mSphereVsTriangleAlgorithm;
+
+        /// Capsule vs Triangle (of a concave shape) collision algorithm
+        CapsuleVsTriangleAlgorithm* mCapsuleVsTriangleAlgorithm;
+
+        /// Box vs Triangle (of a concave shape) collision algorithm
+        BoxVsTriangleAlgorithm* mBoxVsTriangleAlgorithm;
+
+        /// Generic convex shape (cylinder, cone) vs convex shape collision algorithm
+        GenericConvexAlgorithm* mGenericConvexAlgorithm;
+
         /// Collision detection matrix (algorithms to use)
         NarrowPhaseAlgorithmType mCollisionMatrix[NB_COLLISION_SHAPE_TYPES][NB_COLLISION_SHAPE_TYPES];
 
@@ -156,6 +196,36 @@ class CollisionDispatch {
         /// Get the Convex Polyhedron vs Convex Polyhedron narrow-phase collision detection algorithm
         ConvexPolyhedronVsConvexPolyhedronAlgorithm* getConvexPolyhedronVsConvexPolyhedronAlgorithm();
 
+        /// Set the Box vs Box narrow-phase collision detection algorithm
+        void setBoxVsBoxAlgorithm(BoxVsBoxAlgorithm* algorithm);
+
+        /// Get the Box vs Box narrow-phase collision detection algorithm
+        BoxVsBoxAlgorithm* getBoxVsBoxAlgorithm();
+
+        /// Set the Sphere vs Triangle narrow-phase collision detection algorithm
+        void setSphereVsTriangleAlgorithm(SphereVsTriangleAlgorithm* algorithm);
+
+        /// Get the Sphere vs Triangle narrow-phase collision detection algorithm
+        SphereVsTriangleAlgorithm* getSphereVsTriangleAlgorithm();
+
+        /// Set the Capsule vs Triangle narrow-phase collision detection algorithm
+        void setCapsuleVsTriangleAlgorithm(CapsuleVsTriangleAlgorithm* algorithm);
+
+        /// Get the Capsule vs Triangle narrow-phase collision detection algorithm
+        CapsuleVsTriangleAlgorithm* getCapsuleVsTriangleAlgorithm();
+
+        /// Set the Box vs Triangle narrow-phase collision detection algorithm
+        void setBoxVsTriangleAlgorithm(BoxVsTriangleAlgorithm* algorithm);
+
+        /// Get the Box vs Triangle narrow-phase collision detection algorithm
+        BoxVsTriangleAlgorithm* getBoxVsTriangleAlgorithm();
+
+        /// Set the generic convex narrow-phase collision detection algorithm
+        void setGenericConvexAlgorithm(GenericConvexAlgorithm* algorithm);
+
+        /// Get the generic convex narrow-phase collision detection algorithm
+        GenericConvexAlgorithm* getGenericConvexAlgorithm();
+
         /// Fill-in the collision detection matrix
         void fillInCollisionMatrix();
 
@@ -163,6 +233,12 @@ class CollisionDispatch {
         NarrowPhaseAlgorithmType selectNarrowPhaseAlgorithm(const CollisionShapeType& shape1Type,
                                                             const CollisionShapeType& shape2Type) const;
 
+        /// Return the corresponding narrow-phase algorithm type to use for two given collision shapes
+        NarrowPhaseAlgorithmType selectNarrowPhaseAlgorithm(const CollisionShape* shape1, const CollisionShape* shape2) const;
+
+        /// Return the narrow-phase algorithm type to use between a convex shape and the triangles of a concave shape
+        NarrowPhaseAlgorithmType selectConvexVsConcaveNarrowPhaseAlgorithm(const CollisionShape* convexShape) const;
+
 #ifdef IS_RP3D_PROFILING_ENABLED
 
 		/// Set the profiler
@@ -202,6 +278,31 @@ RP3D_FORCE_INLINE ConvexPolyhedronVsConvexPolyhedronAlgorithm* CollisionDispatch
     return mConvexPolyhedronVsConvexPolyhedronAlgorithm;
 }
 
+// Get the Box vs Box narrow-phase collision detection algorithm
+RP3D_FORCE_INLINE BoxVsBoxAlgorithm* CollisionDispatch::getBoxVsBoxAlgorithm() {
+    return mBoxVsBoxAlgorithm;
+}
+
+// Get the Sphere vs Triangle narrow-phase collision detection algorithm
+RP3D_FORCE_INLINE SphereVsTriangleAlgorithm* CollisionDispatch::getSphereVsTriangleAlgorithm() {
+    return mSphereVsTriangleAlgorithm;
+}
+
+// Get the Capsule vs Triangle narrow-phase collision detection algorithm
+RP3D_FORCE_INLINE CapsuleVsTriangleAlgorithm* CollisionDispatch::getCapsuleVsTriangleAlgorithm() {
+    return mCapsuleVsTriangleAlgorithm;
+}
+
+// Get the Box vs Triangle narrow-phase collision detection algorithm
+RP3D_FORCE_INLINE BoxVsTriangleAlgorithm* CollisionDispatch::getBoxVsTriangleAlgorithm() {
+    return mBoxVsTriangleAlgorithm;
+}
+
+// Get the generic convex narrow-phase collision detection algorithm
+RP3D_FORCE_INLINE GenericConvexAlgorithm* CollisionDispatch::getGenericConvexAlgorithm() {
+    return mGenericConvexAlgorithm;
+}
+
 #ifdef IS_RP3D_PROFILING_ENABLED
 
 // Set the profiler
@@ -214,6 +315,11 @@ RP3D_FORCE_INLINE void CollisionDispatch::setProfiler(Profiler* profiler) {
     mSphereVsConvexPolyhedronAlgorithm->setProfiler(profiler);
     mCapsuleVsConvexPolyhedronAlgorithm->setProfiler(profiler);
     mConvexPolyhedronVsConvexPolyhedronAlgorithm->setProfiler(profiler);
+    mBoxVsBoxAlgorithm->setProfiler(profiler);
+    mSphereVsTriangleAlgorithm->setProfiler(profiler);
+    mCapsuleVsTriangleAlgorithm->setProfiler(profiler);
+    mBoxVsTriangleAlgorithm->setProfiler(profiler);
+    mGenericConvexAlgorithm->setProfiler(profiler);
 }
 
 #endif
@@ -34,6 +34,8 @@ namespace reactphysics3d {
 
 // Declarations
 class ContactPoint;
+class SATAlgorithm;
+class EPAAlgorithm;
 struct NarrowPhaseInfoBatch;
 
 // Class ConvexPolyhedronVsConvexPolyhedronAlgorithm
@@ -42,18 +44,43 @@ struct NarrowPhaseInfoBatch;
  * between two convex polyhedra. Here we do not use the GJK algorithm but
  * we run the SAT algorithm to get the contact points and normal.
  * This is based on the "Robust Contact Creation for Physics Simulation"
- * presentation by Dirk Gregorius.
+ * presentation by Dirk Gregorius. The cost of the SAT edge vs edge tests
+ * is quadratic in the number of edges. Therefore, when one of the polyhedra
+ * has many vertices, the EPA algorithm can be used instead to compute the
+ * penetration normal and depth.
  */
 class ConvexPolyhedronVsConvexPolyhedronAlgorithm : public NarrowPhaseAlgorithm {
 
     protected :
 
+        // -------------------- Constants -------------------- //
+
+        /// Minimum cosine between the EPA penetration normal and the normal of a face of
+        /// the polyhedra to clip the polyhedra with this face to get the contact points
+        static const decimal EPA_FACE_CONTACT_MIN_COSINE;
+
+        /// Bias used to prefer a face of the first polyhedron as reference face when the
+        /// faces of both polyhedra are almost aligned with the EPA penetration normal
+        static const decimal EPA_REFERENCE_FACE_COSINE_BIAS;
+
+        // -------------------- Attributes -------------------- //
+
+        /// Minimum number of vertices of the largest polyhedron of a pair to compute the
+        /// penetration depth with the EPA algorithm instead of the SAT algorithm (zero to always use SAT)
+        uint32 mMinNbVerticesForEPA;
+
+        // -------------------- Methods -------------------- //
+
+        /// Compute the narrow-phase collision detection between two convex polyhedra using the EPA algorithm
+        bool testCollisionEPA(const EPAAlgorithm& epaAlgorithm, const SATAlgorithm& satAlgorithm,
+                              NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint32 batchIndex, bool& outIsColliding) const;
+
     public :
 
         // -------------------- Methods -------------------- //
 
         /// Constructor
-        ConvexPolyhedronVsConvexPolyhedronAlgorithm() = default;
+        ConvexPolyhedronVsConvexPolyhedronAlgorithm();
 
         /// Destructor
         virtual ~ConvexPolyhedronVsConvexPolyhedronAlgorithm() override = default;
@@ -67,8 +94,29 @@ class ConvexPolyhedronVsConvexPolyhedronAlgorithm : public NarrowPhaseAlgorithm
         /// Compute the narrow-phase collision detection between two convex polyhedra
         bool testCollision(NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint32 batchStartIndex, uint32 batchNbItems,
                            bool clipWithPreviousAxisIfStillColliding, MemoryAllocator& memoryAllocator);
+
+        /// Return the minimum number of vertices of a polyhedron to use the EPA algorithm
+        uint32 getMinNbVerticesForEPA() const;
+
+        /// Set the minimum number of vertices of a polyhedron to use the EPA algorithm
+        void setMinNbVerticesForEPA(uint32 minNbVertices);
 };
 
+// Return the minimum number of vertices of a polyhedron to use the EPA algorithm
+RP3D_FORCE_INLINE uint32 ConvexPolyhedronVsConvexPolyhedronAlgorithm::getMinNbVerticesForEPA() const {
+    return mMinNbVerticesForEPA;
+}
+
+// Set the minimum number of vertices of a polyhedron to use the EPA algorithm
+/**
+ * @param minNbVertices When the largest polyhedron of a pair has at least this number of vertices, the
+ *                      penetration depth is computed with the EPA algorithm instead of the SAT algorithm.
+ *                      The value zero (default) means that the SAT algorithm is always used
+ */
+RP3D_FORCE_INLINE void ConvexPolyhedronVsConvexPolyhedronAlgorithm::setMinNbVerticesForEPA(uint32 minNbVertices) {
+    mMinNbVerticesForEPA = minNbVertices;
+}
+
 }
 
 #endif
@@ -0,0 +1,181 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2022 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef REACTPHYSICS3D_EPA_ALGORITHM_H
+#define REACTPHYSICS3D_EPA_ALGORITHM_H
+
+// Libraries
+#include <reactphysics3d/decimal.h>
+#include <reactphysics3d/configuration.h>
+#include <reactphysics3d/mathematics/Vector3.h>
+#include <reactphysics3d/mathematics/Transform.h>
+
+/// ReactPhysics3D namespace
+namespace reactphysics3d {
+
+// Declarations
+class ConvexShape;
+class Profiler;
+
+// Constants
+constexpr uint32 MAX_ITERATIONS_EPA_GJK = 64;
+constexpr uint32 MAX_ITERATIONS_EPA = 64;
+constexpr uint32 EPA_MAX_NB_VERTICES = MAX_ITERATIONS_EPA + 4;
+constexpr uint32 EPA_MAX_NB_FACES = 2 * EPA_MAX_NB_VERTICES;
+constexpr uint32 EPA_MAX_NB_HORIZON_EDGES = 3 * EPA_MAX_NB_FACES;
+constexpr decimal EPA_RELATIVE_TOLERANCE = decimal(1.0e-3);
+constexpr decimal EPA_ABSOLUTE_TOLERANCE = decimal(1.0e-4);
+
+// Class EPAAlgorithm
+/**
+ * This class computes the penetration depth between two convex shapes
+ * (without their margins by default) using the Expanding Polytope Algorithm (EPA).
+ * A boolean GJK algorithm is first used to find a tetrahedron of the
+ * Minkowski difference A-B that contains the origin. This polytope is
+ * then expanded towards the boundary of the Minkowski difference until the
+ * face closest to the origin is found. This face gives the penetration normal,
+ * the penetration depth and the witness points on both shapes. The cost of an
+ * iteration is linear in the number of vertices of the shapes which makes this
+ * algorithm a good alternative to the SAT algorithm for convex polyhedra with
+ * many vertices, where the SAT edge vs edge tests are quadratic. This is based
+ * on the description of the algorithm in the book "Collision Detection in
+ * Interactive 3D Environments" by Gino van den Bergen.
+ */
+class EPAAlgorithm {
+
+    public :
+
+        enum class EPAResult {
+            SEPARATED,              // The two shapes (without margin unless requested) are separated
+            INTERPENETRATE,         // The two shapes (without margin unless requested) overlap
+            INVALID                 // The polytope is degenerate (shallow or touching contact), the result cannot be used
+        };
+
+    private :
+
+        // Structure SupportPoint
+        /**
+         * A support point of the Minkowski difference A-B with the support points of A and B it comes from
+         * (in the local-space of the first shape)
+         */
+        struct SupportPoint {
+
+            /// Support point of the Minkowski difference
+            Vector3 point;
+
+            /// Support point on the first shape
+            Vector3 pointShape1;
+
+            /// Support point on the second shape
+            Vector3 pointShape2;
+        };
+
+        // Structure PolytopeFace
+        /**
+         * A triangular face of the expanding polytope. The vertices are in counter-clockwise
+         * order when seen from outside of the polytope
+         */
+        struct PolytopeFace {
+
+            /// Indices of the three vertices of the face
+            uint32 vertices[3];
+
+            /// Unit outward normal of the face
+            Vector3 normal;
+
+            /// Distance from the origin to the plane of the face
+            decimal distance;
+        };
+
+        // -------------------- Attributes -------------------- //
+
+#ifdef IS_RP3D_PROFILING_ENABLED
+
+		/// Pointer to the profiler
+		Profiler* mProfiler;
+
+#endif
+
+        // -------------------- Methods -------------------- //
+
+        /// Compute the support point of the Minkowski difference A-B in a given direction
+        void computeSupportPoint(const ConvexShape* shape1, const ConvexShape* shape2, const Transform& shape2ToShape1,
+                                 const Quaternion& rotateToShape2, bool useMargins, const Vector3& direction,
+                                 SupportPoint& outSupportPoint) const;
+
+        /// Update a triangle simplex and the search direction of the GJK algorithm
+        void updateTriangleSimplex(SupportPoint simplex[4], uint32& nbSimplexPoints, Vector3& direction) const;
+
+        /// Update a tetrahedron simplex and the search direction of the GJK algorithm. Return true if
+        /// the tetrahedron contains the origin
+        bool updateTetrahedronSimplex(SupportPoint simplex[4], uint32& nbSimplexPoints, Vector3& direction) const;
+
+        /// Compute the outward normal and the distance to the origin of a polytope face
+        bool computeFacePlane(const SupportPoint* vertices, PolytopeFace& face) const;
+
+    public :
+
+        // -------------------- Methods -------------------- //
+
+        /// Constructor
+        EPAAlgorithm() = default;
+
+        /// Destructor
+        ~EPAAlgorithm() = default;
+
+        /// Deleted copy-constructor
+        EPAAlgorithm(const EPAAlgorithm& algorithm) = delete;
+
+        /// Deleted assignment operator
+        EPAAlgorithm& operator=(const EPAAlgorithm& algorithm) = delete;
+
+        /// Compute the penetration depth between two convex shapes
+        EPAResult computePenetrationDepth(const ConvexShape* shape1, const Transform& shape1ToWorld,
+                                          const ConvexShape* shape2, const Transform& shape2ToWorld,
+                                          Vector3& inOutSeparatingAxis, Vector3& outNormal, decimal& outPenetrationDepth,
+                                          Vector3& outContactPointShape1, Vector3& outContactPointShape2,
+                                          bool useMargins = false) const;
+
+#ifdef IS_RP3D_PROFILING_ENABLED
+
+		/// Set the profiler
+		void setProfiler(Profiler* profiler);
+
+#endif
+
+};
+
+#ifdef IS_RP3D_PROFILING_ENABLED
+
+// Set the profiler
+RP3D_FORCE_INLINE void EPAAlgorithm::setProfiler(Profiler* profiler) {
+	mProfiler = profiler;
+}
+
+#endif
+
+}
+
+#endif
@@ -38,6 +38,8 @@ struct ContactManifoldInfo;
 struct NarrowPhaseInfoBatch;
 class ConvexShape;
 class Profiler;
+class Transform;
+struct Vector3;
 class VoronoiSimplex;
 template<typename T> class Array;
 
@@ -74,6 +76,11 @@ class GJKAlgorithm {
 
         // -------------------- Methods -------------------- //
 
+        /// Compute a lower bound of the distance between two convex shapes (with their margins)
+        bool computeDistance(const ConvexShape* shape1, const Transform& shape1ToWorld, const ConvexShape* shape2,
+                             const Transform& shape2ToWorld, Vector3& inOutSeparatingAxis, decimal& outDistance,
+                             Vector3& outNormal) const;
+
     public :
 
         enum class GJKResult {
@@ -100,6 +107,14 @@ class GJKAlgorithm {
         void testCollision(NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint32 batchStartIndex,
                            uint32 batchNbItems, Array<GJKResult>& gjkResults);
 
+        /// Test if the two collision shapes of each item of the batch overlap (without computing contacts)
+        bool testOverlap(NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint32 batchStartIndex, uint32 batchNbItems);
+
+        /// Compute the time of impact of a convex shape moving with a translation against another convex shape
+        bool computeTimeOfImpact(const ConvexShape* shape1, const Transform& shape1StartToWorld, const Vector3& translation1,
+                                 const ConvexShape* shape2, const Transform& shape2ToWorld, decimal distanceTolerance,
+                                 decimal& outTimeOfImpact, Vector3& outNormal) const;
+
 #ifdef IS_RP3D_PROFILING_ENABLED
 
 		/// Set the profiler
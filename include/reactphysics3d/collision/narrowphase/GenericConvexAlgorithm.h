@@ -0,0 +1,104 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2022 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+#ifndef REACTPHYSICS3D_GENERIC_CONVEX_ALGORITHM_H
+#define	REACTPHYSICS3D_GENERIC_CONVEX_ALGORITHM_H
+
+// Libraries
+#include <reactphysics3d/collision/narrowphase/NarrowPhaseAlgorithm.h>
+
+/// Namespace ReactPhysics3D
+namespace reactphysics3d {
+
+// Declarations
+class ConvexShape;
+class EPAAlgorithm;
+class Transform;
+struct Vector3;
+struct NarrowPhaseInfoBatch;
+template<typename T> class Array;
+
+// Class GenericConvexAlgorithm
+/**
+ * This class is used to compute the narrow-phase collision detection between a
+ * generic convex shape (cylinder or cone) that is only described by its support
+ * function and any other convex shape. The GJK algorithm is used first. If the
+ * shapes only overlap in their margins, GJK gives the contact normal and depth.
+ * If the shapes overlap even without their margins (deep penetration), the EPA
+ * algorithm computes the penetration normal and depth. A single contact point is
+ * not enough to make a cylinder rest on one of its caps. Therefore, when the
+ * contact normal is almost aligned with a face of one of the shapes (a face of a
+ * polyhedron, the cap of a cylinder or the base of a cone), the contact feature of
+ * the other shape is clipped against this reference face to get more contact points.
+ */
+class GenericConvexAlgorithm : public NarrowPhaseAlgorithm {
+
+    protected :
+
+        // -------------------- Constants -------------------- //
+
+        /// Minimum cosine between the contact normal and the normal of a face (or the
+        /// perpendicular of an edge) to use this face (or edge) as a contact feature
+        static const decimal FEATURE_MIN_COSINE;
+
+        /// Number of vertices of the polygon used to approximate the cap of a cylinder or the base of a cone
+        static const uint32 NB_CAP_POLYGON_VERTICES;
+
+        // -------------------- Methods -------------------- //
+
+        /// Compute the contact with the EPA algorithm when the shapes overlap without their margins
+        bool testCollisionEPA(const EPAAlgorithm& epaAlgorithm, NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint32 batchIndex) const;
+
+        /// Compute the contact feature (face, edge or vertex) of a convex shape in a given direction
+        void computeContactFeature(const ConvexShape* shape, const Transform& shapeToWorld, const Vector3& direction,
+                                   Array<Vector3>& outFeaturePoints, Vector3& outFaceNormal) const;
+
+        /// Replace the contact point of a batch item with the contact points of the features of the shapes
+        void computeFeatureContactPoints(NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint32 batchIndex,
+                                         MemoryAllocator& memoryAllocator) const;
+
+    public :
+
+        // -------------------- Methods -------------------- //
+
+        /// Constructor
+        GenericConvexAlgorithm() = default;
+
+        /// Destructor
+        virtual ~GenericConvexAlgorithm() override = default;
+
+        /// Deleted copy-constructor
+        GenericConvexAlgorithm(const GenericConvexAlgorithm& algorithm) = delete;
+
+        /// Deleted assignment operator
+        GenericConvexAlgorithm& operator=(const GenericConvexAlgorithm& algorithm) = delete;
+
+        /// Compute the narrow-phase collision detection between a generic convex shape and another convex shape
+        bool testCollision(NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint32 batchStartIndex, uint32 batchNbItems,
+                           MemoryAllocator& memoryAllocator);
+};
+
+}
+
+#endif
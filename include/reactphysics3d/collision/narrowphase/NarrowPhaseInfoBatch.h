@@ -52,6 +52,9 @@ struct NarrowPhaseInfoBatch {
         /// Broadphase overlapping pairs ids
         uint64 overlappingPairId;
 
+        /// Pointer to the broad-phase overlapping pair
+        OverlappingPairs::OverlappingPair* overlappingPair;
+
         /// Entity of the first collider to test collision with
         Entity colliderEntity1;
 
@@ -89,10 +92,10 @@ struct NarrowPhaseInfoBatch {
         ContactPointInfo contactPoints[NB_MAX_CONTACT_POINTS_IN_NARROWPHASE_INFO];
 
         /// Constructor
-        NarrowPhaseInfo(uint64 pairId, Entity collider1, Entity collider2, LastFrameCollisionInfo* lastFrameInfo, MemoryAllocator& shapeAllocator,
+        NarrowPhaseInfo(OverlappingPairs::OverlappingPair* pair, Entity collider1, Entity collider2, LastFrameCollisionInfo* lastFrameInfo, MemoryAllocator& shapeAllocator,
                              const Transform& shape1ToWorldTransform, const Transform& shape2ToWorldTransform, CollisionShape* shape1,
                              CollisionShape* shape2, bool needToReportContacts)
-                      : overlappingPairId(pairId), colliderEntity1(collider1), colliderEntity2(collider2), lastFrameCollisionInfo(lastFrameInfo),
+                      : overlappingPairId(pair->pairID), overlappingPair(pair), colliderEntity1(collider1), colliderEntity2(collider2), lastFrameCollisionInfo(lastFrameInfo),
                          collisionShapeAllocator(&shapeAllocator), shape1ToWorldTransform(shape1ToWorldTransform),
                          shape2ToWorldTransform(shape2ToWorldTransform), collisionShape1(shape1),
                         collisionShape2(shape2), reportContacts(needToReportContacts), isColliding(false), nbContactPoints(0) {
@@ -123,7 +126,7 @@ struct NarrowPhaseInfoBatch {
         ~NarrowPhaseInfoBatch();
 
         /// Add shapes to be tested during narrow-phase collision detection into the batch
-        void addNarrowPhaseInfo(uint64 pairId, Entity collider1, Entity collider2, CollisionShape* shape1,
+        void addNarrowPhaseInfo(OverlappingPairs::OverlappingPair* overlappingPair, Entity collider1, Entity collider2, CollisionShape* shape1,
                                                       CollisionShape* shape2, const Transform& shape1Transform, const Transform& shape2Transform,
                                                       bool needToReportContacts, LastFrameCollisionInfo* lastFrameInfo, MemoryAllocator& shapeAllocator);
 
@@ -150,12 +153,12 @@ RP3D_FORCE_INLINE uint32 NarrowPhaseInfoBatch::getNbObjects() const {
 }
 
 // Add shapes to be tested during narrow-phase collision detection into the batch
-RP3D_FORCE_INLINE void NarrowPhaseInfoBatch::addNarrowPhaseInfo(uint64 pairId, Entity collider1, Entity collider2, CollisionShape* shape1,
+RP3D_FORCE_INLINE void NarrowPhaseInfoBatch::addNarrowPhaseInfo(OverlappingPairs::OverlappingPair* overlappingPair, Entity collider1, Entity collider2, CollisionShape* shape1,
                                               CollisionShape* shape2, const Transform& shape1Transform, const Transform& shape2Transform,
                                               bool needToReportContacts, LastFrameCollisionInfo* lastFrameInfo, MemoryAllocator& shapeAllocator) {
 
     // Create a meta data object
-    narrowPhaseInfos.emplace(pairId, collider1, collider2, lastFrameInfo, shapeAllocator, shape1Transform, shape2Transform, shape1, shape2, needToReportContacts);
+    narrowPhaseInfos.emplace(overlappingPair, collider1, collider2, lastFrameInfo, shapeAllocator, shape1Transform, shape2Transform, shape1, shape2, needToReportContacts);
 }
 
 // Add a new contact point
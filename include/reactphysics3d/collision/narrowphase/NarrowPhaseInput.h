@@ -29,6 +29,7 @@
 // Libraries
 #include <reactphysics3d/containers/Array.h>
 #include <reactphysics3d/collision/narrowphase/NarrowPhaseInfoBatch.h>
+#include <reactphysics3d/collision/narrowphase/TriangleNarrowPhaseInfoBatch.h>
 #include <reactphysics3d/collision/narrowphase/CollisionDispatch.h>
 
 /// Namespace ReactPhysics3D
@@ -59,6 +60,15 @@ class NarrowPhaseInput {
         NarrowPhaseInfoBatch mSphereVsConvexPolyhedronBatch;
         NarrowPhaseInfoBatch mCapsuleVsConvexPolyhedronBatch;
         NarrowPhaseInfoBatch mConvexPolyhedronVsConvexPolyhedronBatch;
+        NarrowPhaseInfoBatch mBoxVsBoxBatch;
+        TriangleNarrowPhaseInfoBatch mSphereVsTriangleBatch;
+        TriangleNarrowPhaseInfoBatch mCapsuleVsTriangleBatch;
+        TriangleNarrowPhaseInfoBatch mBoxVsTriangleBatch;
+        NarrowPhaseInfoBatch mGenericConvexBatch;
+
+        /// Batch of the pairs involving a convex polyhedron that do not need to report contacts (triggers
+        /// for instance). Those pairs are only tested for overlap with the GJK algorithm.
+        NarrowPhaseInfoBatch mConvexVsConvexOverlapBatch;
 
     public:
 
@@ -66,7 +76,7 @@ class NarrowPhaseInput {
         NarrowPhaseInput(MemoryAllocator& allocator, OverlappingPairs& overlappingPairs);
 
         /// Add shapes to be tested during narrow-phase collision detection into the batch
-        void addNarrowPhaseTest(uint64 pairId, Entity collider1, Entity collider2, CollisionShape* shape1,
+        void addNarrowPhaseTest(OverlappingPairs::OverlappingPair* overlappingPair, Entity collider1, Entity collider2, CollisionShape* shape1,
                         CollisionShape* shape2, const Transform& shape1Transform,
                         const Transform& shape2Transform, NarrowPhaseAlgorithmType narrowPhaseAlgorithmType, bool reportContacts,
                         LastFrameCollisionInfo* lastFrameInfo, MemoryAllocator& shapeAllocator);
@@ -89,6 +99,24 @@ class NarrowPhaseInput {
         /// Get a reference to the convex polyhedron vs convex polyhedron batch
         NarrowPhaseInfoBatch& getConvexPolyhedronVsConvexPolyhedronBatch();
 
+        /// Get a reference to the box vs box batch
+        NarrowPhaseInfoBatch& getBoxVsBoxBatch();
+
+        /// Get a reference to the sphere vs triangle batch
+        TriangleNarrowPhaseInfoBatch& getSphereVsTriangleBatch();
+
+        /// Get a reference to the capsule vs triangle batch
+        TriangleNarrowPhaseInfoBatch& getCapsuleVsTriangleBatch();
+
+        /// Get a reference to the box vs triangle batch
+        TriangleNarrowPhaseInfoBatch& getBoxVsTriangleBatch();
+
+        /// Get a reference to the generic convex batch
+        NarrowPhaseInfoBatch& getGenericConvexBatch();
+
+        /// Get a reference to the overlap-only batch
+        NarrowPhaseInfoBatch& getConvexVsConvexOverlapBatch();
+
         /// Reserve memory for the containers with cached capacity
         void reserveMemory();
 
@@ -127,30 +155,84 @@ RP3D_FORCE_INLINE NarrowPhaseInfoBatch &NarrowPhaseInput::getConvexPolyhedronVsC
    return mConvexPolyhedronVsConvexPolyhedronBatch;
 }
 
+// Get a reference to the box vs box batch contacts
+RP3D_FORCE_INLINE NarrowPhaseInfoBatch& NarrowPhaseInput::getBoxVsBoxBatch() {
+   return mBoxVsBoxBatch;
+}
+
+// Get a reference to the sphere vs triangle batch contacts
+RP3D_FORCE_INLINE TriangleNarrowPhaseInfoBatch& NarrowPhaseInput::getSphereVsTriangleBatch() {
+   return mSphereVsTriangleBatch;
+}
+
+// Get a reference to the capsule vs triangle batch contacts
+RP3D_FORCE_INLINE TriangleNarrowPhaseInfoBatch& NarrowPhaseInput::getCapsuleVsTriangleBatch() {
+   return mCapsuleVsTriangleBatch;
+}
+
+// Get a reference to the box vs triangle batch contacts
+RP3D_FORCE_INLINE TriangleNarrowPhaseInfoBatch& NarrowPhaseInput::getBoxVsTriangleBatch() {
+   return mBoxVsTriangleBatch;
+}
+
+// Get a reference to the generic convex batch contacts
+RP3D_FORCE_INLINE NarrowPhaseInfoBatch& NarrowPhaseInput::getGenericConvexBatch() {
+   return mGenericConvexBatch;
+}
+
+// Get a reference to the overlap-only batch
+RP3D_FORCE_INLINE NarrowPhaseInfoBatch& NarrowPhaseInput::getConvexVsConvexOverlapBatch() {
+   return mConvexVsConvexOverlapBatch;
+}
+
 // Add shapes to be tested during narrow-phase collision detection into the batch
-RP3D_FORCE_INLINE void NarrowPhaseInput::addNarrowPhaseTest(uint64 pairId, Entity collider1, Entity collider2, CollisionShape* shape1, CollisionShape* shape2,
+RP3D_FORCE_INLINE void NarrowPhaseInput::addNarrowPhaseTest(OverlappingPairs::OverlappingPair* overlappingPair, Entity collider1, Entity collider2, CollisionShape* shape1, CollisionShape* shape2,
                                           const Transform& shape1Transform, const Transform& shape2Transform,
                                           NarrowPhaseAlgorithmType narrowPhaseAlgorithmType, bool reportContacts, LastFrameCollisionInfo* lastFrameInfo,
                                           MemoryAllocator& shapeAllocator) {
 
+    // If the pair involves a convex polyhedron and does not need to report contacts, we only need
+    // to know if the shapes overlap and the pair is tested with a boolean GJK in a separate batch
+    if (!reportContacts && (narrowPhaseAlgorithmType == NarrowPhaseAlgorithmType::SphereVsConvexPolyhedron ||
+                            narrowPhaseAlgorithmType == NarrowPhaseAlgorithmType::CapsuleVsConvexPolyhedron ||
+                            narrowPhaseAlgorithmType == NarrowPhaseAlgorithmType::ConvexPolyhedronVsConvexPolyhedron ||
+                            narrowPhaseAlgorithmType == NarrowPhaseAlgorithmType::BoxVsBox ||
+                            narrowPhaseAlgorithmType == NarrowPhaseAlgorithmType::GenericConvex)) {
+
+        mConvexVsConvexOverlapBatch.addNarrowPhaseInfo(overlappingPair, collider1, collider2, shape1, shape2, shape1Transform, shape2Transform, reportContacts, lastFrameInfo, shapeAllocator);
+        return;
+    }
+
     switch (narrowPhaseAlgorithmType) {
         case NarrowPhaseAlgorithmType::SphereVsSphere:
-            mSphereVsSphereBatch.addNarrowPhaseInfo(pairId, collider1, collider2, shape1, shape2, shape1Transform, shape2Transform, reportContacts, lastFrameInfo, shapeAllocator);
+            mSphereVsSphereBatch.addNarrowPhaseInfo(overlappingPair, collider1, collider2, shape1, shape2, shape1Transform, shape2Transform, reportContacts, lastFrameInfo, shapeAllocator);
             break;
         case NarrowPhaseAlgorithmType::SphereVsCapsule:
-            mSphereVsCapsuleBatch.addNarrowPhaseInfo(pairId, collider1, collider2, shape1, shape2, shape1Transform, shape2Transform, reportContacts, lastFrameInfo, shapeAllocator);
+            mSphereVsCapsuleBatch.addNarrowPhaseInfo(overlappingPair, collider1, collider2, shape1, shape2, shape1Transform, shape2Transform, reportContacts, lastFrameInfo, shapeAllocator);
             break;
         case NarrowPhaseAlgorithmType::CapsuleVsCapsule:
-            mCapsuleVsCapsuleBatch.addNarrowPhaseInfo(pairId, collider1, collider2, shape1, shape2, shape1Transform, shape2Transform, reportContacts, lastFrameInfo, shapeAllocator);
+            mCapsuleVsCapsuleBatch.addNarrowPhaseInfo(overlappingPair, collider1, collider2, shape1, shape2, shape1Transform, shape2Transform, reportContacts, lastFrameInfo, shapeAllocator);
             break;
         case NarrowPhaseAlgorithmType::SphereVsConvexPolyhedron:
-            mSphereVsConvexPolyhedronBatch.addNarrowPhaseInfo(pairId, collider1, collider2, shape1, shape2, shape1Transform, shape2Transform, reportContacts, lastFrameInfo, shapeAllocator);
+            mSphereVsConvexPolyhedronBatch.addNarrowPhaseInfo(overlappingPair, collider1, collider2, shape1, shape2, shape1Transform, shape2Transform, reportContacts, lastFrameInfo, shapeAllocator);
             break;
         case NarrowPhaseAlgorithmType::CapsuleVsConvexPolyhedron:
-            mCapsuleVsConvexPolyhedronBatch.addNarrowPhaseInfo(pairId, collider1, collider2, shape1, shape2, shape1Transform, shape2Transform, reportContacts, lastFrameInfo, shapeAllocator);
+            mCapsuleVsConvexPolyhedronBatch.addNarrowPhaseInfo(overlappingPair, collider1, collider2, shape1, shape2, shape1Transform, shape2Transform, reportContacts, lastFrameInfo, shapeAllocator);
             break;
         case NarrowPhaseAlgorithmType::ConvexPolyhedronVsConvexPolyhedron:
-            mConvexPolyhedronVsConvexPolyhedronBatch.addNarrowPhaseInfo(pairId, collider1, collider2, shape1, shape2, shape1Transform, shape2Transform, reportContacts, lastFrameInfo, shapeAllocator);
+            mConvexPolyhedronVsConvexPolyhedronBatch.addNarrowPhaseInfo(overlappingPair, collider1, collider2, shape1, shape2, shape1Transform, shape2Transform, reportContacts, lastFrameInfo, shapeAllocator);
+            break;
+        case NarrowPhaseAlgorithmType::BoxVsBox:
+            mBoxVsBoxBatch.addNarrowPhaseInfo(overlappingPair, collider1, collider2, shape1, shape2, shape1Transform, shape2Transform, reportContacts, lastFrameInfo, shapeAllocator);
+            break;
+        case NarrowPhaseAlgorithmType::GenericConvex:
+            mGenericConvexBatch.addNarrowPhaseInfo(overlappingPair, collider1, collider2, shape1, shape2, shape1Transform, shape2Transform, reportContacts, lastFrameInfo, shapeAllocator);
+            break;
+        case NarrowPhaseAlgorithmType::SphereVsTriangle:
+        case NarrowPhaseAlgorithmType::CapsuleVsTriangle:
+        case NarrowPhaseAlgorithmType::BoxVsTriangle:
+            // The triangles are added directly into the triangle batches by the middle-phase
+            assert(false);
             break;
         case NarrowPhaseAlgorithmType::None:
             // Must never happen
@@ -39,6 +39,7 @@ class SphereShape;
 struct ContactManifoldInfo;
 struct NarrowPhaseInfoBatch;
 class ConvexPolyhedronShape;
+struct LastFrameCollisionInfo;
 class MemoryAllocator;
 class Profiler;
 
@@ -61,6 +62,10 @@ class SATAlgorithm {
         static const decimal SEPARATING_AXIS_RELATIVE_TOLERANCE;
         static const decimal SEPARATING_AXIS_ABSOLUTE_TOLERANCE;
 
+        /// Minimum absolute cosine between two candidate separating axes to consider them as the same axis
+        /// (for instance the normals of two parallel faces in resting contact)
+        static const decimal SAME_SEPARATING_AXIS_MIN_COSINE;
+
         /// True means that if two shapes were colliding last time (previous frame) and are still colliding
         /// we use the previous (minimum penetration depth) axis to clip the colliding features and we don't
         /// recompute a new (minimum penetration depth) axis. This value must be true for a dynamic simulation
@@ -112,7 +117,21 @@ class SATAlgorithm {
 
         /// Test all the normals of a polyhedron for separating axis in the polyhedron vs polyhedron case
         decimal testFacesDirectionPolyhedronVsPolyhedron(const ConvexPolyhedronShape* polyhedron1, const ConvexPolyhedronShape* polyhedron2,
-                                                        const Transform& polyhedron1ToPolyhedron2, uint& minFaceIndex) const;
+                                                        const Transform& polyhedron1ToPolyhedron2, uint& minFaceIndex,
+                                                        decimal& secondMinPenetrationDepth) const;
+
+        /// Return how much the penetration depths along the face normals of two polyhedra can change before
+        /// another face than the current minimum penetration face is selected by the SAT algorithm
+        decimal computeFaceAxisPenetrationMargin(bool isMinPenetrationFaceNormalPolyhedron1, const ConvexPolyhedronShape* polyhedron1,
+                                                 const ConvexPolyhedronShape* polyhedron2, const Transform& polyhedron1ToPolyhedron2,
+                                                 uint32 faceIndex1, decimal penetrationDepth1, decimal secondMinPenetrationDepth1,
+                                                 uint32 faceIndex2, decimal penetrationDepth2, decimal secondMinPenetrationDepth2) const;
+
+        /// Return true if the previous minimum penetration axis of two polyhedra would still be
+        /// selected as the minimum penetration axis by the SAT algorithm
+        bool isPreviousMinAxisStillValid(const ConvexPolyhedronShape* polyhedron1, const ConvexPolyhedronShape* polyhedron2,
+                                         const Transform& polyhedron1ToPolyhedron2, const Transform& polyhedron2ToPolyhedron1,
+                                         LastFrameCollisionInfo* lastFrameCollisionInfo) const;
 
         /// Compute the penetration depth between a face of the polyhedron and a sphere along the polyhedron face normal direction
         decimal computePolyhedronFaceVsSpherePenetrationDepth(uint32 faceIndex, const ConvexPolyhedronShape* polyhedron,
@@ -129,12 +148,6 @@ class SATAlgorithm {
                                                                  const Vector3& edgeDirectionCapsuleSpace,
                                                                  const Transform& polyhedronToCapsuleTransform, Vector3& outAxis) const;
 
-        /// Compute the contact points between two faces of two convex polyhedra.
-        bool computePolyhedronVsPolyhedronFaceContactPoints(bool isMinPenetrationFaceNormalPolyhedron1, const ConvexPolyhedronShape* polyhedron1,
-                                                            const ConvexPolyhedronShape* polyhedron2, const Transform& polyhedron1ToPolyhedron2,
-                                                            const Transform& polyhedron2ToPolyhedron1, uint32 minFaceIndex,
-                                                            NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint32 batchIndex) const;
-
 
     public :
 
@@ -173,6 +186,12 @@ class SATAlgorithm {
         /// Test collision between two convex meshes
         bool testCollisionConvexPolyhedronVsConvexPolyhedron(NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint32 batchStartIndex, uint32 batchNbItems) const;
 
+        /// Compute the contact points between two faces of two convex polyhedra.
+        bool computePolyhedronVsPolyhedronFaceContactPoints(bool isMinPenetrationFaceNormalPolyhedron1, const ConvexPolyhedronShape* polyhedron1,
+                                                            const ConvexPolyhedronShape* polyhedron2, const Transform& polyhedron1ToPolyhedron2,
+                                                            const Transform& polyhedron2ToPolyhedron1, uint32 minFaceIndex,
+                                                            NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint32 batchIndex) const;
+
 #ifdef IS_RP3D_PROFILING_ENABLED
 
 		/// Set the profiler
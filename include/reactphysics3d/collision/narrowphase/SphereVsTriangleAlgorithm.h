@@ -0,0 +1,74 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2022 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef REACTPHYSICS3D_SPHERE_VS_TRIANGLE_ALGORITHM_H
+#define	REACTPHYSICS3D_SPHERE_VS_TRIANGLE_ALGORITHM_H
+
+// Libraries
+#include <reactphysics3d/collision/narrowphase/NarrowPhaseAlgorithm.h>
+#include <reactphysics3d/mathematics/Vector3.h>
+
+/// Namespace ReactPhysics3D
+namespace reactphysics3d {
+
+// Declarations
+struct TriangleNarrowPhaseInfoBatch;
+
+// Class SphereVsTriangleAlgorithm
+/**
+ * This class is used to compute the narrow-phase collision detection
+ * between a sphere and the triangles of a concave shape (triangle mesh or
+ * height field). The triangles are read directly from the vertices arrays
+ * of the batch. We compute the closest point on the triangle to the center
+ * of the sphere and use the smooth mesh normal at this point as contact normal.
+ * This way, we do not need to create a TriangleShape for each triangle nor
+ * to run the GJK or SAT algorithm.
+ */
+class SphereVsTriangleAlgorithm : public NarrowPhaseAlgorithm {
+
+    public :
+
+        // -------------------- Methods -------------------- //
+
+        /// Constructor
+        SphereVsTriangleAlgorithm() = default;
+
+        /// Destructor
+        virtual ~SphereVsTriangleAlgorithm() override = default;
+
+        /// Deleted copy-constructor
+        SphereVsTriangleAlgorithm(const SphereVsTriangleAlgorithm& algorithm) = delete;
+
+        /// Deleted assignment operator
+        SphereVsTriangleAlgorithm& operator=(const SphereVsTriangleAlgorithm& algorithm) = delete;
+
+        /// Compute the narrow-phase collision detection between a sphere and triangles
+        bool testCollision(TriangleNarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint32 batchStartIndex,
+                           uint32 batchNbItems, MemoryAllocator& memoryAllocator);
+};
+
+}
+
+#endif
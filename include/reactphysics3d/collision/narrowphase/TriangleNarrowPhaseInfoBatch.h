@@ -0,0 +1,117 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2022 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef REACTPHYSICS3D_TRIANGLE_NARROW_PHASE_INFO_BATCH_H
+#define REACTPHYSICS3D_TRIANGLE_NARROW_PHASE_INFO_BATCH_H
+
+// Libraries
+#include <reactphysics3d/collision/narrowphase/NarrowPhaseInfoBatch.h>
+#include <reactphysics3d/collision/shapes/ConvexShape.h>
+
+/// Namespace ReactPhysics3D
+namespace reactphysics3d {
+
+// Struct TriangleNarrowPhaseInfoBatch
+/**
+ * This structure collects the potential collisions between a convex shape and the triangles
+ * of a concave shape. Contrary to the other batches, no TriangleShape is created for the triangles.
+ * The vertices of the triangles are stored in a flat array (three consecutive elements per
+ * narrow-phase info) in the local-space of the concave shape with the convex edges flags of each
+ * triangle and the collision shape of the triangle side of each narrow-phase info is null.
+ */
+struct TriangleNarrowPhaseInfoBatch : public NarrowPhaseInfoBatch {
+
+    protected:
+
+        /// Cached capacity of the triangles arrays
+        uint32 mCachedTrianglesCapacity = 0;
+
+    public:
+
+        /// Vertices of the triangles (three consecutive vertices for each narrow-phase info)
+        Array<Vector3> trianglesVertices;
+
+        /// Convex edges flags of the triangles (one for each narrow-phase info)
+        Array<uint8> trianglesConvexEdges;
+
+        /// Constructor
+        TriangleNarrowPhaseInfoBatch(OverlappingPairs& overlappingPairs, MemoryAllocator& allocator);
+
+        /// Destructor
+        ~TriangleNarrowPhaseInfoBatch();
+
+        /// Add a narrow-phase info for each triangle added into the triangles arrays since the last call
+        void addTrianglesNarrowPhaseInfos(OverlappingPairs::OverlappingPair* overlappingPair, Entity collider1, Entity collider2,
+                                          ConvexShape* convexShape, bool isShape1Convex, const Transform& shape1Transform,
+                                          const Transform& shape2Transform, bool needToReportContacts, MemoryAllocator& shapeAllocator);
+
+        /// Return a pointer to the three vertices of the triangle of a narrow-phase info
+        const Vector3* getTriangleVertices(uint32 index) const;
+
+        /// Return the convex edges flags of the triangle of a narrow-phase info
+        uint8 getTriangleConvexEdges(uint32 index) const;
+
+        // Initialize the containers using cached capacity
+        void reserveMemory();
+
+        /// Clear all the objects in the batch
+        void clear();
+};
+
+// Add a narrow-phase info for each triangle added into the triangles arrays since the last call
+/// The triangles arrays must have been filled-in before (by the concave shape for instance)
+RP3D_FORCE_INLINE void TriangleNarrowPhaseInfoBatch::addTrianglesNarrowPhaseInfos(OverlappingPairs::OverlappingPair* overlappingPair, Entity collider1, Entity collider2,
+                                                                                  ConvexShape* convexShape, bool isShape1Convex, const Transform& shape1Transform,
+                                                                                  const Transform& shape2Transform, bool needToReportContacts, MemoryAllocator& shapeAllocator) {
+
+    assert(trianglesVertices.size() == trianglesConvexEdges.size() * 3);
+    assert(trianglesVertices.size() % 3 == 0);
+
+    CollisionShape* shape1 = isShape1Convex ? convexShape : nullptr;
+    CollisionShape* shape2 = isShape1Convex ? nullptr : convexShape;
+
+    const uint32 nbTriangles = static_cast<uint32>(trianglesVertices.size() / 3);
+    for (uint32 i = static_cast<uint32>(narrowPhaseInfos.size()); i < nbTriangles; i++) {
+
+        // The triangles do not need a last frame collision info
+        narrowPhaseInfos.emplace(overlappingPair, collider1, collider2, nullptr, shapeAllocator, shape1Transform, shape2Transform, shape1, shape2, needToReportContacts);
+    }
+}
+
+// Return a pointer to the three vertices of the triangle of a narrow-phase info
+RP3D_FORCE_INLINE const Vector3* TriangleNarrowPhaseInfoBatch::getTriangleVertices(uint32 index) const {
+    assert(index * 3 < trianglesVertices.size());
+    return &(trianglesVertices[index * 3]);
+}
+
+// Return the convex edges flags of the triangle of a narrow-phase info
+RP3D_FORCE_INLINE uint8 TriangleNarrowPhaseInfoBatch::getTriangleConvexEdges(uint32 index) const {
+    assert(index < trianglesConvexEdges.size());
+    return trianglesConvexEdges[index];
+}
+
+}
+
+#endif
@@ -45,12 +45,12 @@ struct RaycastInfo;
 struct Vector3;
 class Matrix3x3;
     
-/// Type of collision shapes
-enum class CollisionShapeType {SPHERE, CAPSULE, CONVEX_POLYHEDRON, CONCAVE_SHAPE};
-const int NB_COLLISION_SHAPE_TYPES = 4;
+/// Type of collision shapes (GENERIC_CONVEX is a convex shape only described by its support function)
+enum class CollisionShapeType {SPHERE, CAPSULE, CONVEX_POLYHEDRON, GENERIC_CONVEX, CONCAVE_SHAPE};
+const int NB_COLLISION_SHAPE_TYPES = 5;
 
 /// Names of collision shapes
-enum class CollisionShapeName { TRIANGLE, SPHERE, CAPSULE, BOX, CONVEX_MESH, TRIANGLE_MESH, HEIGHTFIELD };
+enum class CollisionShapeName { TRIANGLE, SPHERE, CAPSULE, BOX, CONVEX_MESH, TRIANGLE_MESH, HEIGHTFIELD, CYLINDER, CONE };
 
 // Declarations
 class Collider;
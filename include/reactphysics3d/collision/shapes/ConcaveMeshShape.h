@@ -29,51 +29,25 @@
 // Libraries
 #include <reactphysics3d/collision/shapes/ConcaveShape.h>
 #include <reactphysics3d/collision/broadphase/DynamicAABBTree.h>
+#include <reactphysics3d/collision/broadphase/StaticAABBTree.h>
 #include <reactphysics3d/containers/Array.h>
 
 namespace reactphysics3d {
 
 // Declarations
 class ConcaveMeshShape;
+class ConcaveMeshData;
 class Profiler;
 class TriangleShape;
 class TriangleMesh;
 
-// class ConvexTriangleAABBOverlapCallback
-class ConvexTriangleAABBOverlapCallback : public DynamicAABBTreeOverlapCallback {
-
-    private:
-
-        TriangleCallback& mTriangleTestCallback;
-
-        // Reference to the concave mesh shape
-        const ConcaveMeshShape& mConcaveMeshShape;
-
-        // Reference to the Dynamic AABB tree
-        const DynamicAABBTree& mDynamicAABBTree;
-
-    public:
-
-        // Constructor
-        ConvexTriangleAABBOverlapCallback(TriangleCallback& triangleCallback, const ConcaveMeshShape& concaveShape,
-                                          const DynamicAABBTree& dynamicAABBTree)
-          : mTriangleTestCallback(triangleCallback), mConcaveMeshShape(concaveShape), mDynamicAABBTree(dynamicAABBTree) {
-
-        }
-
-        // Called when a overlapping node has been found during the call to
-        // DynamicAABBTree:reportAllShapesOverlappingWithAABB()
-        virtual void notifyOverlappingNode(int nodeId) override;
-
-};
-
 /// Class ConcaveMeshRaycastCallback
 class ConcaveMeshRaycastCallback : public DynamicAABBTreeRaycastCallback {
 
     private :
 
         Array<int32> mHitAABBNodes;
-        const DynamicAABBTree& mDynamicAABBTree;
+        const StaticAABBTree& mAABBTree;
         const ConcaveMeshShape& mConcaveMeshShape;
         Collider* mCollider;
         RaycastInfo& mRaycastInfo;
@@ -92,14 +66,14 @@ class ConcaveMeshRaycastCallback : public DynamicAABBTreeRaycastCallback {
     public:
 
         // Constructor
-        ConcaveMeshRaycastCallback(const DynamicAABBTree& dynamicAABBTree, const ConcaveMeshShape& concaveMeshShape,
+        ConcaveMeshRaycastCallback(const StaticAABBTree& aabbTree, const ConcaveMeshShape& concaveMeshShape,
                                    Collider* collider, RaycastInfo& raycastInfo, const Ray& ray, const Vector3& meshScale, MemoryAllocator& allocator)
-            : mHitAABBNodes(allocator), mDynamicAABBTree(dynamicAABBTree), mConcaveMeshShape(concaveMeshShape), mCollider(collider),
+            : mHitAABBNodes(allocator), mAABBTree(aabbTree), mConcaveMeshShape(concaveMeshShape), mCollider(collider),
               mRaycastInfo(raycastInfo), mRay(ray), mIsHit(false), mAllocator(allocator), mMeshScale(meshScale) {
 
         }
 
-        /// Collect all the AABB nodes that are hit by the ray in the Dynamic AABB Tree
+        /// Collect all the triangles whose AABB is hit by the ray in the AABB tree
         virtual decimal raycastBroadPhaseShape(int32 nodeId, const Ray& ray) override;
 
         /// Raycast all collision shapes that have been collected
@@ -120,27 +94,216 @@ class ConcaveMeshRaycastCallback : public DynamicAABBTreeRaycastCallback {
 #endif
 };
 
+// Class ConcaveMeshData
+/**
+ * This class contains the data of a concave mesh shape that does not depend on the
+ * scaling of the shape: the AABB tree of the triangles, the convex edges of the
+ * triangles and the optional compressed vertices. The triangles are stored without
+ * scaling, so a single ConcaveMeshData is shared by all the ConcaveMeshShape created
+ * from the same TriangleMesh (or the same cooked data) with different scaling factors.
+ * It is created with the first of those shapes and destroyed with the last one by the
+ * PhysicsCommon object. When the vertices are compressed, the triangles are grouped into
+ * clusters of triangles that are close to each other in the AABB tree and the vertices of
+ * each cluster are quantized on 16 bits relative to the AABB of the cluster. The compressed
+ * data is then self-contained and the TriangleMesh, the TriangleVertexArray and the source
+ * vertices and indices arrays can be freed after the creation of the shape.
+ */
+class ConcaveMeshData {
+
+    private:
+
+        // -------------------- Structures -------------------- //
+
+        /// Cluster of triangles with compressed vertices
+        struct CompressedCluster {
+
+            /// Minimum coordinates of the AABB of the vertices of the cluster
+            Vector3 origin;
+
+            /// Scale factor to convert a quantized coordinate into a coordinate relative to the origin
+            Vector3 dequantizationScale;
+
+            /// Index of the first vertex of the cluster in the array of compressed vertices
+            uint32 firstVertex;
+        };
+
+        // -------------------- Constants -------------------- //
+
+        /// Maximum number of triangles in a cluster of compressed triangles
+        const static uint32 NB_TRIANGLES_PER_COMPRESSED_CLUSTER = 64;
+
+        // -------------------- Attributes -------------------- //
+
+        /// Memory allocator
+        MemoryAllocator& mAllocator;
+
+        /// Pointer to the triangle mesh or to the cooked data used to create the data (null if the
+        /// triangle mesh of compressed data has been destroyed)
+        const void* mSource;
+
+        /// Pointer to the triangle mesh (null if the vertices are compressed)
+        TriangleMesh* mTriangleMesh;
+
+        /// Shape id of the first triangle of each sub-part (the last element is the total number of triangles)
+        Array<uint32> mSubpartsFirstTriangles;
+
+        /// Number of vertices of each sub-part
+        Array<uint32> mSubpartsNbVertices;
+
+        /// Static AABB tree to accelerate collision with the triangles
+        StaticAABBTree mAABBTree;
+
+        /// Convex edges flags of each triangle computed when the data is not created from cooked data
+        Array<uint8> mComputedTrianglesConvexEdges;
+
+        /// Convex edges flags of each triangle of the mesh (indexed by triangle shape id). Bit i
+        /// is set if the edge between the vertices i and (i+1) % 3 of the triangle is a convex edge
+        const uint8* mTrianglesConvexEdges;
+
+        /// True if the data has been created from cooked data (it then owns its triangle mesh)
+        bool mIsCreatedFromCookedData;
+
+        /// True if the data contains a compressed copy of the vertices of the mesh
+        bool mAreVerticesCompressed;
+
+        /// Clusters of compressed triangles
+        Array<CompressedCluster> mCompressedClusters;
+
+        /// Quantized coordinates of the vertices of all the clusters
+        Array<uint16> mCompressedVertices;
+
+        /// Indices of the three vertices (in its cluster) of each compressed triangle
+        Array<uint8> mCompressedTrianglesVertices;
+
+        /// Index of the compressed triangle for each triangle shape id
+        Array<uint32> mCompressedTrianglesIndices;
+
+        /// Index (in the vertex array of its sub-part) of each compressed vertex
+        Array<uint32> mCompressedVerticesIndices;
+
+        /// Number of concave mesh shapes using this data
+        uint32 mNbShapes;
+
+        // -------------------- Methods -------------------- //
+
+        /// Constructor
+        ConcaveMeshData(TriangleMesh* triangleMesh, MemoryAllocator& allocator, bool compressVertices);
+
+        /// Constructor from cooked data
+        ConcaveMeshData(const void* cookedData, MemoryAllocator& allocator);
+
+        /// Destructor
+        ~ConcaveMeshData();
+
+        /// Insert all the triangles into the AABB tree
+        void initBVHTree();
+
+        /// Initialize the number of triangles and vertices of each sub-part from the triangle mesh
+        void initSubparts();
+
+        /// Compute the convex edges of all the triangles of the mesh
+        void computeTrianglesConvexEdges();
+
+        /// Return the number of bytes of memory allocated by the data
+        size_t getSizeInBytes() const;
+
+        /// Compute the compressed vertices of all the triangles of the mesh
+        void computeCompressedVertices();
+
+        /// Return the three vertices coordinates (without scaling) of a triangle
+        void getTriangleVertices(uint32 subPart, uint32 triangleIndex, Vector3* outTriangleVertices) const;
+
+        /// Return the indices of the three vertices of a triangle in the vertex array of its sub-part
+        void getTriangleVerticesIndices(uint32 subPart, uint32 triangleIndex, uint32* outVerticesIndices) const;
+
+        /// Return the vertices (without scaling) and the vertices normals of a sub-part
+        void getSubpartVertices(uint32 subPart, Array<Vector3>& outVertices, Array<Vector3>& outNormals) const;
+
+        /// Compute the shape Id for a given triangle of the mesh
+        uint32 computeTriangleShapeId(uint32 subPart, uint32 triangleIndex) const;
+
+        /// Return the number of sub-parts of the mesh
+        uint32 getNbSubparts() const;
+
+        /// Return the number of triangles of a sub-part
+        uint32 getNbTriangles(uint32 subPart) const;
+
+        /// Return the number of vertices of a sub-part
+        uint32 getNbVertices(uint32 subPart) const;
+
+    public:
+
+        /// Deleted copy-constructor
+        ConcaveMeshData(const ConcaveMeshData& meshData) = delete;
+
+        /// Deleted assignment operator
+        ConcaveMeshData& operator=(const ConcaveMeshData& meshData) = delete;
+
+        // ---------- Friendship ----------- //
+
+        friend class ConcaveMeshShape;
+        friend class ConcaveMeshRaycastCallback;
+        friend class PhysicsCommon;
+};
+
 // Class ConcaveMeshShape
 /**
  * This class represents a static concave mesh shape. Note that collision detection
  * with a concave mesh shape can be very expensive. You should only use
- * this shape for a static mesh.
+ * this shape for a static mesh. The data computed when the shape is created (vertices
+ * normals, AABB tree and convex edges) can be saved as cooked data with the cook()
+ * method. A shape can then be created from the cooked data without any computation.
+ * This data does not depend on the scaling of the shape and is stored in a ConcaveMeshData
+ * object that is shared by all the shapes created from the same mesh (or cooked data).
  */
 class ConcaveMeshShape : public ConcaveShape {
 
     protected:
 
-        // -------------------- Attributes -------------------- //
+        // -------------------- Structures -------------------- //
 
-        /// Pointer to the triangle mesh
-        TriangleMesh* mTriangleMesh;
+        /// Header at the beginning of the cooked data of a mesh
+        struct CookedDataHeader {
+
+            /// Value used to identify cooked data
+            uint32 magic;
+
+            /// Version of the cooked data format
+            uint32 version;
+
+            /// Size (in bytes) of a decimal value in the cooked data
+            uint32 decimalSize;
 
-        /// Dynamic AABB tree to accelerate collision with the triangles
-        DynamicAABBTree mDynamicAABBTree;
+            /// Size (in bytes) of a node of the AABB tree in the cooked data
+            uint32 treeNodeSize;
 
-        /// Array with computed vertices normals for each TriangleVertexArray of the triangle mesh (only
-        /// if the user did not provide its own vertices normals)
-        Vector3** mComputedVerticesNormals;
+            /// Number of sub-parts of the mesh
+            uint32 nbSubparts;
+
+            /// Total number of triangles of the mesh
+            uint32 nbTriangles;
+
+            /// Minimum and maximum coordinates of the AABB of the whole mesh
+            decimal rootAABB[6];
+        };
+
+        /// Description of a sub-part of the mesh in the cooked data
+        struct CookedSubpart {
+
+            /// Number of vertices of the sub-part
+            uint32 nbVertices;
+
+            /// Number of triangles of the sub-part
+            uint32 nbTriangles;
+        };
+
+        // -------------------- Attributes -------------------- //
+
+        /// Data of the mesh that does not depend on the scaling (shared with the other shapes of the same mesh)
+        ConcaveMeshData* mMeshData;
+
+        /// Memory allocator
+        MemoryAllocator& mAllocator;
 
         /// Reference to the triangle half-edge structure
         HalfEdgeStructure& mTriangleHalfEdgeStructure;
@@ -148,7 +311,17 @@ class ConcaveMeshShape : public ConcaveShape {
         // -------------------- Methods -------------------- //
 
         /// Constructor
-        ConcaveMeshShape(TriangleMesh* triangleMesh, MemoryAllocator& allocator, HalfEdgeStructure& triangleHalfEdgeStructure, const Vector3& scaling = Vector3(1, 1, 1));
+        ConcaveMeshShape(ConcaveMeshData* meshData, MemoryAllocator& allocator, HalfEdgeStructure& triangleHalfEdgeStructure,
+                         const Vector3& scaling = Vector3(1, 1, 1));
+
+        /// Return true if the cooked data in parameter can be used to create a shape
+        static bool isCookedDataValid(const void* cookedData, size_t cookedDataSize);
+
+        /// Return the size (in bytes) of the cooked data of a mesh with the given sub-parts
+        static size_t computeCookedDataSize(const CookedSubpart* subparts, uint32 nbSubparts, uint32 nbTriangles);
+
+        /// Return an offset in the cooked data aligned on 8 bytes
+        static size_t alignCookedDataOffset(size_t offset);
 
         /// Raycast method with feedback information
         virtual bool raycast(const Ray& ray, RaycastInfo& raycastInfo, Collider* collider, MemoryAllocator& allocator) const override;
@@ -156,9 +329,6 @@ class ConcaveMeshShape : public ConcaveShape {
         /// Return the number of bytes used by the collision shape
         virtual size_t getSizeInBytes() const override;
 
-        /// Insert all the triangles into the dynamic AABB tree
-        void initBVHTree();
-
         /// Return the three vertices coordinates (in the array outTriangleVertices) of a triangle
         void getTriangleVertices(uint32 subPart, uint32 triangleIndex, Vector3* outTriangleVertices) const;
 
@@ -170,7 +340,7 @@ class ConcaveMeshShape : public ConcaveShape {
 
         /// Compute all the triangles of the mesh that are overlapping with the AABB in parameter
         virtual void computeOverlappingTriangles(const AABB& localAABB, Array<Vector3>& triangleVertices,
-                                                 Array<Vector3> &triangleVerticesNormals, Array<uint32>& shapeIds,
+                                                 Array<uint8>& trianglesConvexEdges, Array<uint32>& shapeIds,
                                                  MemoryAllocator& allocator) const override;
 
         /// Destructor
@@ -196,6 +366,15 @@ class ConcaveMeshShape : public ConcaveShape {
         /// Return the local bounds of the shape in x, y and z directions.
         virtual void getLocalBounds(Vector3& min, Vector3& max) const override;
 
+        /// Return the number of bytes of memory used by the data of the mesh
+        size_t getMeshDataSizeInBytes() const;
+
+        /// Return the size (in bytes) of the cooked data of the shape
+        size_t getCookedDataSize() const;
+
+        /// Write the cooked data of the shape into a buffer
+        void cook(void* outCookedData) const;
+
         /// Return the string representation of the shape
         virtual std::string to_string() const override;
 
@@ -208,12 +387,35 @@ class ConcaveMeshShape : public ConcaveShape {
 
         // ---------- Friendship ----------- //
 
-        friend class ConvexTriangleAABBOverlapCallback;
         friend class ConcaveMeshRaycastCallback;
+        friend class ConcaveMeshData;
         friend class PhysicsCommon;
         friend class DebugRenderer;
 };
 
+// Compute the shape Id for a given triangle of the mesh
+RP3D_FORCE_INLINE uint32 ConcaveMeshData::computeTriangleShapeId(uint32 subPart, uint32 triangleIndex) const {
+    assert(triangleIndex < getNbTriangles(subPart));
+    return mSubpartsFirstTriangles[subPart] + triangleIndex;
+}
+
+// Return the number of sub-parts of the mesh
+RP3D_FORCE_INLINE uint32 ConcaveMeshData::getNbSubparts() const {
+    return static_cast<uint32>(mSubpartsNbVertices.size());
+}
+
+// Return the number of triangles of a sub-part
+RP3D_FORCE_INLINE uint32 ConcaveMeshData::getNbTriangles(uint32 subPart) const {
+    assert(subPart < getNbSubparts());
+    return mSubpartsFirstTriangles[subPart + 1] - mSubpartsFirstTriangles[subPart];
+}
+
+// Return the number of vertices of a sub-part
+RP3D_FORCE_INLINE uint32 ConcaveMeshData::getNbVertices(uint32 subPart) const {
+    assert(subPart < getNbSubparts());
+    return mSubpartsNbVertices[subPart];
+}
+
 // Return the number of bytes used by the collision shape
 RP3D_FORCE_INLINE size_t ConcaveMeshShape::getSizeInBytes() const {
     return sizeof(ConcaveMeshShape);
@@ -227,30 +429,16 @@ RP3D_FORCE_INLINE size_t ConcaveMeshShape::getSizeInBytes() const {
  */
 RP3D_FORCE_INLINE void ConcaveMeshShape::getLocalBounds(Vector3& min, Vector3& max) const {
 
-    // Get the AABB of the whole tree
-    AABB treeAABB = mDynamicAABBTree.getRootAABB();
+    // Get the AABB of the whole tree (the triangles are stored without scaling in the tree)
+    const AABB& treeAABB = mMeshData->mAABBTree.getRootAABB();
 
-    min = treeAABB.getMin();
-    max = treeAABB.getMax();
+    min = treeAABB.getMin() * mScale;
+    max = treeAABB.getMax() * mScale;
 }
 
-// Called when a overlapping node has been found during the call to
-// DynamicAABBTree:reportAllShapesOverlappingWithAABB()
-RP3D_FORCE_INLINE void ConvexTriangleAABBOverlapCallback::notifyOverlappingNode(int nodeId) {
-
-    // Get the node data (triangle index and mesh subpart index)
-    int32* data = mDynamicAABBTree.getNodeDataInt(nodeId);
-
-    // Get the triangle vertices for this node from the concave mesh shape
-    Vector3 trianglePoints[3];
-    mConcaveMeshShape.getTriangleVertices(data[0], data[1], trianglePoints);
-
-    // Get the vertices normals of the triangle
-    Vector3 verticesNormals[3];
-    mConcaveMeshShape.getTriangleVerticesNormals(data[0], data[1], verticesNormals);
-
-    // Call the callback to test narrow-phase collision with this triangle
-    mTriangleTestCallback.testTriangle(trianglePoints, verticesNormals, mConcaveMeshShape.computeTriangleShapeId(data[0], data[1]));
+// Return an offset in the cooked data aligned on 8 bytes
+RP3D_FORCE_INLINE size_t ConcaveMeshShape::alignCookedDataOffset(size_t offset) {
+    return (offset + 7) & ~size_t(7);
 }
 
 #ifdef IS_RP3D_PROFILING_ENABLED
@@ -260,7 +448,7 @@ RP3D_FORCE_INLINE void ConcaveMeshShape::setProfiler(Profiler* profiler) {
 
     CollisionShape::setProfiler(profiler);
 
-    mDynamicAABBTree.setProfiler(profiler);
+    mMeshData->mAABBTree.setProfiler(profiler);
 }
 
 
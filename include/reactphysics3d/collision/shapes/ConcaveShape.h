@@ -112,7 +112,7 @@ class ConcaveShape : public CollisionShape {
 
         /// Use a callback method on all triangles of the concave shape inside a given AABB
         virtual void computeOverlappingTriangles(const AABB& localAABB, Array<Vector3>& triangleVertices,
-                                                 Array<Vector3>& triangleVerticesNormals, Array<uint32>& shapeIds,
+                                                 Array<uint8>& trianglesConvexEdges, Array<uint32>& shapeIds,
                                                  MemoryAllocator& allocator) const=0;
 
         /// Compute and return the volume of the collision shape
@@ -0,0 +1,247 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2022 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+#ifndef REACTPHYSICS3D_CONE_SHAPE_H
+#define REACTPHYSICS3D_CONE_SHAPE_H
+
+// Libraries
+#include <reactphysics3d/collision/shapes/ConvexShape.h>
+#include <reactphysics3d/mathematics/mathematics.h>
+
+// ReactPhysics3D namespace
+namespace reactphysics3d {
+
+// Declarations
+class CollisionBody;
+
+// Class ConeShape
+/**
+ * This class represents a cone collision shape around the Y axis with its apex pointing
+ * in the positive Y direction. The cone is defined by the radius of its base and its
+ * height. The origin of the local-space of the cone is its center of mass that is on
+ * the axis at a quarter of the height above the base. Therefore, the base is at
+ * y = -height/4 and the apex is at y = 3*height/4. The support point of the cone
+ * is computed analytically in constant time. As for the cylinder, the internal core
+ * of the cone is smaller than the shape by the margin so that the core enlarged by
+ * the margin has the same size as the shape with slightly rounded edges.
+ */
+class ConeShape : public ConvexShape {
+
+    protected :
+
+        // -------------------- Attributes -------------------- //
+
+        /// Radius of the base of the cone
+        decimal mRadius;
+
+        /// Height of the cone
+        decimal mHeight;
+
+        /// Y coordinate of the base of the internal core (cone reduced by the margin)
+        decimal mCoreBaseY;
+
+        /// Y coordinate of the apex of the internal core
+        decimal mCoreApexY;
+
+        /// Radius of the base of the internal core
+        decimal mCoreRadius;
+
+        // -------------------- Methods -------------------- //
+
+        /// Constructor
+        ConeShape(decimal radius, decimal height, MemoryAllocator& allocator);
+
+        /// Compute the margin and the internal core of the cone from its dimensions
+        void updateCore();
+
+        /// Return a local support point in a given direction without the object margin
+        virtual Vector3 getLocalSupportPointWithoutMargin(const Vector3& direction) const override;
+
+        /// Return true if a point is inside the collision shape
+        virtual bool testPointInside(const Vector3& localPoint, Collider* collider) const override;
+
+        /// Raycast method with feedback information
+        virtual bool raycast(const Ray& ray, RaycastInfo& raycastInfo, Collider* collider, MemoryAllocator& allocator) const override;
+
+        /// Return the number of bytes used by the collision shape
+        virtual size_t getSizeInBytes() const override;
+
+        /// Destructor
+        virtual ~ConeShape() override = default;
+
+    public :
+
+        // -------------------- Methods -------------------- //
+
+        /// Deleted copy-constructor
+        ConeShape(const ConeShape& shape) = delete;
+
+        /// Deleted assignment operator
+        ConeShape& operator=(const ConeShape& shape) = delete;
+
+        /// Return the radius of the base of the cone
+        decimal getRadius() const;
+
+        /// Set the radius of the base of the cone
+        void setRadius(decimal radius);
+
+        /// Return the height of the cone
+        decimal getHeight() const;
+
+        /// Set the height of the cone
+        void setHeight(decimal height);
+
+        /// Return the local bounds of the shape in x, y and z directions
+        virtual void getLocalBounds(Vector3& min, Vector3& max) const override;
+
+        /// Compute and return the volume of the collision shape
+        virtual decimal getVolume() const override;
+
+        /// Return true if the collision shape is a polyhedron
+        virtual bool isPolyhedron() const override;
+
+        /// Return the local inertia tensor of the collision shape
+        virtual Vector3 getLocalInertiaTensor(decimal mass) const override;
+
+        /// Return the string representation of the shape
+        virtual std::string to_string() const override;
+
+        // ----- Friendship ----- //
+
+        friend class PhysicsCommon;
+        friend class GenericConvexAlgorithm;
+};
+
+// Get the radius of the base of the cone
+/**
+ * @return The radius of the base of the cone shape (in meters)
+ */
+RP3D_FORCE_INLINE decimal ConeShape::getRadius() const {
+    return mRadius;
+}
+
+// Set the radius of the base of the cone
+/// Note that you might want to recompute the inertia tensor and center of mass of the body
+/// after changing the radius of the collision shape
+/**
+ * @param radius The radius of the base of the cone (in meters)
+ */
+RP3D_FORCE_INLINE void ConeShape::setRadius(decimal radius) {
+
+    assert(radius > decimal(0.0));
+    mRadius = radius;
+    updateCore();
+
+    notifyColliderAboutChangedSize();
+}
+
+// Return the height of the cone
+/**
+ * @return The height of the cone shape (in meters)
+ */
+RP3D_FORCE_INLINE decimal ConeShape::getHeight() const {
+    return mHeight;
+}
+
+// Set the height of the cone
+/// Note that you might want to recompute the inertia tensor and center of mass of the body
+/// after changing the height of the collision shape
+/**
+ * @param height The height of the cone (in meters)
+ */
+RP3D_FORCE_INLINE void ConeShape::setHeight(decimal height) {
+
+    assert(height > decimal(0.0));
+    mHeight = height;
+    updateCore();
+
+    notifyColliderAboutChangedSize();
+}
+
+// Return the number of bytes used by the collision shape
+RP3D_FORCE_INLINE size_t ConeShape::getSizeInBytes() const {
+    return sizeof(ConeShape);
+}
+
+// Return the local bounds of the shape in x, y and z directions
+// This method is used to compute the AABB of the box
+/**
+ * @param min The minimum bounds of the shape in local-space coordinates
+ * @param max The maximum bounds of the shape in local-space coordinates
+ */
+RP3D_FORCE_INLINE void ConeShape::getLocalBounds(Vector3& min, Vector3& max) const {
+
+    // Maximum bounds
+    max.x = mRadius;
+    max.y = decimal(0.75) * mHeight;
+    max.z = mRadius;
+
+    // Minimum bounds
+    min.x = -mRadius;
+    min.y = decimal(-0.25) * mHeight;
+    min.z = -mRadius;
+}
+
+// Compute and return the volume of the collision shape
+RP3D_FORCE_INLINE decimal ConeShape::getVolume() const {
+    return reactphysics3d::PI_RP3D * mRadius * mRadius * mHeight / decimal(3.0);
+}
+
+// Return true if the collision shape is a polyhedron
+RP3D_FORCE_INLINE bool ConeShape::isPolyhedron() const {
+    return false;
+}
+
+// Return a local support point in a given direction without the object margin.
+/// The support point of the internal core of the cone is either its apex or the point on the
+/// rim of its base in the direction of the projection of the direction onto the XZ plane.
+/// We return the one with the maximum dot product with the direction.
+RP3D_FORCE_INLINE Vector3 ConeShape::getLocalSupportPointWithoutMargin(const Vector3& direction) const {
+
+    const decimal lengthXZ = std::sqrt(direction.x * direction.x + direction.z * direction.z);
+
+    // Dot products of the apex and of the point on the rim of the base with the direction
+    const decimal dotProductApex = mCoreApexY * direction.y;
+    const decimal dotProductBase = mCoreBaseY * direction.y + mCoreRadius * lengthXZ;
+
+    if (dotProductApex >= dotProductBase) {
+        return Vector3(0, mCoreApexY, 0);
+    }
+
+    if (lengthXZ > MACHINE_EPSILON) {
+        const decimal factor = mCoreRadius / lengthXZ;
+        return Vector3(direction.x * factor, mCoreBaseY, direction.z * factor);
+    }
+
+    return Vector3(0, mCoreBaseY, 0);
+}
+
+// Return the string representation of the shape
+RP3D_FORCE_INLINE std::string ConeShape::to_string() const {
+    return "ConeShape{height=" + std::to_string(mHeight) + ", radius=" + std::to_string(mRadius) + "}";
+}
+
+}
+
+#endif
@@ -0,0 +1,237 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2022 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+#ifndef REACTPHYSICS3D_CYLINDER_SHAPE_H
+#define REACTPHYSICS3D_CYLINDER_SHAPE_H
+
+// Libraries
+#include <reactphysics3d/collision/shapes/ConvexShape.h>
+#include <reactphysics3d/mathematics/mathematics.h>
+
+// ReactPhysics3D namespace
+namespace reactphysics3d {
+
+// Declarations
+class CollisionBody;
+
+// Class CylinderShape
+/**
+ * This class represents a cylinder collision shape around the Y axis and centered at
+ * the origin. The cylinder is defined by its radius and its height. The support
+ * point of the cylinder is computed analytically in constant time. The collision
+ * detection uses a small margin: the internal core of the cylinder is smaller
+ * than the shape by the margin so that the cylinder enlarged by the margin has the
+ * same size as the shape with slightly rounded edges. Therefore, no need to
+ * specify an object margin for a cylinder shape.
+ */
+class CylinderShape : public ConvexShape {
+
+    protected :
+
+        // -------------------- Attributes -------------------- //
+
+        /// Radius of the cylinder
+        decimal mRadius;
+
+        /// Half height of the cylinder
+        decimal mHalfHeight;
+
+        // -------------------- Methods -------------------- //
+
+        /// Constructor
+        CylinderShape(decimal radius, decimal height, MemoryAllocator& allocator);
+
+        /// Compute the margin of the cylinder from its dimensions
+        void updateMargin();
+
+        /// Return a local support point in a given direction without the object margin
+        virtual Vector3 getLocalSupportPointWithoutMargin(const Vector3& direction) const override;
+
+        /// Return true if a point is inside the collision shape
+        virtual bool testPointInside(const Vector3& localPoint, Collider* collider) const override;
+
+        /// Raycast method with feedback information
+        virtual bool raycast(const Ray& ray, RaycastInfo& raycastInfo, Collider* collider, MemoryAllocator& allocator) const override;
+
+        /// Return the number of bytes used by the collision shape
+        virtual size_t getSizeInBytes() const override;
+
+        /// Destructor
+        virtual ~CylinderShape() override = default;
+
+    public :
+
+        // -------------------- Methods -------------------- //
+
+        /// Deleted copy-constructor
+        CylinderShape(const CylinderShape& shape) = delete;
+
+        /// Deleted assignment operator
+        CylinderShape& operator=(const CylinderShape& shape) = delete;
+
+        /// Return the radius of the cylinder
+        decimal getRadius() const;
+
+        /// Set the radius of the cylinder
+        void setRadius(decimal radius);
+
+        /// Return the height of the cylinder
+        decimal getHeight() const;
+
+        /// Set the height of the cylinder
+        void setHeight(decimal height);
+
+        /// Return the local bounds of the shape in x, y and z directions
+        virtual void getLocalBounds(Vector3& min, Vector3& max) const override;
+
+        /// Compute and return the volume of the collision shape
+        virtual decimal getVolume() const override;
+
+        /// Return true if the collision shape is a polyhedron
+        virtual bool isPolyhedron() const override;
+
+        /// Return the local inertia tensor of the collision shape
+        virtual Vector3 getLocalInertiaTensor(decimal mass) const override;
+
+        /// Return the string representation of the shape
+        virtual std::string to_string() const override;
+
+        // ----- Friendship ----- //
+
+        friend class PhysicsCommon;
+        friend class GenericConvexAlgorithm;
+};
+
+// Get the radius of the cylinder
+/**
+ * @return The radius of the cylinder shape (in meters)
+ */
+RP3D_FORCE_INLINE decimal CylinderShape::getRadius() const {
+    return mRadius;
+}
+
+// Set the radius of the cylinder
+/// Note that you might want to recompute the inertia tensor and center of mass of the body
+/// after changing the radius of the collision shape
+/**
+ * @param radius The radius of the cylinder (in meters)
+ */
+RP3D_FORCE_INLINE void CylinderShape::setRadius(decimal radius) {
+
+    assert(radius > decimal(0.0));
+    mRadius = radius;
+    updateMargin();
+
+    notifyColliderAboutChangedSize();
+}
+
+// Return the height of the cylinder
+/**
+ * @return The height of the cylinder shape (in meters)
+ */
+RP3D_FORCE_INLINE decimal CylinderShape::getHeight() const {
+    return mHalfHeight + mHalfHeight;
+}
+
+// Set the height of the cylinder
+/// Note that you might want to recompute the inertia tensor and center of mass of the body
+/// after changing the height of the collision shape
+/**
+ * @param height The height of the cylinder (in meters)
+ */
+RP3D_FORCE_INLINE void CylinderShape::setHeight(decimal height) {
+
+    assert(height > decimal(0.0));
+    mHalfHeight = height * decimal(0.5);
+    updateMargin();
+
+    notifyColliderAboutChangedSize();
+}
+
+// Compute the margin of the cylinder from its dimensions
+RP3D_FORCE_INLINE void CylinderShape::updateMargin() {
+    mMargin = std::min(GENERIC_CONVEX_SHAPE_MAX_MARGIN, decimal(0.1) * std::min(mRadius, mHalfHeight));
+}
+
+// Return the number of bytes used by the collision shape
+RP3D_FORCE_INLINE size_t CylinderShape::getSizeInBytes() const {
+    return sizeof(CylinderShape);
+}
+
+// Return the local bounds of the shape in x, y and z directions
+// This method is used to compute the AABB of the box
+/**
+ * @param min The minimum bounds of the shape in local-space coordinates
+ * @param max The maximum bounds of the shape in local-space coordinates
+ */
+RP3D_FORCE_INLINE void CylinderShape::getLocalBounds(Vector3& min, Vector3& max) const {
+
+    // Maximum bounds
+    max.x = mRadius;
+    max.y = mHalfHeight;
+    max.z = mRadius;
+
+    // Minimum bounds
+    min.x = -mRadius;
+    min.y = -mHalfHeight;
+    min.z = -mRadius;
+}
+
+// Compute and return the volume of the collision shape
+RP3D_FORCE_INLINE decimal CylinderShape::getVolume() const {
+    return reactphysics3d::PI_RP3D * mRadius * mRadius * (mHalfHeight + mHalfHeight);
+}
+
+// Return true if the collision shape is a polyhedron
+RP3D_FORCE_INLINE bool CylinderShape::isPolyhedron() const {
+    return false;
+}
+
+// Return a local support point in a given direction without the object margin.
+/// The support point of the internal core of the cylinder (the cylinder reduced by the margin) is
+/// on the rim of the top or bottom cap depending on the sign of the Y component of the direction.
+/// The point on the rim is in the direction of the projection of the direction onto the XZ plane.
+RP3D_FORCE_INLINE Vector3 CylinderShape::getLocalSupportPointWithoutMargin(const Vector3& direction) const {
+
+    const decimal coreRadius = mRadius - mMargin;
+    const decimal coreHalfHeight = mHalfHeight - mMargin;
+    const decimal y = direction.y < decimal(0.0) ? -coreHalfHeight : coreHalfHeight;
+
+    const decimal lengthXZ = std::sqrt(direction.x * direction.x + direction.z * direction.z);
+    if (lengthXZ > MACHINE_EPSILON) {
+        const decimal factor = coreRadius / lengthXZ;
+        return Vector3(direction.x * factor, y, direction.z * factor);
+    }
+
+    return Vector3(0, y, 0);
+}
+
+// Return the string representation of the shape
+RP3D_FORCE_INLINE std::string CylinderShape::to_string() const {
+    return "CylinderShape{halfHeight=" + std::to_string(mHalfHeight) + ", radius=" + std::to_string(mRadius) + "}";
+}
+
+}
+
+#endif
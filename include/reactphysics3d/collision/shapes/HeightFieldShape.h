@@ -29,6 +29,8 @@
 // Libraries
 #include <reactphysics3d/collision/shapes/ConcaveShape.h>
 #include <reactphysics3d/collision/shapes/AABB.h>
+#include <reactphysics3d/containers/Array.h>
+#include <type_traits>
 
 namespace reactphysics3d {
 
@@ -41,21 +43,62 @@ class TriangleShape;
  * This class represents a static height field that can be used to represent
  * a terrain. The height field is made of a grid with rows and columns with a
  * height value at each grid point. Note that the height values are not copied into the shape
- * but are shared instead. The height values can be of type integer, float or double.
+ * but are shared instead. The height values can be of type integer, 16-bits unsigned integer, float or double.
+ * Integer height values are multiplied by a scale and translated by an offset.
  * When creating a HeightFieldShape, you need to specify the minimum and maximum height value of
  * your height field. Note that the HeightFieldShape will be re-centered based on its AABB. It means
  * that for instance, if the minimum height value is -200 and the maximum value is 400, the final
  * minimum height of the field in the simulation will be -300 and the maximum height will be 300.
+ * A pyramid with the minimum and maximum heights of blocks of grid cells is built when the shape is
+ * created. It is used to skip whole blocks of cells during the overlap queries and the raycasts.
+ * If you modify the shared height values, you need to call the updateHeights() method with the
+ * modified region of the grid.
  */
 class HeightFieldShape : public ConcaveShape {
 
     public:
 
         /// Data type for the height data of the height field
-        enum class HeightDataType {HEIGHT_FLOAT_TYPE, HEIGHT_DOUBLE_TYPE, HEIGHT_INT_TYPE};
+        enum class HeightDataType {HEIGHT_FLOAT_TYPE, HEIGHT_DOUBLE_TYPE, HEIGHT_INT_TYPE, HEIGHT_UINT16_TYPE};
 
     protected:
 
+        // -------------------- Structures -------------------- //
+
+        /// Level of the min/max height pyramid
+        struct HeightPyramidLevel {
+
+            /// Number of blocks along the columns of the grid
+            int nbBlocksI;
+
+            /// Number of blocks along the rows of the grid
+            int nbBlocksJ;
+
+            /// Index of the first block of the level in the pyramid
+            uint32 offset;
+        };
+
+        /// Block of the min/max height pyramid to visit during a raycast
+        struct HeightPyramidBlock {
+
+            /// Level of the block in the pyramid
+            int level;
+
+            /// Index of the block along the columns of the grid
+            int i;
+
+            /// Index of the block along the rows of the grid
+            int j;
+
+            /// Hit fraction where the ray enters the AABB of the block
+            decimal entryFraction;
+        };
+
+        // -------------------- Constants -------------------- //
+
+        /// Number of grid cells along each side of a block of the first level of the min/max height pyramid
+        const static int HEIGHT_PYRAMID_BLOCK_SIZE = 4;
+
         // -------------------- Attributes -------------------- //
 
         /// Number of columns in the grid of the height field
@@ -82,6 +125,9 @@ class HeightFieldShape : public ConcaveShape {
         /// Height values scale for height field with integer height values
         decimal mIntegerHeightScale;
 
+        /// Height values offset for height field with integer height values
+        decimal mIntegerHeightOffset;
+
         /// Data type of the height values
         HeightDataType mHeightDataType;
 
@@ -94,21 +140,45 @@ class HeightFieldShape : public ConcaveShape {
         /// Reference to the half-edge structure
         HalfEdgeStructure& mTriangleHalfEdgeStructure;
 
+        /// Minimum and maximum heights of each block of each level of the min/max height pyramid
+        Array<decimal> mHeightPyramid;
+
+        /// Levels of the min/max height pyramid (the last level contains a single block)
+        Array<HeightPyramidLevel> mHeightPyramidLevels;
+
         // -------------------- Methods -------------------- //
 
         /// Constructor
         HeightFieldShape(int nbGridColumns, int nbGridRows, decimal minHeight, decimal maxHeight,
                          const void* heightFieldData, HeightDataType dataType, MemoryAllocator& allocator,
                          HalfEdgeStructure& triangleHalfEdgeStructure, int upAxis = 1, decimal integerHeightScale = 1.0f,
-                         const Vector3& scaling = Vector3(1,1,1));
+                         const Vector3& scaling = Vector3(1,1,1), decimal integerHeightOffset = 0.0f);
 
         /// Raycast a single triangle of the height-field
-        bool raycastTriangle(const Ray& ray, const Vector3& p1, const Vector3& p2, const Vector3& p3, uint32 shapeId,
-                             Collider *collider, RaycastInfo& raycastInfo, decimal &smallestHitFraction, MemoryAllocator& allocator) const;
+        bool raycastTriangle(const Ray& ray, const Vector3& p1, const Vector3& p2, const Vector3& p3,
+                             Collider *collider, RaycastInfo& raycastInfo, decimal &smallestHitFraction) const;
 
         /// Raycast method with feedback information
         virtual bool raycast(const Ray& ray, RaycastInfo& raycastInfo, Collider* collider, MemoryAllocator& allocator) const override;
 
+        /// Raycast method with a given type of height values
+        template<typename HeightType>
+        bool raycastWithHeightType(const Ray& ray, RaycastInfo& raycastInfo, Collider* collider, MemoryAllocator& allocator) const;
+
+        /// Compute the triangles of the height field overlapping a given AABB with a given type of height values
+        template<typename HeightType>
+        void computeOverlappingTrianglesWithHeightType(const AABB& localAABB, Array<Vector3>& triangleVertices,
+                                                       Array<uint8>& trianglesConvexEdges, Array<uint32>& shapeIds,
+                                                       MemoryAllocator& allocator) const;
+
+        /// Return the height of a given (x,y) point with a given type of height values
+        template<typename HeightType>
+        decimal getHeightValueAt(int x, int y) const;
+
+        /// Return the vertex (local-coordinates) of a given (x,y) point with a given type of height values
+        template<typename HeightType>
+        Vector3 computeVertexAt(int x, int y) const;
+
         /// Return the number of bytes used by the collision shape
         virtual size_t getSizeInBytes() const override;
 
@@ -123,8 +193,22 @@ class HeightFieldShape : public ConcaveShape {
         /// Compute the shape Id for a given triangle
         uint32 computeTriangleShapeId(uint32 iIndex, uint32 jIndex, uint32 secondTriangleIncrement) const;
 
-        /// Compute the first grid cell of the heightfield intersected by a ray
-        bool computeEnteringRayGridCoordinates(const Ray& ray, int& i, int& j, Vector3& outHitPoint) const;
+        /// Build the min/max height pyramid
+        void buildHeightPyramid();
+
+        /// Recompute the minimum and maximum heights of a range of blocks of the first level of the pyramid and of their parents
+        void updateHeightPyramid(int blockIMin, int blockIMax, int blockJMin, int blockJMax);
+
+        /// Recompute the minimum and maximum heights of a range of blocks of the pyramid with a given type of height values
+        template<typename HeightType>
+        void updateHeightPyramidWithHeightType(int blockIMin, int blockIMax, int blockJMin, int blockJMax);
+
+        /// Return the local AABB (without scaling) of a range of grid points with given minimum and maximum heights
+        AABB computeGridAABB(int iMin, int iMax, int jMin, int jMax, decimal minHeight, decimal maxHeight) const;
+
+        /// Compute the hit fraction where a ray enters an AABB
+        static bool computeRayEntryFraction(const Vector3& rayOrigin, const Vector3& rayDirectionInverse, const AABB& aabb,
+                                            decimal maxFraction, decimal& outEntryFraction);
         
         /// Destructor
         virtual ~HeightFieldShape() override = default;
@@ -152,12 +236,15 @@ class HeightFieldShape : public ConcaveShape {
         /// Return the type of height value in the height field
         HeightDataType getHeightDataType() const;
 
+        /// Notify the height field that the height values of a rectangular region of the grid have been modified
+        void updateHeights(int minColumn, int minRow, int maxColumn, int maxRow);
+
         /// Return the local bounds of the shape in x, y and z directions.
         virtual void getLocalBounds(Vector3& min, Vector3& max) const override;
 
         /// Use a callback method on all triangles of the concave shape inside a given AABB
         virtual void computeOverlappingTriangles(const AABB& localAABB, Array<Vector3>& triangleVertices,
-                                                   Array<Vector3>& triangleVerticesNormals, Array<uint32>& shapeIds,
+                                                   Array<uint8>& trianglesConvexEdges, Array<uint32>& shapeIds,
                                                    MemoryAllocator& allocator) const override;
 
         /// Return the string representation of the shape
@@ -165,7 +252,6 @@ class HeightFieldShape : public ConcaveShape {
 
         // ---------- Friendship ----------- //
 
-        friend class ConvexTriangleAABBOverlapCallback;
         friend class ConcaveMeshRaycastCallback;
         friend class PhysicsCommon;
 };
@@ -197,13 +283,31 @@ RP3D_FORCE_INLINE decimal HeightFieldShape::getHeightAt(int x, int y) const {
     assert(y >= 0 && y < mNbRows);
 
     switch(mHeightDataType) {
-        case HeightDataType::HEIGHT_FLOAT_TYPE : return decimal(((float*)mHeightFieldData)[y * mNbColumns + x]);
-        case HeightDataType::HEIGHT_DOUBLE_TYPE : return decimal(((double*)mHeightFieldData)[y * mNbColumns + x]);
-        case HeightDataType::HEIGHT_INT_TYPE : return decimal(((int*)mHeightFieldData)[y * mNbColumns + x] * mIntegerHeightScale);
+        case HeightDataType::HEIGHT_FLOAT_TYPE : return getHeightValueAt<float>(x, y);
+        case HeightDataType::HEIGHT_DOUBLE_TYPE : return getHeightValueAt<double>(x, y);
+        case HeightDataType::HEIGHT_INT_TYPE : return getHeightValueAt<int>(x, y);
+        case HeightDataType::HEIGHT_UINT16_TYPE : return getHeightValueAt<uint16>(x, y);
         default: assert(false); return 0;
     }
 }
 
+// Return the height of a given (x,y) point with a given type of height values
+/// The integer height values are scaled and translated. The test on the type is resolved at compile time.
+template<typename HeightType>
+RP3D_FORCE_INLINE decimal HeightFieldShape::getHeightValueAt(int x, int y) const {
+
+    assert(x >= 0 && x < mNbColumns);
+    assert(y >= 0 && y < mNbRows);
+
+    const HeightType value = static_cast<const HeightType*>(mHeightFieldData)[y * mNbColumns + x];
+
+    if (std::is_integral<HeightType>::value) {
+        return decimal(value) * mIntegerHeightScale + mIntegerHeightOffset;
+    }
+
+    return decimal(value);
+}
+
 // Compute the shape Id for a given triangle
 RP3D_FORCE_INLINE uint32 HeightFieldShape::computeTriangleShapeId(uint32 iIndex, uint32 jIndex, uint32 secondTriangleIncrement) const {
 
@@ -70,8 +70,8 @@ class TriangleShape : public ConvexPolyhedronShape {
         /// Normal of the triangle
         Vector3 mNormal;
 
-        /// Three vertices normals for smooth collision with triangle mesh
-        Vector3 mVerticesNormals[3];
+        /// Convex edges flags of the triangle in the mesh (see ConcaveMeshShape)
+        uint8 mConvexEdges;
 
         /// Raycast test type for the triangle (front, back, front-back)
         TriangleRaycastSide mRaycastTestType;
@@ -84,9 +84,6 @@ class TriangleShape : public ConvexPolyhedronShape {
         /// Return a local support point in a given direction without the object margin
         virtual Vector3 getLocalSupportPointWithoutMargin(const Vector3& direction) const override;
 
-        /// Get a smooth contact normal for collision for a triangle of the mesh
-        Vector3 computeSmoothLocalContactNormalForTriangle(const Vector3& localContactPoint) const;
-
         /// Return true if a point is inside the collider
         virtual bool testPointInside(const Vector3& localPoint, Collider* collider) const override;
 
@@ -107,7 +104,7 @@ class TriangleShape : public ConvexPolyhedronShape {
                                       Vector3& outNewLocalContactPointOtherShape, Vector3& outSmoothWorldContactTriangleNormal) const;
 
         /// Constructor
-        TriangleShape(const Vector3* vertices, const Vector3* verticesNormals, uint32 shapeId, HalfEdgeStructure& triangleHalfEdgeStructure,
+        TriangleShape(const Vector3* vertices, uint8 convexEdges, uint32 shapeId, HalfEdgeStructure& triangleHalfEdgeStructure,
                       MemoryAllocator& allocator);
 
         /// Constructor
@@ -171,12 +168,20 @@ class TriangleShape : public ConvexPolyhedronShape {
         /// Compute and return the volume of the collision shape
         virtual decimal getVolume() const override;
 
-        /// This method compute the smooth mesh contact with a triangle in case one of the two collision shapes is a triangle. The idea in this case is to use a smooth vertex normal of the triangle mesh
+        /// This method compute the smooth mesh contact with a triangle in case one of the two collision shapes is a triangle. The idea in this case is to use the triangle face normal on the internal edges of the mesh
         static void computeSmoothTriangleMeshContact(const CollisionShape* shape1, const CollisionShape* shape2,
                                                      Vector3& localContactPointShape1, Vector3& localContactPointShape2,
                                                      const Transform& shape1ToWorld, const Transform& shape2ToWorld,
                                                      decimal penetrationDepth, Vector3& outSmoothVertexNormal);
 
+        /// Return true if the face normal of a triangle must be used as contact normal at a given point
+        static bool isFaceContactNormalAtPoint(decimal u, decimal v, decimal w, uint8 convexEdges);
+
+        /// Compute the hit fraction of a ray with a triangle given by its three vertices
+        static bool computeRayIntersection(const Vector3& rayOrigin, const Vector3& rayDirection, decimal maxFraction,
+                                           const Vector3& a, const Vector3& b, const Vector3& c,
+                                           TriangleRaycastSide raycastSide, decimal& outHitFraction);
+
         /// Return the string representation of the shape
         virtual std::string to_string() const override;
 
@@ -285,6 +290,58 @@ RP3D_FORCE_INLINE void TriangleShape::setRaycastTestType(TriangleRaycastSide tes
     mRaycastTestType = testType;
 }
 
+// Compute the hit fraction of a ray with a triangle given by its three vertices
+/// This method uses the ray vs triangle intersection technique described in "Fast, Minimum Storage Ray/Triangle
+/// Intersection" by Tomas Moller and Ben Trumbore. It works directly on the vertices so that no triangle shape needs
+/// to be created to raycast the triangles of a mesh. The front face of the triangle is the one for which the
+/// vertices (a, b, c) are in counter-clockwise order.
+/**
+ * @param rayOrigin Origin of the ray
+ * @param rayDirection Vector from the origin of the ray to its end point (the ray point at fraction 1)
+ * @param maxFraction Maximum hit fraction of the ray
+ * @param a First vertex of the triangle
+ * @param b Second vertex of the triangle
+ * @param c Third vertex of the triangle
+ * @param raycastSide Sides of the triangle that can be hit by the ray
+ * @param[out] outHitFraction Hit fraction of the ray with the triangle
+ * @return True if the ray hits the triangle between the fractions 0 and maxFraction
+ */
+RP3D_FORCE_INLINE bool TriangleShape::computeRayIntersection(const Vector3& rayOrigin, const Vector3& rayDirection, decimal maxFraction,
+                                                             const Vector3& a, const Vector3& b, const Vector3& c,
+                                                             TriangleRaycastSide raycastSide, decimal& outHitFraction) {
+
+    const Vector3 edge1 = b - a;
+    const Vector3 edge2 = c - a;
+
+    // The determinant is positive if the ray hits the front face of the triangle
+    const Vector3 p = rayDirection.cross(edge2);
+    const decimal determinant = edge1.dot(p);
+    switch (raycastSide) {
+        case TriangleRaycastSide::FRONT: if (determinant <= decimal(0.0)) return false; break;
+        case TriangleRaycastSide::BACK: if (determinant >= decimal(0.0)) return false; break;
+        case TriangleRaycastSide::FRONT_AND_BACK: if (determinant == decimal(0.0)) return false; break;
+    }
+
+    const decimal inverseDeterminant = decimal(1.0) / determinant;
+
+    // Compute the barycentric coordinates of the intersection point
+    const Vector3 originToA = rayOrigin - a;
+    const decimal u = originToA.dot(p) * inverseDeterminant;
+    if (u < decimal(0.0) || u > decimal(1.0)) return false;
+
+    const Vector3 q = originToA.cross(edge1);
+    const decimal v = rayDirection.dot(q) * inverseDeterminant;
+    if (v < decimal(0.0) || u + v > decimal(1.0)) return false;
+
+    // Compute the hit fraction
+    const decimal hitFraction = edge2.dot(q) * inverseDeterminant;
+    if (hitFraction < decimal(0.0) || hitFraction > maxFraction) return false;
+
+    outHitFraction = hitFraction;
+
+    return true;
+}
+
 // Return the string representation of the shape
 RP3D_FORCE_INLINE std::string TriangleShape::to_string() const {
     return "TriangleShape{v1=" + mPoints[0].to_string() + ", v2=" + mPoints[1].to_string() + "," +
@@ -296,47 +353,26 @@ RP3D_FORCE_INLINE decimal TriangleShape::getVolume() const {
     return decimal(0.0);
 }
 
-// Get a smooth contact normal for collision for a triangle of the mesh
+// Return true if the face normal of a triangle must be used as contact normal at a given point
 /// This is used to avoid the internal edges issue that occurs when a shape is colliding with
 /// several triangles of a concave mesh. If the shape collide with an edge of the triangle for instance,
 /// the computed contact normal from this triangle edge is not necessarily in the direction of the surface
-/// normal of the mesh at this point. The idea to solve this problem is to use the real (smooth) surface
-/// normal of the mesh at this point as the contact normal. This technique is described in the chapter 5
-/// of the Game Physics Pearl book by Gino van der Bergen and Dirk Gregorius. The vertices normals of the
-/// mesh are either provided by the user or precomputed if the user did not provide them. Note that we only
-/// use the interpolated normal if the contact point is on an edge of the triangle. If the contact is in the
-/// middle of the triangle, we return the true triangle normal.
-RP3D_FORCE_INLINE Vector3 TriangleShape::computeSmoothLocalContactNormalForTriangle(const Vector3& localContactPoint) const {
-
-    assert(mNormal.length() > decimal(0.0));
-
-    // Compute the barycentric coordinates of the point in the triangle
-    decimal u, v, w;
-    computeBarycentricCoordinatesInTriangle(mPoints[0], mPoints[1], mPoints[2], localContactPoint, u, v, w);
-
-    // If the contact is in the middle of the triangle face (not on the edges)
-    if (u > MACHINE_EPSILON && v > MACHINE_EPSILON && w > MACHINE_EPSILON) {
-
-        // We return the true triangle face normal (not the interpolated one)
-        return mNormal;
-    }
-
-    // We compute the contact normal as the barycentric interpolation of the three vertices normals
-    const Vector3 interpolatedNormal = u * mVerticesNormals[0] + v * mVerticesNormals[1] + w * mVerticesNormals[2];
-
-    // If the interpolated normal is degenerated
-    if (interpolatedNormal.lengthSquare() < MACHINE_EPSILON) {
-
-        // Return the original normal
-        return mNormal;
-    }
-
-    return interpolatedNormal.getUnit();
+/// normal of the mesh at this point. The convex edges of the mesh are precomputed (see ConcaveMeshShape)
+/// so that we only need to look at the barycentric coordinates (u, v, w) of the point. If the point is in
+/// the middle of the triangle or on edges that are not convex edges of the mesh, the triangle face normal
+/// is the contact normal. Otherwise, the contact is on a real convex edge or vertex of the mesh and the
+/// contact normal computed by the narrow-phase algorithm is kept.
+/// Bit i of convexEdges is set if the edge between the vertices i and (i+1) % 3 is a convex edge.
+RP3D_FORCE_INLINE bool TriangleShape::isFaceContactNormalAtPoint(decimal u, decimal v, decimal w, uint8 convexEdges) {
+
+    return !((w <= MACHINE_EPSILON && (convexEdges & 1) != 0) ||
+             (u <= MACHINE_EPSILON && (convexEdges & 2) != 0) ||
+             (v <= MACHINE_EPSILON && (convexEdges & 4) != 0));
 }
 
 // This method compute the smooth mesh contact with a triangle in case one of the two collision
-// shapes is a triangle. The idea in this case is to use a smooth vertex normal of the triangle mesh
-// at the contact point instead of the triangle normal to avoid the internal edge collision issue.
+// shapes is a triangle. The idea in this case is to use the triangle face normal instead of the
+// computed contact normal on the internal edges of the mesh to avoid the internal edge collision issue.
 // This method will return the new smooth world contact
 // normal of the triangle and the the local contact point on the other shape.
 RP3D_FORCE_INLINE void TriangleShape::computeSmoothTriangleMeshContact(const CollisionShape* shape1, const CollisionShape* shape2,
@@ -76,16 +76,22 @@ class ColliderComponents : public Components {
 
         /// Array of bits used to define the collision category of this shape.
         /// You can set a single bit to one to define a category value for this
-        /// shape. This value is one (0x0001) by default. This variable can be used
+        /// shape. This value is one (0x1) by default. This variable can be used
         /// together with the mCollideWithMaskBits variable so that given
         /// categories of shapes collide with each other and do not collide with
         /// other categories.
-        unsigned short* mCollisionCategoryBits;
+        uint64* mCollisionCategoryBits;
 
         /// Array of bits mask used to state which collision categories this shape can
-        /// collide with. This value is 0xFFFF by default. It means that this
+        /// collide with. This value is 0xFFFFFFFFFFFFFFFF by default. It means that this
         /// collider will collide with every collision categories by default.
-        unsigned short* mCollideWithMaskBits;
+        uint64* mCollideWithMaskBits;
+
+        /// Array with the collision group of each collider. Two colliders with the same
+        /// positive group always collide and two colliders with the same negative group
+        /// never collide (whatever their category and mask bits). The group zero (default)
+        /// means that the collider does not belong to any group.
+        int32* mCollisionGroups;
 
         /// Array with the local-to-world transforms of the colliders
         Transform* mLocalToWorldTransforms;
@@ -128,15 +134,15 @@ class ColliderComponents : public Components {
             AABB localBounds;
             const Transform& localToBodyTransform;
             CollisionShape* collisionShape;
-            unsigned short collisionCategoryBits;
-            unsigned short collideWithMaskBits;
+            uint64 collisionCategoryBits;
+            uint64 collideWithMaskBits;
             const Transform& localToWorldTransform;
             const Material& material;
 
             /// Constructor
             ColliderComponent(Entity bodyEntity, Collider* collider, AABB localBounds, const Transform& localToBodyTransform,
-                                CollisionShape* collisionShape, unsigned short collisionCategoryBits,
-                                unsigned short collideWithMaskBits, const Transform& localToWorldTransform, const Material& material)
+                                CollisionShape* collisionShape, uint64 collisionCategoryBits,
+                                uint64 collideWithMaskBits, const Transform& localToWorldTransform, const Material& material)
                  :bodyEntity(bodyEntity), collider(collider), localBounds(localBounds), localToBodyTransform(localToBodyTransform),
                   collisionShape(collisionShape), collisionCategoryBits(collisionCategoryBits), collideWithMaskBits(collideWithMaskBits),
                   localToWorldTransform(localToWorldTransform), material(material) {
@@ -177,16 +183,25 @@ class ColliderComponents : public Components {
         void setBroadPhaseId(Entity colliderEntity, int32 broadPhaseId);
 
         /// Return the collision category bits of a given collider
-        unsigned short getCollisionCategoryBits(Entity colliderEntity) const;
+        uint64 getCollisionCategoryBits(Entity colliderEntity) const;
 
         /// Set the collision category bits of a given collider
-        void setCollisionCategoryBits(Entity colliderEntity, unsigned short collisionCategoryBits);
+        void setCollisionCategoryBits(Entity colliderEntity, uint64 collisionCategoryBits);
 
         /// Return the "collide with" mask bits of a given collider
-        unsigned short getCollideWithMaskBits(Entity colliderEntity) const;
+        uint64 getCollideWithMaskBits(Entity colliderEntity) const;
 
         /// Set the "collide with" mask bits of a given collider
-        void setCollideWithMaskBits(Entity colliderEntity, unsigned short collideWithMaskBits);
+        void setCollideWithMaskBits(Entity colliderEntity, uint64 collideWithMaskBits);
+
+        /// Return the collision group of a given collider
+        int32 getCollisionGroup(Entity colliderEntity) const;
+
+        /// Set the collision group of a given collider
+        void setCollisionGroup(Entity colliderEntity, int32 collisionGroup);
+
+        /// Return true if the collision filtering allows two colliders to collide
+        bool canCollide(uint32 collider1Index, uint32 collider2Index) const;
 
         /// Return the local-to-world transform of a collider
         const Transform& getLocalToWorldTransform(Entity colliderEntity) const;
@@ -222,6 +237,7 @@ class ColliderComponents : public Components {
         friend class ContactSolverSystem;
         friend class DynamicsSystem;
         friend class OverlappingPairs;
+        friend class PhysicsWorld;
         friend class RigidBody;
 };
 
@@ -282,7 +298,7 @@ RP3D_FORCE_INLINE void ColliderComponents::setBroadPhaseId(Entity colliderEntity
 }
 
 // Return the collision category bits of a given collider
-RP3D_FORCE_INLINE unsigned short ColliderComponents::getCollisionCategoryBits(Entity colliderEntity) const {
+RP3D_FORCE_INLINE uint64 ColliderComponents::getCollisionCategoryBits(Entity colliderEntity) const {
 
     assert(mMapEntityToComponentIndex.containsKey(colliderEntity));
 
@@ -290,7 +306,7 @@ RP3D_FORCE_INLINE unsigned short ColliderComponents::getCollisionCategoryBits(En
 }
 
 // Return the "collide with" mask bits of a given collider
-RP3D_FORCE_INLINE unsigned short ColliderComponents::getCollideWithMaskBits(Entity colliderEntity) const {
+RP3D_FORCE_INLINE uint64 ColliderComponents::getCollideWithMaskBits(Entity colliderEntity) const {
 
     assert(mMapEntityToComponentIndex.containsKey(colliderEntity));
 
@@ -298,7 +314,7 @@ RP3D_FORCE_INLINE unsigned short ColliderComponents::getCollideWithMaskBits(Enti
 }
 
 // Set the collision category bits of a given collider
-RP3D_FORCE_INLINE void ColliderComponents::setCollisionCategoryBits(Entity colliderEntity, unsigned short collisionCategoryBits) {
+RP3D_FORCE_INLINE void ColliderComponents::setCollisionCategoryBits(Entity colliderEntity, uint64 collisionCategoryBits) {
 
     assert(mMapEntityToComponentIndex.containsKey(colliderEntity));
 
@@ -306,13 +322,47 @@ RP3D_FORCE_INLINE void ColliderComponents::setCollisionCategoryBits(Entity colli
 }
 
 // Set the "collide with" mask bits of a given collider
-RP3D_FORCE_INLINE void ColliderComponents::setCollideWithMaskBits(Entity colliderEntity, unsigned short collideWithMaskBits) {
+RP3D_FORCE_INLINE void ColliderComponents::setCollideWithMaskBits(Entity colliderEntity, uint64 collideWithMaskBits) {
 
     assert(mMapEntityToComponentIndex.containsKey(colliderEntity));
 
     mCollideWithMaskBits[mMapEntityToComponentIndex[colliderEntity]] = collideWithMaskBits;
 }
 
+// Return the collision group of a given collider
+RP3D_FORCE_INLINE int32 ColliderComponents::getCollisionGroup(Entity colliderEntity) const {
+
+    assert(mMapEntityToComponentIndex.containsKey(colliderEntity));
+
+    return mCollisionGroups[mMapEntityToComponentIndex[colliderEntity]];
+}
+
+// Set the collision group of a given collider
+RP3D_FORCE_INLINE void ColliderComponents::setCollisionGroup(Entity colliderEntity, int32 collisionGroup) {
+
+    assert(mMapEntityToComponentIndex.containsKey(colliderEntity));
+
+    mCollisionGroups[mMapEntityToComponentIndex[colliderEntity]] = collisionGroup;
+}
+
+// Return true if the collision filtering allows two colliders to collide
+/// Two colliders with the same non-zero collision group always collide if the group is positive and
+/// never collide if it is negative. Otherwise, the category bits of each collider must be part of the
+/// "collide with" mask bits of the other one. This test only uses the component arrays (no hashing)
+RP3D_FORCE_INLINE bool ColliderComponents::canCollide(uint32 collider1Index, uint32 collider2Index) const {
+
+    assert(collider1Index < mNbComponents);
+    assert(collider2Index < mNbComponents);
+
+    const int32 collisionGroup1 = mCollisionGroups[collider1Index];
+    if (collisionGroup1 != 0 && collisionGroup1 == mCollisionGroups[collider2Index]) {
+        return collisionGroup1 > 0;
+    }
+
+    return (mCollideWithMaskBits[collider1Index] & mCollisionCategoryBits[collider2Index]) != 0 &&
+           (mCollisionCategoryBits[collider1Index] & mCollideWithMaskBits[collider2Index]) != 0;
+}
+
 // Return the local-to-world transform of a collider
 RP3D_FORCE_INLINE const Transform& ColliderComponents::getLocalToWorldTransform(Entity colliderEntity) const {
 
@@ -58,6 +58,12 @@ class FixedJointComponents : public Components {
         /// Array of pointers to the joints
         FixedJoint** mJoints;
 
+        /// Index of body 1 in the solver bodies of the current step
+        uint32* mSolverBodyIndexBody1;
+
+        /// Index of body 2 in the solver bodies of the current step
+        uint32* mSolverBodyIndexBody2;
+
         /// Anchor point of body 1 (in local-space coordinates of body 1)
         Vector3* mLocalAnchorPointBody1;
 
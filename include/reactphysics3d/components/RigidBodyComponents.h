@@ -145,6 +145,9 @@ class RigidBodyComponents : public Components {
         /// Array with the boolean value to know if the body has already been added into an island
         bool* mIsAlreadyInIsland;
 
+        /// True if the motion of the body is clamped against static geometry to avoid tunneling
+        bool* mIsContinuousCollisionDetectionEnabled;
+
         /// For each body, the array of joints entities the body is part of
         Array<Entity>* mJoints;
 
@@ -318,6 +321,9 @@ class RigidBodyComponents : public Components {
         /// Return true if the entity is already in an island
         bool getIsAlreadyInIsland(Entity bodyEntity) const;
 
+        /// Return true if continuous collision detection is enabled for this entity
+        bool getIsContinuousCollisionDetectionEnabled(Entity bodyEntity) const;
+
         /// Return the lock translation factor
         const Vector3& getLinearLockAxisFactor(Entity bodyEntity) const;
 
@@ -354,6 +360,9 @@ class RigidBodyComponents : public Components {
         /// Set the value to know if the entity is already in an island
         void setIsAlreadyInIsland(Entity bodyEntity, bool isAlreadyInIsland);
 
+        /// Set the value to know if continuous collision detection is enabled for this entity
+        void setIsContinuousCollisionDetectionEnabled(Entity bodyEntity, bool isEnabled);
+
         /// Set the linear lock axis factor
         void setLinearLockAxisFactor(Entity bodyEntity, const Vector3& linearLockAxisFactor);
 
@@ -382,6 +391,7 @@ class RigidBodyComponents : public Components {
         friend class SolveHingeJointSystem;
         friend class SolveSliderJointSystem;
         friend class DynamicsSystem;
+        friend struct SolverBodies;
         friend class BallAndSocketJoint;
         friend class FixedJoint;
         friend class HingeJoint;
@@ -772,6 +782,14 @@ RP3D_FORCE_INLINE bool RigidBodyComponents::getIsAlreadyInIsland(Entity bodyEnti
    return mIsAlreadyInIsland[mMapEntityToComponentIndex[bodyEntity]];
 }
 
+// Return true if continuous collision detection is enabled for this entity
+RP3D_FORCE_INLINE bool RigidBodyComponents::getIsContinuousCollisionDetectionEnabled(Entity bodyEntity) const {
+
+   assert(mMapEntityToComponentIndex.containsKey(bodyEntity));
+
+   return mIsContinuousCollisionDetectionEnabled[mMapEntityToComponentIndex[bodyEntity]];
+}
+
 
 // Return the linear lock axis factor
 RP3D_FORCE_INLINE const Vector3& RigidBodyComponents::getLinearLockAxisFactor(Entity bodyEntity) const {
@@ -804,6 +822,14 @@ RP3D_FORCE_INLINE void RigidBodyComponents::setIsAlreadyInIsland(Entity bodyEnti
    mIsAlreadyInIsland[mMapEntityToComponentIndex[bodyEntity]] = isAlreadyInIsland;
 }
 
+// Set the value to know if continuous collision detection is enabled for this entity
+RP3D_FORCE_INLINE void RigidBodyComponents::setIsContinuousCollisionDetectionEnabled(Entity bodyEntity, bool isEnabled) {
+
+   assert(mMapEntityToComponentIndex.containsKey(bodyEntity));
+
+   mIsContinuousCollisionDetectionEnabled[mMapEntityToComponentIndex[bodyEntity]] = isEnabled;
+}
+
 // Set the linear lock axis factor
 RP3D_FORCE_INLINE void RigidBodyComponents::setLinearLockAxisFactor(Entity bodyEntity, const Vector3& linearLockAxisFactor) {
 
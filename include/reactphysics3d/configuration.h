@@ -123,12 +123,33 @@ constexpr uint8 NB_MAX_CONTACT_MANIFOLDS = 3;
 /// Maximum number of potential contact manifolds in an overlapping pair
 constexpr uint8 NB_MAX_POTENTIAL_CONTACT_MANIFOLDS = 4 * NB_MAX_CONTACT_MANIFOLDS;
 
-/// Maximum number of contact points in potential contact manifold
-constexpr uint16 NB_MAX_CONTACT_POINTS_IN_POTENTIAL_MANIFOLD = 256;
+/// Maximum number of contact points in potential contact manifold (the contact points
+/// of a full potential manifold are reduced before adding new ones)
+constexpr uint16 NB_MAX_CONTACT_POINTS_IN_POTENTIAL_MANIFOLD = 64;
 
 /// Distance threshold to consider that two contact points in a manifold are the same
 constexpr decimal SAME_CONTACT_POINT_DISTANCE_THRESHOLD = decimal(0.01);
 
+/// Maximum margin of the convex shapes that are only described by their support function
+/// (cylinder and cone). The margin of a small shape is a fraction of its dimensions
+constexpr decimal GENERIC_CONVEX_SHAPE_MAX_MARGIN = decimal(0.04);
+
+/// Distance under which the continuous collision detection considers that a moving collider
+/// hits a static collider (end of the conservative advancement)
+constexpr decimal CCD_DISTANCE_TOLERANCE = decimal(0.001);
+
+/// Penetration depth at which a body is stopped by the continuous collision detection so that
+/// the discrete collision detection creates a contact at the next step
+constexpr decimal CCD_PENETRATION_DEPTH = decimal(0.005);
+
+/// Number of lanes of a contact batch in the contact solver. The contact manifolds of a batch
+/// do not share any dynamic body and are solved side by side, one manifold per lane
+#if defined(IS_RP3D_DOUBLE_PRECISION_ENABLED)
+constexpr uint8 NB_CONTACT_SOLVER_LANES = 4;
+#else
+constexpr uint8 NB_CONTACT_SOLVER_LANES = 8;
+#endif
+
 /// Current version of ReactPhysics3D
 const std::string RP3D_VERSION = std::string("0.9.0");
 
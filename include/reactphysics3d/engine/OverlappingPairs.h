@@ -83,11 +83,18 @@ struct LastFrameCollisionInfo {
     uint8 satMinEdge1Index;
     uint8 satMinEdge2Index;
 
+    /// Difference between the penetration depth along the closest competing axis and the
+    /// penetration depth along the minimum axis when the full SAT test was last run
+    decimal satMinAxisPenetrationMargin;
+
+    /// Transform from polyhedron 1 to polyhedron 2 when the full SAT test was last run
+    Transform satReferenceTransform;
+
     /// Constructor
     LastFrameCollisionInfo()
         :isValid(false), isObsolete(false), wasColliding(false), wasUsingGJK(false), gjkSeparatingAxis(Vector3(0, 1, 0)),
          satIsAxisFacePolyhedron1(false), satIsAxisFacePolyhedron2(false), satMinAxisFaceIndex(0),
-         satMinEdge1Index(0), satMinEdge2Index(0) {
+         satMinEdge1Index(0), satMinEdge2Index(0), satMinAxisPenetrationMargin(0) {
 
     }
 };
@@ -135,12 +142,17 @@ class OverlappingPairs {
             /// True if the colliders of the overlapping pair are colliding in the current frame
             bool collidingInCurrentFrame;
 
+            /// Index of the contact pair of this overlapping pair in the array of contact pairs of the last frame
+            /// where the colliders were colliding. This index is only valid if the contact pair at this index
+            /// has the same pair id as this overlapping pair
+            uint32 contactPairIndex;
+
             /// Constructor
             OverlappingPair(uint64 pairId, int32 broadPhaseId1, int32 broadPhaseId2, Entity collider1, Entity collider2,
                             NarrowPhaseAlgorithmType narrowPhaseAlgorithmType)
                : pairID(pairId), broadPhaseId1(broadPhaseId1), broadPhaseId2(broadPhaseId2), collider1(collider1) , collider2(collider2),
                  needToTestOverlap(false), narrowPhaseAlgorithmType(narrowPhaseAlgorithmType), collidingInPreviousFrame(false),
-                 collidingInCurrentFrame(false) {
+                 collidingInCurrentFrame(false), contactPairIndex(0) {
 
             }
 
@@ -157,10 +169,21 @@ class OverlappingPairs {
             /// we might have collision data for several overlapping triangles.
             LastFrameCollisionInfo lastFrameCollisionInfo;
 
+            /// True if the contact manifold persistence data below are valid
+            bool isPersistenceDataValid;
+
+            /// Relative transform (from collider 2 local-space to collider 1 local-space)
+            /// the last time the narrow-phase has been computed for this pair
+            Transform narrowPhaseRelativeTransform;
+
+            /// Orientation of collider 1 when the contacts of the previous frame have been created
+            Quaternion previousContactsOrientation1;
+
             /// Constructor
             ConvexOverlappingPair(uint64 pairId, int32 broadPhaseId1, int32 broadPhaseId2, Entity collider1, Entity collider2,
                             NarrowPhaseAlgorithmType narrowPhaseAlgorithmType)
-              : OverlappingPair(pairId, broadPhaseId1, broadPhaseId2, collider1, collider2, narrowPhaseAlgorithmType) {
+              : OverlappingPair(pairId, broadPhaseId1, broadPhaseId2, collider1, collider2, narrowPhaseAlgorithmType),
+                isPersistenceDataValid(false) {
 
             }
         };
@@ -32,6 +32,8 @@
 #include <reactphysics3d/collision/shapes/SphereShape.h>
 #include <reactphysics3d/collision/shapes/BoxShape.h>
 #include <reactphysics3d/collision/shapes/CapsuleShape.h>
+#include <reactphysics3d/collision/shapes/CylinderShape.h>
+#include <reactphysics3d/collision/shapes/ConeShape.h>
 #include <reactphysics3d/collision/shapes/HeightFieldShape.h>
 #include <reactphysics3d/collision/shapes/ConvexMeshShape.h>
 #include <reactphysics3d/collision/shapes/ConcaveMeshShape.h>
@@ -68,12 +70,22 @@ class PhysicsCommon {
         /// Set of capsule shapes
         Set<CapsuleShape*> mCapsuleShapes;
 
+        /// Set of cylinder shapes
+        Set<CylinderShape*> mCylinderShapes;
+
+        /// Set of cone shapes
+        Set<ConeShape*> mConeShapes;
+
         /// Set of convex mesh shapes
         Set<ConvexMeshShape*> mConvexMeshShapes;
 
         /// Set of concave mesh shapes
         Set<ConcaveMeshShape*> mConcaveMeshShapes;
 
+        /// Map a triangle mesh or cooked data (with the flag to compress the vertices) to the data
+        /// shared by all the concave mesh shapes created from it
+        Map<Pair<const void*, bool>, ConcaveMeshData*> mConcaveMeshesData;
+
         /// Set of height field shapes
         Set<HeightFieldShape*> mHeightFieldShapes;
 
@@ -118,6 +130,12 @@ class PhysicsCommon {
         /// Delete a capsule collision shape
         void deleteCapsuleShape(CapsuleShape* capsuleShape);
 
+        /// Delete a cylinder collision shape
+        void deleteCylinderShape(CylinderShape* cylinderShape);
+
+        /// Delete a cone collision shape
+        void deleteConeShape(ConeShape* coneShape);
+
         /// Delete a convex mesh shape
         void deleteConvexMeshShape(ConvexMeshShape* convexMeshShape);
 
@@ -127,6 +145,9 @@ class PhysicsCommon {
         /// Delete a concave mesh shape
         void deleteConcaveMeshShape(ConcaveMeshShape* concaveMeshShape);
 
+        /// Create a concave mesh shape using the shared data of a mesh
+        ConcaveMeshShape* createConcaveMeshShapeWithData(ConcaveMeshData* meshData, const Vector3& scaling);
+
         /// Delete a polyhedron mesh
         void deletePolyhedronMesh(PolyhedronMesh* polyhedronMesh);
 
@@ -190,6 +211,18 @@ class PhysicsCommon {
         /// Destroy a capsule collision shape
         void destroyCapsuleShape(CapsuleShape* capsuleShape);
 
+        /// Create and return a cylinder shape
+        CylinderShape* createCylinderShape(decimal radius, decimal height);
+
+        /// Destroy a cylinder collision shape
+        void destroyCylinderShape(CylinderShape* cylinderShape);
+
+        /// Create and return a cone shape
+        ConeShape* createConeShape(decimal radius, decimal height);
+
+        /// Destroy a cone collision shape
+        void destroyConeShape(ConeShape* coneShape);
+
         /// Create and return a convex mesh shape
         ConvexMeshShape* createConvexMeshShape(PolyhedronMesh* polyhedronMesh, const Vector3& scaling = Vector3(1,1,1));
 
@@ -200,13 +233,17 @@ class PhysicsCommon {
         HeightFieldShape* createHeightFieldShape(int nbGridColumns, int nbGridRows, decimal minHeight, decimal maxHeight,
                                                  const void* heightFieldData, HeightFieldShape::HeightDataType dataType,
                                                  int upAxis = 1, decimal integerHeightScale = 1.0f,
-                                                  const Vector3& scaling = Vector3(1,1,1));
+                                                  const Vector3& scaling = Vector3(1,1,1), decimal integerHeightOffset = 0.0f);
 
         /// Destroy a height-field shape
         void destroyHeightFieldShape(HeightFieldShape* heightFieldShape);
 
         /// Create and return a concave mesh shape
-        ConcaveMeshShape* createConcaveMeshShape(TriangleMesh* triangleMesh, const Vector3& scaling = Vector3(1, 1, 1));
+        ConcaveMeshShape* createConcaveMeshShape(TriangleMesh* triangleMesh, const Vector3& scaling = Vector3(1, 1, 1),
+                                                 bool compressVertices = false);
+
+        /// Create and return a concave mesh shape from cooked data
+        ConcaveMeshShape* createConcaveMeshShapeFromCooked(const void* cookedData, size_t cookedDataSize, const Vector3& scaling = Vector3(1, 1, 1));
 
         /// Destroy a concave mesh shape
         void destroyConcaveMeshShape(ConcaveMeshShape* concaveMeshShape);
@@ -214,6 +251,9 @@ class PhysicsCommon {
         /// Create a polyhedron mesh
         PolyhedronMesh* createPolyhedronMesh(PolygonVertexArray* polygonVertexArray);
 
+        /// Create a polyhedron mesh from the convex hull of a cloud of points
+        PolyhedronMesh* createConvexHull(const Vector3* points, uint32 nbPoints, uint32 maxNbVertices = 0);
+
         /// Destroy a polyhedron mesh
         void destroyPolyhedronMesh(PolyhedronMesh* polyhedronMesh);
 
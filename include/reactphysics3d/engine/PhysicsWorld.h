@@ -50,6 +50,7 @@
 #include <reactphysics3d/systems/ContactSolverSystem.h>
 #include <reactphysics3d/systems/DynamicsSystem.h>
 #include <reactphysics3d/engine/Islands.h>
+#include <reactphysics3d/engine/SolverBodies.h>
 #include <reactphysics3d/utils/DebugRenderer.h>
 #include <sstream>
 
@@ -119,6 +120,22 @@ class PhysicsWorld {
             /// than the value bellow, the manifold are considered to be similar.
             decimal cosAngleSimilarContactManifold;
 
+            /// True if the contact manifold of a resting convex pair can be reused from the previous frame
+            /// instead of running the narrow-phase collision detection again for this pair
+            bool isContactManifoldPersistenceEnabled;
+
+            /// Maximum relative displacement (in meters) between two colliders since the last narrow-phase
+            /// of their pair for their contact manifold to be reused
+            decimal contactManifoldPersistenceDistanceThreshold;
+
+            /// Maximum relative rotation angle (in radians) between two colliders since the last narrow-phase
+            /// of their pair for their contact manifold to be reused
+            decimal contactManifoldPersistenceAngleThreshold;
+
+            /// Minimum number of vertices of the largest convex polyhedron of a pair to compute the penetration
+            /// depth with the EPA algorithm instead of the SAT algorithm (zero means that SAT is always used)
+            uint32 minNbPolyhedronVerticesForEPA;
+
             WorldSettings() {
 
                 worldName = "";
@@ -134,6 +151,10 @@ class PhysicsWorld {
                 defaultSleepLinearVelocity = decimal(0.02);
                 defaultSleepAngularVelocity = decimal(3.0) * (PI_RP3D / decimal(180.0));
                 cosAngleSimilarContactManifold = decimal(0.95);
+                isContactManifoldPersistenceEnabled = false;
+                contactManifoldPersistenceDistanceThreshold = decimal(0.005);
+                contactManifoldPersistenceAngleThreshold = decimal(0.5) * (PI_RP3D / decimal(180.0));
+                minNbPolyhedronVerticesForEPA = 0;
             }
 
             ~WorldSettings() = default;
@@ -156,6 +177,10 @@ class PhysicsWorld {
                 ss << "defaultSleepLinearVelocity=" << defaultSleepLinearVelocity << std::endl;
                 ss << "defaultSleepAngularVelocity=" << defaultSleepAngularVelocity << std::endl;
                 ss << "cosAngleSimilarContactManifold=" << cosAngleSimilarContactManifold << std::endl;
+                ss << "isContactManifoldPersistenceEnabled=" << isContactManifoldPersistenceEnabled << std::endl;
+                ss << "contactManifoldPersistenceDistanceThreshold=" << contactManifoldPersistenceDistanceThreshold << std::endl;
+                ss << "contactManifoldPersistenceAngleThreshold=" << contactManifoldPersistenceAngleThreshold << std::endl;
+                ss << "minNbPolyhedronVerticesForEPA=" << minNbPolyhedronVerticesForEPA << std::endl;
 
                 return ss.str();
             }
@@ -236,6 +261,9 @@ class PhysicsWorld {
         /// This array contains the indices of the ContactPairs.
         Array<uint32> mProcessContactPairsOrderIslands;
 
+        /// Compact state of the bodies solved by the velocity solver during the current frame
+        SolverBodies mSolverBodies;
+
         /// Contact solver system
         ContactSolverSystem mContactSolverSystem;
 
@@ -287,6 +315,9 @@ class PhysicsWorld {
         /// Solve the position error correction of the constraints
         void solvePositionCorrection();
 
+        /// Clamp the motion of the fast bodies with continuous collision detection enabled
+        void solveContinuousCollisionDetection();
+
         /// Compute the islands of awake bodies.
         void computeIslands();
 
@@ -319,7 +350,7 @@ class PhysicsWorld {
         CollisionDispatch& getCollisionDispatch();
 
         /// Ray cast method
-        void raycast(const Ray& ray, RaycastCallback* raycastCallback, unsigned short raycastWithCategoryMaskBits = 0xFFFF) const;
+        void raycast(const Ray& ray, RaycastCallback* raycastCallback, uint64 raycastWithCategoryMaskBits = 0xFFFFFFFFFFFFFFFF) const;
 
         /// Return true if two bodies overlap (collide)
         bool testOverlap(CollisionBody* body1, CollisionBody* body2);
@@ -500,7 +531,7 @@ RP3D_FORCE_INLINE CollisionDispatch& PhysicsWorld::getCollisionDispatch() {
  */
 RP3D_FORCE_INLINE void PhysicsWorld::raycast(const Ray& ray,
                                     RaycastCallback* raycastCallback,
-                                    unsigned short raycastWithCategoryMaskBits) const {
+                                    uint64 raycastWithCategoryMaskBits) const {
     mCollisionDetection.raycast(raycastCallback, ray, raycastWithCategoryMaskBits);
 }
 
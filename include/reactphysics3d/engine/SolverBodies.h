@@ -0,0 +1,153 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2022 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef REACTPHYSICS3D_SOLVER_BODIES_H
+#define REACTPHYSICS3D_SOLVER_BODIES_H
+
+// Libraries
+#include <reactphysics3d/configuration.h>
+#include <reactphysics3d/containers/Array.h>
+#include <reactphysics3d/mathematics/mathematics.h>
+
+namespace reactphysics3d {
+
+// Declarations
+struct Islands;
+class RigidBodyComponents;
+
+// Structure SolverBodies
+/**
+ * This class contains a compact copy of the state of the bodies that is read and written by the
+ * velocity solver during a frame. The bodies are stored island after island, so that the contacts
+ * and joints of an island reference bodies that are close to each other in memory. The contact and
+ * joint constraints refer to the bodies with their dense index in those arrays instead of their
+ * index in the rigid body components. The velocities are copied back into the components once
+ * the velocity constraints have been solved.
+ */
+struct SolverBodies {
+
+    private:
+
+        // -------------------- Attributes -------------------- //
+
+        /// Reference to the rigid body components
+        RigidBodyComponents& mRigidBodyComponents;
+
+        /// For each rigid body component, index of the body in the solver bodies (or INVALID_INDEX)
+        Array<uint32> mSolverBodyIndices;
+
+        /// Number of solver bodies in the previous frame
+        uint32 mNbBodiesPreviousFrame;
+
+    public:
+
+        // -------------------- Constants -------------------- //
+
+        /// Index of a rigid body component that is not a solver body
+        static const uint32 INVALID_INDEX;
+
+        // -------------------- Attributes -------------------- //
+
+        /// Index of the rigid body component of each solver body
+        Array<uint32> rigidBodyComponentIndices;
+
+        /// Constrained linear velocity of each solver body
+        Array<Vector3> linearVelocities;
+
+        /// Constrained angular velocity of each solver body
+        Array<Vector3> angularVelocities;
+
+        /// Split linear velocity of each solver body (used for position error correction)
+        Array<Vector3> splitLinearVelocities;
+
+        /// Split angular velocity of each solver body (used for position error correction)
+        Array<Vector3> splitAngularVelocities;
+
+        /// Inverse mass of each solver body
+        Array<decimal> inverseMasses;
+
+        /// Inverse of the world-space inertia tensor of each solver body
+        Array<Matrix3x3> inverseInertiaTensorsWorld;
+
+        /// Linear lock axis factor of each solver body
+        Array<Vector3> linearLockAxisFactors;
+
+        /// Angular lock axis factor of each solver body
+        Array<Vector3> angularLockAxisFactors;
+
+        // -------------------- Methods -------------------- //
+
+        /// Constructor
+        SolverBodies(MemoryAllocator& allocator, RigidBodyComponents& rigidBodyComponents);
+
+        /// Destructor
+        ~SolverBodies() = default;
+
+        /// Assignment operator
+        SolverBodies& operator=(const SolverBodies& solverBodies) = delete;
+
+        /// Copy-constructor
+        SolverBodies(const SolverBodies& solverBodies) = delete;
+
+        /// Return the number of solver bodies
+        uint32 getNbBodies() const;
+
+        /// Return the solver index of the body of a given rigid body component (adding it if necessary)
+        uint32 getSolverBodyIndex(uint32 rigidBodyComponentIndex);
+
+        /// Create the solver bodies of all the bodies of the islands
+        void create(const Islands& islands);
+
+        /// Copy the velocities of the solver bodies back into the rigid body components
+        void storeVelocities();
+
+        /// Clear all the solver bodies
+        void clear();
+
+    private:
+
+        /// Add the body of a rigid body component as a new solver body and return its index
+        uint32 addBody(uint32 rigidBodyComponentIndex);
+};
+
+// Return the number of solver bodies
+RP3D_FORCE_INLINE uint32 SolverBodies::getNbBodies() const {
+    return static_cast<uint32>(rigidBodyComponentIndices.size());
+}
+
+// Return the solver index of the body of a given rigid body component (adding it if necessary)
+/// The bodies of the islands are already in the solver bodies. A body that is not in any island
+/// (for instance a static body of a joint) is added the first time it is requested.
+RP3D_FORCE_INLINE uint32 SolverBodies::getSolverBodyIndex(uint32 rigidBodyComponentIndex) {
+
+    assert(rigidBodyComponentIndex < mSolverBodyIndices.size());
+
+    const uint32 solverBodyIndex = mSolverBodyIndices[rigidBodyComponentIndex];
+    return solverBodyIndex != INVALID_INDEX ? solverBodyIndex : addBody(rigidBodyComponentIndex);
+}
+
+}
+
+#endif
@@ -218,6 +218,76 @@ RP3D_FORCE_INLINE void computeBarycentricCoordinatesInTriangle(const Vector3& a,
     u = decimal(1.0) - v - w;
 }
 
+// Compute the closest point of a triangle to a given point and its barycentric coordinates
+// This method uses the technique described in the book Real-Time Collision Detection by
+// Christer Ericson. The barycentric coordinates (u, v, w) of the closest point are such that
+// closestPoint = u * a + v * b + w * c.
+RP3D_FORCE_INLINE Vector3 computeClosestPointOnTriangle(const Vector3& a, const Vector3& b, const Vector3& c, const Vector3& point,
+                                                       decimal& u, decimal& v, decimal& w) {
+
+    const Vector3 ab = b - a;
+    const Vector3 ac = c - a;
+
+    // Check if the point is in the vertex region outside of A
+    const Vector3 ap = point - a;
+    const decimal d1 = ab.dot(ap);
+    const decimal d2 = ac.dot(ap);
+    if (d1 <= decimal(0.0) && d2 <= decimal(0.0)) {
+        u = decimal(1.0); v = decimal(0.0); w = decimal(0.0);
+        return a;
+    }
+
+    // Check if the point is in the vertex region outside of B
+    const Vector3 bp = point - b;
+    const decimal d3 = ab.dot(bp);
+    const decimal d4 = ac.dot(bp);
+    if (d3 >= decimal(0.0) && d4 <= d3) {
+        u = decimal(0.0); v = decimal(1.0); w = decimal(0.0);
+        return b;
+    }
+
+    // Check if the point is in the edge region of AB
+    const decimal vc = d1 * d4 - d3 * d2;
+    if (vc <= decimal(0.0) && d1 >= decimal(0.0) && d3 <= decimal(0.0)) {
+        const decimal t = d1 / (d1 - d3);
+        u = decimal(1.0) - t; v = t; w = decimal(0.0);
+        return a + t * ab;
+    }
+
+    // Check if the point is in the vertex region outside of C
+    const Vector3 cp = point - c;
+    const decimal d5 = ab.dot(cp);
+    const decimal d6 = ac.dot(cp);
+    if (d6 >= decimal(0.0) && d5 <= d6) {
+        u = decimal(0.0); v = decimal(0.0); w = decimal(1.0);
+        return c;
+    }
+
+    // Check if the point is in the edge region of AC
+    const decimal vb = d5 * d2 - d1 * d6;
+    if (vb <= decimal(0.0) && d2 >= decimal(0.0) && d6 <= decimal(0.0)) {
+        const decimal t = d2 / (d2 - d6);
+        u = decimal(1.0) - t; v = decimal(0.0); w = t;
+        return a + t * ac;
+    }
+
+    // Check if the point is in the edge region of BC
+    const decimal va = d3 * d6 - d5 * d4;
+    if (va <= decimal(0.0) && (d4 - d3) >= decimal(0.0) && (d5 - d6) >= decimal(0.0)) {
+        const decimal t = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+        u = decimal(0.0); v = decimal(1.0) - t; w = t;
+        return b + t * (c - b);
+    }
+
+    // The point is inside the face region
+    const decimal denominator = decimal(1.0) / (va + vb + vc);
+    v = vb * denominator;
+    w = vc * denominator;
+    u = decimal(1.0) - v - w;
+
+    return a + ab * v + ac * w;
+}
+
 // Compute the intersection between a plane and a segment
 // Let the plane define by the equation planeNormal.dot(X) = planeD with X a point on the plane and "planeNormal" the plane normal. This method
 // computes the intersection P between the plane and the segment (segA, segB). The method returns the value "t" such
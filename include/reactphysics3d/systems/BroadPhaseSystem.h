@@ -30,6 +30,7 @@
 #include <reactphysics3d/collision/broadphase/DynamicAABBTree.h>
 #include <reactphysics3d/containers/LinkedList.h>
 #include <reactphysics3d/containers/Set.h>
+#include <reactphysics3d/containers/Map.h>
 #include <reactphysics3d/components/ColliderComponents.h>
 #include <reactphysics3d/components/TransformComponents.h>
 #include <reactphysics3d/components/RigidBodyComponents.h>
@@ -75,17 +76,27 @@ class BroadPhaseRaycastCallback : public DynamicAABBTreeRaycastCallback {
 
         const DynamicAABBTree& mDynamicAABBTree;
 
-        unsigned short mRaycastWithCategoryMaskBits;
+        uint64 mRaycastWithCategoryMaskBits;
 
         RaycastTest& mRaycastTest;
 
+        /// Pointer to the broad-phase system (null when raycasting the colliders tree of a compound body)
+        const BroadPhaseSystem* mBroadPhaseSystem;
+
+        /// True if the raycast test has asked to stop the raycast
+        bool mIsStopped;
+
+        /// Smallest positive hit fraction returned by the raycast test
+        decimal mSmallestHitFraction;
+
     public:
 
         // Constructor
-        BroadPhaseRaycastCallback(const DynamicAABBTree& dynamicAABBTree, unsigned short raycastWithCategoryMaskBits,
-                                  RaycastTest& raycastTest)
+        BroadPhaseRaycastCallback(const DynamicAABBTree& dynamicAABBTree, uint64 raycastWithCategoryMaskBits,
+                                  RaycastTest& raycastTest, const BroadPhaseSystem* broadPhaseSystem = nullptr)
             : mDynamicAABBTree(dynamicAABBTree), mRaycastWithCategoryMaskBits(raycastWithCategoryMaskBits),
-              mRaycastTest(raycastTest) {
+              mRaycastTest(raycastTest), mBroadPhaseSystem(broadPhaseSystem), mIsStopped(false),
+              mSmallestHitFraction(DECIMAL_LARGEST) {
 
         }
 
@@ -104,11 +115,48 @@ class BroadPhaseRaycastCallback : public DynamicAABBTreeRaycastCallback {
  * that have their AABBs overlapping. Only those pairs of bodies will be tested
  * later for collision during the narrow-phase collision detection. A dynamic AABB
  * tree data structure is used for fast broad-phase collision detection.
+ * The colliders of a compound body are not inserted into the dynamic AABB tree of the world
+ * but into a local dynamic AABB tree of the body. The world tree only contains a single node
+ * for the whole compound body. Therefore, the pairs of colliders of the same compound body
+ * are never reported.
  */
 class BroadPhaseSystem {
 
     protected :
 
+        // -------------------- Structures -------------------- //
+
+        /// Broad-phase proxy of a compound body
+        struct CompoundProxy {
+
+            /// Entity of the body
+            Entity bodyEntity;
+
+            /// Dynamic AABB tree with the world-space AABBs of the colliders of the body
+            DynamicAABBTree* collidersTree;
+
+            /// Id of the node of the body in the world dynamic AABB tree (-1 if the body has no collider)
+            int32 worldNodeId;
+
+            /// Number of colliders in the colliders tree
+            uint32 nbColliders;
+        };
+
+        /// Collider of a compound body in the broad-phase
+        struct CompoundChild {
+
+            /// Compound of the collider (null if this compound child is not used)
+            CompoundProxy* compound;
+
+            /// Id of the node of the collider in the colliders tree of the compound
+            int32 nodeId;
+        };
+
+        // -------------------- Constants -------------------- //
+
+        /// Bit set in the broad-phase id of the colliders of compound bodies
+        static const int32 COMPOUND_CHILD_ID_BIT = 1 << 30;
+
         // -------------------- Attributes -------------------- //
 
         /// Dynamic AABB tree
@@ -131,6 +179,21 @@ class BroadPhaseSystem {
         /// Reference to the collision detection object
         CollisionDetectionSystem& mCollisionDetection;
 
+        /// Reference to the memory allocator
+        MemoryAllocator& mAllocator;
+
+        /// Map a compound body entity to its broad-phase proxy
+        Map<Entity, CompoundProxy*> mMapBodyToCompound;
+
+        /// Map the node id of a compound body in the world tree to its broad-phase proxy
+        Map<int32, CompoundProxy*> mMapWorldNodeToCompound;
+
+        /// Colliders of the compound bodies (indexed by their broad-phase id without the compound bit)
+        Array<CompoundChild> mCompoundChildren;
+
+        /// Indices of the unused elements of the mCompoundChildren array
+        Array<uint32> mFreeCompoundChildren;
+
 #ifdef IS_RP3D_PROFILING_ENABLED
 
 		/// Pointer to the profiler
@@ -146,6 +209,23 @@ class BroadPhaseSystem {
         /// Update the broad-phase state of some colliders components
         void updateCollidersComponents(uint32 startIndex, uint32 nbItems);
 
+        /// Add a collider into the colliders tree of a compound body
+        int32 addCompoundChild(CompoundProxy* compound, Collider* collider, const AABB& aabb);
+
+        /// Remove a collider from the colliders tree of its compound body
+        void removeCompoundChild(int32 broadPhaseId);
+
+        /// Update the node of a compound body in the world tree after its colliders tree has changed
+        void updateCompoundWorldNode(CompoundProxy* compound);
+
+        /// Report the overlapping pairs between a collider and the colliders of a compound body
+        void reportCompoundChildrenOverlappingWithCollider(const CompoundProxy* compound, int32 broadPhaseId,
+                                                            Array<int>& overlappingNodes,
+                                                            Array<Pair<int32, int32>>& outOverlappingPairs) const;
+
+        /// Return true if a broad-phase id is the id of a collider of a compound body
+        static bool isCompoundChild(int32 broadPhaseId);
+
     public :
 
         // -------------------- Methods -------------------- //
@@ -155,7 +235,7 @@ class BroadPhaseSystem {
                          TransformComponents& transformComponents, RigidBodyComponents& rigidBodyComponents);
 
         /// Destructor
-        ~BroadPhaseSystem() = default;
+        ~BroadPhaseSystem();
 
         /// Deleted copy-constructor
         BroadPhaseSystem(const BroadPhaseSystem& algorithm) = delete;
@@ -196,7 +276,20 @@ class BroadPhaseSystem {
         const AABB& getFatAABB(int broadPhaseId) const;
 
         /// Ray casting method
-        void raycast(const Ray& ray, RaycastTest& raycastTest, unsigned short raycastWithCategoryMaskBits) const;
+        void raycast(const Ray& ray, RaycastTest& raycastTest, uint64 raycastWithCategoryMaskBits) const;
+
+        /// Report all the colliders with a fat AABB overlapping with a given AABB
+        void reportAllCollidersOverlappingWithAABB(const AABB& aabb, Array<Collider*>& overlappingColliders,
+                                                   MemoryAllocator& allocator) const;
+
+        /// Set whether the colliders of a body are grouped into a single compound node of the world tree
+        void setIsBodyCompound(Entity bodyEntity, bool isCompound);
+
+        /// Return true if the colliders of a body are grouped into a single compound node of the world tree
+        bool isBodyCompound(Entity bodyEntity) const;
+
+        /// Return the colliders tree of the compound body of a given node of the world tree (null if not a compound body)
+        const DynamicAABBTree* getCompoundCollidersTree(int32 worldNodeId) const;
 
 #ifdef IS_RP3D_PROFILING_ENABLED
 
@@ -207,11 +300,36 @@ class BroadPhaseSystem {
 
 };
 
+// Return true if a broad-phase id is the id of a collider of a compound body
+RP3D_FORCE_INLINE bool BroadPhaseSystem::isCompoundChild(int32 broadPhaseId) {
+    return (broadPhaseId & COMPOUND_CHILD_ID_BIT) != 0;
+}
+
 // Return the fat AABB of a given broad-phase shape
 RP3D_FORCE_INLINE const AABB& BroadPhaseSystem::getFatAABB(int broadPhaseId) const  {
+
+    if (isCompoundChild(broadPhaseId)) {
+        const CompoundChild& child = mCompoundChildren[broadPhaseId & ~COMPOUND_CHILD_ID_BIT];
+        return child.compound->collidersTree->getFatAABB(child.nodeId);
+    }
+
     return mDynamicAABBTree.getFatAABB(broadPhaseId);
 }
 
+// Return true if the colliders of a body are grouped into a single compound node of the world tree
+RP3D_FORCE_INLINE bool BroadPhaseSystem::isBodyCompound(Entity bodyEntity) const {
+    return mMapBodyToCompound.containsKey(bodyEntity);
+}
+
+// Return the colliders tree of the compound body of a given node of the world tree (null if not a compound body)
+RP3D_FORCE_INLINE const DynamicAABBTree* BroadPhaseSystem::getCompoundCollidersTree(int32 worldNodeId) const {
+
+    if (mMapWorldNodeToCompound.size() == 0) return nullptr;
+
+    auto it = mMapWorldNodeToCompound.find(worldNodeId);
+    return it != mMapWorldNodeToCompound.end() ? it->second->collidersTree : nullptr;
+}
+
 // Remove a collider from the array of colliders that have moved in the last simulation step
 // and that need to be tested again for broad-phase overlapping.
 RP3D_FORCE_INLINE void BroadPhaseSystem::removeMovedCollider(int broadPhaseID) {
@@ -222,6 +340,12 @@ RP3D_FORCE_INLINE void BroadPhaseSystem::removeMovedCollider(int broadPhaseID) {
 
 // Return the collider corresponding to the broad-phase node id in parameter
 RP3D_FORCE_INLINE Collider* BroadPhaseSystem::getColliderForBroadPhaseId(int broadPhaseId) const {
+
+    if (isCompoundChild(broadPhaseId)) {
+        const CompoundChild& child = mCompoundChildren[broadPhaseId & ~COMPOUND_CHILD_ID_BIT];
+        return static_cast<Collider*>(child.compound->collidersTree->getNodeDataPointer(child.nodeId));
+    }
+
     return static_cast<Collider*>(mDynamicAABBTree.getNodeDataPointer(broadPhaseId));
 }
 
@@ -231,6 +355,10 @@ RP3D_FORCE_INLINE Collider* BroadPhaseSystem::getColliderForBroadPhaseId(int bro
 RP3D_FORCE_INLINE void BroadPhaseSystem::setProfiler(Profiler* profiler) {
 	mProfiler = profiler;
 	mDynamicAABBTree.setProfiler(profiler);
+
+    for (auto it = mMapBodyToCompound.begin(); it != mMapBodyToCompound.end(); ++it) {
+        it->second->collidersTree->setProfiler(profiler);
+    }
 }
 
 #endif
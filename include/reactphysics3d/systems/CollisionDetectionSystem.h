@@ -132,10 +132,6 @@ class CollisionDetectionSystem {
         /// Array of lost contact pairs (contact pairs in contact in previous frame but not in the current one)
         Array<ContactPair> mLostContactPairs;
 
-        /// Pointer to the map of overlappingPairId to the index of contact pair of the previous frame
-        /// (either mMapPairIdToContactPairIndex1 or mMapPairIdToContactPairIndex2)
-        Map<uint64, uint> mPreviousMapPairIdToContactPairIndex;
-
         /// First array with the contact manifolds
         Array<ContactManifold> mContactManifolds1;
 
@@ -163,6 +159,21 @@ class CollisionDetectionSystem {
         /// Array with the indices of all the contact pairs that have at least one CollisionBody
         Array<uint32> mCollisionBodyContactPairsIndices;
 
+        /// Array with the indices of the potential contact manifolds reused from the previous frame
+        Array<uint32> mPersistentPotentialContactManifoldsIndices;
+
+        /// Array with the overlapping pairs of the potential contact manifolds reused from the previous frame
+        Array<OverlappingPairs::ConvexOverlappingPair*> mPersistentOverlappingPairs;
+
+        /// Shape ids of the triangles overlapping with the convex shape of a convex vs concave pair (reused for each pair)
+        Array<uint32> mOverlappingTrianglesShapeIds;
+
+        /// Vertices of the triangles overlapping with the convex shape of a convex vs concave pair (reused for each pair)
+        Array<Vector3> mOverlappingTrianglesVertices;
+
+        /// Convex edges flags of the triangles overlapping with the convex shape of a convex vs concave pair (reused for each pair)
+        Array<uint8> mOverlappingTrianglesConvexEdges;
+
         /// Number of potential contact manifolds in the previous frame
         uint32 mNbPreviousPotentialContactManifolds;
 
@@ -185,7 +196,14 @@ class CollisionDetectionSystem {
         void computeBroadPhase();
 
         /// Compute the middle-phase collision detection
-        void computeMiddlePhase(NarrowPhaseInput& narrowPhaseInput, bool needToReportContacts);
+        void computeMiddlePhase(NarrowPhaseInput& narrowPhaseInput, bool needToReportContacts, bool reusePreviousContacts = false);
+
+        /// Try to reuse the contacts of the previous frame for a convex pair instead of computing its narrow-phase
+        bool reusePreviousFrameContacts(OverlappingPairs::ConvexOverlappingPair& overlappingPair, const Transform& shape1ToWorldTransform,
+                                        const Transform& shape2ToWorldTransform, decimal minCosHalfAngle);
+
+        /// Add the contact pairs of the overlapping pairs that have reused their contacts from the previous frame
+        void addPersistentContactPairs(Array<ContactPair>* contactPairs);
 
         // Compute the middle-phase collision detection
         void computeMiddlePhaseCollisionSnapshot(Array<uint64>& convexPairs, Array<uint64>& concavePairs, NarrowPhaseInput& narrowPhaseInput,
@@ -228,12 +246,12 @@ class CollisionDetectionSystem {
 
         /// Convert the potential contact into actual contacts
         void processPotentialContacts(NarrowPhaseInfoBatch& narrowPhaseInfoBatch,
-                                      bool updateLastFrameInfo, Array<ContactPointInfo>& potentialContactPoints,
-                                      Array<ContactManifoldInfo>& potentialContactManifolds,
-                                      Map<uint64, uint>& mapPairIdToContactPairIndex, Array<ContactPair>* contactPairs);
+                                      bool updateLastFrameInfo, bool linkContactPairs, Array<ContactPointInfo>& potentialContactPoints,
+                                      Array<ContactManifoldInfo>& potentialContactManifolds, Array<ContactPair>* contactPairs);
 
         /// Process the potential contacts after narrow-phase collision detection
-        void processAllPotentialContacts(NarrowPhaseInput& narrowPhaseInput, bool updateLastFrameInfo, Array<ContactPointInfo>& potentialContactPoints,
+        void processAllPotentialContacts(NarrowPhaseInput& narrowPhaseInput, bool updateLastFrameInfo, bool linkContactPairs,
+                                         Array<ContactPointInfo>& potentialContactPoints,
                                          Array<ContactManifoldInfo>& potentialContactManifolds, Array<ContactPair>* contactPairs);
 
         /// Reduce the potential contact manifolds and contact points of the overlapping pair contacts
@@ -246,8 +264,8 @@ class CollisionDetectionSystem {
         /// Add the contact pairs to the corresponding bodies
         void addContactPairsToBodies();
 
-        /// Compute the map from contact pairs ids to contact pair for the next frame
-        void computeMapPreviousContactPairs();
+        /// Link a new contact pair of the current frame with the contact pair of the previous frame of its overlapping pair
+        void linkContactPairWithPreviousOne(OverlappingPairs::OverlappingPair& overlappingPair, ContactPair& contactPair);
 
         /// Compute the lost contact pairs (contact pairs in contact in the previous frame but not in the current one)
         void computeLostContactPairs();
@@ -288,8 +306,9 @@ class CollisionDetectionSystem {
         /// Filter the overlapping pairs to keep only the pairs where two given bodies are involved
         void filterOverlappingPairs(Entity body1Entity, Entity body2Entity, Array<uint64>& convexPairs, Array<uint64>& concavePairs) const;
 
-        /// Remove an element in an array (and replace it by the last one in the array)
-        void removeItemAtInArray(uint array[], uint8 index, uint8& arraySize) const;
+        /// Compute the signed areas of the triangles made by an edge and each point of a structure of arrays
+        static void computeTriangleAreas(const Vector3& a, const Vector3& b, const Vector3& normal, const decimal pointsX[],
+                                         const decimal pointsY[], const decimal pointsZ[], uint32 nbPoints, decimal outAreas[]);
 
         /// Remove the duplicated contact points in a given contact manifold
         void removeDuplicatedContactPointsInManifold(ContactManifoldInfo& manifold, const Array<ContactPointInfo>& potentialContactPoints) const;
@@ -336,6 +355,12 @@ class CollisionDetectionSystem {
         /// Ask for a collision shape to be tested again during broad-phase.
         void askForBroadPhaseCollisionCheck(Collider* collider);
 
+        /// Set whether the colliders of a body are grouped into a single compound node of the broad-phase
+        void setIsBodyCompound(Entity bodyEntity, bool isCompound);
+
+        /// Return true if the colliders of a body are grouped into a single compound node of the broad-phase
+        bool isBodyCompound(Entity bodyEntity) const;
+
         /// Notify that the overlapping pairs where a given collider is involved need to be tested for overlap
         void notifyOverlappingPairsToTestOverlap(Collider* collider);
 
@@ -347,7 +372,12 @@ class CollisionDetectionSystem {
 
         /// Ray casting method
         void raycast(RaycastCallback* raycastCallback, const Ray& ray,
-                     unsigned short raycastWithCategoryMaskBits) const;
+                     uint64 raycastWithCategoryMaskBits) const;
+
+        /// Compute the time of impact of a moving collider against the colliders of the static bodies
+        bool computeTimeOfImpactWithStaticColliders(Entity colliderEntity, const Transform& colliderStartToWorld,
+                                                    const Vector3& translation, decimal& inOutTimeOfImpact,
+                                                    Vector3& outNormal);
 
         /// Return true if two bodies (collide) overlap
         bool testOverlap(CollisionBody* body1, CollisionBody* body2);
@@ -428,6 +458,17 @@ RP3D_FORCE_INLINE void CollisionDetectionSystem::askForBroadPhaseCollisionCheck(
     }
 }
 
+// Set whether the colliders of a body are grouped into a single compound node of the broad-phase
+/// The colliders of the body must not be in the broad-phase when this method is called.
+RP3D_FORCE_INLINE void CollisionDetectionSystem::setIsBodyCompound(Entity bodyEntity, bool isCompound) {
+    mBroadPhaseSystem.setIsBodyCompound(bodyEntity, isCompound);
+}
+
+// Return true if the colliders of a body are grouped into a single compound node of the broad-phase
+RP3D_FORCE_INLINE bool CollisionDetectionSystem::isBodyCompound(Entity bodyEntity) const {
+    return mBroadPhaseSystem.isBodyCompound(bodyEntity);
+}
+
 // Return a pointer to the world
 RP3D_FORCE_INLINE PhysicsWorld* CollisionDetectionSystem::getWorld() {
     return mWorld;
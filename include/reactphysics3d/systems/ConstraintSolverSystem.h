@@ -40,6 +40,7 @@ namespace reactphysics3d {
 class Joint;
 class Island;
 struct Islands;
+struct SolverBodies;
 class Profiler;
 class RigidBodyComponents;
 class JointComponents;
@@ -184,7 +185,8 @@ class ConstraintSolverSystem {
         // -------------------- Methods -------------------- //
 
         /// Constructor
-        ConstraintSolverSystem(PhysicsWorld& world, Islands& islands, RigidBodyComponents& rigidBodyComponents,
+        ConstraintSolverSystem(PhysicsWorld& world, Islands& islands, SolverBodies& solverBodies,
+                               RigidBodyComponents& rigidBodyComponents,
                                TransformComponents& transformComponents,
                                JointComponents& jointComponents,
                                BallAndSocketJointComponents& ballAndSocketJointComponents,
@@ -32,6 +32,7 @@
 #include <reactphysics3d/mathematics/Matrix3x3.h>
 #include <reactphysics3d/containers/Array.h>
 #include <reactphysics3d/engine/Material.h>
+#include <reactphysics3d/collision/ContactManifold.h>
 
 /// ReactPhysics3D namespace
 namespace reactphysics3d {
@@ -44,6 +45,7 @@ class MemoryManager;
 class Profiler;
 class Island;
 struct Islands;
+struct SolverBodies;
 class RigidBody;
 class Collider;
 class PhysicsWorld;
@@ -120,6 +122,13 @@ class ColliderComponents;
  * constraints at the center of the contact manifold, we need two constraints for tangential
  * friction but also another twist friction constraint to prevent spin of the body around the
  * contact manifold center.
+ *
+ * The contact manifolds are packed into batches of NB_CONTACT_SOLVER_LANES manifolds that do
+ * not share any dynamic body. The data of a batch is stored as a structure of arrays with one
+ * lane per manifold and the constraints of all the lanes of a batch are solved together so that
+ * the compiler can use SIMD instructions. A manifold is always packed after the previous manifolds
+ * of its dynamic bodies. Therefore, the constraints of a given body are still solved in the same
+ * order as with a manifold-by-manifold solver.
  */
 class ContactSolverSystem {
 
@@ -179,11 +188,11 @@ class ContactSolverSystem {
             /// Pointer to the external contact manifold
             ContactManifold* externalContactManifold;
 
-            /// Index of body 1 in the dynamics components arrays
-            uint32 rigidBodyComponentIndexBody1;
+            /// Index of body 1 in the solver bodies
+            uint32 solverBodyIndexBody1;
 
-            /// Index of body 2 in the dynamics components arrays
-            uint32 rigidBodyComponentIndexBody2;
+            /// Index of body 2 in the solver bodies
+            uint32 solverBodyIndexBody2;
 
             /// Inverse of the mass of body 1
             decimal massInverseBody1;
@@ -275,6 +284,163 @@ class ContactSolverSystem {
             int8 nbContacts;
         };
 
+        // Structure Vector3Lanes
+        /**
+         * Vectors of the lanes of a contact batch stored component by component
+         */
+        struct Vector3Lanes {
+
+            /// X components of the vectors
+            decimal x[NB_CONTACT_SOLVER_LANES];
+
+            /// Y components of the vectors
+            decimal y[NB_CONTACT_SOLVER_LANES];
+
+            /// Z components of the vectors
+            decimal z[NB_CONTACT_SOLVER_LANES];
+
+            /// Set the vector of a given lane
+            void set(uint32 lane, const Vector3& vector) {
+                x[lane] = vector.x;
+                y[lane] = vector.y;
+                z[lane] = vector.z;
+            }
+        };
+
+        // Structure ContactBatchSolver
+        /**
+         * Contact solver internal data structure that packs up to NB_CONTACT_SOLVER_LANES
+         * contact manifolds into lanes (structure of arrays). The manifolds of a batch
+         * do not share any dynamic body. Therefore, the constraints of all the lanes
+         * can be solved at the same time with the same instructions. The unused lanes
+         * and contact points are filled with zeros so that they produce zero impulses.
+         * The penetration rows are stored with the Jacobian terms already multiplied by the
+         * inverse masses, inverse inertia tensors and lock axis factors of the bodies.
+         */
+        struct ContactBatchSolver {
+
+            /// Index of the contact manifold solver of each lane
+            uint32 contactManifoldIndices[NB_CONTACT_SOLVER_LANES];
+
+            /// Index of the first contact point solver of each lane
+            uint32 contactPointIndices[NB_CONTACT_SOLVER_LANES];
+
+            /// Index of body 1 of each lane in the solver bodies
+            uint32 solverBodyIndexBody1[NB_CONTACT_SOLVER_LANES];
+
+            /// Index of body 2 of each lane in the solver bodies
+            uint32 solverBodyIndexBody2[NB_CONTACT_SOLVER_LANES];
+
+            /// Inverse mass of body 1 multiplied by its linear lock axis factor
+            Vector3Lanes linearFactorBody1;
+
+            /// Inverse mass of body 2 multiplied by its linear lock axis factor
+            Vector3Lanes linearFactorBody2;
+
+            // ---------- Penetration constraints (one row per contact point) ---------- //
+
+            /// Normal vector of the contact points
+            Vector3Lanes normal[ContactManifold::MAX_CONTACT_POINTS_IN_MANIFOLD];
+
+            /// Cross product of r1 with the contact normal
+            Vector3Lanes r1CrossN[ContactManifold::MAX_CONTACT_POINTS_IN_MANIFOLD];
+
+            /// Cross product of r2 with the contact normal
+            Vector3Lanes r2CrossN[ContactManifold::MAX_CONTACT_POINTS_IN_MANIFOLD];
+
+            /// Angular velocity change of body 1 for a unit penetration impulse
+            Vector3Lanes angularPenetrationBody1[ContactManifold::MAX_CONTACT_POINTS_IN_MANIFOLD];
+
+            /// Angular velocity change of body 2 for a unit penetration impulse
+            Vector3Lanes angularPenetrationBody2[ContactManifold::MAX_CONTACT_POINTS_IN_MANIFOLD];
+
+            /// Velocity bias of the penetration constraints
+            decimal velocityBias[ContactManifold::MAX_CONTACT_POINTS_IN_MANIFOLD][NB_CONTACT_SOLVER_LANES];
+
+            /// Bias of the split impulse penetration constraints
+            decimal splitBias[ContactManifold::MAX_CONTACT_POINTS_IN_MANIFOLD][NB_CONTACT_SOLVER_LANES];
+
+            /// Inverse of the matrix K for the penetration
+            decimal inversePenetrationMass[ContactManifold::MAX_CONTACT_POINTS_IN_MANIFOLD][NB_CONTACT_SOLVER_LANES];
+
+            /// Accumulated normal impulse
+            decimal penetrationImpulse[ContactManifold::MAX_CONTACT_POINTS_IN_MANIFOLD][NB_CONTACT_SOLVER_LANES];
+
+            /// Accumulated split impulse for penetration correction
+            decimal penetrationSplitImpulse[ContactManifold::MAX_CONTACT_POINTS_IN_MANIFOLD][NB_CONTACT_SOLVER_LANES];
+
+            // ---------- Friction constraints at the center of the manifolds ---------- //
+
+            /// Average normal vector of the contact manifolds
+            Vector3Lanes manifoldNormal;
+
+            /// First friction direction at contact manifold center
+            Vector3Lanes frictionVector1;
+
+            /// Second friction direction at contact manifold center
+            Vector3Lanes frictionVector2;
+
+            /// Cross product of r1 with 1st friction vector
+            Vector3Lanes r1CrossT1;
+
+            /// Cross product of r1 with 2nd friction vector
+            Vector3Lanes r1CrossT2;
+
+            /// Cross product of r2 with 1st friction vector
+            Vector3Lanes r2CrossT1;
+
+            /// Cross product of r2 with 2nd friction vector
+            Vector3Lanes r2CrossT2;
+
+            /// Angular velocity change of body 1 for a unit impulse along the 1st friction vector
+            Vector3Lanes angularFriction1Body1;
+
+            /// Angular velocity change of body 2 for a unit impulse along the 1st friction vector
+            Vector3Lanes angularFriction1Body2;
+
+            /// Angular velocity change of body 1 for a unit impulse along the 2nd friction vector
+            Vector3Lanes angularFriction2Body1;
+
+            /// Angular velocity change of body 2 for a unit impulse along the 2nd friction vector
+            Vector3Lanes angularFriction2Body2;
+
+            /// Angular velocity change of body 1 for a unit twist friction impulse
+            Vector3Lanes angularTwistBody1;
+
+            /// Angular velocity change of body 2 for a unit twist friction impulse
+            Vector3Lanes angularTwistBody2;
+
+            /// Matrix K for the first friction constraint
+            decimal inverseFriction1Mass[NB_CONTACT_SOLVER_LANES];
+
+            /// Matrix K for the second friction constraint
+            decimal inverseFriction2Mass[NB_CONTACT_SOLVER_LANES];
+
+            /// Matrix K for the twist friction constraint
+            decimal inverseTwistFrictionMass[NB_CONTACT_SOLVER_LANES];
+
+            /// Mix friction coefficient for the two bodies
+            decimal frictionCoefficient[NB_CONTACT_SOLVER_LANES];
+
+            /// First friction direction impulse at manifold center
+            decimal friction1Impulse[NB_CONTACT_SOLVER_LANES];
+
+            /// Second friction direction impulse at manifold center
+            decimal friction2Impulse[NB_CONTACT_SOLVER_LANES];
+
+            /// Twist friction impulse at contact manifold center
+            decimal frictionTwistImpulse[NB_CONTACT_SOLVER_LANES];
+
+            /// Number of contact points of each lane
+            int8 nbContacts[NB_CONTACT_SOLVER_LANES];
+
+            /// Number of used lanes
+            uint8 nbLanes;
+
+            /// Largest number of contact points of the lanes
+            uint8 nbContactSlots;
+        };
+
         // -------------------- Constants --------------------- //
 
         /// Beta value for the penetration depth position correction without split impulses
@@ -286,6 +452,9 @@ class ContactSolverSystem {
         /// Slop distance (allowed penetration distance between bodies)
         static const decimal SLOP;
 
+        /// Maximum number of contact batches searched for a free lane when a contact manifold is packed
+        static const uint32 NB_MAX_SEARCHED_CONTACT_BATCHES;
+
         // -------------------- Attributes -------------------- //
 
         /// Memory manager
@@ -312,9 +481,18 @@ class ContactSolverSystem {
         /// Number of contact constraints
         uint32 mNbContactManifolds;
 
+        /// Contact batches (contact manifolds with disjoint dynamic bodies packed into lanes)
+        ContactBatchSolver* mContactBatches;
+
+        /// Number of contact batches
+        uint32 mNbContactBatches;
+
         /// Reference to the islands
         Islands& mIslands;
 
+        /// Reference to the solver bodies
+        SolverBodies& mSolverBodies;
+
         /// Pointer to the array of contact manifolds from narrow-phase
         Array<ContactManifold>* mAllContactManifolds;
 
@@ -357,13 +535,43 @@ class ContactSolverSystem {
         /// Warm start the solver.
         void warmStart();
 
+        /// Pack the contact constraints into contact batches
+        void createContactBatches();
+
+        /// Copy a contact constraint into a lane of a contact batch
+        void initializeBatchLane(ContactBatchSolver& batch, uint8 lane, uint32 contactManifoldIndex,
+                                 uint32 contactPointIndex, decimal beta);
+
+        /// Gather the velocities of the bodies of the lanes of a contact batch
+        void gatherVelocities(const ContactBatchSolver& batch, const Array<Vector3>& linearVelocities,
+                              const Array<Vector3>& angularVelocities, Vector3Lanes& v1, Vector3Lanes& w1,
+                              Vector3Lanes& v2, Vector3Lanes& w2) const;
+
+        /// Scatter the velocities of the bodies of the lanes of a contact batch
+        void scatterVelocities(const ContactBatchSolver& batch, Array<Vector3>& linearVelocities,
+                               Array<Vector3>& angularVelocities, const Vector3Lanes& v1, const Vector3Lanes& w1,
+                               const Vector3Lanes& v2, const Vector3Lanes& w2) const;
+
+        /// Solve the penetration constraints of a given contact point of all the lanes of a contact batch
+        void solvePenetrationConstraints(const ContactBatchSolver& batch, uint32 contactIndex, const decimal* bias,
+                                         decimal* impulses, Vector3Lanes& v1, Vector3Lanes& w1,
+                                         Vector3Lanes& v2, Vector3Lanes& w2) const;
+
+        /// Solve a friction constraint at the manifold center of all the lanes of a contact batch
+        void solveFrictionConstraints(const ContactBatchSolver& batch, const Vector3Lanes& frictionVector,
+                                      const Vector3Lanes& r1CrossT, const Vector3Lanes& r2CrossT,
+                                      const Vector3Lanes& angularFrictionBody1, const Vector3Lanes& angularFrictionBody2,
+                                      const decimal* inverseFrictionMass, const decimal* frictionLimit,
+                                      decimal* impulses, Vector3Lanes& v1, Vector3Lanes& w1,
+                                      Vector3Lanes& v2, Vector3Lanes& w2) const;
+
    public:
 
         // -------------------- Methods -------------------- //
 
         /// Constructor
-        ContactSolverSystem(MemoryManager& memoryManager, PhysicsWorld& world, Islands& islands, CollisionBodyComponents& bodyComponents,
-                      RigidBodyComponents& rigidBodyComponents, ColliderComponents& colliderComponents, decimal& restitutionVelocityThreshold);
+        ContactSolverSystem(MemoryManager& memoryManager, PhysicsWorld& world, Islands& islands, SolverBodies& solverBodies,
+                      CollisionBodyComponents& bodyComponents, RigidBodyComponents& rigidBodyComponents, ColliderComponents& colliderComponents, decimal& restitutionVelocityThreshold);
 
         /// Destructor
         ~ContactSolverSystem() = default;
@@ -408,6 +616,117 @@ RP3D_FORCE_INLINE void ContactSolverSystem::setIsSplitImpulseActive(bool isActiv
     mIsSplitImpulseActive = isActive;
 }
 
+// Gather the velocities of the bodies of the lanes of a contact batch
+/// The velocities of the unused lanes are set to zero
+RP3D_FORCE_INLINE void ContactSolverSystem::gatherVelocities(const ContactBatchSolver& batch, const Array<Vector3>& linearVelocities,
+                                           const Array<Vector3>& angularVelocities, Vector3Lanes& v1, Vector3Lanes& w1,
+                                           Vector3Lanes& v2, Vector3Lanes& w2) const {
+
+    for (uint32 l=0; l < batch.nbLanes; l++) {
+        v1.set(l, linearVelocities[batch.solverBodyIndexBody1[l]]);
+        w1.set(l, angularVelocities[batch.solverBodyIndexBody1[l]]);
+        v2.set(l, linearVelocities[batch.solverBodyIndexBody2[l]]);
+        w2.set(l, angularVelocities[batch.solverBodyIndexBody2[l]]);
+    }
+    for (uint32 l=batch.nbLanes; l < NB_CONTACT_SOLVER_LANES; l++) {
+        v1.set(l, Vector3::zero());
+        w1.set(l, Vector3::zero());
+        v2.set(l, Vector3::zero());
+        w2.set(l, Vector3::zero());
+    }
+}
+
+// Scatter the velocities of the bodies of the lanes of a contact batch
+RP3D_FORCE_INLINE void ContactSolverSystem::scatterVelocities(const ContactBatchSolver& batch, Array<Vector3>& linearVelocities,
+                                            Array<Vector3>& angularVelocities, const Vector3Lanes& v1, const Vector3Lanes& w1,
+                                            const Vector3Lanes& v2, const Vector3Lanes& w2) const {
+
+    for (uint32 l=0; l < batch.nbLanes; l++) {
+        linearVelocities[batch.solverBodyIndexBody1[l]].setAllValues(v1.x[l], v1.y[l], v1.z[l]);
+        angularVelocities[batch.solverBodyIndexBody1[l]].setAllValues(w1.x[l], w1.y[l], w1.z[l]);
+        linearVelocities[batch.solverBodyIndexBody2[l]].setAllValues(v2.x[l], v2.y[l], v2.z[l]);
+        angularVelocities[batch.solverBodyIndexBody2[l]].setAllValues(w2.x[l], w2.y[l], w2.z[l]);
+    }
+}
+
+// Solve the penetration constraints of a given contact point of all the lanes of a contact batch
+RP3D_FORCE_INLINE void ContactSolverSystem::solvePenetrationConstraints(const ContactBatchSolver& batch, uint32 contactIndex, const decimal* bias,
+                                                      decimal* impulses, Vector3Lanes& v1, Vector3Lanes& w1,
+                                                      Vector3Lanes& v2, Vector3Lanes& w2) const {
+
+    const Vector3Lanes& n = batch.normal[contactIndex];
+    const Vector3Lanes& r1CrossN = batch.r1CrossN[contactIndex];
+    const Vector3Lanes& r2CrossN = batch.r2CrossN[contactIndex];
+    const Vector3Lanes& angular1 = batch.angularPenetrationBody1[contactIndex];
+    const Vector3Lanes& angular2 = batch.angularPenetrationBody2[contactIndex];
+    const decimal* inversePenetrationMass = batch.inversePenetrationMass[contactIndex];
+
+    for (uint32 l=0; l < NB_CONTACT_SOLVER_LANES; l++) {
+
+        // Compute J*v = (v2 + w2.cross(r2) - v1 - w1.cross(r1)).dot(n)
+        const decimal Jv = (v2.x[l] - v1.x[l]) * n.x[l] + (v2.y[l] - v1.y[l]) * n.y[l] + (v2.z[l] - v1.z[l]) * n.z[l] +
+                           w2.x[l] * r2CrossN.x[l] + w2.y[l] * r2CrossN.y[l] + w2.z[l] * r2CrossN.z[l] -
+                           w1.x[l] * r1CrossN.x[l] - w1.y[l] * r1CrossN.y[l] - w1.z[l] * r1CrossN.z[l];
+
+        // Compute the Lagrange multiplier lambda
+        const decimal lambdaTemp = impulses[l];
+        impulses[l] = std::max(lambdaTemp - (Jv + bias[l]) * inversePenetrationMass[l], decimal(0.0));
+        const decimal deltaLambda = impulses[l] - lambdaTemp;
+
+        // Update the velocities of the bodies by applying the impulse P
+        v1.x[l] -= deltaLambda * batch.linearFactorBody1.x[l] * n.x[l];
+        v1.y[l] -= deltaLambda * batch.linearFactorBody1.y[l] * n.y[l];
+        v1.z[l] -= deltaLambda * batch.linearFactorBody1.z[l] * n.z[l];
+        w1.x[l] -= deltaLambda * angular1.x[l];
+        w1.y[l] -= deltaLambda * angular1.y[l];
+        w1.z[l] -= deltaLambda * angular1.z[l];
+        v2.x[l] += deltaLambda * batch.linearFactorBody2.x[l] * n.x[l];
+        v2.y[l] += deltaLambda * batch.linearFactorBody2.y[l] * n.y[l];
+        v2.z[l] += deltaLambda * batch.linearFactorBody2.z[l] * n.z[l];
+        w2.x[l] += deltaLambda * angular2.x[l];
+        w2.y[l] += deltaLambda * angular2.y[l];
+        w2.z[l] += deltaLambda * angular2.z[l];
+    }
+}
+
+// Solve a friction constraint at the manifold center of all the lanes of a contact batch
+RP3D_FORCE_INLINE void ContactSolverSystem::solveFrictionConstraints(const ContactBatchSolver& batch, const Vector3Lanes& frictionVector,
+                                                   const Vector3Lanes& r1CrossT, const Vector3Lanes& r2CrossT,
+                                                   const Vector3Lanes& angularFrictionBody1, const Vector3Lanes& angularFrictionBody2,
+                                                   const decimal* inverseFrictionMass, const decimal* frictionLimit,
+                                                   decimal* impulses, Vector3Lanes& v1, Vector3Lanes& w1,
+                                                   Vector3Lanes& v2, Vector3Lanes& w2) const {
+
+    const Vector3Lanes& t = frictionVector;
+
+    for (uint32 l=0; l < NB_CONTACT_SOLVER_LANES; l++) {
+
+        // Compute J*v = (v2 + w2.cross(r2Friction) - v1 - w1.cross(r1Friction)).dot(t)
+        const decimal Jv = (v2.x[l] - v1.x[l]) * t.x[l] + (v2.y[l] - v1.y[l]) * t.y[l] + (v2.z[l] - v1.z[l]) * t.z[l] +
+                           w2.x[l] * r2CrossT.x[l] + w2.y[l] * r2CrossT.y[l] + w2.z[l] * r2CrossT.z[l] -
+                           w1.x[l] * r1CrossT.x[l] - w1.y[l] * r1CrossT.y[l] - w1.z[l] * r1CrossT.z[l];
+
+        // Compute the Lagrange multiplier lambda
+        const decimal lambdaTemp = impulses[l];
+        impulses[l] = std::max(-frictionLimit[l], std::min(lambdaTemp - Jv * inverseFrictionMass[l], frictionLimit[l]));
+        const decimal deltaLambda = impulses[l] - lambdaTemp;
+
+        // Update the velocities of the bodies by applying the impulse P
+        v1.x[l] -= deltaLambda * batch.linearFactorBody1.x[l] * t.x[l];
+        v1.y[l] -= deltaLambda * batch.linearFactorBody1.y[l] * t.y[l];
+        v1.z[l] -= deltaLambda * batch.linearFactorBody1.z[l] * t.z[l];
+        w1.x[l] -= deltaLambda * angularFrictionBody1.x[l];
+        w1.y[l] -= deltaLambda * angularFrictionBody1.y[l];
+        w1.z[l] -= deltaLambda * angularFrictionBody1.z[l];
+        v2.x[l] += deltaLambda * batch.linearFactorBody2.x[l] * t.x[l];
+        v2.y[l] += deltaLambda * batch.linearFactorBody2.y[l] * t.y[l];
+        v2.z[l] += deltaLambda * batch.linearFactorBody2.z[l] * t.z[l];
+        w2.x[l] += deltaLambda * angularFrictionBody2.x[l];
+        w2.y[l] += deltaLambda * angularFrictionBody2.y[l];
+        w2.z[l] += deltaLambda * angularFrictionBody2.z[l];
+    }
+}
+
 // Compute the collision restitution factor from the restitution factor of each collider
 RP3D_FORCE_INLINE decimal ContactSolverSystem::computeMixedRestitutionFactor(const Material& material1, const Material& material2) const {
 
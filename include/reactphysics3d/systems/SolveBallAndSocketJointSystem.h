@@ -37,6 +37,7 @@ namespace reactphysics3d {
 
 // Forward declarations
 class PhysicsWorld;
+struct SolverBodies;
 
 // Class SolveBallAndSocketJointSystem
 /**
@@ -56,6 +57,9 @@ class SolveBallAndSocketJointSystem {
         /// Physics world
         PhysicsWorld& mWorld;
 
+        /// Reference to the solver bodies
+        SolverBodies& mSolverBodies;
+
         /// Reference to the rigid body components
         RigidBodyComponents& mRigidBodyComponents;
 
@@ -85,7 +89,8 @@ class SolveBallAndSocketJointSystem {
         // -------------------- Methods -------------------- //
 
         /// Constructor
-        SolveBallAndSocketJointSystem(PhysicsWorld& world, RigidBodyComponents& rigidBodyComponents,
+        SolveBallAndSocketJointSystem(PhysicsWorld& world, SolverBodies& solverBodies,
+                                      RigidBodyComponents& rigidBodyComponents,
                                       TransformComponents& transformComponents,
                                       JointComponents& jointComponents,
                                       BallAndSocketJointComponents& ballAndSocketJointComponents);
@@ -36,6 +36,7 @@
 namespace reactphysics3d {
 
 class PhysicsWorld;
+struct SolverBodies;
 
 // Class SolveFixedJointSystem
 /**
@@ -55,6 +56,9 @@ class SolveFixedJointSystem {
         /// Physics world
         PhysicsWorld& mWorld;
 
+        /// Reference to the solver bodies
+        SolverBodies& mSolverBodies;
+
         /// Reference to the rigid body components
         RigidBodyComponents& mRigidBodyComponents;
 
@@ -84,7 +88,8 @@ class SolveFixedJointSystem {
         // -------------------- Methods -------------------- //
 
         /// Constructor
-        SolveFixedJointSystem(PhysicsWorld& world, RigidBodyComponents& rigidBodyComponents, TransformComponents& transformComponents,
+        SolveFixedJointSystem(PhysicsWorld& world, SolverBodies& solverBodies,
+                              RigidBodyComponents& rigidBodyComponents, TransformComponents& transformComponents,
                               JointComponents& jointComponents, FixedJointComponents& fixedJointComponents);
 
         /// Destructor
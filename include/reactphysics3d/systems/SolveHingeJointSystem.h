@@ -36,6 +36,7 @@
 namespace reactphysics3d {
 
 class PhysicsWorld;
+struct SolverBodies;
 
 // Class SolveHingeJointSystem
 /**
@@ -55,6 +56,9 @@ class SolveHingeJointSystem {
         /// Physics world
         PhysicsWorld& mWorld;
 
+        /// Reference to the solver bodies
+        SolverBodies& mSolverBodies;
+
         /// Reference to the rigid body components
         RigidBodyComponents& mRigidBodyComponents;
 
@@ -99,7 +103,8 @@ class SolveHingeJointSystem {
         // -------------------- Methods -------------------- //
 
         /// Constructor
-        SolveHingeJointSystem(PhysicsWorld& world, RigidBodyComponents& rigidBodyComponents,
+        SolveHingeJointSystem(PhysicsWorld& world, SolverBodies& solverBodies,
+                              RigidBodyComponents& rigidBodyComponents,
                               TransformComponents& transformComponents,
                               JointComponents& jointComponents,
                               HingeJointComponents& hingeJointComponents);
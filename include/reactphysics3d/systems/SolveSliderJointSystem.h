@@ -36,6 +36,7 @@
 namespace reactphysics3d {
 
 class PhysicsWorld;
+struct SolverBodies;
 
 // Class SolveSliderJointSystem
 /**
@@ -55,6 +56,9 @@ class SolveSliderJointSystem {
         /// Physics world
         PhysicsWorld& mWorld;
 
+        /// Reference to the solver bodies
+        SolverBodies& mSolverBodies;
+
         /// Reference to the rigid body components
         RigidBodyComponents& mRigidBodyComponents;
 
@@ -86,7 +90,8 @@ class SolveSliderJointSystem {
         // -------------------- Methods -------------------- //
 
         /// Constructor
-        SolveSliderJointSystem(PhysicsWorld& world, RigidBodyComponents& rigidBodyComponents,
+        SolveSliderJointSystem(PhysicsWorld& world, SolverBodies& solverBodies,
+                               RigidBodyComponents& rigidBodyComponents,
                               TransformComponents& transformComponents,
                               JointComponents& jointComponents,
                               SliderJointComponents& sliderJointComponents);
@@ -191,6 +191,12 @@ class DebugRenderer : public EventListener {
 		/// Draw a capsule
 		void drawCapsule(const Transform& transform, decimal radius, decimal height, uint32 color);
 
+		/// Draw a cylinder
+		void drawCylinder(const Transform& transform, decimal radius, decimal height, uint32 color);
+
+		/// Draw a cone
+		void drawCone(const Transform& transform, decimal radius, decimal height, uint32 color);
+
 		/// Draw a convex mesh
 		void drawConvexMesh(const Transform& transform, const ConvexMeshShape* convexMesh, uint32 color);
 
@@ -91,7 +91,7 @@ Collider* CollisionBody::addCollider(CollisionShape* collisionShape, const Trans
     const Transform localToWorldTransform = mWorld.mTransformComponents.getTransform(mEntity) * transform;
     Material material(mWorld.mConfig.defaultFrictionCoefficient, mWorld.mConfig.defaultBounciness);
     ColliderComponents::ColliderComponent colliderComponent(mEntity, collider, AABB(localBoundsMin, localBoundsMax),
-                                                                  transform, collisionShape, 0x0001, 0xFFFF, localToWorldTransform, material);
+                                                                  transform, collisionShape, 0x0001, 0xFFFFFFFFFFFFFFFF, localToWorldTransform, material);
     bool isActive = mWorld.mCollisionBodyComponents.getIsActive(mEntity);
     mWorld.mCollidersComponents.addComponent(colliderEntity, !isActive, colliderComponent);
 
@@ -287,6 +287,60 @@ void CollisionBody::setIsActive(bool isActive) {
              (isActive ? "true" : "false"),  __FILE__, __LINE__);
 }
 
+// Return true if the colliders of the body are grouped into a single node of the broad-phase
+/**
+ * @return True if the body is a compound body
+ */
+bool CollisionBody::isCompound() const {
+    return mWorld.mCollisionDetection.isBodyCompound(mEntity);
+}
+
+// Set whether or not the colliders of the body are grouped into a single node of the broad-phase
+/// The colliders of a compound body are stored in a local dynamic AABB tree of the body and the
+/// dynamic AABB tree of the world only contains a single node for the whole body. This is useful
+/// for a body with many colliders because it makes the world tree smaller and the pairs of colliders
+/// of the body (that can never collide) are not reported by the broad-phase anymore.
+/**
+ * @param isCompound True if the colliders of the body must be grouped into a single broad-phase node
+ */
+void CollisionBody::setIsCompound(bool isCompound) {
+
+    if (isCompound == this->isCompound()) return;
+
+    const Array<Entity>& colliderEntities = mWorld.mCollisionBodyComponents.getColliders(mEntity);
+
+    // Remove the colliders of the body from the broad-phase
+    Array<Collider*> collidersInBroadPhase(mWorld.mMemoryManager.getHeapAllocator());
+    for (uint32 i=0; i < colliderEntities.size(); i++) {
+
+        Collider* collider = mWorld.mCollidersComponents.getCollider(colliderEntities[i]);
+
+        if (collider->getBroadPhaseId() != -1) {
+            collidersInBroadPhase.add(collider);
+            mWorld.mCollisionDetection.removeCollider(collider);
+        }
+    }
+
+    mWorld.mCollisionDetection.setIsBodyCompound(mEntity, isCompound);
+
+    // Add the colliders of the body back into the broad-phase
+    const Transform& transform = mWorld.mTransformComponents.getTransform(mEntity);
+    for (uint32 i=0; i < collidersInBroadPhase.size(); i++) {
+
+        Collider* collider = collidersInBroadPhase[i];
+
+        // Compute the world-space AABB of the collider
+        AABB aabb;
+        collider->getCollisionShape()->computeAABB(aabb, transform * mWorld.mCollidersComponents.getLocalToBodyTransform(collider->getEntity()));
+
+        mWorld.mCollisionDetection.addCollider(collider, aabb);
+    }
+
+    RP3D_LOG(mWorld.mConfig.worldName, Logger::Level::Information, Logger::Category::Body,
+             "Body " + std::to_string(mEntity.id) + ": Set isCompound=" +
+             (isCompound ? "true" : "false"),  __FILE__, __LINE__);
+}
+
 // Ask the broad-phase to test again the collision shapes of the body for collision
 // (as if the body has moved).
 void CollisionBody::askForBroadPhaseCollisionCheck() const {
@@ -672,7 +672,7 @@ Collider* RigidBody::addCollider(CollisionShape* collisionShape, const Transform
     const Transform localToWorldTransform = mWorld.mTransformComponents.getTransform(mEntity) * transform;
     Material material(mWorld.mConfig.defaultFrictionCoefficient, mWorld.mConfig.defaultBounciness);
     ColliderComponents::ColliderComponent colliderComponent(mEntity, collider, AABB(localBoundsMin, localBoundsMax),
-                                                            transform, collisionShape, 0x0001, 0xFFFF, localToWorldTransform, material);
+                                                            transform, collisionShape, 0x0001, 0xFFFFFFFFFFFFFFFF, localToWorldTransform, material);
     bool isSleeping = mWorld.mRigidBodyComponents.getIsSleeping(mEntity);
     mWorld.mCollidersComponents.addComponent(colliderEntity, isSleeping, colliderComponent);
 
@@ -730,6 +730,21 @@ void RigidBody::enableGravity(bool isEnabled) {
              (isEnabled ? "true" : "false"),  __FILE__, __LINE__);
 }
 
+// Set the variable to know if continuous collision detection is enabled for this rigid body
+/// When enabled, if the body moves farther than its smallest half-extent during a step, its
+/// motion is clamped at the first static collider it would hit so that it cannot tunnel through it.
+/// Only the linear motion of the center of mass is considered.
+/**
+ * @param isEnabled True if you want to prevent this fast moving body from tunneling through static bodies
+ */
+void RigidBody::enableContinuousCollisionDetection(bool isEnabled) {
+    mWorld.mRigidBodyComponents.setIsContinuousCollisionDetectionEnabled(mEntity, isEnabled);
+
+    RP3D_LOG(mWorld.mConfig.worldName, Logger::Level::Information, Logger::Category::Body,
+             "Body " + std::to_string(mEntity.id) + ": Set isContinuousCollisionDetectionEnabled=" +
+             (isEnabled ? "true" : "false"),  __FILE__, __LINE__);
+}
+
 // Set the linear damping factor.
 /**
  * @param linearDamping The linear damping factor of this body (in range [0; +inf]). Zero means no damping.
@@ -863,6 +878,14 @@ bool RigidBody::isGravityEnabled() const {
     return mWorld.mRigidBodyComponents.getIsGravityEnabled(mEntity);
 }
 
+// Return true if continuous collision detection is enabled for this rigid body
+/**
+ * @return True if the motion of the body is clamped against static bodies to avoid tunneling
+ */
+bool RigidBody::isContinuousCollisionDetectionEnabled() const {
+    return mWorld.mRigidBodyComponents.getIsContinuousCollisionDetectionEnabled(mEntity);
+}
+
 // Return the linear lock axis factor
 /// The linear lock axis factor specify whether linear motion along world-space axes X,Y,Z is
 /// restricted or not.
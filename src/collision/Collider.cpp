@@ -68,7 +68,7 @@ bool Collider::testPointInside(const Vector3& worldPoint) {
 /**
  * @param collisionCategoryBits The collision category bits mask of the collider
  */
-void Collider::setCollisionCategoryBits(unsigned short collisionCategoryBits) {
+void Collider::setCollisionCategoryBits(uint64 collisionCategoryBits) {
 
     mBody->mWorld.mCollidersComponents.setCollisionCategoryBits(mEntity, collisionCategoryBits);
 
@@ -86,7 +86,7 @@ void Collider::setCollisionCategoryBits(unsigned short collisionCategoryBits) {
 /**
  * @param collideWithMaskBits The bits mask that specifies with which collision category this shape will collide
  */
-void Collider::setCollideWithMaskBits(unsigned short collideWithMaskBits) {
+void Collider::setCollideWithMaskBits(uint64 collideWithMaskBits) {
 
     mBody->mWorld.mCollidersComponents.setCollideWithMaskBits(mEntity, collideWithMaskBits);
 
@@ -100,6 +100,27 @@ void Collider::setCollideWithMaskBits(unsigned short collideWithMaskBits) {
              std::to_string(collideWithMaskBits),  __FILE__, __LINE__);
 }
 
+// Set the collision group
+/**
+ * Two colliders with the same positive collision group always collide and two colliders
+ * with the same negative collision group never collide, whatever their category and mask
+ * bits. The default group is zero, meaning that the collider does not belong to any group.
+ * @param collisionGroup The collision group of the collider
+ */
+void Collider::setCollisionGroup(int32 collisionGroup) {
+
+    mBody->mWorld.mCollidersComponents.setCollisionGroup(mEntity, collisionGroup);
+
+    int broadPhaseId = mBody->mWorld.mCollidersComponents.getBroadPhaseId(mEntity);
+
+    // Ask the broad-phase collision detection to test this collider next frame
+    mBody->mWorld.mCollisionDetection.askForBroadPhaseCollisionCheck(this);
+
+    RP3D_LOG(mBody->mWorld.mConfig.worldName, Logger::Level::Information, Logger::Category::Collider,
+             "Collider " + std::to_string(broadPhaseId) + ": Set collisionGroup=" +
+             std::to_string(collisionGroup),  __FILE__, __LINE__);
+}
+
 // Set the local to  body transform
 /**
  * @param transform The transform from local-space of the collider into the local-space of the body
@@ -197,7 +218,7 @@ bool Collider::raycast(const Ray& ray, RaycastInfo& raycastInfo) {
 /**
  * @return The collision category bits mask of the collider
  */
-unsigned short Collider::getCollisionCategoryBits() const {
+uint64 Collider::getCollisionCategoryBits() const {
     return mBody->mWorld.mCollidersComponents.getCollisionCategoryBits(mEntity);
 }
 
@@ -205,10 +226,18 @@ unsigned short Collider::getCollisionCategoryBits() const {
 /**
  * @return The bits mask that specifies with which collision category this shape will collide
  */
-unsigned short Collider::getCollideWithMaskBits() const {
+uint64 Collider::getCollideWithMaskBits() const {
     return mBody->mWorld.mCollidersComponents.getCollideWithMaskBits(mEntity);
 }
 
+// Return the collision group
+/**
+ * @return The collision group of the collider (zero if the collider does not belong to any group)
+ */
+int32 Collider::getCollisionGroup() const {
+    return mBody->mWorld.mCollidersComponents.getCollisionGroup(mEntity);
+}
+
 // Notify the collider that the size of the collision shape has been changed by the user
 void Collider::setHasCollisionShapeChangedSize(bool hasCollisionShapeChangedSize) {
     mBody->mWorld.mCollidersComponents.setHasCollisionShapeChangedSize(mEntity, hasCollisionShapeChangedSize);
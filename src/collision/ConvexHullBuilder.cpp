@@ -0,0 +1,641 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2022 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+// Libraries
+#include <reactphysics3d/collision/ConvexHullBuilder.h>
+#include <cmath>
+
+using namespace reactphysics3d;
+
+// Static variables initialization
+const decimal ConvexHullBuilder::WELD_RELATIVE_DISTANCE = decimal(0.0001);
+
+// Constructor
+ConvexHullBuilder::ConvexHullBuilder(MemoryAllocator& allocator)
+                  : mAllocator(allocator), mWeldedPoints(allocator), mPoints(nullptr), mNbPoints(0), mTolerance(0), mWeldDistance(0), mFaces(allocator),
+                    mPointsFace(allocator), mPointsDistance(allocator), mPointsNbFaces(allocator), mNbHullVertices(0),
+                    mMapEdgeToFace(allocator), mVertices(allocator), mFacesVertices(allocator), mFacesNbVertices(allocator) {
+
+}
+
+// Compute the convex hull of a cloud of points
+/// This method returns false if the hull cannot be computed because all the points are
+/// (almost) coplanar. If a maximum number of vertices is given, the points are added to
+/// the hull from the farthest to the closest one until the hull reaches this number of vertices.
+/// The points closer than WELD_RELATIVE_DISTANCE times the diagonal of their bounding box are
+/// welded before computing the hull, so the vertices of the hull can be up to this distance
+/// inside some of the input points.
+/**
+ * @param points Pointer to the array of points
+ * @param nbPoints Number of points in the array
+ * @param maxNbVertices Maximum number of vertices of the hull (zero for no limit, at least four otherwise)
+ * @return True if the hull has been computed and false otherwise
+ */
+bool ConvexHullBuilder::computeHull(const Vector3* points, uint32 nbPoints, uint32 maxNbVertices) {
+
+    mNbHullVertices = 0;
+    mFaces.clear();
+    mPointsFace.clear();
+    mPointsDistance.clear();
+    mPointsNbFaces.clear();
+    mMapEdgeToFace.clear();
+    mVertices.clear();
+    mFacesVertices.clear();
+    mFacesNbVertices.clear();
+
+    if (nbPoints < 4) return false;
+
+    // Weld the near-duplicate points (they would create faces with degenerate normals)
+    weldPoints(points, nbPoints);
+    mPoints = &(mWeldedPoints[0]);
+    mNbPoints = static_cast<uint32>(mWeldedPoints.size());
+
+    if (mNbPoints < 4) return false;
+
+    // Compute the distance tolerance relative to the magnitude of the coordinates
+    Vector3 maxCoordinates(0, 0, 0);
+    mPointsFace.reserve(mNbPoints);
+    mPointsDistance.reserve(mNbPoints);
+    mPointsNbFaces.reserve(mNbPoints);
+    for (uint32 i=0; i < mNbPoints; i++) {
+        maxCoordinates = Vector3::max(maxCoordinates, mPoints[i].getAbsoluteVector());
+        mPointsFace.add(-1);
+        mPointsDistance.add(decimal(0.0));
+        mPointsNbFaces.add(0);
+    }
+    mTolerance = decimal(3.0) * MACHINE_EPSILON * (maxCoordinates.x + maxCoordinates.y + maxCoordinates.z);
+
+    if (!computeInitialTetrahedron()) return false;
+
+    // Assign each point to the outside set of a face of the tetrahedron
+    Array<uint32> initialFaces(mAllocator, 4);
+    for (uint32 f=0; f < 4; f++) {
+        initialFaces.add(f);
+    }
+    for (uint32 i=0; i < mNbPoints; i++) {
+        if (mPointsNbFaces[i] == 0) {
+            assignPointToFaces(i, initialFaces);
+        }
+    }
+
+    // While the hull has not reached the maximum number of vertices
+    while (maxNbVertices == 0 || mNbHullVertices < maxNbVertices) {
+
+        // Find the point that is the farthest outside of the hull
+        int32 farthestPoint = -1;
+        decimal maxDistance = decimal(0.0);
+        for (uint32 i=0; i < mNbPoints; i++) {
+            if (mPointsFace[i] >= 0 && mPointsDistance[i] > maxDistance) {
+                maxDistance = mPointsDistance[i];
+                farthestPoint = static_cast<int32>(i);
+            }
+        }
+
+        // If all the points are inside the hull, we are done
+        if (farthestPoint < 0) break;
+
+        addPointToHull(static_cast<uint32>(farthestPoint));
+    }
+
+    computeHullPolygons();
+
+    return true;
+}
+
+// Weld the input points that are closer than a distance relative to the size of the cloud
+/// The kept points are stored in a uniform grid with cells of the size of the welding distance. A point
+/// is welded to the first kept point closer than this distance in the neighbouring cells of its cell and
+/// is kept otherwise. The kept points are input points (they are not moved).
+void ConvexHullBuilder::weldPoints(const Vector3* points, uint32 nbPoints) {
+
+    assert(nbPoints > 0);
+
+    mWeldedPoints.clear();
+    mWeldedPoints.reserve(nbPoints);
+
+    // Compute the welding distance from the diagonal of the bounding box of the points
+    Vector3 minBounds = points[0];
+    Vector3 maxBounds = points[0];
+    for (uint32 i=1; i < nbPoints; i++) {
+        minBounds = Vector3::min(minBounds, points[i]);
+        maxBounds = Vector3::max(maxBounds, points[i]);
+    }
+    mWeldDistance = WELD_RELATIVE_DISTANCE * (maxBounds - minBounds).length();
+
+    // If all the points are at the same position
+    if (mWeldDistance <= decimal(0.0)) {
+        mWeldedPoints.add(points[0]);
+        return;
+    }
+
+    const decimal weldDistanceSquare = mWeldDistance * mWeldDistance;
+
+    // For each cell of the grid, last kept point in this cell. The previous kept points of the same
+    // cell are linked with the array of next points.
+    Map<uint64, uint32> mapCellToPoint(mAllocator);
+    Array<int32> nextPointInCell(mAllocator, nbPoints);
+
+    for (uint32 i=0; i < nbPoints; i++) {
+
+        // Coordinates of the cell of the point (shifted by one so that the neighbouring cells are not negative)
+        const Vector3 cellCoordinates = (points[i] - minBounds) / mWeldDistance;
+        const uint32 cellX = static_cast<uint32>(cellCoordinates.x) + 1;
+        const uint32 cellY = static_cast<uint32>(cellCoordinates.y) + 1;
+        const uint32 cellZ = static_cast<uint32>(cellCoordinates.z) + 1;
+
+        // Look for a kept point close enough in the cell of the point and in the neighbouring cells
+        bool isWelded = false;
+        for (uint32 x=cellX - 1; x <= cellX + 1 && !isWelded; x++) {
+            for (uint32 y=cellY - 1; y <= cellY + 1 && !isWelded; y++) {
+                for (uint32 z=cellZ - 1; z <= cellZ + 1 && !isWelded; z++) {
+
+                    auto it = mapCellToPoint.find(computeCellKey(x, y, z));
+                    if (it == mapCellToPoint.end()) continue;
+
+                    for (int32 p = static_cast<int32>(it->second); p >= 0 && !isWelded; p = nextPointInCell[p]) {
+                        isWelded = (mWeldedPoints[p] - points[i]).lengthSquare() <= weldDistanceSquare;
+                    }
+                }
+            }
+        }
+
+        // If the point is not welded, we keep it
+        if (!isWelded) {
+
+            const uint64 cellKey = computeCellKey(cellX, cellY, cellZ);
+            auto it = mapCellToPoint.find(cellKey);
+            nextPointInCell.add(it != mapCellToPoint.end() ? static_cast<int32>(it->second) : -1);
+            mapCellToPoint.add(Pair<uint64, uint32>(cellKey, static_cast<uint32>(mWeldedPoints.size())), true);
+            mWeldedPoints.add(points[i]);
+        }
+    }
+}
+
+// Compute the initial tetrahedron of the hull
+/// This method returns false if the points are (almost) colinear or coplanar
+bool ConvexHullBuilder::computeInitialTetrahedron() {
+
+    // Find the extreme points along each axis
+    uint32 extremePoints[6] = {0, 0, 0, 0, 0, 0};
+    for (uint32 i=1; i < mNbPoints; i++) {
+        for (uint32 axis=0; axis < 3; axis++) {
+            if (mPoints[i][axis] < mPoints[extremePoints[2 * axis]][axis]) extremePoints[2 * axis] = i;
+            if (mPoints[i][axis] > mPoints[extremePoints[2 * axis + 1]][axis]) extremePoints[2 * axis + 1] = i;
+        }
+    }
+
+    // The first edge is the longest one between two extreme points along the same axis
+    uint32 v1 = extremePoints[0];
+    uint32 v2 = extremePoints[1];
+    decimal maxDistance = decimal(-1.0);
+    for (uint32 axis=0; axis < 3; axis++) {
+        const decimal distance = (mPoints[extremePoints[2 * axis + 1]] - mPoints[extremePoints[2 * axis]]).lengthSquare();
+        if (distance > maxDistance) {
+            maxDistance = distance;
+            v1 = extremePoints[2 * axis];
+            v2 = extremePoints[2 * axis + 1];
+        }
+    }
+    if (std::sqrt(maxDistance) <= mTolerance) return false;
+
+    // The third vertex is the farthest point from the line of the first edge
+    const Vector3 edgeDirection = (mPoints[v2] - mPoints[v1]).getUnit();
+    uint32 v3 = v1;
+    maxDistance = decimal(0.0);
+    for (uint32 i=0; i < mNbPoints; i++) {
+        const decimal distance = (mPoints[i] - mPoints[v1]).cross(edgeDirection).lengthSquare();
+        if (distance > maxDistance) {
+            maxDistance = distance;
+            v3 = i;
+        }
+    }
+    if (std::sqrt(maxDistance) <= mTolerance) return false;
+
+    // The fourth vertex is the farthest point from the plane of the first three vertices
+    const Vector3 planeNormal = (mPoints[v2] - mPoints[v1]).cross(mPoints[v3] - mPoints[v1]).getUnit();
+    uint32 v4 = v1;
+    maxDistance = decimal(0.0);
+    for (uint32 i=0; i < mNbPoints; i++) {
+        const decimal distance = std::abs(planeNormal.dot(mPoints[i] - mPoints[v1]));
+        if (distance > maxDistance) {
+            maxDistance = distance;
+            v4 = i;
+        }
+    }
+    if (maxDistance <= mTolerance) return false;
+
+    // Create the four faces with their normals pointing away from the opposite vertex
+    if (planeNormal.dot(mPoints[v4] - mPoints[v1]) > decimal(0.0)) {
+        addFace(v1, v3, v2);
+        addFace(v1, v2, v4);
+        addFace(v2, v3, v4);
+        addFace(v3, v1, v4);
+    }
+    else {
+        addFace(v1, v2, v3);
+        addFace(v1, v4, v2);
+        addFace(v2, v4, v3);
+        addFace(v3, v4, v1);
+    }
+
+    return true;
+}
+
+// Add a new triangle face to the hull and return its index
+/// The vertices must be given counter-clockwise when seen from outside of the hull
+uint32 ConvexHullBuilder::addFace(uint32 v1, uint32 v2, uint32 v3) {
+
+    Vector3 normal = (mPoints[v2] - mPoints[v1]).cross(mPoints[v3] - mPoints[v1]);
+
+    // The face is degenerate if its height from its longest edge is below the tolerance
+    const decimal maxEdgeLengthSquare = std::max(std::max((mPoints[v2] - mPoints[v1]).lengthSquare(), (mPoints[v3] - mPoints[v2]).lengthSquare()),
+                                                 (mPoints[v1] - mPoints[v3]).lengthSquare());
+    const decimal doubleArea = normal.length();
+    const bool isDegenerate = doubleArea < MACHINE_EPSILON || doubleArea <= mTolerance * std::sqrt(maxEdgeLengthSquare);
+
+    normal.normalize();
+
+    const uint32 faceIndex = static_cast<uint32>(mFaces.size());
+    mFaces.add(HullFace(v1, v2, v3, normal, normal.dot(mPoints[v1]), isDegenerate));
+
+    mMapEdgeToFace.add(Pair<uint64, uint32>(computeEdgeKey(v1, v2), faceIndex), true);
+    mMapEdgeToFace.add(Pair<uint64, uint32>(computeEdgeKey(v2, v3), faceIndex), true);
+    mMapEdgeToFace.add(Pair<uint64, uint32>(computeEdgeKey(v3, v1), faceIndex), true);
+
+    for (uint32 i=0; i < 3; i++) {
+        const uint32 vertex = mFaces[faceIndex].vertices[i];
+        if (mPointsNbFaces[vertex] == 0) mNbHullVertices++;
+        mPointsNbFaces[vertex]++;
+    }
+
+    return faceIndex;
+}
+
+// Remove a triangle face from the hull
+void ConvexHullBuilder::removeFace(uint32 faceIndex) {
+
+    HullFace& face = mFaces[faceIndex];
+    assert(face.isValid);
+    face.isValid = false;
+
+    for (uint32 i=0; i < 3; i++) {
+        mMapEdgeToFace.remove(computeEdgeKey(face.vertices[i], face.vertices[(i + 1) % 3]));
+
+        const uint32 vertex = face.vertices[i];
+        assert(mPointsNbFaces[vertex] > 0);
+        mPointsNbFaces[vertex]--;
+        if (mPointsNbFaces[vertex] == 0) mNbHullVertices--;
+    }
+}
+
+// Return the face on the other side of an edge of a face
+/**
+ * @param faceIndex Index of the face
+ * @param edgeIndex Index of the edge in the face (the edge from vertex edgeIndex to the next vertex)
+ * @return The index of the adjacent face
+ */
+uint32 ConvexHullBuilder::getAdjacentFace(uint32 faceIndex, uint32 edgeIndex) const {
+
+    const HullFace& face = mFaces[faceIndex];
+    auto it = mMapEdgeToFace.find(computeEdgeKey(face.vertices[(edgeIndex + 1) % 3], face.vertices[edgeIndex]));
+    assert(it != mMapEdgeToFace.end());
+
+    return it->second;
+}
+
+// Assign a point to the outside set of the farthest face among some faces
+/// If the point is not outside of any of the faces, it is not assigned to any face
+void ConvexHullBuilder::assignPointToFaces(uint32 pointIndex, const Array<uint32>& faces) {
+
+    int32 bestFace = -1;
+    decimal bestDistance = mTolerance;
+
+    const uint32 nbFaces = static_cast<uint32>(faces.size());
+    for (uint32 i=0; i < nbFaces; i++) {
+
+        const HullFace& face = mFaces[faces[i]];
+        if (!face.isValid) continue;
+
+        const decimal distance = face.getDistance(mPoints[pointIndex]);
+        if (distance > bestDistance) {
+            bestDistance = distance;
+            bestFace = static_cast<int32>(faces[i]);
+        }
+    }
+
+    mPointsFace[pointIndex] = bestFace;
+    mPointsDistance[pointIndex] = bestFace >= 0 ? bestDistance : decimal(0.0);
+}
+
+// Add a point to the hull
+/// The faces that can see the point are removed and the hole is closed by connecting the
+/// point with the horizon edges (boundary between the visible and the non-visible faces)
+void ConvexHullBuilder::addPointToHull(uint32 pointIndex) {
+
+    assert(mPointsFace[pointIndex] >= 0);
+
+    const Vector3& point = mPoints[pointIndex];
+    const uint32 nbFaces = static_cast<uint32>(mFaces.size());
+
+    // State of each face (0: not tested, 1: visible from the point, 2: not visible)
+    Array<uint8> facesState(mAllocator, nbFaces);
+    for (uint32 f=0; f < nbFaces; f++) {
+        facesState.add(0);
+    }
+
+    // Find the visible faces with a flood fill from the face of the point and collect the horizon edges
+    Array<uint32> visibleFaces(mAllocator);
+    Array<uint32> horizonEdges(mAllocator);
+    const uint32 startFace = static_cast<uint32>(mPointsFace[pointIndex]);
+    facesState[startFace] = 1;
+    visibleFaces.add(startFace);
+    for (uint32 i=0; i < visibleFaces.size(); i++) {
+
+        const uint32 faceIndex = visibleFaces[i];
+
+        for (uint32 e=0; e < 3; e++) {
+
+            const uint32 adjacentFace = getAdjacentFace(faceIndex, e);
+
+            if (facesState[adjacentFace] == 0) {
+                const bool isVisible = mFaces[adjacentFace].getDistance(point) > mTolerance;
+                facesState[adjacentFace] = isVisible ? 1 : 2;
+                if (isVisible) visibleFaces.add(adjacentFace);
+            }
+
+            if (facesState[adjacentFace] == 2) {
+                horizonEdges.add(mFaces[faceIndex].vertices[e]);
+                horizonEdges.add(mFaces[faceIndex].vertices[(e + 1) % 3]);
+            }
+        }
+    }
+
+    // The horizon must be a single loop without repeated vertices. Because of numerical errors, this might
+    // not be the case if the point is almost coplanar with some faces. The point is then discarded because
+    // adding it would make the hull non-manifold.
+    Map<uint32, uint32> mapHorizonEdges(mAllocator, horizonEdges.size() / 2);
+    bool isHorizonValid = horizonEdges.size() >= 6;
+    for (uint32 i=0; i < horizonEdges.size() && isHorizonValid; i += 2) {
+        isHorizonValid = !mapHorizonEdges.containsKey(horizonEdges[i]);
+        if (isHorizonValid) {
+            mapHorizonEdges.add(Pair<uint32, uint32>(horizonEdges[i], horizonEdges[i + 1]));
+        }
+    }
+    if (isHorizonValid) {
+        uint32 vertex = horizonEdges[0];
+        uint32 nbLoopEdges = 0;
+        do {
+            auto it = mapHorizonEdges.find(vertex);
+            if (it == mapHorizonEdges.end()) break;
+            vertex = it->second;
+            nbLoopEdges++;
+        } while (vertex != horizonEdges[0] && nbLoopEdges < mapHorizonEdges.size());
+
+        isHorizonValid = vertex == horizonEdges[0] && nbLoopEdges == mapHorizonEdges.size();
+    }
+    if (!isHorizonValid) {
+        mPointsFace[pointIndex] = -1;
+        return;
+    }
+
+    // Collect the points in the outside sets of the visible faces
+    Array<uint32> orphanPoints(mAllocator);
+    for (uint32 i=0; i < mNbPoints; i++) {
+        if (mPointsFace[i] >= 0 && facesState[mPointsFace[i]] == 1) {
+            mPointsFace[i] = -1;
+            if (i != pointIndex) orphanPoints.add(i);
+        }
+    }
+
+    // Remove the visible faces
+    for (uint32 i=0; i < visibleFaces.size(); i++) {
+        removeFace(visibleFaces[i]);
+    }
+
+    // Create the new faces between the horizon edges and the point
+    Array<uint32> newFaces(mAllocator, horizonEdges.size() / 2);
+    for (uint32 i=0; i < horizonEdges.size(); i += 2) {
+        newFaces.add(addFace(horizonEdges[i], horizonEdges[i + 1], pointIndex));
+    }
+
+    // Assign the orphan points to the new faces
+    for (uint32 i=0; i < orphanPoints.size(); i++) {
+        assignPointToFaces(orphanPoints[i], newFaces);
+    }
+}
+
+// Merge the coplanar faces and compute the resulting vertices and polygon faces
+/// Adjacent triangles with almost the same plane are grouped with a flood fill and the
+/// boundary of each group becomes a polygon face. Vertices that end up being used by
+/// only two polygons are on the edge between them and are removed. The degenerate triangles
+/// (with an almost zero area) do not have a meaningful normal. They are merged into the
+/// group of an adjacent triangle and dropped if all their adjacent triangles are degenerate.
+void ConvexHullBuilder::computeHullPolygons() {
+
+    const decimal cosAngleTolerance = decimal(0.9999);
+    // A vertex closer than the welding distance from the plane of a face is considered to be on this plane
+    const decimal distanceTolerance = std::max(decimal(100.0) * mTolerance, mWeldDistance);
+
+    const uint32 nbFaces = static_cast<uint32>(mFaces.size());
+    Array<int32> facesGroup(mAllocator, nbFaces);
+    for (uint32 f=0; f < nbFaces; f++) {
+        facesGroup.add(-1);
+    }
+
+    // Vertices (indices of input points) of the polygons and number of vertices of each polygon
+    Array<uint32> polygonsVertices(mAllocator);
+    Array<uint32> polygonsNbVertices(mAllocator);
+
+    Array<uint32> groupFaces(mAllocator);
+    Array<uint32> polygon(mAllocator);
+    Map<uint32, uint32> mapBoundaryEdges(mAllocator);
+    int32 nbGroups = 0;
+
+    // The non-degenerate faces are used first as seeds of the groups
+    Array<uint32> seedFaces(mAllocator, nbFaces);
+    for (uint32 f=0; f < nbFaces; f++) {
+        if (mFaces[f].isValid && !mFaces[f].isDegenerate) seedFaces.add(f);
+    }
+    for (uint32 f=0; f < nbFaces; f++) {
+        if (mFaces[f].isValid && mFaces[f].isDegenerate) seedFaces.add(f);
+    }
+
+    for (uint32 s=0; s < seedFaces.size(); s++) {
+
+        const uint32 f = seedFaces[s];
+        if (facesGroup[f] >= 0) continue;
+
+        const int32 group = nbGroups++;
+        const HullFace& seedFace = mFaces[f];
+
+        // Flood fill the adjacent faces that are coplanar with the seed face
+        groupFaces.clear();
+        groupFaces.add(f);
+        facesGroup[f] = group;
+        for (uint32 i=0; i < groupFaces.size(); i++) {
+            for (uint32 e=0; e < 3; e++) {
+
+                const uint32 adjacentFace = getAdjacentFace(groupFaces[i], e);
+                if (facesGroup[adjacentFace] >= 0) continue;
+
+                const HullFace& face = mFaces[adjacentFace];
+                bool isCoplanar = face.isDegenerate;
+                if (!isCoplanar && !seedFace.isDegenerate) {
+                    isCoplanar = seedFace.normal.dot(face.normal) >= cosAngleTolerance;
+                    for (uint32 v=0; v < 3 && isCoplanar; v++) {
+                        isCoplanar = std::abs(seedFace.getDistance(mPoints[face.vertices[v]])) <= distanceTolerance;
+                    }
+                }
+
+                if (isCoplanar) {
+                    facesGroup[adjacentFace] = group;
+                    groupFaces.add(adjacentFace);
+                }
+            }
+        }
+
+        // A group of degenerate faces only is dropped
+        if (seedFace.isDegenerate) continue;
+
+        // Collect the boundary edges of the group
+        mapBoundaryEdges.clear();
+        bool isBoundaryValid = true;
+        for (uint32 i=0; i < groupFaces.size(); i++) {
+            const HullFace& face = mFaces[groupFaces[i]];
+            for (uint32 e=0; e < 3; e++) {
+                if (facesGroup[getAdjacentFace(groupFaces[i], e)] != group) {
+
+                    // Two boundary edges starting at the same vertex means that the boundary is not a simple loop
+                    if (mapBoundaryEdges.containsKey(face.vertices[e])) {
+                        isBoundaryValid = false;
+                    }
+                    else {
+                        mapBoundaryEdges.add(Pair<uint32, uint32>(face.vertices[e], face.vertices[(e + 1) % 3]));
+                    }
+                }
+            }
+        }
+
+        // Walk along the boundary edges to get the polygon
+        polygon.clear();
+        if (isBoundaryValid) {
+            const uint32 startVertex = mapBoundaryEdges.begin()->first;
+            uint32 vertex = startVertex;
+            do {
+                polygon.add(vertex);
+                auto it = mapBoundaryEdges.find(vertex);
+                if (it == mapBoundaryEdges.end()) break;
+                vertex = it->second;
+            } while (vertex != startVertex && polygon.size() <= mapBoundaryEdges.size());
+
+            isBoundaryValid = vertex == startVertex && polygon.size() == mapBoundaryEdges.size();
+        }
+
+        if (isBoundaryValid) {
+            polygonsVertices.addRange(polygon);
+            polygonsNbVertices.add(static_cast<uint32>(polygon.size()));
+        }
+        else {
+
+            // The boundary is not a simple loop, so we keep the triangles of the group
+            for (uint32 i=0; i < groupFaces.size(); i++) {
+                const HullFace& face = mFaces[groupFaces[i]];
+                polygonsVertices.add(face.vertices[0]);
+                polygonsVertices.add(face.vertices[1]);
+                polygonsVertices.add(face.vertices[2]);
+                polygonsNbVertices.add(3);
+            }
+        }
+    }
+
+    // Remove the vertices used by less than three polygons (they are on the edge between two polygons). A
+    // polygon that is left with less than three vertices is a degenerate sliver and is removed. This can
+    // leave other vertices with less than three polygons, so we repeat until nothing changes.
+    Array<uint32> pointsNbPolygons(mAllocator, mNbPoints);
+    for (uint32 i=0; i < mNbPoints; i++) {
+        pointsNbPolygons.add(0);
+    }
+    Array<uint32> keptPolygonsVertices(mAllocator, polygonsVertices.size());
+    Array<uint32> keptPolygonsNbVertices(mAllocator, polygonsNbVertices.size());
+    bool isModified = true;
+    while (isModified) {
+
+        isModified = false;
+
+        for (uint32 i=0; i < mNbPoints; i++) {
+            pointsNbPolygons[i] = 0;
+        }
+        for (uint32 i=0; i < polygonsVertices.size(); i++) {
+            pointsNbPolygons[polygonsVertices[i]]++;
+        }
+
+        keptPolygonsVertices.clear();
+        keptPolygonsNbVertices.clear();
+        uint32 polygonStart = 0;
+        for (uint32 p=0; p < polygonsNbVertices.size(); p++) {
+
+            const uint32 polygonNbVertices = polygonsNbVertices[p];
+            const uint32 keptStart = static_cast<uint32>(keptPolygonsVertices.size());
+            for (uint32 i=polygonStart; i < polygonStart + polygonNbVertices; i++) {
+                if (pointsNbPolygons[polygonsVertices[i]] >= 3) {
+                    keptPolygonsVertices.add(polygonsVertices[i]);
+                }
+            }
+
+            const uint32 nbKeptVertices = static_cast<uint32>(keptPolygonsVertices.size()) - keptStart;
+            if (nbKeptVertices >= 3) {
+                keptPolygonsNbVertices.add(nbKeptVertices);
+            }
+            else {
+                while (keptPolygonsVertices.size() > keptStart) {
+                    keptPolygonsVertices.removeAt(keptPolygonsVertices.size() - 1);
+                }
+            }
+
+            isModified |= nbKeptVertices != polygonNbVertices;
+            polygonStart += polygonNbVertices;
+        }
+
+        polygonsVertices = keptPolygonsVertices;
+        polygonsNbVertices = keptPolygonsNbVertices;
+    }
+
+    // Create the final vertices and faces
+    Array<int32> pointsNewIndex(mAllocator, mNbPoints);
+    for (uint32 i=0; i < mNbPoints; i++) {
+        pointsNewIndex.add(-1);
+    }
+    for (uint32 i=0; i < polygonsVertices.size(); i++) {
+
+        const uint32 point = polygonsVertices[i];
+        if (pointsNewIndex[point] < 0) {
+            pointsNewIndex[point] = static_cast<int32>(mVertices.size());
+            mVertices.add(mPoints[point]);
+        }
+
+        mFacesVertices.add(static_cast<uint32>(pointsNewIndex[point]));
+    }
+    mFacesNbVertices.addRange(polygonsNbVertices);
+}
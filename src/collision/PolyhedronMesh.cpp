@@ -27,6 +27,7 @@
 #include <reactphysics3d/collision/PolyhedronMesh.h>
 #include <reactphysics3d/memory/MemoryManager.h>
 #include <reactphysics3d/collision/PolygonVertexArray.h>
+#include <reactphysics3d/collision/ConvexHullBuilder.h>
 #include <reactphysics3d/utils/DefaultLogger.h>
 #include <reactphysics3d/engine/PhysicsCommon.h>
 #include <cstdlib>
@@ -41,7 +42,8 @@ using namespace reactphysics3d;
  */
 PolyhedronMesh::PolyhedronMesh(PolygonVertexArray* polygonVertexArray, MemoryAllocator& allocator)
                : mMemoryAllocator(allocator), mHalfEdgeStructure(allocator, polygonVertexArray->getNbFaces(), polygonVertexArray->getNbVertices(),
-                                    (polygonVertexArray->getNbFaces() + polygonVertexArray->getNbVertices() - 2) * 2), mFacesNormals(nullptr) {
+                                    (polygonVertexArray->getNbFaces() + polygonVertexArray->getNbVertices() - 2) * 2), mFacesNormals(nullptr),
+                 mOwnedData(nullptr), mOwnedDataSize(0) {
 
    mPolygonVertexArray = polygonVertexArray;
 }
@@ -57,6 +59,14 @@ PolyhedronMesh::~PolyhedronMesh() {
 
         mMemoryAllocator.release(mFacesNormals, mHalfEdgeStructure.getNbFaces() * sizeof(Vector3));
     }
+
+    // If the mesh owns its polygon vertex array and its data
+    if (mOwnedData != nullptr) {
+
+        mPolygonVertexArray->~PolygonVertexArray();
+
+        mMemoryAllocator.release(mOwnedData, mOwnedDataSize);
+    }
 }
 
 /// Static factory method to create a polyhedron mesh. This methods returns null_ptr if the mesh is not valid
@@ -64,18 +74,81 @@ PolyhedronMesh* PolyhedronMesh::create(PolygonVertexArray* polygonVertexArray, M
 
     PolyhedronMesh* mesh = new (polyhedronMeshAllocator.allocate(sizeof(PolyhedronMesh))) PolyhedronMesh(polygonVertexArray, dataAllocator);
 
-    // Create the half-edge structure of the mesh
-    bool isValid = mesh->createHalfEdgeStructure();
+    if (!mesh->init()) {
+        mesh->~PolyhedronMesh();
+        polyhedronMeshAllocator.release(mesh, sizeof(PolyhedronMesh));
+        mesh = nullptr;
+    }
 
-    if (isValid) {
+    return mesh;
+}
 
-        // Compute the faces normals
-        mesh->computeFacesNormals();
+/// Static factory method to create a polyhedron mesh from the convex hull of a cloud of points.
+/// The vertices, indices and faces of the hull are stored in a memory block owned by the mesh.
+/// This methods returns null_ptr if the hull cannot be computed.
+PolyhedronMesh* PolyhedronMesh::createConvexHull(const Vector3* points, uint32 nbPoints, uint32 maxNbVertices,
+                                                 MemoryAllocator& polyhedronMeshAllocator, MemoryAllocator& dataAllocator) {
 
-        // Compute the centroid
-        mesh->computeCentroid();
+    // Compute the convex hull of the points
+    ConvexHullBuilder hullBuilder(dataAllocator);
+    if (!hullBuilder.computeHull(points, nbPoints, maxNbVertices)) {
+
+        RP3D_LOG("PhysicsCommon", Logger::Level::Error, Logger::Category::PhysicCommon,
+                 "Error when creating a convex hull: there must be at least four points that are not all coplanar.",  __FILE__, __LINE__);
+
+        return nullptr;
     }
-    else {
+
+    const Array<Vector3>& hullVertices = hullBuilder.getVertices();
+    const Array<uint32>& hullFacesVertices = hullBuilder.getFacesVertices();
+    const Array<uint32>& hullFacesNbVertices = hullBuilder.getFacesNbVertices();
+    const uint32 nbVertices = static_cast<uint32>(hullVertices.size());
+    const uint32 nbIndices = static_cast<uint32>(hullFacesVertices.size());
+    const uint32 nbFaces = static_cast<uint32>(hullFacesNbVertices.size());
+
+    // Allocate a single memory block for the polygon vertex array, the vertices, the faces and the indices
+    const size_t polygonVertexArraySize = sizeof(PolygonVertexArray);
+    const size_t verticesSize = nbVertices * 3 * sizeof(decimal);
+    const size_t facesSize = nbFaces * sizeof(PolygonVertexArray::PolygonFace);
+    const size_t indicesSize = nbIndices * sizeof(uint32);
+    const size_t dataSize = polygonVertexArraySize + verticesSize + facesSize + indicesSize;
+    unsigned char* data = static_cast<unsigned char*>(dataAllocator.allocate(dataSize));
+    decimal* vertices = reinterpret_cast<decimal*>(data + polygonVertexArraySize);
+    PolygonVertexArray::PolygonFace* faces = reinterpret_cast<PolygonVertexArray::PolygonFace*>(data + polygonVertexArraySize + verticesSize);
+    uint32* indices = reinterpret_cast<uint32*>(data + polygonVertexArraySize + verticesSize + facesSize);
+
+    for (uint32 v=0; v < nbVertices; v++) {
+        vertices[3 * v] = hullVertices[v].x;
+        vertices[3 * v + 1] = hullVertices[v].y;
+        vertices[3 * v + 2] = hullVertices[v].z;
+    }
+
+    uint32 indexBase = 0;
+    for (uint32 f=0; f < nbFaces; f++) {
+        faces[f].nbVertices = hullFacesNbVertices[f];
+        faces[f].indexBase = indexBase;
+        indexBase += hullFacesNbVertices[f];
+    }
+
+    for (uint32 i=0; i < nbIndices; i++) {
+        indices[i] = hullFacesVertices[i];
+    }
+
+#if defined(IS_RP3D_DOUBLE_PRECISION_ENABLED)
+    const PolygonVertexArray::VertexDataType vertexDataType = PolygonVertexArray::VertexDataType::VERTEX_DOUBLE_TYPE;
+#else
+    const PolygonVertexArray::VertexDataType vertexDataType = PolygonVertexArray::VertexDataType::VERTEX_FLOAT_TYPE;
+#endif
+
+    PolygonVertexArray* polygonVertexArray = new (data) PolygonVertexArray(nbVertices, vertices, 3 * sizeof(decimal), indices, sizeof(uint32),
+                                                                           nbFaces, faces, vertexDataType,
+                                                                           PolygonVertexArray::IndexDataType::INDEX_INTEGER_TYPE);
+
+    PolyhedronMesh* mesh = new (polyhedronMeshAllocator.allocate(sizeof(PolyhedronMesh))) PolyhedronMesh(polygonVertexArray, dataAllocator);
+    mesh->mOwnedData = data;
+    mesh->mOwnedDataSize = dataSize;
+
+    if (!mesh->init()) {
         mesh->~PolyhedronMesh();
         polyhedronMeshAllocator.release(mesh, sizeof(PolyhedronMesh));
         mesh = nullptr;
@@ -84,6 +157,24 @@ PolyhedronMesh* PolyhedronMesh::create(PolygonVertexArray* polygonVertexArray, M
     return mesh;
 }
 
+// Initialize the mesh and return true if the mesh is valid
+bool PolyhedronMesh::init() {
+
+    // Create the half-edge structure of the mesh
+    bool isValid = createHalfEdgeStructure();
+
+    if (isValid) {
+
+        // Compute the faces normals
+        computeFacesNormals();
+
+        // Compute the centroid
+        computeCentroid();
+    }
+
+    return isValid;
+}
+
 // Create the half-edge structure of the mesh
 /// This method returns true if the mesh is valid or false otherwise
 bool PolyhedronMesh::createHalfEdgeStructure() {
@@ -174,6 +265,8 @@ Vector3 PolyhedronMesh::getVertex(uint32 index) const {
 }
 
 // Compute the faces normals
+/// We sum the cross products of all the triangles of a fan over the face (area-weighted normal) so that
+/// the normal is still accurate if the first vertices of a face are almost colinear
 void PolyhedronMesh::computeFacesNormals() {
 
     // For each face
@@ -183,9 +276,14 @@ void PolyhedronMesh::computeFacesNormals() {
 
         assert(face.faceVertices.size() >= 3);
 
-        const Vector3 vec1 = getVertex(face.faceVertices[1]) - getVertex(face.faceVertices[0]);
-        const Vector3 vec2 = getVertex(face.faceVertices[2]) - getVertex(face.faceVertices[0]);
-        mFacesNormals[f] = vec1.cross(vec2);
+        const uint32 nbFaceVertices = static_cast<uint32>(face.faceVertices.size());
+        const Vector3 v0 = getVertex(face.faceVertices[0]);
+        mFacesNormals[f].setToZero();
+        for (uint32 v=2; v < nbFaceVertices; v++) {
+            const Vector3 vec1 = getVertex(face.faceVertices[v - 1]) - v0;
+            const Vector3 vec2 = getVertex(face.faceVertices[v]) - v0;
+            mFacesNormals[f] += vec1.cross(vec2);
+        }
         mFacesNormals[f].normalize();
     }
 }
@@ -38,6 +38,8 @@ using namespace reactphysics3d;
 /// vertices normals will be computed automatically. The vertices normals are
 /// computed with weighted average of the associated triangle face normal. The
 /// weights are the angle between the associated edges of neighbor triangle face.
+/// The normals are only computed the first time they are requested so that no
+/// time or memory is spent on meshes whose normals are never used.
 /**
  * @param nbVertices Number of vertices in the array
  * @param verticesStart Pointer to the first vertices of the array
@@ -63,9 +65,6 @@ TriangleVertexArray::TriangleVertexArray(uint32 nbVertices, const void* vertices
     mVertexNormaldDataType = NormalDataType::NORMAL_FLOAT_TYPE;
     mIndexDataType = indexDataType;
     mAreVerticesNormalsProvidedByUser = false;
-
-    // Compute the vertices normals because they are not provided by the user
-    computeVerticesNormals();
 }
 
 // Constructor with vertices normals
@@ -110,8 +109,8 @@ TriangleVertexArray::TriangleVertexArray(uint32 nbVertices, const void* vertices
 // Destructor
 TriangleVertexArray::~TriangleVertexArray() {
 
-    // If the vertices normals have not been provided by the user
-    if (!mAreVerticesNormalsProvidedByUser) {
+    // If the vertices normals have not been provided by the user and have been computed
+    if (!mAreVerticesNormalsProvidedByUser && mVerticesNormalsStart != nullptr) {
 
         // Release the allocated memory
         const void* verticesNormalPointer = static_cast<const void*>(mVerticesNormalsStart);
@@ -123,8 +122,12 @@ TriangleVertexArray::~TriangleVertexArray() {
 // Compute the vertices normals when they are not provided by the user
 /// The vertices normals are computed with weighted average of the associated
 /// triangle face normal. The weights are the angle between the associated edges
-/// of neighbor triangle face.
-void TriangleVertexArray::computeVerticesNormals() {
+/// of neighbor triangle face. This method is called the first time the normals
+/// are requested.
+void TriangleVertexArray::computeVerticesNormals() const {
+
+    assert(!mAreVerticesNormalsProvidedByUser);
+    assert(mVerticesNormalsStart == nullptr);
 
     // Allocate memory for the vertices normals
     float* verticesNormals = new float[mNbVertices * 3];
@@ -268,6 +271,11 @@ void TriangleVertexArray::getTriangleVerticesNormals(uint32 triangleIndex, Vecto
 
     assert(triangleIndex < mNbTriangles);
 
+    // Compute the vertices normals the first time they are needed
+    if (mVerticesNormalsStart == nullptr) {
+        computeVerticesNormals();
+    }
+
     // Get the three vertex index of the three vertices of the triangle
     uint32 verticesIndices[3];
     getTriangleVerticesIndices(triangleIndex, verticesIndices);
@@ -336,6 +344,11 @@ void TriangleVertexArray::getNormal(uint32 vertexIndex, Vector3* outNormal) {
 
     assert(vertexIndex < mNbVertices);
 
+    // Compute the vertices normals the first time they are needed
+    if (mVerticesNormalsStart == nullptr) {
+        computeVerticesNormals();
+    }
+
     const uchar* vertexNormalPointerChar = mVerticesNormalsStart + vertexIndex * mVerticesNormalsStride;
     const void* vertexNormalPointer = static_cast<const void*>(vertexNormalPointerChar);
 
@@ -0,0 +1,497 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2022 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+// Libraries
+#include <reactphysics3d/collision/broadphase/StaticAABBTree.h>
+#include <reactphysics3d/collision/broadphase/DynamicAABBTree.h>
+#include <reactphysics3d/containers/Stack.h>
+#include <reactphysics3d/mathematics/mathematics_functions.h>
+#include <reactphysics3d/utils/Profiler.h>
+#include <cmath>
+
+using namespace reactphysics3d;
+
+// Initialization of static variables
+const uint32 StaticTreeNode::LEAF_BIT = uint32(1) << 31;
+const decimal StaticAABBTree::QUANTIZATION_MAX = decimal(65535.0);
+
+// Constructor
+StaticAABBTree::StaticAABBTree(MemoryAllocator& allocator)
+               : mAllocator(allocator), mNodes(allocator), mObjectsData(allocator), mNodesData(nullptr), mObjectsDataPointer(nullptr),
+                 mObjectsAABBs(allocator), mNbObjects(0),
+                 mRootAABB(Vector3::zero(), Vector3::zero()), mQuantizationScale(Vector3::zero()),
+                 mQuantizationScaleInverse(Vector3::zero()) {
+
+#ifdef IS_RP3D_PROFILING_ENABLED
+
+    mProfiler = nullptr;
+
+#endif
+
+}
+
+// Add an object to be inserted into the tree when it is built
+void StaticAABBTree::addObject(const AABB& aabb, int32 data1, int32 data2) {
+
+    // Objects cannot be added once the tree has been built
+    assert(mNodes.size() == 0);
+
+    mObjectsAABBs.add(aabb);
+    mObjectsData.add(data1);
+    mObjectsData.add(data2);
+    mNbObjects++;
+}
+
+// Build the tree with all the objects that have been added
+/// The tree is built top-down. Each range of objects is split in two using the Surface Area
+/// Heuristic evaluated on bins of the object centers along the three axes. The nodes are
+/// created in depth-first order using a stack of ranges to split. Once the tree has been
+/// built, the AABBs of the objects are released because only the quantized AABBs stored in
+/// the nodes are used by the queries.
+void StaticAABBTree::build() {
+
+    RP3D_PROFILE("StaticAABBTree::build()", mProfiler);
+
+    assert(mNodes.size() == 0);
+
+    if (mNbObjects == 0) return;
+
+    // Compute the AABB of the whole tree
+    mRootAABB = mObjectsAABBs[0];
+    for (uint32 i=1; i < mNbObjects; i++) {
+        mRootAABB.mergeWithAABB(mObjectsAABBs[i]);
+    }
+
+    computeQuantizationScales();
+
+    // A tree with a single object does not have any node
+    if (mNbObjects > 1) {
+
+        Array<uint32> objectsIndices(mAllocator, mNbObjects);
+        Array<Vector3> centers(mAllocator, mNbObjects);
+        for (uint32 i=0; i < mNbObjects; i++) {
+            objectsIndices.add(i);
+            centers.add(mObjectsAABBs[i].getCenter());
+        }
+
+        // A binary tree with one object per leaf has exactly one node less than the number of objects
+        mNodes.reserve(mNbObjects - 1);
+
+        Stack<BuildTask> stack(mAllocator, 64);
+        stack.push(BuildTask{0, mNbObjects, 0, 0});
+
+        while (stack.size() > 0) {
+
+            const BuildTask task = stack.pop();
+
+            // Create the node for this range of objects and link it with its parent
+            const uint32 nodeIndex = static_cast<uint32>(mNodes.size());
+            mNodes.add(StaticTreeNode());
+            if (nodeIndex > 0) {
+                mNodes[task.parentNode].children[task.parentChild] = nodeIndex;
+            }
+
+            // Split the objects of the range in two
+            AABB leftAABB, rightAABB;
+            const uint32 middle = splitObjects(objectsIndices, centers, task.start, task.end, leftAABB, rightAABB);
+            assert(middle > task.start && middle < task.end);
+
+            // The right child range is pushed first so that the left child node is created right after this node
+            if (task.end - middle == 1) {
+                setChild(nodeIndex, 1, StaticTreeNode::LEAF_BIT | objectsIndices[middle], rightAABB);
+            }
+            else {
+                setChild(nodeIndex, 1, 0, rightAABB);
+                stack.push(BuildTask{middle, task.end, nodeIndex, 1});
+            }
+
+            if (middle - task.start == 1) {
+                setChild(nodeIndex, 0, StaticTreeNode::LEAF_BIT | objectsIndices[task.start], leftAABB);
+            }
+            else {
+                setChild(nodeIndex, 0, 0, leftAABB);
+                stack.push(BuildTask{task.start, middle, nodeIndex, 0});
+            }
+        }
+
+        assert(mNodes.size() == mNbObjects - 1);
+    }
+
+    // The AABBs of the objects are not needed anymore
+    mObjectsAABBs.clear(true);
+
+    mNodesData = mNodes.size() > 0 ? &(mNodes[0]) : nullptr;
+    mObjectsDataPointer = &(mObjectsData[0]);
+}
+
+// Initialize the tree with the nodes and objects data of a tree built before
+/// The nodes and the objects data are not copied. Therefore, they must remain valid
+/// during the lifetime of the tree. The tree must contain getNbObjects() - 1 nodes.
+/**
+ * @param nodes Pointer to the first node of the tree (in depth-first order)
+ * @param objectsData Pointer to the two pieces of data of the first object of the tree
+ * @param nbObjects Number of objects in the tree
+ * @param rootAABB AABB of the whole tree that has been used to quantize the nodes
+ */
+void StaticAABBTree::initFromData(const StaticTreeNode* nodes, const int32* objectsData, uint32 nbObjects, const AABB& rootAABB) {
+
+    assert(mNbObjects == 0);
+
+    mNodesData = nodes;
+    mObjectsDataPointer = objectsData;
+    mNbObjects = nbObjects;
+    mRootAABB = rootAABB;
+
+    computeQuantizationScales();
+}
+
+// Compute the quantization scale factors from the AABB of the whole tree
+/// A flat axis of the tree is always quantized to zero
+void StaticAABBTree::computeQuantizationScales() {
+
+    const Vector3 rootExtent = mRootAABB.getExtent();
+    for (int i=0; i < 3; i++) {
+        if (rootExtent[i] > MACHINE_EPSILON) {
+            mQuantizationScale[i] = QUANTIZATION_MAX / rootExtent[i];
+            mQuantizationScaleInverse[i] = rootExtent[i] / QUANTIZATION_MAX;
+        }
+        else {
+            mQuantizationScale[i] = decimal(0.0);
+            mQuantizationScaleInverse[i] = decimal(0.0);
+        }
+    }
+}
+
+// Split a range of objects in two using the Surface Area Heuristic
+/// The objects indices of the range are reordered so that the objects of the left
+/// part come first. This method returns the index of the first object of the right part.
+uint32 StaticAABBTree::splitObjects(Array<uint32>& objectsIndices, const Array<Vector3>& centers, uint32 start, uint32 end,
+                                    AABB& outLeftAABB, AABB& outRightAABB) const {
+
+    assert(end - start > 1);
+
+    // Compute the bounds of the centers of the objects
+    Vector3 centersMin = centers[objectsIndices[start]];
+    Vector3 centersMax = centersMin;
+    for (uint32 i=start + 1; i < end; i++) {
+        centersMin = Vector3::min(centersMin, centers[objectsIndices[i]]);
+        centersMax = Vector3::max(centersMax, centers[objectsIndices[i]]);
+    }
+
+    decimal bestCost = DECIMAL_LARGEST;
+    int bestAxis = -1;
+    uint32 bestBin = 0;
+
+    // For each axis
+    for (int axis=0; axis < 3; axis++) {
+
+        const decimal centersExtent = centersMax[axis] - centersMin[axis];
+        if (centersExtent <= MACHINE_EPSILON) continue;
+
+        const decimal binScale = decimal(NB_SAH_BINS) / centersExtent;
+
+        // Compute the number of objects and the AABB of each bin
+        uint32 binsNbObjects[NB_SAH_BINS] = {0};
+        AABB binsAABBs[NB_SAH_BINS];
+        for (uint32 i=start; i < end; i++) {
+
+            const uint32 objectIndex = objectsIndices[i];
+            const uint32 bin = std::min(static_cast<uint32>((centers[objectIndex][axis] - centersMin[axis]) * binScale), NB_SAH_BINS - 1);
+
+            if (binsNbObjects[bin] == 0) {
+                binsAABBs[bin] = mObjectsAABBs[objectIndex];
+            }
+            else {
+                binsAABBs[bin].mergeWithAABB(mObjectsAABBs[objectIndex]);
+            }
+            binsNbObjects[bin]++;
+        }
+
+        // Sweep the bins from the right to compute the cost of the right part of each split
+        decimal rightCosts[NB_SAH_BINS];
+        AABB rightAABB;
+        uint32 nbRightObjects = 0;
+        for (uint32 b=NB_SAH_BINS - 1; b > 0; b--) {
+            if (binsNbObjects[b] > 0) {
+                if (nbRightObjects == 0) {
+                    rightAABB = binsAABBs[b];
+                }
+                else {
+                    rightAABB.mergeWithAABB(binsAABBs[b]);
+                }
+                nbRightObjects += binsNbObjects[b];
+            }
+            rightCosts[b] = nbRightObjects > 0 ? computeHalfSurfaceArea(rightAABB) * nbRightObjects : decimal(-1.0);
+        }
+
+        // Sweep the bins from the left and keep the split with the smallest cost
+        AABB leftAABB;
+        uint32 nbLeftObjects = 0;
+        for (uint32 b=0; b < NB_SAH_BINS - 1; b++) {
+            if (binsNbObjects[b] > 0) {
+                if (nbLeftObjects == 0) {
+                    leftAABB = binsAABBs[b];
+                }
+                else {
+                    leftAABB.mergeWithAABB(binsAABBs[b]);
+                }
+                nbLeftObjects += binsNbObjects[b];
+            }
+
+            // Both parts of the split must contain objects
+            if (nbLeftObjects > 0 && rightCosts[b + 1] >= decimal(0.0)) {
+
+                const decimal cost = computeHalfSurfaceArea(leftAABB) * nbLeftObjects + rightCosts[b + 1];
+                if (cost < bestCost) {
+                    bestCost = cost;
+                    bestAxis = axis;
+                    bestBin = b;
+                }
+            }
+        }
+    }
+
+    uint32 middle;
+
+    // If all the centers are at the same position, we split the range in the middle
+    if (bestAxis == -1) {
+        middle = start + (end - start) / 2;
+    }
+    else {
+
+        // Move the objects of the bins on the left of the split at the beginning of the range
+        const decimal binScale = decimal(NB_SAH_BINS) / (centersMax[bestAxis] - centersMin[bestAxis]);
+        middle = start;
+        for (uint32 i=start; i < end; i++) {
+
+            const uint32 objectIndex = objectsIndices[i];
+            const uint32 bin = std::min(static_cast<uint32>((centers[objectIndex][bestAxis] - centersMin[bestAxis]) * binScale), NB_SAH_BINS - 1);
+            if (bin <= bestBin) {
+                objectsIndices[i] = objectsIndices[middle];
+                objectsIndices[middle] = objectIndex;
+                middle++;
+            }
+        }
+    }
+
+    // Compute the AABBs of the two parts
+    outLeftAABB = mObjectsAABBs[objectsIndices[start]];
+    for (uint32 i=start + 1; i < middle; i++) {
+        outLeftAABB.mergeWithAABB(mObjectsAABBs[objectsIndices[i]]);
+    }
+    outRightAABB = mObjectsAABBs[objectsIndices[middle]];
+    for (uint32 i=middle + 1; i < end; i++) {
+        outRightAABB.mergeWithAABB(mObjectsAABBs[objectsIndices[i]]);
+    }
+
+    return middle;
+}
+
+// Return half the surface area of an AABB
+decimal StaticAABBTree::computeHalfSurfaceArea(const AABB& aabb) {
+    const Vector3 extent = aabb.getExtent();
+    return extent.x * extent.y + extent.y * extent.z + extent.z * extent.x;
+}
+
+// Quantize an AABB (the result contains the AABB)
+/// The minimum coordinates are rounded down and the maximum coordinates are rounded up. One more
+/// quantization step is added on each side to absorb the floating-point rounding errors.
+void StaticAABBTree::quantize(const AABB& aabb, uint16* outMin, uint16* outMax) const {
+
+    const Vector3& rootMin = mRootAABB.getMin();
+
+    for (int i=0; i < 3; i++) {
+        const decimal min = std::floor((aabb.getMin()[i] - rootMin[i]) * mQuantizationScale[i]) - decimal(1.0);
+        const decimal max = std::ceil((aabb.getMax()[i] - rootMin[i]) * mQuantizationScale[i]) + decimal(1.0);
+        outMin[i] = static_cast<uint16>(clamp(min, decimal(0.0), QUANTIZATION_MAX));
+        outMax[i] = static_cast<uint16>(clamp(max, decimal(0.0), QUANTIZATION_MAX));
+    }
+}
+
+// Return the dequantized AABB of a child of a node
+AABB StaticAABBTree::dequantize(const StaticTreeNode& node, uint32 childIndex) const {
+
+    const Vector3& rootMin = mRootAABB.getMin();
+
+    return AABB(Vector3(rootMin.x + node.childrenMin[childIndex][0] * mQuantizationScaleInverse.x,
+                        rootMin.y + node.childrenMin[childIndex][1] * mQuantizationScaleInverse.y,
+                        rootMin.z + node.childrenMin[childIndex][2] * mQuantizationScaleInverse.z),
+                Vector3(rootMin.x + node.childrenMax[childIndex][0] * mQuantizationScaleInverse.x,
+                        rootMin.y + node.childrenMax[childIndex][1] * mQuantizationScaleInverse.y,
+                        rootMin.z + node.childrenMax[childIndex][2] * mQuantizationScaleInverse.z));
+}
+
+// Set the quantized AABB and the value of a child of a node
+void StaticAABBTree::setChild(uint32 nodeIndex, uint32 childIndex, uint32 child, const AABB& aabb) {
+
+    StaticTreeNode& node = mNodes[nodeIndex];
+    node.children[childIndex] = child;
+    quantize(aabb, node.childrenMin[childIndex], node.childrenMax[childIndex]);
+}
+
+// Return the indices of all the objects in the depth-first order of the leaves of the tree
+/// Consecutive objects in this order are close to each other in space
+void StaticAABBTree::getObjectsInDepthFirstOrder(Array<uint32>& outObjects) const {
+
+    if (mNbObjects == 1) {
+        outObjects.add(0);
+        return;
+    }
+
+    if (mNbObjects == 0) return;
+
+    // The stack contains the values of the children to visit (nodes or leaves)
+    Stack<uint32> stack(mAllocator, 64);
+    stack.push(0);
+
+    while (stack.size() > 0) {
+
+        const uint32 child = stack.pop();
+
+        // If the child is a leaf, we report its object. Otherwise, we visit its children
+        if ((child & StaticTreeNode::LEAF_BIT) != 0) {
+            outObjects.add(child & ~StaticTreeNode::LEAF_BIT);
+        }
+        else {
+
+            // The second child is pushed first so that the first child is visited first
+            stack.push(mNodesData[child].children[1]);
+            stack.push(mNodesData[child].children[0]);
+        }
+    }
+}
+
+// Report all the objects whose quantized AABB overlaps with the AABB in parameter
+/// The AABB in parameter is quantized once and the tree is traversed using only integer comparisons
+void StaticAABBTree::reportAllShapesOverlappingWithAABB(const AABB& aabb, Array<int32>& overlappingObjects) const {
+
+    RP3D_PROFILE("StaticAABBTree::reportAllShapesOverlappingWithAABB()", mProfiler);
+
+    // If the AABB does not overlap with the tree (this must be tested before quantizing the AABB)
+    if (mNbObjects == 0 || !aabb.testCollision(mRootAABB)) return;
+
+    if (mNbObjects == 1) {
+        overlappingObjects.add(0);
+        return;
+    }
+
+    uint16 min[3];
+    uint16 max[3];
+    quantize(aabb, min, max);
+
+    // Create a stack with the nodes to visit
+    Stack<uint32> stack(mAllocator, 64);
+    stack.push(0);
+
+    // While there are still nodes to visit
+    while (stack.size() > 0) {
+
+        const StaticTreeNode& node = mNodesData[stack.pop()];
+
+        // For each child of the node
+        for (uint32 c=0; c < 2; c++) {
+
+            // If the AABB in parameter overlaps with the AABB of the child
+            if (testOverlap(min, max, node, c)) {
+
+                const uint32 child = node.children[c];
+
+                // If the child is a leaf, we report its object. Otherwise, we need to visit the child node
+                if ((child & StaticTreeNode::LEAF_BIT) != 0) {
+                    overlappingObjects.add(static_cast<int32>(child & ~StaticTreeNode::LEAF_BIT));
+                }
+                else {
+                    stack.push(child);
+                }
+            }
+        }
+    }
+}
+
+// Ray casting method
+/// The callback is called with the index of each object whose quantized AABB is hit by the ray
+void StaticAABBTree::raycast(const Ray& ray, DynamicAABBTreeRaycastCallback& callback) const {
+
+    RP3D_PROFILE("StaticAABBTree::raycast()", mProfiler);
+
+    if (mNbObjects == 0) return;
+
+    decimal maxFraction = ray.maxFraction;
+
+    // Compute the inverse ray direction
+    const Vector3 rayDirection = ray.point2 - ray.point1;
+    const Vector3 rayDirectionInverse(decimal(1.0) / rayDirection.x, decimal(1.0) / rayDirection.y, decimal(1.0) / rayDirection.z);
+
+    // Test if the ray intersects with the AABB of the whole tree
+    if (!mRootAABB.testRayIntersect(ray.point1, rayDirectionInverse, maxFraction)) return;
+
+    if (mNbObjects == 1) {
+        callback.raycastBroadPhaseShape(0, ray);
+        return;
+    }
+
+    Stack<uint32> stack(mAllocator, 128);
+    stack.push(0);
+
+    // Walk through the tree from the root looking for objects whose AABB is hit by the ray
+    while (stack.size() > 0) {
+
+        const StaticTreeNode& node = mNodesData[stack.pop()];
+
+        // For each child of the node
+        for (uint32 c=0; c < 2; c++) {
+
+            // Test if the ray intersects with the AABB of the child
+            if (!dequantize(node, c).testRayIntersect(ray.point1, rayDirectionInverse, maxFraction)) continue;
+
+            const uint32 child = node.children[c];
+
+            // If the child is a leaf
+            if ((child & StaticTreeNode::LEAF_BIT) != 0) {
+
+                Ray rayTemp(ray.point1, ray.point2, maxFraction);
+
+                // Call the callback that will raycast again the object
+                decimal hitFraction = callback.raycastBroadPhaseShape(static_cast<int32>(child & ~StaticTreeNode::LEAF_BIT), rayTemp);
+
+                // If the user returned a hitFraction of zero, it means that
+                // the raycasting should stop here
+                if (hitFraction == decimal(0.0)) {
+                    return;
+                }
+
+                // If the user returned a positive fraction, we update the maximum fraction of the ray
+                if (hitFraction > decimal(0.0) && hitFraction < maxFraction) {
+                    maxFraction = hitFraction;
+                }
+            }
+            else {
+
+                // We need to visit the child node
+                stack.push(child);
+            }
+        }
+    }
+}
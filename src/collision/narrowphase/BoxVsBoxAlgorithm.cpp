@@ -0,0 +1,484 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2022 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+// Libraries
+#include <reactphysics3d/collision/narrowphase/BoxVsBoxAlgorithm.h>
+#include <reactphysics3d/collision/shapes/BoxShape.h>
+#include <reactphysics3d/collision/narrowphase/NarrowPhaseInfoBatch.h>
+#include <reactphysics3d/engine/OverlappingPairs.h>
+#include <reactphysics3d/mathematics/mathematics_functions.h>
+#include <reactphysics3d/utils/Profiler.h>
+
+// We want to use the ReactPhysics3D namespace
+using namespace reactphysics3d;
+
+// Static variables initialization
+const decimal BoxVsBoxAlgorithm::SEPARATING_AXIS_RELATIVE_TOLERANCE = decimal(1.002);
+const decimal BoxVsBoxAlgorithm::SEPARATING_AXIS_ABSOLUTE_TOLERANCE = decimal(0.0005);
+const decimal BoxVsBoxAlgorithm::PARALLEL_EDGES_EPSILON = decimal(0.00001);
+
+// Compute the narrow-phase collision detection between two boxes
+// The candidate separating axes are indexed as follows: 0-2 are the face normals of box 1,
+// 3-5 are the face normals of box 2 and 6-14 are the cross products (3 * i + j) of the edge
+// direction i of box 1 with the edge direction j of box 2.
+bool BoxVsBoxAlgorithm::testCollision(NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint32 batchStartIndex, uint32 batchNbItems,
+                                      bool clipWithPreviousAxisIfStillColliding, MemoryAllocator& /*memoryAllocator*/) {
+
+    RP3D_PROFILE("BoxVsBoxAlgorithm::testCollision()", mProfiler);
+
+    bool isCollisionFound = false;
+
+    // For each item in the batch
+    for (uint32 batchIndex = batchStartIndex; batchIndex < batchStartIndex + batchNbItems; batchIndex++) {
+
+        assert(narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].collisionShape1->getName() == CollisionShapeName::BOX);
+        assert(narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].collisionShape2->getName() == CollisionShapeName::BOX);
+        assert(narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].nbContactPoints == 0);
+
+        const BoxShape* box1 = static_cast<const BoxShape*>(narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].collisionShape1);
+        const BoxShape* box2 = static_cast<const BoxShape*>(narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].collisionShape2);
+
+        const Vector3 halfExtents1 = box1->getHalfExtents();
+        const Vector3 halfExtents2 = box2->getHalfExtents();
+
+        // Compute the transform from the local-space of box 2 to the local-space of box 1
+        const Transform box2ToBox1 = narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].shape1ToWorldTransform.getInverse() *
+                                     narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].shape2ToWorldTransform;
+        const Matrix3x3 orientation = box2ToBox1.getOrientation().getMatrix();
+        const Vector3& box2Center = box2ToBox1.getPosition();
+        const Matrix3x3 absOrientation(std::abs(orientation[0][0]), std::abs(orientation[0][1]), std::abs(orientation[0][2]),
+                                       std::abs(orientation[1][0]), std::abs(orientation[1][1]), std::abs(orientation[1][2]),
+                                       std::abs(orientation[2][0]), std::abs(orientation[2][1]), std::abs(orientation[2][2]));
+
+        LastFrameCollisionInfo* lastFrameCollisionInfo = narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].lastFrameCollisionInfo;
+
+        // If the last frame collision info is valid and was also using SAT algorithm
+        if (lastFrameCollisionInfo->isValid && lastFrameCollisionInfo->wasUsingSAT) {
+
+            // We perform temporal coherence, we check if there is still an overlapping along the previous minimum separating
+            // axis. If the boxes are still separated along this axis, we directly exit with no collision. If they were
+            // colliding and are still overlapping along a previous face axis, we use this axis to clip the faces.
+            const uint32 previousAxisIndex = getPreviousSeparatingAxis(lastFrameCollisionInfo);
+
+            Vector3 axis;
+            const decimal penetrationDepth = computeAxisPenetrationDepth(previousAxisIndex, halfExtents1, halfExtents2, orientation,
+                                                                         absOrientation, box2Center, axis);
+
+            // If the previous axis was a separating axis and is still a separating axis in this frame
+            if (!lastFrameCollisionInfo->wasColliding && penetrationDepth <= decimal(0.0)) {
+
+                // Return no collision without testing the other axes
+                continue;
+            }
+
+            // The two boxes were overlapping in the previous frame and still seem to overlap in this one
+            if (lastFrameCollisionInfo->wasColliding && clipWithPreviousAxisIfStillColliding && previousAxisIndex < 6 &&
+                penetrationDepth > decimal(0.0) && narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].reportContacts) {
+
+                // If the contact manifold is not empty, we can return without testing the other axes
+                if (computeFaceContactPoints(previousAxisIndex, box1, box2, box2ToBox1, narrowPhaseInfoBatch, batchIndex)) {
+
+                    narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].isColliding = true;
+                    isCollisionFound = true;
+                    continue;
+                }
+
+                // The contact manifold is empty. Therefore, we have to test all the axes again
+            }
+        }
+
+        // Test all the candidate separating axes and keep the axis with minimum
+        // penetration depth for the faces of box 1, the faces of box 2 and the edges
+        decimal minPenetrationDepthFaces1 = DECIMAL_LARGEST;
+        decimal minPenetrationDepthFaces2 = DECIMAL_LARGEST;
+        decimal minPenetrationDepthEdges = DECIMAL_LARGEST;
+        uint32 minAxisFaces1 = 0;
+        uint32 minAxisFaces2 = 3;
+        uint32 minAxisEdges = NB_SEPARATING_AXES;
+        Vector3 minAxisEdgesBox1Space;
+        bool separatingAxisFound = false;
+
+        for (uint32 axisIndex = 0; axisIndex < NB_SEPARATING_AXES; axisIndex++) {
+
+            Vector3 axis;
+            const decimal penetrationDepth = computeAxisPenetrationDepth(axisIndex, halfExtents1, halfExtents2, orientation,
+                                                                         absOrientation, box2Center, axis);
+
+            // If we have found a separating axis
+            if (penetrationDepth <= decimal(0.0)) {
+
+                saveSeparatingAxis(lastFrameCollisionInfo, axisIndex);
+                separatingAxisFound = true;
+                break;
+            }
+
+            if (axisIndex < 3) {
+                if (penetrationDepth < minPenetrationDepthFaces1) {
+                    minPenetrationDepthFaces1 = penetrationDepth;
+                    minAxisFaces1 = axisIndex;
+                }
+            }
+            else if (axisIndex < 6) {
+                if (penetrationDepth < minPenetrationDepthFaces2) {
+                    minPenetrationDepthFaces2 = penetrationDepth;
+                    minAxisFaces2 = axisIndex;
+                }
+            }
+            else if (penetrationDepth < minPenetrationDepthEdges) {
+                minPenetrationDepthEdges = penetrationDepth;
+                minAxisEdges = axisIndex;
+                minAxisEdgesBox1Space = axis;
+            }
+        }
+
+        if (separatingAxisFound) {
+            continue;
+        }
+
+        // Here we know that the boxes are overlapping. As in the generic SAT algorithm, we use a relative and
+        // absolute bias so that we prefer the faces of box 1 over the faces of box 2 and the faces over the
+        // edges when the penetration depths are almost the same. This is better for stability.
+        const bool isMinAxisFaceBox1 = minPenetrationDepthFaces1 < minPenetrationDepthFaces2 * SEPARATING_AXIS_RELATIVE_TOLERANCE +
+                                                                   SEPARATING_AXIS_ABSOLUTE_TOLERANCE;
+        const decimal minPenetrationDepthFaces = std::min(minPenetrationDepthFaces1, minPenetrationDepthFaces2);
+        const bool isMinAxisEdge = minAxisEdges < NB_SEPARATING_AXES &&
+                                   minPenetrationDepthEdges * SEPARATING_AXIS_RELATIVE_TOLERANCE + SEPARATING_AXIS_ABSOLUTE_TOLERANCE < minPenetrationDepthFaces;
+        const uint32 minAxis = isMinAxisEdge ? minAxisEdges : (isMinAxisFaceBox1 ? minAxisFaces1 : minAxisFaces2);
+
+        saveSeparatingAxis(lastFrameCollisionInfo, minAxis);
+
+        // If we need to report contacts
+        if (narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].reportContacts) {
+
+            if (isMinAxisEdge) {
+
+                const uint32 edge1Index = (minAxis - 6) / 3;
+                const uint32 edge2Index = (minAxis - 6) % 3;
+                computeEdgeContactPoint(box1, box2, edge1Index, edge2Index, minAxisEdgesBox1Space, minPenetrationDepthEdges,
+                                        box2ToBox1, narrowPhaseInfoBatch, batchIndex);
+            }
+            else if (!computeFaceContactPoints(minAxis, box1, box2, box2ToBox1, narrowPhaseInfoBatch, batchIndex)) {
+
+                // There should be clipping points here. If it is not the case, it might be
+                // because of a numerical issue. We return no collision.
+                continue;
+            }
+        }
+
+        narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].isColliding = true;
+        isCollisionFound = true;
+    }
+
+    for (uint32 batchIndex = batchStartIndex; batchIndex < batchStartIndex + batchNbItems; batchIndex++) {
+
+        // Get the last frame collision info
+        LastFrameCollisionInfo* lastFrameCollisionInfo = narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].lastFrameCollisionInfo;
+
+        lastFrameCollisionInfo->wasUsingSAT = true;
+        lastFrameCollisionInfo->wasUsingGJK = false;
+    }
+
+    return isCollisionFound;
+}
+
+// Compute the penetration depth of the two boxes along a given candidate separating axis
+/// The returned axis is a unit vector in the local-space of box 1 that points from box 1 toward box 2.
+/// A penetration depth smaller or equal to zero means that the axis is a separating axis. If the axis
+/// is the cross product of two parallel edges, it is not a valid axis and DECIMAL_LARGEST is returned.
+decimal BoxVsBoxAlgorithm::computeAxisPenetrationDepth(uint32 axisIndex, const Vector3& halfExtents1, const Vector3& halfExtents2,
+                                                       const Matrix3x3& box2ToBox1Orientation, const Matrix3x3& absBox2ToBox1Orientation,
+                                                       const Vector3& box2CenterBox1Space, Vector3& outAxisBox1Space) const {
+
+    const Matrix3x3& R = box2ToBox1Orientation;
+    const Matrix3x3& absR = absBox2ToBox1Orientation;
+    const Vector3& t = box2CenterBox1Space;
+
+    // Face normal of box 1
+    if (axisIndex < 3) {
+
+        const int i = static_cast<int>(axisIndex);
+        const decimal projectedRadius1 = halfExtents1[i];
+        const decimal projectedRadius2 = halfExtents2.dot(absR[i]);
+
+        outAxisBox1Space.setToZero();
+        outAxisBox1Space[i] = t[i] < decimal(0.0) ? decimal(-1.0) : decimal(1.0);
+
+        return projectedRadius1 + projectedRadius2 - std::abs(t[i]);
+    }
+
+    // Face normal of box 2
+    if (axisIndex < 6) {
+
+        const int j = static_cast<int>(axisIndex) - 3;
+        const Vector3 axis = R.getColumn(j);
+        const decimal distance = axis.dot(t);
+        const decimal projectedRadius1 = halfExtents1.dot(absR.getColumn(j));
+        const decimal projectedRadius2 = halfExtents2[j];
+
+        outAxisBox1Space = distance < decimal(0.0) ? -axis : axis;
+
+        return projectedRadius1 + projectedRadius2 - std::abs(distance);
+    }
+
+    // Cross product of the edge direction i of box 1 and the edge direction j of box 2
+    const int i = static_cast<int>(axisIndex - 6) / 3;
+    const int j = static_cast<int>(axisIndex - 6) % 3;
+    const int i1 = (i + 1) % 3;
+    const int i2 = (i + 2) % 3;
+    const int j1 = (j + 1) % 3;
+    const int j2 = (j + 2) % 3;
+
+    // Compute the (non normalized) axis e_i x R_j
+    Vector3 axis;
+    axis[i] = decimal(0.0);
+    axis[i1] = -R[i2][j];
+    axis[i2] = R[i1][j];
+
+    // If the two edges are parallel, the cross product is not a valid axis
+    const decimal axisLengthSquare = axis.lengthSquare();
+    if (axisLengthSquare < PARALLEL_EDGES_EPSILON) {
+        return DECIMAL_LARGEST;
+    }
+
+    // Project the two boxes on the axis (closed form of the sum of the absolute
+    // dot products of the axis with the scaled axes of each box)
+    const decimal projectedRadius1 = halfExtents1[i1] * absR[i2][j] + halfExtents1[i2] * absR[i1][j];
+    const decimal projectedRadius2 = halfExtents2[j1] * absR[i][j2] + halfExtents2[j2] * absR[i][j1];
+    const decimal distance = axis.dot(t);
+
+    const decimal axisLength = std::sqrt(axisLengthSquare);
+    outAxisBox1Space = (distance < decimal(0.0) ? -axis : axis) / axisLength;
+
+    return (projectedRadius1 + projectedRadius2 - std::abs(distance)) / axisLength;
+}
+
+// Compute the contact points between a reference face and an incident face of the two boxes
+/// The reference face is given by a face axis index (0-2 for box 1 and 3-5 for box 2). All the
+/// computations are done in the local-space of the reference box where the side planes of the
+/// reference face are axis-aligned. The method returns true if contact points have been found.
+bool BoxVsBoxAlgorithm::computeFaceContactPoints(uint32 axisIndex, const BoxShape* box1, const BoxShape* box2,
+                                                 const Transform& box2ToBox1, NarrowPhaseInfoBatch& narrowPhaseInfoBatch,
+                                                 uint32 batchIndex) const {
+
+    RP3D_PROFILE("BoxVsBoxAlgorithm::computeFaceContactPoints", mProfiler);
+
+    assert(axisIndex < 6);
+
+    const bool isReferenceBox1 = axisIndex < 3;
+    const int k = static_cast<int>(isReferenceBox1 ? axisIndex : axisIndex - 3);
+    const int k1 = (k + 1) % 3;
+    const int k2 = (k + 2) % 3;
+
+    const Vector3 referenceHalfExtents = isReferenceBox1 ? box1->getHalfExtents() : box2->getHalfExtents();
+    const Vector3 incidentHalfExtents = isReferenceBox1 ? box2->getHalfExtents() : box1->getHalfExtents();
+    const Transform incidentToReference = isReferenceBox1 ? box2ToBox1 : box2ToBox1.getInverse();
+    const Transform referenceToIncident = incidentToReference.getInverse();
+    const Matrix3x3 incidentToReferenceOrientation = incidentToReference.getOrientation().getMatrix();
+
+    // Reference face normal (in reference-space) pointing toward the incident box
+    const decimal normalSign = incidentToReference.getPosition()[k] < decimal(0.0) ? decimal(-1.0) : decimal(1.0);
+    Vector3 referenceNormal(0, 0, 0);
+    referenceNormal[k] = normalSign;
+
+    // The incident face is the face of the incident box that is the most anti-parallel to the reference normal
+    const Vector3 referenceNormalIncidentSpace = incidentToReferenceOrientation[k] * normalSign;
+    const int m = referenceNormalIncidentSpace.getAbsoluteVector().getMaxAxis();
+    const int m1 = (m + 1) % 3;
+    const int m2 = (m + 2) % 3;
+    Vector3 incidentFaceCenter(0, 0, 0);
+    incidentFaceCenter[m] = referenceNormalIncidentSpace[m] > decimal(0.0) ? -incidentHalfExtents[m] : incidentHalfExtents[m];
+    Vector3 incidentEdge1(0, 0, 0);
+    incidentEdge1[m1] = incidentHalfExtents[m1];
+    Vector3 incidentEdge2(0, 0, 0);
+    incidentEdge2[m2] = incidentHalfExtents[m2];
+
+    // Compute the vertices of the incident face in reference-space
+    Vector3 vertices[NB_MAX_CLIPPED_VERTICES];
+    Vector3 clippedVertices[NB_MAX_CLIPPED_VERTICES];
+    vertices[0] = incidentToReference * (incidentFaceCenter + incidentEdge1 + incidentEdge2);
+    vertices[1] = incidentToReference * (incidentFaceCenter - incidentEdge1 + incidentEdge2);
+    vertices[2] = incidentToReference * (incidentFaceCenter - incidentEdge1 - incidentEdge2);
+    vertices[3] = incidentToReference * (incidentFaceCenter + incidentEdge1 - incidentEdge2);
+    uint32 nbVertices = 4;
+
+    // Clip the incident face with the four side planes of the reference face
+    nbVertices = clipPolygonWithAxisAlignedPlane(vertices, nbVertices, clippedVertices, k1, decimal(1.0), referenceHalfExtents[k1]);
+    nbVertices = clipPolygonWithAxisAlignedPlane(clippedVertices, nbVertices, vertices, k1, decimal(-1.0), referenceHalfExtents[k1]);
+    nbVertices = clipPolygonWithAxisAlignedPlane(vertices, nbVertices, clippedVertices, k2, decimal(1.0), referenceHalfExtents[k2]);
+    nbVertices = clipPolygonWithAxisAlignedPlane(clippedVertices, nbVertices, vertices, k2, decimal(-1.0), referenceHalfExtents[k2]);
+
+    // Compute the contact normal in world-space (from box 1 toward box 2)
+    const Vector3 normalWorld = isReferenceBox1 ?
+                narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].shape1ToWorldTransform.getOrientation() * referenceNormal :
+                narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].shape2ToWorldTransform.getOrientation() * (-referenceNormal);
+
+    bool contactPointsFound = false;
+
+    // We only keep the clipped points that are below the reference face
+    for (uint32 i = 0; i < nbVertices; i++) {
+
+        const decimal penetrationDepth = referenceHalfExtents[k] - normalSign * vertices[i][k];
+
+        if (penetrationDepth > decimal(0.0)) {
+
+            contactPointsFound = true;
+
+            // Project the clipped point onto the reference face
+            Vector3 contactPointReferenceBox = vertices[i];
+            contactPointReferenceBox[k] = normalSign * referenceHalfExtents[k];
+
+            const Vector3 contactPointIncidentBox = referenceToIncident * vertices[i];
+
+            // Create a new contact point
+            narrowPhaseInfoBatch.addContactPoint(batchIndex, normalWorld, penetrationDepth,
+                                                 isReferenceBox1 ? contactPointReferenceBox : contactPointIncidentBox,
+                                                 isReferenceBox1 ? contactPointIncidentBox : contactPointReferenceBox);
+        }
+    }
+
+    return contactPointsFound;
+}
+
+// Compute the contact point between two edges of the two boxes
+/// The supporting edges are the edges of each box that are the furthest along
+/// the separating axis (toward the other box).
+void BoxVsBoxAlgorithm::computeEdgeContactPoint(const BoxShape* box1, const BoxShape* box2, uint32 edge1Index, uint32 edge2Index,
+                                                const Vector3& axisBox1Space, decimal penetrationDepth, const Transform& box2ToBox1,
+                                                NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint32 batchIndex) const {
+
+    RP3D_PROFILE("BoxVsBoxAlgorithm::computeEdgeContactPoint", mProfiler);
+
+    const int i = static_cast<int>(edge1Index);
+    const int j = static_cast<int>(edge2Index);
+
+    const Vector3 halfExtents1 = box1->getHalfExtents();
+    const Vector3 halfExtents2 = box2->getHalfExtents();
+
+    // Compute the supporting edge of box 1 (in the local-space of box 1)
+    Vector3 edge1A(axisBox1Space.x < decimal(0.0) ? -halfExtents1.x : halfExtents1.x,
+                   axisBox1Space.y < decimal(0.0) ? -halfExtents1.y : halfExtents1.y,
+                   axisBox1Space.z < decimal(0.0) ? -halfExtents1.z : halfExtents1.z);
+    Vector3 edge1B = edge1A;
+    edge1A[i] = -halfExtents1[i];
+    edge1B[i] = halfExtents1[i];
+
+    // Compute the supporting edge of box 2 (in the local-space of box 2)
+    const Vector3 axisBox2Space = box2ToBox1.getOrientation().getInverse() * axisBox1Space;
+    Vector3 edge2A(axisBox2Space.x > decimal(0.0) ? -halfExtents2.x : halfExtents2.x,
+                   axisBox2Space.y > decimal(0.0) ? -halfExtents2.y : halfExtents2.y,
+                   axisBox2Space.z > decimal(0.0) ? -halfExtents2.z : halfExtents2.z);
+    Vector3 edge2B = edge2A;
+    edge2A[j] = -halfExtents2[j];
+    edge2B[j] = halfExtents2[j];
+
+    // Compute the closest points between the two edges (in the local-space of box 1)
+    Vector3 closestPointBox1Edge, closestPointBox2Edge;
+    computeClosestPointBetweenTwoSegments(edge1A, edge1B, box2ToBox1 * edge2A, box2ToBox1 * edge2B,
+                                          closestPointBox1Edge, closestPointBox2Edge);
+
+    // Compute the world normal
+    const Vector3 normalWorld = narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].shape1ToWorldTransform.getOrientation() * axisBox1Space;
+
+    // Create the contact point
+    narrowPhaseInfoBatch.addContactPoint(batchIndex, normalWorld, penetrationDepth, closestPointBox1Edge,
+                                         box2ToBox1.getInverse() * closestPointBox2Edge);
+}
+
+// Clip a polygon against the plane "sign * x[axis] = offset" and keep the part below it
+/// This is the Sutherland-Hodgman clipping algorithm for a single axis-aligned plane. The
+/// number of vertices of the output polygon is returned.
+uint32 BoxVsBoxAlgorithm::clipPolygonWithAxisAlignedPlane(const Vector3* inputVertices, uint32 nbInputVertices, Vector3* outputVertices,
+                                                          int axis, decimal sign, decimal offset) const {
+
+    uint32 nbOutputVertices = 0;
+
+    if (nbInputVertices == 0) {
+        return 0;
+    }
+
+    uint32 vStartIndex = nbInputVertices - 1;
+    decimal startDistance = sign * inputVertices[vStartIndex][axis] - offset;
+
+    // For each edge of the polygon
+    for (uint32 vEndIndex = 0; vEndIndex < nbInputVertices; vEndIndex++) {
+
+        const Vector3& v1 = inputVertices[vStartIndex];
+        const Vector3& v2 = inputVertices[vEndIndex];
+        const decimal endDistance = sign * v2[axis] - offset;
+
+        // If the edge crosses the plane, add the intersection point
+        if ((startDistance <= decimal(0.0)) != (endDistance <= decimal(0.0))) {
+
+            assert(nbOutputVertices < NB_MAX_CLIPPED_VERTICES);
+            const decimal t = startDistance / (startDistance - endDistance);
+            outputVertices[nbOutputVertices++] = v1 + t * (v2 - v1);
+        }
+
+        // If the end vertex is below the plane, keep it
+        if (endDistance <= decimal(0.0)) {
+
+            assert(nbOutputVertices < NB_MAX_CLIPPED_VERTICES);
+            outputVertices[nbOutputVertices++] = v2;
+        }
+
+        vStartIndex = vEndIndex;
+        startDistance = endDistance;
+    }
+
+    return nbOutputVertices;
+}
+
+// Save the minimum separating axis into the last frame collision info
+void BoxVsBoxAlgorithm::saveSeparatingAxis(LastFrameCollisionInfo* lastFrameCollisionInfo, uint32 axisIndex) const {
+
+    assert(axisIndex < NB_SEPARATING_AXES);
+
+    lastFrameCollisionInfo->satIsAxisFacePolyhedron1 = axisIndex < 3;
+    lastFrameCollisionInfo->satIsAxisFacePolyhedron2 = axisIndex >= 3 && axisIndex < 6;
+
+    if (axisIndex < 3) {
+        lastFrameCollisionInfo->satMinAxisFaceIndex = static_cast<uint8>(axisIndex);
+    }
+    else if (axisIndex < 6) {
+        lastFrameCollisionInfo->satMinAxisFaceIndex = static_cast<uint8>(axisIndex - 3);
+    }
+    else {
+        lastFrameCollisionInfo->satMinEdge1Index = static_cast<uint8>((axisIndex - 6) / 3);
+        lastFrameCollisionInfo->satMinEdge2Index = static_cast<uint8>((axisIndex - 6) % 3);
+    }
+}
+
+// Return the separating axis saved in the last frame collision info
+uint32 BoxVsBoxAlgorithm::getPreviousSeparatingAxis(const LastFrameCollisionInfo* lastFrameCollisionInfo) const {
+
+    if (lastFrameCollisionInfo->satIsAxisFacePolyhedron1) {
+        return lastFrameCollisionInfo->satMinAxisFaceIndex;
+    }
+    if (lastFrameCollisionInfo->satIsAxisFacePolyhedron2) {
+        return 3 + lastFrameCollisionInfo->satMinAxisFaceIndex;
+    }
+
+    return 6 + 3 * lastFrameCollisionInfo->satMinEdge1Index + lastFrameCollisionInfo->satMinEdge2Index;
+}
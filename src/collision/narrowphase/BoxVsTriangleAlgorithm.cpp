@@ -0,0 +1,475 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2022 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+// Libraries
+#include <reactphysics3d/collision/narrowphase/BoxVsTriangleAlgorithm.h>
+#include <reactphysics3d/collision/narrowphase/TriangleNarrowPhaseInfoBatch.h>
+#include <reactphysics3d/collision/shapes/BoxShape.h>
+#include <reactphysics3d/collision/shapes/TriangleShape.h>
+#include <reactphysics3d/mathematics/mathematics_functions.h>
+#include <reactphysics3d/utils/Profiler.h>
+
+// We want to use the ReactPhysics3D namespace
+using namespace reactphysics3d;
+
+// Static variables initialization
+const decimal BoxVsTriangleAlgorithm::SEPARATING_AXIS_RELATIVE_TOLERANCE = decimal(1.002);
+const decimal BoxVsTriangleAlgorithm::SEPARATING_AXIS_ABSOLUTE_TOLERANCE = decimal(0.0005);
+const decimal BoxVsTriangleAlgorithm::PARALLEL_EDGES_EPSILON = decimal(0.00001);
+
+// Compute the narrow-phase collision detection between a box and triangles
+// All the computations are done in the local-space of the box. The candidate separating axes
+// are indexed as follows: 0 is the triangle face normal, 1-3 are the face normals of the box
+// and 4-12 are the cross products (3 * i + j) of the edge direction i of the box with the
+// edge j of the triangle.
+bool BoxVsTriangleAlgorithm::testCollision(TriangleNarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint32 batchStartIndex,
+                                           uint32 batchNbItems, MemoryAllocator& /*memoryAllocator*/) {
+
+    RP3D_PROFILE("BoxVsTriangleAlgorithm::testCollision()", mProfiler);
+
+    bool isCollisionFound = false;
+
+    // The triangles of a given overlapping pair are consecutive in the batch and share the same
+    // transforms. Therefore, we only recompute the transforms when the overlapping pair changes.
+    const OverlappingPairs::OverlappingPair* currentPair = nullptr;
+    Transform triangleToBoxTransform;
+    Transform boxToTriangleTransform;
+
+    // For each item in the batch
+    for (uint32 batchIndex = batchStartIndex; batchIndex < batchStartIndex + batchNbItems; batchIndex++) {
+
+        NarrowPhaseInfoBatch::NarrowPhaseInfo& narrowPhaseInfo = narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex];
+
+        assert(narrowPhaseInfo.nbContactPoints == 0);
+        assert(!narrowPhaseInfo.isColliding);
+
+        // The collision shape of the triangle is null
+        const bool isBoxShape1 = narrowPhaseInfo.collisionShape1 != nullptr;
+        const BoxShape* boxShape = static_cast<const BoxShape*>(isBoxShape1 ? narrowPhaseInfo.collisionShape1 : narrowPhaseInfo.collisionShape2);
+
+        assert(boxShape != nullptr && boxShape->getName() == CollisionShapeName::BOX);
+        assert(narrowPhaseInfo.collisionShape1 == nullptr || narrowPhaseInfo.collisionShape2 == nullptr);
+
+        const Transform& boxToWorldTransform = isBoxShape1 ? narrowPhaseInfo.shape1ToWorldTransform : narrowPhaseInfo.shape2ToWorldTransform;
+
+        if (narrowPhaseInfo.overlappingPair != currentPair) {
+
+            currentPair = narrowPhaseInfo.overlappingPair;
+
+            const Transform& triangleToWorldTransform = isBoxShape1 ? narrowPhaseInfo.shape2ToWorldTransform : narrowPhaseInfo.shape1ToWorldTransform;
+            triangleToBoxTransform = boxToWorldTransform.getInverse() * triangleToWorldTransform;
+            boxToTriangleTransform = triangleToBoxTransform.getInverse();
+        }
+
+        const Vector3 halfExtents = boxShape->getHalfExtents();
+
+        // Compute the vertices of the triangle in the local-space of the box
+        const Vector3* triangleVertices = narrowPhaseInfoBatch.getTriangleVertices(batchIndex);
+        const Vector3 vertices[3] = {triangleToBoxTransform * triangleVertices[0],
+                                     triangleToBoxTransform * triangleVertices[1],
+                                     triangleToBoxTransform * triangleVertices[2]};
+
+        // Compute the triangle face normal
+        Vector3 triangleNormal = (vertices[1] - vertices[0]).cross(vertices[2] - vertices[0]);
+        const decimal triangleNormalLengthSquare = triangleNormal.lengthSquare();
+
+        // Do not generate a contact with a degenerate triangle
+        if (triangleNormalLengthSquare < MACHINE_EPSILON) {
+            continue;
+        }
+        triangleNormal /= std::sqrt(triangleNormalLengthSquare);
+
+        // Compute the directions of the three edges of the triangle
+        Vector3 triangleEdgesDirections[3];
+        for (uint32 j = 0; j < 3; j++) {
+            triangleEdgesDirections[j] = vertices[(j + 1) % 3] - vertices[j];
+            triangleEdgesDirections[j] /= triangleEdgesDirections[j].length();
+        }
+
+        // Test all the candidate separating axes and keep the axis with minimum penetration
+        // depth for the triangle face, the faces of the box and the edges
+        decimal minPenetrationDepthTriangleFace = DECIMAL_LARGEST;
+        decimal minPenetrationDepthBoxFaces = DECIMAL_LARGEST;
+        decimal minPenetrationDepthEdges = DECIMAL_LARGEST;
+        uint32 minAxisBoxFaces = 1;
+        uint32 minAxisEdges = NB_SEPARATING_AXES;
+        Vector3 minAxisTriangleFace;
+        Vector3 minAxisBoxFacesBoxToTriangle;
+        Vector3 minAxisEdgesBoxToTriangle;
+        bool separatingAxisFound = false;
+
+        for (uint32 axisIndex = 0; axisIndex < NB_SEPARATING_AXES; axisIndex++) {
+
+            Vector3 axis(0, 0, 0);
+
+            // Face normal of the triangle
+            if (axisIndex == 0) {
+                axis = triangleNormal;
+            }
+            // Face normal of the box
+            else if (axisIndex < 4) {
+                axis[axisIndex - 1] = decimal(1.0);
+            }
+            // Cross product of the edge direction i of the box and the edge j of the triangle
+            else {
+
+                const int i = static_cast<int>(axisIndex - 4) / 3;
+                const uint32 j = (axisIndex - 4) % 3;
+                const int i1 = (i + 1) % 3;
+                const int i2 = (i + 2) % 3;
+
+                // Compute the (non normalized) axis e_i x edge_j
+                axis[i1] = -triangleEdgesDirections[j][i2];
+                axis[i2] = triangleEdgesDirections[j][i1];
+
+                // If the two edges are parallel, the cross product is not a valid axis
+                const decimal axisLengthSquare = axis.lengthSquare();
+                if (axisLengthSquare < PARALLEL_EDGES_EPSILON) {
+                    continue;
+                }
+                axis /= std::sqrt(axisLengthSquare);
+            }
+
+            Vector3 axisBoxToTriangle;
+            const decimal penetrationDepth = computeAxisPenetrationDepth(axis, halfExtents, vertices, axisBoxToTriangle);
+
+            // If we have found a separating axis
+            if (penetrationDepth <= decimal(0.0)) {
+                separatingAxisFound = true;
+                break;
+            }
+
+            if (axisIndex == 0) {
+                minPenetrationDepthTriangleFace = penetrationDepth;
+                minAxisTriangleFace = axisBoxToTriangle;
+            }
+            else if (axisIndex < 4) {
+                if (penetrationDepth < minPenetrationDepthBoxFaces) {
+                    minPenetrationDepthBoxFaces = penetrationDepth;
+                    minAxisBoxFaces = axisIndex;
+                    minAxisBoxFacesBoxToTriangle = axisBoxToTriangle;
+                }
+            }
+            else if (penetrationDepth < minPenetrationDepthEdges) {
+                minPenetrationDepthEdges = penetrationDepth;
+                minAxisEdges = axisIndex;
+                minAxisEdgesBoxToTriangle = axisBoxToTriangle;
+            }
+        }
+
+        if (separatingAxisFound) {
+            continue;
+        }
+
+        // Here we know that the box and the triangle are overlapping. As in the BoxVsBoxAlgorithm, we use a relative
+        // and absolute bias so that we prefer the triangle face over the faces of the box and the faces over the
+        // edges when the penetration depths are almost the same. This is better for stability.
+        const bool isMinAxisTriangleFace = minPenetrationDepthTriangleFace < minPenetrationDepthBoxFaces * SEPARATING_AXIS_RELATIVE_TOLERANCE +
+                                                                             SEPARATING_AXIS_ABSOLUTE_TOLERANCE;
+        const decimal minPenetrationDepthFaces = std::min(minPenetrationDepthTriangleFace, minPenetrationDepthBoxFaces);
+        const bool isMinAxisEdge = minAxisEdges < NB_SEPARATING_AXES &&
+                                   minPenetrationDepthEdges * SEPARATING_AXIS_RELATIVE_TOLERANCE + SEPARATING_AXIS_ABSOLUTE_TOLERANCE < minPenetrationDepthFaces;
+
+        // If we need to report contacts
+        if (narrowPhaseInfo.reportContacts) {
+
+            if (isMinAxisEdge) {
+
+                const int i = static_cast<int>(minAxisEdges - 4) / 3;
+                const uint32 j = (minAxisEdges - 4) % 3;
+
+                // Compute the supporting edge of the box (the furthest edge toward the triangle)
+                const Vector3& axis = minAxisEdgesBoxToTriangle;
+                Vector3 boxEdgeA(axis.x < decimal(0.0) ? -halfExtents.x : halfExtents.x,
+                                 axis.y < decimal(0.0) ? -halfExtents.y : halfExtents.y,
+                                 axis.z < decimal(0.0) ? -halfExtents.z : halfExtents.z);
+                Vector3 boxEdgeB = boxEdgeA;
+                boxEdgeA[i] = -halfExtents[i];
+                boxEdgeB[i] = halfExtents[i];
+
+                // Compute the closest points between the edge of the box and the edge of the triangle
+                Vector3 closestPointBoxEdge, closestPointTriangleEdge;
+                computeClosestPointBetweenTwoSegments(boxEdgeA, boxEdgeB, vertices[j], vertices[(j + 1) % 3],
+                                                      closestPointBoxEdge, closestPointTriangleEdge);
+
+                addSmoothContactPoint(axis, minPenetrationDepthEdges, closestPointBoxEdge, closestPointTriangleEdge, vertices,
+                                      triangleNormal, isBoxShape1, boxToWorldTransform, boxToTriangleTransform,
+                                      narrowPhaseInfoBatch, batchIndex);
+            }
+            else if (isMinAxisTriangleFace) {
+
+                if (!computeTriangleFaceContactPoints(halfExtents, vertices, triangleNormal, minAxisTriangleFace, isBoxShape1,
+                                                      boxToWorldTransform, boxToTriangleTransform, narrowPhaseInfoBatch, batchIndex)) {
+
+                    // There should be clipping points here. If it is not the case, it might be
+                    // because of a numerical issue. We return no collision.
+                    continue;
+                }
+            }
+            else if (!computeBoxFaceContactPoints(static_cast<int>(minAxisBoxFaces) - 1, halfExtents, vertices, triangleNormal,
+                                                  minAxisBoxFacesBoxToTriangle, isBoxShape1, boxToWorldTransform, boxToTriangleTransform,
+                                                  narrowPhaseInfoBatch, batchIndex)) {
+
+                // There should be clipping points here. If it is not the case, it might be
+                // because of a numerical issue. We return no collision.
+                continue;
+            }
+        }
+
+        narrowPhaseInfo.isColliding = true;
+        isCollisionFound = true;
+    }
+
+    return isCollisionFound;
+}
+
+// Compute the penetration depth of the box and the triangle along a given candidate separating axis
+/// The axis is a unit vector in the local-space of the box. The returned axis is the same axis oriented
+/// from the box toward the triangle. A penetration depth smaller or equal to zero means that the axis
+/// is a separating axis.
+decimal BoxVsTriangleAlgorithm::computeAxisPenetrationDepth(const Vector3& axis, const Vector3& halfExtents, const Vector3* triangleVertices,
+                                                            Vector3& outAxisBoxToTriangle) {
+
+    // Project the box (centered at the origin) on the axis
+    const decimal projectedRadius = halfExtents.dot(axis.getAbsoluteVector());
+
+    // Project the triangle on the axis
+    const decimal projection0 = axis.dot(triangleVertices[0]);
+    const decimal projection1 = axis.dot(triangleVertices[1]);
+    const decimal projection2 = axis.dot(triangleVertices[2]);
+    const decimal minProjection = std::min(projection0, std::min(projection1, projection2));
+    const decimal maxProjection = std::max(projection0, std::max(projection1, projection2));
+
+    // Penetration depths to separate the triangle along the positive and negative directions of the axis
+    const decimal penetrationDepthPositive = projectedRadius - minProjection;
+    const decimal penetrationDepthNegative = maxProjection + projectedRadius;
+
+    if (penetrationDepthPositive < penetrationDepthNegative) {
+        outAxisBoxToTriangle = axis;
+        return penetrationDepthPositive;
+    }
+
+    outAxisBoxToTriangle = -axis;
+    return penetrationDepthNegative;
+}
+
+// Compute the contact points between the triangle face and the incident face of the box
+/// The incident face of the box is clipped against the three side planes of the triangle and
+/// we keep the clipped points that are below the triangle face. The method returns true if
+/// contact points have been found.
+bool BoxVsTriangleAlgorithm::computeTriangleFaceContactPoints(const Vector3& halfExtents, const Vector3* triangleVertices, const Vector3& triangleNormal,
+                                                              const Vector3& axisBoxToTriangle, bool isBoxShape1, const Transform& boxToWorldTransform,
+                                                              const Transform& boxToTriangleTransform, TriangleNarrowPhaseInfoBatch& narrowPhaseInfoBatch,
+                                                              uint32 batchIndex) const {
+
+    RP3D_PROFILE("BoxVsTriangleAlgorithm::computeTriangleFaceContactPoints", mProfiler);
+
+    // The incident face is the face of the box that is the most parallel to the axis (toward the triangle)
+    const int m = axisBoxToTriangle.getAbsoluteVector().getMaxAxis();
+    const int m1 = (m + 1) % 3;
+    const int m2 = (m + 2) % 3;
+    Vector3 incidentFaceCenter(0, 0, 0);
+    incidentFaceCenter[m] = axisBoxToTriangle[m] < decimal(0.0) ? -halfExtents[m] : halfExtents[m];
+    Vector3 incidentEdge1(0, 0, 0);
+    incidentEdge1[m1] = halfExtents[m1];
+    Vector3 incidentEdge2(0, 0, 0);
+    incidentEdge2[m2] = halfExtents[m2];
+
+    // Compute the vertices of the incident face
+    Vector3 vertices[NB_MAX_CLIPPED_VERTICES];
+    Vector3 clippedVertices[NB_MAX_CLIPPED_VERTICES];
+    vertices[0] = incidentFaceCenter + incidentEdge1 + incidentEdge2;
+    vertices[1] = incidentFaceCenter - incidentEdge1 + incidentEdge2;
+    vertices[2] = incidentFaceCenter - incidentEdge1 - incidentEdge2;
+    vertices[3] = incidentFaceCenter + incidentEdge1 - incidentEdge2;
+    uint32 nbVertices = 4;
+
+    // Clip the incident face with the three side planes of the triangle (with normals pointing outside of the triangle)
+    nbVertices = clipPolygonWithPlane(vertices, nbVertices, clippedVertices, triangleVertices[0],
+                                      (triangleVertices[1] - triangleVertices[0]).cross(triangleNormal));
+    nbVertices = clipPolygonWithPlane(clippedVertices, nbVertices, vertices, triangleVertices[1],
+                                      (triangleVertices[2] - triangleVertices[1]).cross(triangleNormal));
+    nbVertices = clipPolygonWithPlane(vertices, nbVertices, clippedVertices, triangleVertices[2],
+                                      (triangleVertices[0] - triangleVertices[2]).cross(triangleNormal));
+
+    bool contactPointsFound = false;
+
+    // We only keep the clipped points that are below the triangle face
+    for (uint32 i = 0; i < nbVertices; i++) {
+
+        const decimal penetrationDepth = axisBoxToTriangle.dot(clippedVertices[i] - triangleVertices[0]);
+
+        if (penetrationDepth > decimal(0.0)) {
+
+            contactPointsFound = true;
+
+            // Project the clipped point onto the triangle face
+            const Vector3 contactPointTriangle = clippedVertices[i] - axisBoxToTriangle * penetrationDepth;
+
+            addSmoothContactPoint(axisBoxToTriangle, penetrationDepth, clippedVertices[i], contactPointTriangle, triangleVertices,
+                                  triangleNormal, isBoxShape1, boxToWorldTransform, boxToTriangleTransform, narrowPhaseInfoBatch,
+                                  batchIndex);
+        }
+    }
+
+    return contactPointsFound;
+}
+
+// Compute the contact points between a face of the box and the triangle
+/// The triangle is clipped against the four side planes of the reference face of the box, which are
+/// axis-aligned in the local-space of the box, and we keep the clipped points that are below the
+/// reference face. The method returns true if contact points have been found.
+bool BoxVsTriangleAlgorithm::computeBoxFaceContactPoints(int faceAxis, const Vector3& halfExtents, const Vector3* triangleVertices,
+                                                         const Vector3& triangleNormal, const Vector3& axisBoxToTriangle, bool isBoxShape1,
+                                                         const Transform& boxToWorldTransform, const Transform& boxToTriangleTransform,
+                                                         TriangleNarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint32 batchIndex) const {
+
+    RP3D_PROFILE("BoxVsTriangleAlgorithm::computeBoxFaceContactPoints", mProfiler);
+
+    const int k = faceAxis;
+    const int k1 = (k + 1) % 3;
+    const int k2 = (k + 2) % 3;
+
+    // Reference face normal pointing toward the triangle
+    const decimal normalSign = axisBoxToTriangle[k] < decimal(0.0) ? decimal(-1.0) : decimal(1.0);
+
+    Vector3 vertices[NB_MAX_CLIPPED_VERTICES];
+    Vector3 clippedVertices[NB_MAX_CLIPPED_VERTICES];
+    vertices[0] = triangleVertices[0];
+    vertices[1] = triangleVertices[1];
+    vertices[2] = triangleVertices[2];
+    uint32 nbVertices = 3;
+
+    // Clip the triangle with the four side planes of the reference face
+    Vector3 sidePlaneNormal1(0, 0, 0);
+    sidePlaneNormal1[k1] = decimal(1.0);
+    Vector3 sidePlaneNormal2(0, 0, 0);
+    sidePlaneNormal2[k2] = decimal(1.0);
+    nbVertices = clipPolygonWithPlane(vertices, nbVertices, clippedVertices, sidePlaneNormal1 * halfExtents[k1], sidePlaneNormal1);
+    nbVertices = clipPolygonWithPlane(clippedVertices, nbVertices, vertices, -sidePlaneNormal1 * halfExtents[k1], -sidePlaneNormal1);
+    nbVertices = clipPolygonWithPlane(vertices, nbVertices, clippedVertices, sidePlaneNormal2 * halfExtents[k2], sidePlaneNormal2);
+    nbVertices = clipPolygonWithPlane(clippedVertices, nbVertices, vertices, -sidePlaneNormal2 * halfExtents[k2], -sidePlaneNormal2);
+
+    bool contactPointsFound = false;
+
+    // We only keep the clipped points that are below the reference face
+    for (uint32 i = 0; i < nbVertices; i++) {
+
+        const decimal penetrationDepth = halfExtents[k] - normalSign * vertices[i][k];
+
+        if (penetrationDepth > decimal(0.0)) {
+
+            contactPointsFound = true;
+
+            // Project the clipped point onto the reference face
+            Vector3 contactPointBox = vertices[i];
+            contactPointBox[k] = normalSign * halfExtents[k];
+
+            addSmoothContactPoint(axisBoxToTriangle, penetrationDepth, contactPointBox, vertices[i], triangleVertices,
+                                  triangleNormal, isBoxShape1, boxToWorldTransform, boxToTriangleTransform, narrowPhaseInfoBatch,
+                                  batchIndex);
+        }
+    }
+
+    return contactPointsFound;
+}
+
+// Add a contact point between the box and a triangle using the smooth mesh normal
+/// The contact points and the normal (from the box toward the triangle) are given in the local-space
+/// of the box. If the contact is in the middle of the triangle face or on an internal edge of the mesh,
+/// the triangle face normal is used as contact normal and the contact point on the box is re-aligned
+/// along this normal (see TriangleShape::computeSmoothMeshContact()).
+void BoxVsTriangleAlgorithm::addSmoothContactPoint(const Vector3& normalBoxToTriangle, decimal penetrationDepth, const Vector3& contactPointBox,
+                                                   const Vector3& contactPointTriangle, const Vector3* triangleVertices, const Vector3& triangleNormal,
+                                                   bool isBoxShape1, const Transform& boxToWorldTransform, const Transform& boxToTriangleTransform,
+                                                   TriangleNarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint32 batchIndex) const {
+
+    Vector3 contactNormal = normalBoxToTriangle;
+    Vector3 contactPointBoxLocal = contactPointBox;
+
+    decimal u, v, w;
+    computeBarycentricCoordinatesInTriangle(triangleVertices[0], triangleVertices[1], triangleVertices[2], contactPointTriangle, u, v, w);
+    if (TriangleShape::isFaceContactNormalAtPoint(u, v, w, narrowPhaseInfoBatch.getTriangleConvexEdges(batchIndex))) {
+
+        // The triangle normal should be the one in the direction out of the current colliding face of the triangle
+        contactNormal = triangleNormal.dot(normalBoxToTriangle) < decimal(0.0) ? -triangleNormal : triangleNormal;
+        contactPointBoxLocal = contactPointTriangle + contactNormal * penetrationDepth;
+    }
+
+    // Compute the contact normal in world-space (from shape 1 toward shape 2)
+    const Vector3 boxWorldNormal = boxToWorldTransform.getOrientation() * contactNormal;
+    const Vector3 normalWorld = isBoxShape1 ? boxWorldNormal : -boxWorldNormal;
+
+    const Vector3 contactPointTriangleLocal = boxToTriangleTransform * contactPointTriangle;
+
+    narrowPhaseInfoBatch.addContactPoint(batchIndex, normalWorld, penetrationDepth,
+                                         isBoxShape1 ? contactPointBoxLocal : contactPointTriangleLocal,
+                                         isBoxShape1 ? contactPointTriangleLocal : contactPointBoxLocal);
+}
+
+// Clip a polygon against a plane and keep the part below it
+/// This is the Sutherland-Hodgman clipping algorithm for a single plane. The part of the polygon
+/// on the side of the plane opposite to its normal is kept. The number of vertices of the output
+/// polygon is returned.
+uint32 BoxVsTriangleAlgorithm::clipPolygonWithPlane(const Vector3* inputVertices, uint32 nbInputVertices, Vector3* outputVertices,
+                                                    const Vector3& planePoint, const Vector3& planeNormal) {
+
+    uint32 nbOutputVertices = 0;
+
+    if (nbInputVertices == 0) {
+        return 0;
+    }
+
+    uint32 vStartIndex = nbInputVertices - 1;
+    decimal startDistance = planeNormal.dot(inputVertices[vStartIndex] - planePoint);
+
+    // For each edge of the polygon
+    for (uint32 vEndIndex = 0; vEndIndex < nbInputVertices; vEndIndex++) {
+
+        const Vector3& v1 = inputVertices[vStartIndex];
+        const Vector3& v2 = inputVertices[vEndIndex];
+        const decimal endDistance = planeNormal.dot(v2 - planePoint);
+
+        // If the edge crosses the plane, add the intersection point
+        if ((startDistance <= decimal(0.0)) != (endDistance <= decimal(0.0))) {
+
+            assert(nbOutputVertices < NB_MAX_CLIPPED_VERTICES);
+            const decimal t = startDistance / (startDistance - endDistance);
+            outputVertices[nbOutputVertices++] = v1 + t * (v2 - v1);
+        }
+
+        // If the end vertex is below the plane, keep it
+        if (endDistance <= decimal(0.0)) {
+
+            assert(nbOutputVertices < NB_MAX_CLIPPED_VERTICES);
+            outputVertices[nbOutputVertices++] = v2;
+        }
+
+        vStartIndex = vEndIndex;
+        startDistance = endDistance;
+    }
+
+    return nbOutputVertices;
+}
@@ -0,0 +1,298 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2022 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+// Libraries
+#include <reactphysics3d/collision/narrowphase/CapsuleVsTriangleAlgorithm.h>
+#include <reactphysics3d/collision/narrowphase/TriangleNarrowPhaseInfoBatch.h>
+#include <reactphysics3d/collision/shapes/CapsuleShape.h>
+#include <reactphysics3d/collision/shapes/TriangleShape.h>
+#include <reactphysics3d/mathematics/mathematics_functions.h>
+#include <reactphysics3d/utils/Profiler.h>
+
+// We want to use the ReactPhysics3D namespace
+using namespace reactphysics3d;
+
+// Static variables initialization
+const decimal CapsuleVsTriangleAlgorithm::FACE_CONTACT_TOLERANCE = decimal(0.001);
+
+// Compute the narrow-phase collision detection between a capsule and triangles
+/// All the computations are done in the local-space of the concave shape, where the
+/// triangles vertices of the batch are defined.
+bool CapsuleVsTriangleAlgorithm::testCollision(TriangleNarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint32 batchStartIndex,
+                                               uint32 batchNbItems, MemoryAllocator& /*memoryAllocator*/) {
+
+    RP3D_PROFILE("CapsuleVsTriangleAlgorithm::testCollision()", mProfiler);
+
+    bool isCollisionFound = false;
+
+    // The triangles of a given overlapping pair are consecutive in the batch and share the same
+    // transforms. Therefore, we only recompute the transforms when the overlapping pair changes.
+    const OverlappingPairs::OverlappingPair* currentPair = nullptr;
+    Transform triangleToCapsuleTransform;
+    Vector3 segmentPointA;
+    Vector3 segmentPointB;
+
+    // For each item in the batch
+    for (uint32 batchIndex = batchStartIndex; batchIndex < batchStartIndex + batchNbItems; batchIndex++) {
+
+        NarrowPhaseInfoBatch::NarrowPhaseInfo& narrowPhaseInfo = narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex];
+
+        assert(narrowPhaseInfo.nbContactPoints == 0);
+        assert(!narrowPhaseInfo.isColliding);
+
+        // The collision shape of the triangle is null
+        const bool isCapsuleShape1 = narrowPhaseInfo.collisionShape1 != nullptr;
+        const CapsuleShape* capsuleShape = static_cast<const CapsuleShape*>(isCapsuleShape1 ? narrowPhaseInfo.collisionShape1 : narrowPhaseInfo.collisionShape2);
+
+        assert(capsuleShape != nullptr && capsuleShape->getName() == CollisionShapeName::CAPSULE);
+        assert(narrowPhaseInfo.collisionShape1 == nullptr || narrowPhaseInfo.collisionShape2 == nullptr);
+
+        const Transform& capsuleToWorldTransform = isCapsuleShape1 ? narrowPhaseInfo.shape1ToWorldTransform : narrowPhaseInfo.shape2ToWorldTransform;
+        const Transform& triangleToWorldTransform = isCapsuleShape1 ? narrowPhaseInfo.shape2ToWorldTransform : narrowPhaseInfo.shape1ToWorldTransform;
+
+        if (narrowPhaseInfo.overlappingPair != currentPair) {
+
+            currentPair = narrowPhaseInfo.overlappingPair;
+
+            // Compute the inner segment of the capsule in the local-space of the triangles
+            const Transform capsuleToTriangleTransform = triangleToWorldTransform.getInverse() * capsuleToWorldTransform;
+            const decimal capsuleHalfHeight = capsuleShape->getHeight() * decimal(0.5);
+            segmentPointA = capsuleToTriangleTransform * Vector3(0, -capsuleHalfHeight, 0);
+            segmentPointB = capsuleToTriangleTransform * Vector3(0, capsuleHalfHeight, 0);
+
+            triangleToCapsuleTransform = capsuleToTriangleTransform.getInverse();
+        }
+
+        const Vector3* vertices = narrowPhaseInfoBatch.getTriangleVertices(batchIndex);
+
+        // Compute the triangle face normal
+        Vector3 faceNormal = (vertices[1] - vertices[0]).cross(vertices[2] - vertices[0]);
+        const decimal faceNormalLengthSquare = faceNormal.lengthSquare();
+
+        // Do not generate a contact with a degenerate triangle
+        if (faceNormalLengthSquare < MACHINE_EPSILON) {
+            continue;
+        }
+        faceNormal /= std::sqrt(faceNormalLengthSquare);
+
+        // Compute the closest points between the inner segment of the capsule and the triangle
+        Vector3 closestPointSegment;
+        Vector3 closestPointTriangle;
+        const decimal distanceSquare = computeClosestPointsSegmentTriangle(segmentPointA, segmentPointB, vertices, faceNormal,
+                                                                           closestPointSegment, closestPointTriangle);
+
+        const decimal radius = capsuleShape->getRadius();
+
+        // If the capsule does not overlap with the triangle
+        if (distanceSquare >= radius * radius) {
+            continue;
+        }
+
+        // If we need to report contacts
+        if (narrowPhaseInfo.reportContacts) {
+
+            // Compute the penetration axis (from the triangle to the capsule) and depth at the closest points. The
+            // triangle normal is the face normal on the side of the triangle where the capsule is.
+            const decimal distance = std::sqrt(distanceSquare);
+            const decimal penetrationDepth = radius - distance;
+            Vector3 triangleNormal = faceNormal;
+            Vector3 penetrationAxis;
+            if (distance > MACHINE_EPSILON) {
+
+                penetrationAxis = (closestPointSegment - closestPointTriangle) / distance;
+                if (triangleNormal.dot(penetrationAxis) < decimal(0.0)) {
+                    triangleNormal = -triangleNormal;
+                }
+            }
+            else {  // If the segment intersects the triangle, we use the side where most of the segment is
+
+                if (faceNormal.dot(segmentPointA - vertices[0]) + faceNormal.dot(segmentPointB - vertices[0]) < decimal(0.0)) {
+                    triangleNormal = -triangleNormal;
+                }
+                penetrationAxis = triangleNormal;
+            }
+
+            // Compute the world contact normal from shape 1 to shape 2 for a contact normal from the triangle to the capsule
+            const Quaternion& triangleToWorldOrientation = triangleToWorldTransform.getOrientation();
+
+            bool isFaceContact = false;
+
+            // Clip the segment with the side planes of the triangle. If the clipped segment is as deep below the
+            // triangle face as the closest points, the capsule is in contact with the face and we create a contact
+            // point at each end of the clipped segment (two contact points if the capsule lies on the face)
+            Vector3 clippedPointA = segmentPointA;
+            Vector3 clippedPointB = segmentPointB;
+            if (clipSegmentWithTriangleSidePlanes(vertices, faceNormal, clippedPointA, clippedPointB)) {
+
+                const decimal penetrationDepthA = radius - triangleNormal.dot(clippedPointA - vertices[0]);
+                const decimal penetrationDepthB = radius - triangleNormal.dot(clippedPointB - vertices[0]);
+
+                if (std::max(penetrationDepthA, penetrationDepthB) >= penetrationDepth - FACE_CONTACT_TOLERANCE) {
+
+                    const Vector3 triangleWorldNormal = triangleToWorldOrientation * triangleNormal;
+                    const Vector3 normalWorld = isCapsuleShape1 ? -triangleWorldNormal : triangleWorldNormal;
+
+                    const bool isClippedSegmentPoint = (clippedPointB - clippedPointA).lengthSquare() < MACHINE_EPSILON;
+
+                    for (uint32 i = 0; i < (isClippedSegmentPoint ? 1u : 2u); i++) {
+
+                        const Vector3& clippedPoint = i == 0 ? clippedPointA : clippedPointB;
+                        const decimal clippedPointDepth = i == 0 ? penetrationDepthA : penetrationDepthB;
+
+                        if (clippedPointDepth > decimal(0.0)) {
+
+                            // Project the clipped point onto the triangle and onto the surface of the capsule
+                            const Vector3 contactPointTriangleLocal = clippedPoint - triangleNormal * (radius - clippedPointDepth);
+                            const Vector3 contactPointCapsuleLocal = triangleToCapsuleTransform * (clippedPoint - triangleNormal * radius);
+
+                            narrowPhaseInfoBatch.addContactPoint(batchIndex, normalWorld, clippedPointDepth,
+                                                                 isCapsuleShape1 ? contactPointCapsuleLocal : contactPointTriangleLocal,
+                                                                 isCapsuleShape1 ? contactPointTriangleLocal : contactPointCapsuleLocal);
+
+                            isFaceContact = true;
+                        }
+                    }
+                }
+            }
+
+            // If the capsule is not in contact with the triangle face, we create a single contact at the closest points
+            if (!isFaceContact) {
+
+                // If the contact is in the middle of the triangle face or on an internal edge of the mesh we use the
+                // face normal, otherwise the contact is on a convex edge or vertex of the mesh and we use the penetration axis
+                decimal u, v, w;
+                computeBarycentricCoordinatesInTriangle(vertices[0], vertices[1], vertices[2], closestPointTriangle, u, v, w);
+                const Vector3& contactNormal = TriangleShape::isFaceContactNormalAtPoint(u, v, w, narrowPhaseInfoBatch.getTriangleConvexEdges(batchIndex)) ?
+                                               triangleNormal : penetrationAxis;
+
+                // Re-align the contact point on the capsule such that it is aligned along the contact normal
+                const Vector3 contactPointCapsuleLocal = triangleToCapsuleTransform * (closestPointTriangle - contactNormal * penetrationDepth);
+                const Vector3& contactPointTriangleLocal = closestPointTriangle;
+
+                const Vector3 triangleWorldNormal = triangleToWorldOrientation * contactNormal;
+                const Vector3 normalWorld = isCapsuleShape1 ? -triangleWorldNormal : triangleWorldNormal;
+
+                narrowPhaseInfoBatch.addContactPoint(batchIndex, normalWorld, penetrationDepth,
+                                                     isCapsuleShape1 ? contactPointCapsuleLocal : contactPointTriangleLocal,
+                                                     isCapsuleShape1 ? contactPointTriangleLocal : contactPointCapsuleLocal);
+            }
+        }
+
+        narrowPhaseInfo.isColliding = true;
+        isCollisionFound = true;
+    }
+
+    return isCollisionFound;
+}
+
+// Compute the closest points between a segment and a triangle and return their square distance
+/// If the segment intersects the triangle, the two closest points are the intersection point and the
+/// returned distance is zero. Otherwise, the closest points are between an end-point of the segment and
+/// the triangle or between the segment and an edge of the triangle.
+decimal CapsuleVsTriangleAlgorithm::computeClosestPointsSegmentTriangle(const Vector3& segmentPointA, const Vector3& segmentPointB,
+                                                                        const Vector3* triangleVertices, const Vector3& triangleNormal,
+                                                                        Vector3& outClosestPointSegment, Vector3& outClosestPointTriangle) {
+
+    decimal u, v, w;
+
+    // If the segment crosses the plane of the triangle, we check if the intersection point is inside the triangle
+    const decimal distanceA = triangleNormal.dot(segmentPointA - triangleVertices[0]);
+    const decimal distanceB = triangleNormal.dot(segmentPointB - triangleVertices[0]);
+    if ((distanceA <= decimal(0.0)) != (distanceB <= decimal(0.0))) {
+
+        const Vector3 intersectionPoint = segmentPointA + (segmentPointB - segmentPointA) * (distanceA / (distanceA - distanceB));
+        computeBarycentricCoordinatesInTriangle(triangleVertices[0], triangleVertices[1], triangleVertices[2], intersectionPoint, u, v, w);
+
+        if (u >= decimal(0.0) && v >= decimal(0.0) && w >= decimal(0.0)) {
+
+            outClosestPointSegment = intersectionPoint;
+            outClosestPointTriangle = intersectionPoint;
+
+            return decimal(0.0);
+        }
+    }
+
+    // Closest points between the two end-points of the segment and the triangle
+    outClosestPointSegment = segmentPointA;
+    outClosestPointTriangle = computeClosestPointOnTriangle(triangleVertices[0], triangleVertices[1], triangleVertices[2], segmentPointA, u, v, w);
+    decimal minDistanceSquare = (segmentPointA - outClosestPointTriangle).lengthSquare();
+
+    Vector3 closestPointTriangle = computeClosestPointOnTriangle(triangleVertices[0], triangleVertices[1], triangleVertices[2], segmentPointB, u, v, w);
+    decimal distanceSquare = (segmentPointB - closestPointTriangle).lengthSquare();
+    if (distanceSquare < minDistanceSquare) {
+        minDistanceSquare = distanceSquare;
+        outClosestPointSegment = segmentPointB;
+        outClosestPointTriangle = closestPointTriangle;
+    }
+
+    // Closest points between the segment and the three edges of the triangle
+    for (uint32 i = 0; i < 3; i++) {
+
+        Vector3 closestPointSegment;
+        computeClosestPointBetweenTwoSegments(segmentPointA, segmentPointB, triangleVertices[i], triangleVertices[(i + 1) % 3],
+                                              closestPointSegment, closestPointTriangle);
+
+        distanceSquare = (closestPointSegment - closestPointTriangle).lengthSquare();
+        if (distanceSquare < minDistanceSquare) {
+            minDistanceSquare = distanceSquare;
+            outClosestPointSegment = closestPointSegment;
+            outClosestPointTriangle = closestPointTriangle;
+        }
+    }
+
+    return minDistanceSquare;
+}
+
+// Clip a segment against the side planes of a triangle
+/// The side planes contain the edges of the triangle and are orthogonal to its face. The method
+/// returns false if the segment is completely outside of the triangle prism. Otherwise, the two
+/// end-points of the segment are replaced by the end-points of the clipped segment.
+bool CapsuleVsTriangleAlgorithm::clipSegmentWithTriangleSidePlanes(const Vector3* triangleVertices, const Vector3& triangleNormal,
+                                                                   Vector3& segmentPointA, Vector3& segmentPointB) {
+
+    for (uint32 i = 0; i < 3; i++) {
+
+        // Normal of the side plane pointing outside of the triangle
+        const Vector3 sidePlaneNormal = (triangleVertices[(i + 1) % 3] - triangleVertices[i]).cross(triangleNormal);
+
+        const decimal distanceA = sidePlaneNormal.dot(segmentPointA - triangleVertices[i]);
+        const decimal distanceB = sidePlaneNormal.dot(segmentPointB - triangleVertices[i]);
+
+        // If the segment is outside of the side plane
+        if (distanceA > decimal(0.0) && distanceB > decimal(0.0)) {
+            return false;
+        }
+
+        // Keep the part of the segment that is inside of the side plane
+        if (distanceA > decimal(0.0)) {
+            segmentPointA = segmentPointA + (segmentPointB - segmentPointA) * (distanceA / (distanceA - distanceB));
+        }
+        else if (distanceB > decimal(0.0)) {
+            segmentPointB = segmentPointB + (segmentPointA - segmentPointB) * (distanceB / (distanceB - distanceA));
+        }
+    }
+
+    return true;
+}
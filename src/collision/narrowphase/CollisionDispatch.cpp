@@ -38,6 +38,11 @@ CollisionDispatch::CollisionDispatch(MemoryAllocator& allocator) : mAllocator(al
     mSphereVsConvexPolyhedronAlgorithm = new (allocator.allocate(sizeof(SphereVsConvexPolyhedronAlgorithm))) SphereVsConvexPolyhedronAlgorithm();
     mCapsuleVsConvexPolyhedronAlgorithm = new (allocator.allocate(sizeof(CapsuleVsConvexPolyhedronAlgorithm))) CapsuleVsConvexPolyhedronAlgorithm();
     mConvexPolyhedronVsConvexPolyhedronAlgorithm = new (allocator.allocate(sizeof(ConvexPolyhedronVsConvexPolyhedronAlgorithm))) ConvexPolyhedronVsConvexPolyhedronAlgorithm();
+    mBoxVsBoxAlgorithm = new (allocator.allocate(sizeof(BoxVsBoxAlgorithm))) BoxVsBoxAlgorithm();
+    mSphereVsTriangleAlgorithm = new (allocator.allocate(sizeof(SphereVsTriangleAlgorithm))) SphereVsTriangleAlgorithm();
+    mCapsuleVsTriangleAlgorithm = new (allocator.allocate(sizeof(CapsuleVsTriangleAlgorithm))) CapsuleVsTriangleAlgorithm();
+    mBoxVsTriangleAlgorithm = new (allocator.allocate(sizeof(BoxVsTriangleAlgorithm))) BoxVsTriangleAlgorithm();
+    mGenericConvexAlgorithm = new (allocator.allocate(sizeof(GenericConvexAlgorithm))) GenericConvexAlgorithm();
 
     // Fill in the collision matrix
     fillInCollisionMatrix();
@@ -65,6 +70,21 @@ CollisionDispatch::~CollisionDispatch() {
     if (mIsConvexPolyhedronVsConvexPolyhedronDefault) {
         mAllocator.release(mConvexPolyhedronVsConvexPolyhedronAlgorithm, sizeof(ConvexPolyhedronVsConvexPolyhedronAlgorithm));
     }
+    if (mIsBoxVsBoxDefault) {
+        mAllocator.release(mBoxVsBoxAlgorithm, sizeof(BoxVsBoxAlgorithm));
+    }
+    if (mIsSphereVsTriangleDefault) {
+        mAllocator.release(mSphereVsTriangleAlgorithm, sizeof(SphereVsTriangleAlgorithm));
+    }
+    if (mIsCapsuleVsTriangleDefault) {
+        mAllocator.release(mCapsuleVsTriangleAlgorithm, sizeof(CapsuleVsTriangleAlgorithm));
+    }
+    if (mIsBoxVsTriangleDefault) {
+        mAllocator.release(mBoxVsTriangleAlgorithm, sizeof(BoxVsTriangleAlgorithm));
+    }
+    if (mIsGenericConvexDefault) {
+        mAllocator.release(mGenericConvexAlgorithm, sizeof(GenericConvexAlgorithm));
+    }
 }
 
 // Select and return the narrow-phase collision detection algorithm to
@@ -102,6 +122,10 @@ NarrowPhaseAlgorithmType CollisionDispatch::selectAlgorithm(int type1, int type2
         shape2Type == CollisionShapeType::CONVEX_POLYHEDRON) {
         return NarrowPhaseAlgorithmType::ConvexPolyhedronVsConvexPolyhedron;
     }
+    // Convex shape vs Generic Convex shape (cylinder, cone) algorithm
+    if (shape2Type == CollisionShapeType::GENERIC_CONVEX) {
+        return NarrowPhaseAlgorithmType::GenericConvex;
+    }
 
     return NarrowPhaseAlgorithmType::None;
 }
@@ -184,6 +208,65 @@ void CollisionDispatch::setConvexPolyhedronVsConvexPolyhedronAlgorithm(ConvexPol
     fillInCollisionMatrix();
 }
 
+// Set the Box vs Box narrow-phase collision detection algorithm
+void CollisionDispatch::setBoxVsBoxAlgorithm(BoxVsBoxAlgorithm* algorithm) {
+
+    if (mIsBoxVsBoxDefault) {
+        mAllocator.release(mBoxVsBoxAlgorithm, sizeof(BoxVsBoxAlgorithm));
+        mIsBoxVsBoxDefault = false;
+    }
+
+    mBoxVsBoxAlgorithm = algorithm;
+
+    fillInCollisionMatrix();
+}
+
+// Set the Sphere vs Triangle narrow-phase collision detection algorithm
+void CollisionDispatch::setSphereVsTriangleAlgorithm(SphereVsTriangleAlgorithm* algorithm) {
+
+    if (mIsSphereVsTriangleDefault) {
+        mAllocator.release(mSphereVsTriangleAlgorithm, sizeof(SphereVsTriangleAlgorithm));
+        mIsSphereVsTriangleDefault = false;
+    }
+
+    mSphereVsTriangleAlgorithm = algorithm;
+}
+
+// Set the Capsule vs Triangle narrow-phase collision detection algorithm
+void CollisionDispatch::setCapsuleVsTriangleAlgorithm(CapsuleVsTriangleAlgorithm* algorithm) {
+
+    if (mIsCapsuleVsTriangleDefault) {
+        mAllocator.release(mCapsuleVsTriangleAlgorithm, sizeof(CapsuleVsTriangleAlgorithm));
+        mIsCapsuleVsTriangleDefault = false;
+    }
+
+    mCapsuleVsTriangleAlgorithm = algorithm;
+}
+
+// Set the Box vs Triangle narrow-phase collision detection algorithm
+void CollisionDispatch::setBoxVsTriangleAlgorithm(BoxVsTriangleAlgorithm* algorithm) {
+
+    if (mIsBoxVsTriangleDefault) {
+        mAllocator.release(mBoxVsTriangleAlgorithm, sizeof(BoxVsTriangleAlgorithm));
+        mIsBoxVsTriangleDefault = false;
+    }
+
+    mBoxVsTriangleAlgorithm = algorithm;
+}
+
+// Set the generic convex narrow-phase collision detection algorithm
+void CollisionDispatch::setGenericConvexAlgorithm(GenericConvexAlgorithm* algorithm) {
+
+    if (mIsGenericConvexDefault) {
+        mAllocator.release(mGenericConvexAlgorithm, sizeof(GenericConvexAlgorithm));
+        mIsGenericConvexDefault = false;
+    }
+
+    mGenericConvexAlgorithm = algorithm;
+
+    fillInCollisionMatrix();
+}
+
 
 // Fill-in the collision detection matrix
 void CollisionDispatch::fillInCollisionMatrix() {
@@ -213,5 +296,46 @@ NarrowPhaseAlgorithmType CollisionDispatch::selectNarrowPhaseAlgorithm(const Col
     return mCollisionMatrix[shape1Index][shape2Index];
 }
 
+// Return the corresponding narrow-phase algorithm type to use for two given collision shapes
+// This method uses the collision matrix (based on the type of the shapes) but selects a more
+// specialized algorithm when both shapes are boxes
+NarrowPhaseAlgorithmType CollisionDispatch::selectNarrowPhaseAlgorithm(const CollisionShape* shape1, const CollisionShape* shape2) const {
+
+    NarrowPhaseAlgorithmType algorithmType = selectNarrowPhaseAlgorithm(shape1->getType(), shape2->getType());
+
+    // Box vs Box algorithm
+    if (algorithmType == NarrowPhaseAlgorithmType::ConvexPolyhedronVsConvexPolyhedron &&
+        shape1->getName() == CollisionShapeName::BOX && shape2->getName() == CollisionShapeName::BOX) {
+        return NarrowPhaseAlgorithmType::BoxVsBox;
+    }
+
+    return algorithmType;
+}
+
+// Return the narrow-phase algorithm type to use between a convex shape and the triangles of a concave shape
+// Spheres, capsules and boxes use a dedicated algorithm working directly on the triangle vertices (without
+// creating a TriangleShape for each triangle). The other convex shapes test the triangles as convex polyhedra.
+NarrowPhaseAlgorithmType CollisionDispatch::selectConvexVsConcaveNarrowPhaseAlgorithm(const CollisionShape* convexShape) const {
+
+    assert(convexShape->isConvex());
+
+    NarrowPhaseAlgorithmType algorithmType = selectNarrowPhaseAlgorithm(convexShape->getType(), CollisionShapeType::CONVEX_POLYHEDRON);
 
+    // Sphere vs Triangle algorithm
+    if (algorithmType == NarrowPhaseAlgorithmType::SphereVsConvexPolyhedron) {
+        return NarrowPhaseAlgorithmType::SphereVsTriangle;
+    }
+
+    // Capsule vs Triangle algorithm
+    if (algorithmType == NarrowPhaseAlgorithmType::CapsuleVsConvexPolyhedron) {
+        return NarrowPhaseAlgorithmType::CapsuleVsTriangle;
+    }
 
+    // Box vs Triangle algorithm
+    if (algorithmType == NarrowPhaseAlgorithmType::ConvexPolyhedronVsConvexPolyhedron &&
+        convexShape->getName() == CollisionShapeName::BOX) {
+        return NarrowPhaseAlgorithmType::BoxVsTriangle;
+    }
+
+    return algorithmType;
+}
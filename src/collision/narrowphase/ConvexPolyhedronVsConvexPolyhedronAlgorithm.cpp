@@ -27,11 +27,23 @@
 #include <reactphysics3d/collision/narrowphase/ConvexPolyhedronVsConvexPolyhedronAlgorithm.h>
 #include <reactphysics3d/collision/narrowphase/GJK/GJKAlgorithm.h>
 #include <reactphysics3d/collision/narrowphase/SAT/SATAlgorithm.h>
+#include <reactphysics3d/collision/narrowphase/EPA/EPAAlgorithm.h>
 #include <reactphysics3d/collision/narrowphase/NarrowPhaseInfoBatch.h>
+#include <reactphysics3d/collision/shapes/ConvexPolyhedronShape.h>
+#include <reactphysics3d/engine/OverlappingPairs.h>
 
 // We want to use the ReactPhysics3D namespace
 using namespace reactphysics3d;
 
+// Static variables initialization
+const decimal ConvexPolyhedronVsConvexPolyhedronAlgorithm::EPA_FACE_CONTACT_MIN_COSINE = decimal(0.998);
+const decimal ConvexPolyhedronVsConvexPolyhedronAlgorithm::EPA_REFERENCE_FACE_COSINE_BIAS = decimal(0.0005);
+
+// Constructor
+ConvexPolyhedronVsConvexPolyhedronAlgorithm::ConvexPolyhedronVsConvexPolyhedronAlgorithm() : mMinNbVerticesForEPA(0) {
+
+}
+
 // Compute the narrow-phase collision detection between two convex polyhedra
 // This technique is based on the "Robust Contact Creation for Physics Simulations" presentation
 // by Dirk Gregorius.
@@ -49,16 +61,143 @@ bool ConvexPolyhedronVsConvexPolyhedronAlgorithm::testCollision(NarrowPhaseInfoB
 
 #endif
 
-    bool isCollisionFound = satAlgorithm.testCollisionConvexPolyhedronVsConvexPolyhedron(narrowPhaseInfoBatch, batchStartIndex, batchNbItems);
+    // If the EPA algorithm is disabled, all the pairs are tested with the SAT algorithm
+    if (mMinNbVerticesForEPA == 0) {
+
+        bool isCollisionFound = satAlgorithm.testCollisionConvexPolyhedronVsConvexPolyhedron(narrowPhaseInfoBatch, batchStartIndex, batchNbItems);
+
+        for (uint32 batchIndex = batchStartIndex; batchIndex < batchStartIndex + batchNbItems; batchIndex++) {
+
+            // Get the last frame collision info
+            LastFrameCollisionInfo* lastFrameCollisionInfo = narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].lastFrameCollisionInfo;
+
+            lastFrameCollisionInfo->wasUsingSAT = true;
+            lastFrameCollisionInfo->wasUsingGJK = false;
+        }
+
+        return isCollisionFound;
+    }
+
+    EPAAlgorithm epaAlgorithm;
+
+#ifdef IS_RP3D_PROFILING_ENABLED
+
+
+	epaAlgorithm.setProfiler(mProfiler);
+
+#endif
+
+    bool isCollisionFound = false;
 
     for (uint32 batchIndex = batchStartIndex; batchIndex < batchStartIndex + batchNbItems; batchIndex++) {
 
+        const ConvexPolyhedronShape* polyhedron1 = static_cast<const ConvexPolyhedronShape*>(narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].collisionShape1);
+        const ConvexPolyhedronShape* polyhedron2 = static_cast<const ConvexPolyhedronShape*>(narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].collisionShape2);
+
         // Get the last frame collision info
         LastFrameCollisionInfo* lastFrameCollisionInfo = narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].lastFrameCollisionInfo;
 
-        lastFrameCollisionInfo->wasUsingSAT = true;
-        lastFrameCollisionInfo->wasUsingGJK = false;
+        // The EPA algorithm is only used for large polyhedra. Triangles of concave meshes are
+        // always tested with the SAT algorithm because their contacts need to be smoothed
+        const bool useEPA = polyhedron1->getName() != CollisionShapeName::TRIANGLE &&
+                            polyhedron2->getName() != CollisionShapeName::TRIANGLE &&
+                            std::max(polyhedron1->getNbVertices(), polyhedron2->getNbVertices()) >= mMinNbVerticesForEPA;
+
+        bool isColliding;
+        if (useEPA && testCollisionEPA(epaAlgorithm, satAlgorithm, narrowPhaseInfoBatch, batchIndex, isColliding)) {
+
+            isCollisionFound |= isColliding;
+
+            lastFrameCollisionInfo->wasUsingGJK = true;
+            lastFrameCollisionInfo->wasUsingSAT = false;
+        }
+        else {
+
+            // If the EPA algorithm cannot be used (or if its polytope is degenerate because
+            // of a touching contact for instance), we run the SAT algorithm
+            isCollisionFound |= satAlgorithm.testCollisionConvexPolyhedronVsConvexPolyhedron(narrowPhaseInfoBatch, batchIndex, 1);
+
+            lastFrameCollisionInfo->wasUsingSAT = true;
+            lastFrameCollisionInfo->wasUsingGJK = false;
+        }
     }
 
     return isCollisionFound;
 }
+
+// Compute the narrow-phase collision detection between two convex polyhedra using the EPA algorithm
+// The EPA algorithm gives the penetration normal and depth. If the normal is almost aligned with a
+// face normal of one of the polyhedra (face contact), we clip the polyhedra with this reference face
+// as in the SAT algorithm to get the contact points. Otherwise (edge or vertex contact), we create a
+// single contact point from the EPA witness points. This method returns false if the EPA algorithm
+// was not able to compute a valid result and the SAT algorithm needs to be used instead.
+bool ConvexPolyhedronVsConvexPolyhedronAlgorithm::testCollisionEPA(const EPAAlgorithm& epaAlgorithm, const SATAlgorithm& satAlgorithm,
+                                                                   NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint32 batchIndex,
+                                                                   bool& outIsColliding) const {
+
+    NarrowPhaseInfoBatch::NarrowPhaseInfo& narrowPhaseInfo = narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex];
+
+    assert(narrowPhaseInfo.nbContactPoints == 0);
+
+    const ConvexPolyhedronShape* polyhedron1 = static_cast<const ConvexPolyhedronShape*>(narrowPhaseInfo.collisionShape1);
+    const ConvexPolyhedronShape* polyhedron2 = static_cast<const ConvexPolyhedronShape*>(narrowPhaseInfo.collisionShape2);
+
+    LastFrameCollisionInfo* lastFrameCollisionInfo = narrowPhaseInfo.lastFrameCollisionInfo;
+
+    // Use the cached separating axis (in local-space of polyhedron 1) if the EPA algorithm was used in the previous frame
+    Vector3 separatingAxis = lastFrameCollisionInfo->isValid && lastFrameCollisionInfo->wasUsingGJK ?
+                             lastFrameCollisionInfo->gjkSeparatingAxis : Vector3::zero();
+
+    Vector3 normalPolyhedron1Space;
+    decimal penetrationDepth;
+    Vector3 contactPointPolyhedron1;
+    Vector3 contactPointPolyhedron2;
+    const EPAAlgorithm::EPAResult result = epaAlgorithm.computePenetrationDepth(polyhedron1, narrowPhaseInfo.shape1ToWorldTransform,
+                                                                               polyhedron2, narrowPhaseInfo.shape2ToWorldTransform,
+                                                                               separatingAxis, normalPolyhedron1Space, penetrationDepth,
+                                                                               contactPointPolyhedron1, contactPointPolyhedron2);
+    if (result == EPAAlgorithm::EPAResult::INVALID) {
+        return false;
+    }
+
+    // Cache the separating axis for frame coherence
+    lastFrameCollisionInfo->gjkSeparatingAxis = separatingAxis;
+
+    outIsColliding = result == EPAAlgorithm::EPAResult::INTERPENETRATE;
+    if (!outIsColliding) {
+        return true;
+    }
+
+    narrowPhaseInfo.isColliding = true;
+
+    const Transform polyhedron1ToPolyhedron2 = narrowPhaseInfo.shape2ToWorldTransform.getInverse() * narrowPhaseInfo.shape1ToWorldTransform;
+    const Transform polyhedron2ToPolyhedron1 = polyhedron1ToPolyhedron2.getInverse();
+    const Vector3 normalPolyhedron2Space = polyhedron1ToPolyhedron2.getOrientation() * normalPolyhedron1Space;
+
+    // Find the face of polyhedron 1 that is the most aligned with the penetration normal and
+    // the face of polyhedron 2 that is the most aligned with the opposite of the normal
+    const uint32 faceIndex1 = polyhedron1->findMostAntiParallelFace(-normalPolyhedron1Space);
+    const uint32 faceIndex2 = polyhedron2->findMostAntiParallelFace(normalPolyhedron2Space);
+    const decimal cosine1 = polyhedron1->getFaceNormal(faceIndex1).dot(normalPolyhedron1Space);
+    const decimal cosine2 = -polyhedron2->getFaceNormal(faceIndex2).dot(normalPolyhedron2Space);
+
+    // If the contact is a face contact, we clip the incident face with the reference face to get the contact points
+    const bool isReferenceFacePolyhedron1 = cosine1 + EPA_REFERENCE_FACE_COSINE_BIAS >= cosine2;
+    if (std::max(cosine1, cosine2) >= EPA_FACE_CONTACT_MIN_COSINE &&
+        satAlgorithm.computePolyhedronVsPolyhedronFaceContactPoints(isReferenceFacePolyhedron1, polyhedron1, polyhedron2,
+                                                                    polyhedron1ToPolyhedron2, polyhedron2ToPolyhedron1,
+                                                                    isReferenceFacePolyhedron1 ? faceIndex1 : faceIndex2,
+                                                                    narrowPhaseInfoBatch, batchIndex)) {
+        return true;
+    }
+
+    // If we need to report contacts
+    if (narrowPhaseInfo.reportContacts) {
+
+        // Create a single contact point from the EPA witness points
+        const Vector3 normalWorld = narrowPhaseInfo.shape1ToWorldTransform.getOrientation() * normalPolyhedron1Space;
+        narrowPhaseInfoBatch.addContactPoint(batchIndex, normalWorld, penetrationDepth, contactPointPolyhedron1, contactPointPolyhedron2);
+    }
+
+    return true;
+}
@@ -0,0 +1,404 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2022 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+// Libraries
+#include <reactphysics3d/collision/narrowphase/EPA/EPAAlgorithm.h>
+#include <reactphysics3d/collision/shapes/ConvexShape.h>
+#include <reactphysics3d/mathematics/mathematics_functions.h>
+#include <reactphysics3d/utils/Profiler.h>
+
+// We want to use the ReactPhysics3D namespace
+using namespace reactphysics3d;
+
+// Compute the penetration depth between two convex shapes
+// The shapes are tested without their margins. The computation is done in the local-space of the
+// first shape. The boolean GJK algorithm is first used to find a tetrahedron of the Minkowski difference
+// that contains the origin. If no such tetrahedron exists, the shapes are separated and the last search
+// direction of GJK is returned as separating axis. Otherwise, the tetrahedron is expanded with the
+// EPA algorithm to find the face of the Minkowski difference that is the closest to the origin.
+// The cached separating axis of the previous frame is used as initial search direction and is updated
+// with the new axis to cache. The normal (from the first shape towards the second one) and the contact
+// point on the first shape are in local-space of the first shape, the contact point on the second shape
+// is in local-space of the second shape. If the margins are used, the shapes enlarged by their margins are
+// tested and the contact points are on the surfaces of the enlarged shapes.
+EPAAlgorithm::EPAResult EPAAlgorithm::computePenetrationDepth(const ConvexShape* shape1, const Transform& shape1ToWorld,
+                                                              const ConvexShape* shape2, const Transform& shape2ToWorld,
+                                                              Vector3& inOutSeparatingAxis, Vector3& outNormal, decimal& outPenetrationDepth,
+                                                              Vector3& outContactPointShape1, Vector3& outContactPointShape2,
+                                                              bool useMargins) const {
+
+    RP3D_PROFILE("EPAAlgorithm::computePenetrationDepth()", mProfiler);
+
+    // Transform from the local-space of the second shape to the local-space of the first shape
+    const Transform shape2ToShape1 = shape1ToWorld.getInverse() * shape2ToWorld;
+
+    // Quaternion that transforms a direction from local-space of the first shape into local-space of the second shape
+    const Quaternion rotateToShape2 = shape2ToWorld.getOrientation().getInverse() * shape1ToWorld.getOrientation();
+
+    // ---------- Boolean GJK algorithm ---------- //
+
+    // The most recent point of the simplex is always the first one
+    SupportPoint simplex[4];
+    uint32 nbSimplexPoints = 0;
+
+    // Use the cached separating axis of the previous frame as initial search direction
+    Vector3 direction = -inOutSeparatingAxis;
+    if (direction.lengthSquare() < MACHINE_EPSILON) {
+        direction.setAllValues(0, 1, 0);
+    }
+
+    computeSupportPoint(shape1, shape2, shape2ToShape1, rotateToShape2, useMargins, direction, simplex[2]);
+
+    // Search towards the origin
+    direction = -simplex[2].point;
+    if (direction.lengthSquare() < MACHINE_EPSILON) {
+
+        // The origin is on the boundary of the Minkowski difference (touching contact)
+        return EPAResult::INVALID;
+    }
+
+    computeSupportPoint(shape1, shape2, shape2ToShape1, rotateToShape2, useMargins, direction, simplex[1]);
+    if (simplex[1].point.dot(direction) <= decimal(0.0)) {
+
+        // The origin cannot be reached, the shapes are separated
+        inOutSeparatingAxis = -direction;
+        return EPAResult::SEPARATED;
+    }
+
+    // Search in the direction orthogonal to the segment towards the origin
+    const Vector3 segment = simplex[2].point - simplex[1].point;
+    direction = segment.cross(-simplex[1].point).cross(segment);
+    if (direction.lengthSquare() < MACHINE_EPSILON) {
+
+        // The origin is on the line of the segment, take any direction orthogonal to the segment
+        direction = segment.getOneUnitOrthogonalVector();
+    }
+    nbSimplexPoints = 2;
+
+    bool isOriginEnclosed = false;
+    for (uint32 iteration = 0; iteration < MAX_ITERATIONS_EPA_GJK; iteration++) {
+
+        computeSupportPoint(shape1, shape2, shape2ToShape1, rotateToShape2, useMargins, direction, simplex[0]);
+        if (simplex[0].point.dot(direction) <= decimal(0.0)) {
+
+            // The origin cannot be reached, the shapes are separated
+            inOutSeparatingAxis = -direction;
+            return EPAResult::SEPARATED;
+        }
+
+        nbSimplexPoints++;
+        if (nbSimplexPoints == 3) {
+            updateTriangleSimplex(simplex, nbSimplexPoints, direction);
+        }
+        else if (updateTetrahedronSimplex(simplex, nbSimplexPoints, direction)) {
+            isOriginEnclosed = true;
+            break;
+        }
+
+        // If the origin is on the boundary of the simplex (touching contact)
+        if (direction.lengthSquare() < MACHINE_EPSILON) {
+            return EPAResult::INVALID;
+        }
+    }
+
+    if (!isOriginEnclosed) {
+        return EPAResult::INVALID;
+    }
+
+    // ---------- Expanding Polytope Algorithm ---------- //
+
+    SupportPoint vertices[EPA_MAX_NB_VERTICES];
+    PolytopeFace faces[EPA_MAX_NB_FACES];
+    uint32 horizonEdges[EPA_MAX_NB_HORIZON_EDGES][2];
+
+    // Initial polytope (the GJK tetrahedron). For each face, the fourth index is the opposite vertex
+    const uint32 tetrahedronFaces[4][4] = {{0, 1, 2, 3}, {0, 2, 3, 1}, {0, 3, 1, 2}, {1, 3, 2, 0}};
+    for (uint32 i=0; i < 4; i++) {
+        vertices[i] = simplex[i];
+    }
+    for (uint32 i=0; i < 4; i++) {
+
+        PolytopeFace& face = faces[i];
+        face.vertices[0] = tetrahedronFaces[i][0];
+        face.vertices[1] = tetrahedronFaces[i][1];
+        face.vertices[2] = tetrahedronFaces[i][2];
+        if (!computeFacePlane(vertices, face)) {
+            return EPAResult::INVALID;
+        }
+
+        // Make sure the face normal points outside of the tetrahedron
+        if (face.normal.dot(vertices[tetrahedronFaces[i][3]].point - vertices[face.vertices[0]].point) > decimal(0.0)) {
+            face.vertices[1] = tetrahedronFaces[i][2];
+            face.vertices[2] = tetrahedronFaces[i][1];
+            face.normal = -face.normal;
+            face.distance = -face.distance;
+        }
+    }
+    uint32 nbVertices = 4;
+    uint32 nbFaces = 4;
+
+    PolytopeFace closestFace;
+    for (uint32 iteration = 0; ; iteration++) {
+
+        // Find the face of the polytope that is the closest to the origin
+        uint32 closestFaceIndex = 0;
+        for (uint32 i=1; i < nbFaces; i++) {
+            if (faces[i].distance < faces[closestFaceIndex].distance) {
+                closestFaceIndex = i;
+            }
+        }
+        closestFace = faces[closestFaceIndex];
+
+        // If we cannot expand the polytope anymore, we keep the current closest face
+        if (iteration == MAX_ITERATIONS_EPA || nbVertices == EPA_MAX_NB_VERTICES) {
+            break;
+        }
+
+        // Compute the support point in the direction of the closest face normal
+        SupportPoint supportPoint;
+        computeSupportPoint(shape1, shape2, shape2ToShape1, rotateToShape2, useMargins, closestFace.normal, supportPoint);
+        const decimal supportDistance = supportPoint.point.dot(closestFace.normal);
+
+        // If the closest face is on the boundary of the Minkowski difference (up to the tolerance)
+        if (supportDistance - closestFace.distance <= EPA_ABSOLUTE_TOLERANCE + EPA_RELATIVE_TOLERANCE * supportDistance) {
+            break;
+        }
+
+        // Remove all the faces that can be seen from the new support point and
+        // compute the horizon (edges of the removed faces that are not shared by two removed faces)
+        uint32 nbHorizonEdges = 0;
+        uint32 faceIndex = 0;
+        while (faceIndex < nbFaces) {
+
+            const PolytopeFace& face = faces[faceIndex];
+            if (face.normal.dot(supportPoint.point - vertices[face.vertices[0]].point) > decimal(0.0)) {
+
+                for (uint32 i=0; i < 3; i++) {
+
+                    const uint32 edgeVertex1 = face.vertices[i];
+                    const uint32 edgeVertex2 = face.vertices[(i + 1) % 3];
+
+                    // If the opposite edge already belongs to a removed face, the edge is not on the horizon
+                    bool isOppositeEdgeFound = false;
+                    for (uint32 j=0; j < nbHorizonEdges; j++) {
+                        if (horizonEdges[j][0] == edgeVertex2 && horizonEdges[j][1] == edgeVertex1) {
+                            nbHorizonEdges--;
+                            horizonEdges[j][0] = horizonEdges[nbHorizonEdges][0];
+                            horizonEdges[j][1] = horizonEdges[nbHorizonEdges][1];
+                            isOppositeEdgeFound = true;
+                            break;
+                        }
+                    }
+
+                    if (!isOppositeEdgeFound) {
+
+                        if (nbHorizonEdges == EPA_MAX_NB_HORIZON_EDGES) {
+                            return EPAResult::INVALID;
+                        }
+
+                        horizonEdges[nbHorizonEdges][0] = edgeVertex1;
+                        horizonEdges[nbHorizonEdges][1] = edgeVertex2;
+                        nbHorizonEdges++;
+                    }
+                }
+
+                // Remove the face
+                nbFaces--;
+                faces[faceIndex] = faces[nbFaces];
+            }
+            else {
+                faceIndex++;
+            }
+        }
+
+        if (nbFaces + nbHorizonEdges > EPA_MAX_NB_FACES) {
+            return EPAResult::INVALID;
+        }
+
+        // Add the support point to the polytope and connect it with the horizon edges
+        const uint32 newVertexIndex = nbVertices;
+        vertices[nbVertices] = supportPoint;
+        nbVertices++;
+        for (uint32 i=0; i < nbHorizonEdges; i++) {
+
+            PolytopeFace& face = faces[nbFaces];
+            face.vertices[0] = horizonEdges[i][0];
+            face.vertices[1] = horizonEdges[i][1];
+            face.vertices[2] = newVertexIndex;
+            if (!computeFacePlane(vertices, face)) {
+                return EPAResult::INVALID;
+            }
+            nbFaces++;
+        }
+    }
+
+    // If the origin is on the boundary of the Minkowski difference, there is no penetration
+    if (closestFace.distance <= decimal(0.0)) {
+        return EPAResult::INVALID;
+    }
+
+    // Compute the witness points on both shapes using the barycentric coordinates of the
+    // projection of the origin onto the closest face
+    const SupportPoint& a = vertices[closestFace.vertices[0]];
+    const SupportPoint& b = vertices[closestFace.vertices[1]];
+    const SupportPoint& c = vertices[closestFace.vertices[2]];
+    decimal u, v, w;
+    computeBarycentricCoordinatesInTriangle(a.point, b.point, c.point, closestFace.normal * closestFace.distance, u, v, w);
+
+    outNormal = closestFace.normal;
+    outPenetrationDepth = closestFace.distance;
+    outContactPointShape1 = u * a.pointShape1 + v * b.pointShape1 + w * c.pointShape1;
+    outContactPointShape2 = shape2ToShape1.getInverse() * (u * a.pointShape2 + v * b.pointShape2 + w * c.pointShape2);
+
+    // Cache the penetration normal for frame coherence
+    inOutSeparatingAxis = closestFace.normal;
+
+    return EPAResult::INTERPENETRATE;
+}
+
+// Compute the support point of the Minkowski difference A-B in a given direction (in local-space of the first shape)
+void EPAAlgorithm::computeSupportPoint(const ConvexShape* shape1, const ConvexShape* shape2, const Transform& shape2ToShape1,
+                                       const Quaternion& rotateToShape2, bool useMargins, const Vector3& direction,
+                                       SupportPoint& outSupportPoint) const {
+
+    if (useMargins) {
+        outSupportPoint.pointShape1 = shape1->getLocalSupportPointWithMargin(direction);
+        outSupportPoint.pointShape2 = shape2ToShape1 * shape2->getLocalSupportPointWithMargin(rotateToShape2 * (-direction));
+    }
+    else {
+        outSupportPoint.pointShape1 = shape1->getLocalSupportPointWithoutMargin(direction);
+        outSupportPoint.pointShape2 = shape2ToShape1 * shape2->getLocalSupportPointWithoutMargin(rotateToShape2 * (-direction));
+    }
+    outSupportPoint.point = outSupportPoint.pointShape1 - outSupportPoint.pointShape2;
+}
+
+// Update a triangle simplex and the search direction of the GJK algorithm
+// The first point of the simplex is the new point. The origin is known to be on the side of the
+// segment made of the two other points where the new point is. We keep the feature of the triangle
+// (edge or triangle) that is the closest to the origin.
+void EPAAlgorithm::updateTriangleSimplex(SupportPoint simplex[4], uint32& nbSimplexPoints, Vector3& direction) const {
+
+    const Vector3 ab = simplex[1].point - simplex[0].point;
+    const Vector3 ac = simplex[2].point - simplex[0].point;
+    const Vector3 ao = -simplex[0].point;
+    const Vector3 normal = ab.cross(ac);
+
+    // If the origin is in the region of the edge AB
+    if (ab.cross(normal).dot(ao) > decimal(0.0)) {
+        simplex[2] = simplex[0];
+        direction = ab.cross(ao).cross(ab);
+        nbSimplexPoints = 2;
+        return;
+    }
+
+    // If the origin is in the region of the edge AC
+    if (normal.cross(ac).dot(ao) > decimal(0.0)) {
+        simplex[1] = simplex[0];
+        direction = ac.cross(ao).cross(ac);
+        nbSimplexPoints = 2;
+        return;
+    }
+
+    // The origin is above or below the triangle, we reorder the points such that the
+    // triangle of the three last points has its normal pointing towards the origin
+    if (normal.dot(ao) > decimal(0.0)) {
+        simplex[3] = simplex[2];
+        simplex[2] = simplex[1];
+        simplex[1] = simplex[0];
+        direction = normal;
+    }
+    else {
+        simplex[3] = simplex[1];
+        simplex[1] = simplex[0];
+        direction = -normal;
+    }
+}
+
+// Update a tetrahedron simplex and the search direction of the GJK algorithm
+// The first point of the simplex is the new point (apex) and the origin is known to be above the base
+// triangle and below the apex. We only need to test the three faces adjacent to the apex.
+// Return true if the tetrahedron contains the origin
+bool EPAAlgorithm::updateTetrahedronSimplex(SupportPoint simplex[4], uint32& nbSimplexPoints, Vector3& direction) const {
+
+    const Vector3 ab = simplex[1].point - simplex[0].point;
+    const Vector3 ac = simplex[2].point - simplex[0].point;
+    const Vector3 ad = simplex[3].point - simplex[0].point;
+    const Vector3 ao = -simplex[0].point;
+
+    const Vector3 abcNormal = ab.cross(ac);
+    const Vector3 acdNormal = ac.cross(ad);
+    const Vector3 adbNormal = ad.cross(ab);
+
+    nbSimplexPoints = 3;
+
+    // If the origin is in front of the face ABC
+    if (abcNormal.dot(ao) > decimal(0.0)) {
+        simplex[3] = simplex[2];
+        simplex[2] = simplex[1];
+        simplex[1] = simplex[0];
+        direction = abcNormal;
+        return false;
+    }
+
+    // If the origin is in front of the face ACD
+    if (acdNormal.dot(ao) > decimal(0.0)) {
+        simplex[1] = simplex[0];
+        direction = acdNormal;
+        return false;
+    }
+
+    // If the origin is in front of the face ADB
+    if (adbNormal.dot(ao) > decimal(0.0)) {
+        simplex[2] = simplex[3];
+        simplex[3] = simplex[1];
+        simplex[1] = simplex[0];
+        direction = adbNormal;
+        return false;
+    }
+
+    nbSimplexPoints = 4;
+
+    return true;
+}
+
+// Compute the outward normal and the distance to the origin of a polytope face
+// Return false if the face is degenerate
+bool EPAAlgorithm::computeFacePlane(const SupportPoint* vertices, PolytopeFace& face) const {
+
+    const Vector3& a = vertices[face.vertices[0]].point;
+    const Vector3& b = vertices[face.vertices[1]].point;
+    const Vector3& c = vertices[face.vertices[2]].point;
+
+    face.normal = (b - a).cross(c - a);
+    const decimal normalLength = face.normal.length();
+    if (normalLength < MACHINE_EPSILON) {
+        return false;
+    }
+
+    face.normal /= normalLength;
+    face.distance = face.normal.dot(a);
+
+    return true;
+}
@@ -235,3 +235,291 @@ void GJKAlgorithm::testCollision(NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uin
         gjkResults.add(GJKResult::INTERPENETRATE);
     }
 }
+
+// Test if the two collision shapes of each item of the batch overlap.
+/// This method only runs the GJK algorithm until it can tell if the enlarged objects (with
+/// margins) overlap or not. As soon as a point of the Minkowski difference of the original
+/// objects is found inside the margins, we exit without computing the penetration depth or the
+/// contact points. This is used for the pairs that do not need to report contacts (triggers and
+/// overlap queries). This method returns true if at least one overlap has been found.
+bool GJKAlgorithm::testOverlap(NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint32 batchStartIndex, uint32 batchNbItems) {
+
+    RP3D_PROFILE("GJKAlgorithm::testOverlap()", mProfiler);
+
+    bool isOverlapFound = false;
+
+    // For each item in the batch
+    for (uint32 batchIndex = batchStartIndex; batchIndex < batchStartIndex + batchNbItems; batchIndex++) {
+
+        NarrowPhaseInfoBatch::NarrowPhaseInfo& narrowPhaseInfo = narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex];
+
+        Vector3 suppA;             // Support point of object A
+        Vector3 suppB;             // Support point of object B
+        Vector3 w;                 // Support point of Minkowski difference A-B
+        decimal vDotw;
+        decimal prevDistSquare;
+
+        assert(narrowPhaseInfo.collisionShape1->isConvex());
+        assert(narrowPhaseInfo.collisionShape2->isConvex());
+        assert(!narrowPhaseInfo.reportContacts);
+
+        const ConvexShape* shape1 = static_cast<const ConvexShape*>(narrowPhaseInfo.collisionShape1);
+        const ConvexShape* shape2 = static_cast<const ConvexShape*>(narrowPhaseInfo.collisionShape2);
+
+        // Transform a point from local space of body 2 to local
+        // space of body 1 (the GJK algorithm is done in local space of body 1)
+        const Transform body2Tobody1 = narrowPhaseInfo.shape1ToWorldTransform.getInverse() * narrowPhaseInfo.shape2ToWorldTransform;
+
+        // Quaternion that transform a direction from local
+        // space of body 1 into local space of body 2
+        const Quaternion rotateToBody2 = narrowPhaseInfo.shape2ToWorldTransform.getOrientation().getInverse() *
+                                         narrowPhaseInfo.shape1ToWorldTransform.getOrientation();
+
+        // Initialize the margin (sum of margins of both objects). Contrary to the testCollision()
+        // method, the margin can be zero here (two convex polyhedra for instance)
+        const decimal margin = shape1->getMargin() + shape2->getMargin();
+        const decimal marginSquare = margin * margin;
+
+        // Create a simplex set
+        VoronoiSimplex simplex;
+
+        // Get the last collision frame info
+        LastFrameCollisionInfo* lastFrameCollisionInfo = narrowPhaseInfo.lastFrameCollisionInfo;
+
+        // Get the previous point V (last cached separating axis)
+        Vector3 v;
+        if (lastFrameCollisionInfo->isValid && lastFrameCollisionInfo->wasUsingGJK) {
+            v = lastFrameCollisionInfo->gjkSeparatingAxis;
+            assert(v.lengthSquare() > decimal(0.000001));
+        }
+        else {
+            v.setAllValues(0, 1, 0);
+        }
+
+        // Initialize the upper bound for the square distance
+        decimal distSquare = DECIMAL_LARGEST;
+
+        // If the loop ends because the simplex contains the origin, the original objects interpenetrate
+        bool isOverlapping = true;
+
+        do {
+
+            // Compute the support points for original objects (without margins) A and B
+            suppA = shape1->getLocalSupportPointWithoutMargin(-v);
+            suppB = body2Tobody1 * shape2->getLocalSupportPointWithoutMargin(rotateToBody2 * v);
+
+            // Compute the support point for the Minkowski difference A-B
+            w = suppA - suppB;
+
+            vDotw = v.dot(w);
+
+            // If the enlarge objects (with margins) do not intersect
+            if (vDotw > decimal(0.0) && vDotw * vDotw > distSquare * marginSquare) {
+
+                // Cache the current separating axis for frame coherence
+                lastFrameCollisionInfo->gjkSeparatingAxis = v;
+
+                isOverlapping = false;
+                break;
+            }
+
+            // If the distance cannot be improved anymore, the objects are separated
+            // unless the closest point of the simplex is the origin
+            if (simplex.isPointInSimplex(w) || distSquare - vDotw <= distSquare * REL_ERROR_SQUARE) {
+                isOverlapping = distSquare <= MACHINE_EPSILON;
+                break;
+            }
+
+            // Add the new support point to the simplex
+            simplex.addPoint(w, suppA, suppB);
+
+            // If the simplex is affinely dependent
+            if (simplex.isAffinelyDependent()) {
+                isOverlapping = distSquare <= MACHINE_EPSILON;
+                break;
+            }
+
+            // Compute the point of the simplex closest to the origin
+            // If the computation of the closest point fails
+            if (!simplex.computeClosestPoint(v)) {
+                isOverlapping = distSquare <= MACHINE_EPSILON;
+                break;
+            }
+
+            // Store and update the squared distance of the closest point
+            prevDistSquare = distSquare;
+            distSquare = v.lengthSquare();
+
+            // If the closest point is inside the margins, the enlarged objects overlap and
+            // we do not need to compute the exact distance
+            if (distSquare < marginSquare) {
+                break;
+            }
+
+            // If the distance to the closest point doesn't improve a lot
+            if (prevDistSquare - distSquare <= MACHINE_EPSILON * prevDistSquare) {
+
+                simplex.backupClosestPointInSimplex(v);
+
+                // Get the new squared distance
+                distSquare = v.lengthSquare();
+
+                isOverlapping = distSquare <= MACHINE_EPSILON;
+                break;
+            }
+
+        } while(!simplex.isFull() && distSquare > MACHINE_EPSILON * simplex.getMaxLengthSquareOfAPoint());
+
+        lastFrameCollisionInfo->wasUsingGJK = true;
+        lastFrameCollisionInfo->wasUsingSAT = false;
+
+        narrowPhaseInfo.isColliding = isOverlapping;
+        isOverlapFound |= isOverlapping;
+    }
+
+    return isOverlapFound;
+}
+
+// Compute the time of impact of a convex shape moving with a translation against another convex shape
+/// This method uses the conservative advancement with the GJK algorithm. The first shape is moved along
+/// its translation by the distance between the shapes divided by the speed at which it approaches the
+/// second shape in the direction of the closest points. This can never move the shape past the time of
+/// impact. The orientation of the first shape does not change during the translation. This method returns
+/// true if the shapes (with their margins) get closer than the distance tolerance during the translation.
+/// The time of impact (between zero and one) and the normal (from the first shape towards the second one,
+/// in world-space) at this time are then returned. If the shapes already overlap at the start of the
+/// translation, false is returned because the discrete collision detection handles this case.
+bool GJKAlgorithm::computeTimeOfImpact(const ConvexShape* shape1, const Transform& shape1StartToWorld, const Vector3& translation1,
+                                       const ConvexShape* shape2, const Transform& shape2ToWorld, decimal distanceTolerance,
+                                       decimal& outTimeOfImpact, Vector3& outNormal) const {
+
+    RP3D_PROFILE("GJKAlgorithm::computeTimeOfImpact()", mProfiler);
+
+    // The point of the Minkowski difference closest to the origin is roughly opposite to the translation
+    Vector3 separatingAxis = shape1StartToWorld.getOrientation().getInverse() * (-translation1);
+    if (separatingAxis.lengthSquare() < MACHINE_EPSILON) {
+        separatingAxis.setAllValues(0, 1, 0);
+    }
+
+    Transform shape1ToWorld = shape1StartToWorld;
+    decimal time = decimal(0.0);
+    Vector3 normal;
+
+    for (int iteration = 0; iteration < MAX_ITERATIONS_GJK_RAYCAST; iteration++) {
+
+        decimal distance;
+        if (!computeDistance(shape1, shape1ToWorld, shape2, shape2ToWorld, separatingAxis, distance, normal)) {
+
+            // If the shapes overlap at the start, the discrete collision detection handles them
+            if (iteration == 0) return false;
+
+            break;
+        }
+
+        // If the first shape does not approach the second one, there is no impact
+        const decimal approachSpeed = translation1.dot(normal);
+        if (approachSpeed <= MACHINE_EPSILON) return false;
+
+        // If the shapes are touching
+        if (distance <= distanceTolerance) break;
+
+        // Advance the first shape. It cannot travel the distance between the shapes faster than its approach speed
+        time += distance / approachSpeed;
+        if (time > decimal(1.0)) return false;
+
+        shape1ToWorld.setPosition(shape1StartToWorld.getPosition() + time * translation1);
+    }
+
+    outTimeOfImpact = time;
+    outNormal = normal;
+
+    return true;
+}
+
+// Compute a lower bound of the distance between two convex shapes (with their margins)
+/// The GJK algorithm is run on the original objects (without margins) until the closest point of the
+/// Minkowski difference is found and the margins are then subtracted from the distance. The separating
+/// axis (in local-space of the first shape) is used as initial search direction and is updated. The
+/// unit normal (from the first shape towards the second one) is returned in world-space. This method
+/// returns false if the original objects (without margins) overlap.
+bool GJKAlgorithm::computeDistance(const ConvexShape* shape1, const Transform& shape1ToWorld, const ConvexShape* shape2,
+                                   const Transform& shape2ToWorld, Vector3& inOutSeparatingAxis, decimal& outDistance,
+                                   Vector3& outNormal) const {
+
+    // Transform a point from local space of body 2 to local
+    // space of body 1 (the GJK algorithm is done in local space of body 1)
+    const Transform body2Tobody1 = shape1ToWorld.getInverse() * shape2ToWorld;
+
+    // Quaternion that transform a direction from local
+    // space of body 1 into local space of body 2
+    const Quaternion rotateToBody2 = shape2ToWorld.getOrientation().getInverse() * shape1ToWorld.getOrientation();
+
+    // Create a simplex set
+    VoronoiSimplex simplex;
+
+    Vector3 v = inOutSeparatingAxis;
+    decimal distSquare = DECIMAL_LARGEST;
+    decimal prevDistSquare;
+
+    // Largest distance from the origin to a support plane of the Minkowski difference
+    decimal distanceLowerBound = decimal(0.0);
+
+    do {
+
+        // Compute the support points for original objects (without margins) A and B
+        const Vector3 suppA = shape1->getLocalSupportPointWithoutMargin(-v);
+        const Vector3 suppB = body2Tobody1 * shape2->getLocalSupportPointWithoutMargin(rotateToBody2 * v);
+
+        // Compute the support point for the Minkowski difference A-B
+        const Vector3 w = suppA - suppB;
+
+        // The Minkowski difference is on the other side of the support plane through w
+        const decimal vDotw = v.dot(w);
+        if (vDotw > decimal(0.0)) {
+            distanceLowerBound = std::max(distanceLowerBound, vDotw / v.length());
+        }
+
+        // If the distance cannot be improved anymore
+        if (simplex.isPointInSimplex(w) || distSquare - vDotw <= distSquare * REL_ERROR_SQUARE) {
+            break;
+        }
+
+        // Add the new support point to the simplex
+        simplex.addPoint(w, suppA, suppB);
+
+        // If the simplex is affinely dependent
+        if (simplex.isAffinelyDependent()) {
+            break;
+        }
+
+        // Compute the point of the simplex closest to the origin
+        // If the computation of the closest point fails
+        if (!simplex.computeClosestPoint(v)) {
+            break;
+        }
+
+        // Store and update the squared distance of the closest point
+        prevDistSquare = distSquare;
+        distSquare = v.lengthSquare();
+
+        // If the distance to the closest point doesn't improve a lot
+        if (prevDistSquare - distSquare <= MACHINE_EPSILON * prevDistSquare) {
+
+            simplex.backupClosestPointInSimplex(v);
+            distSquare = v.lengthSquare();
+            break;
+        }
+
+    } while(!simplex.isFull() && distSquare > MACHINE_EPSILON * simplex.getMaxLengthSquareOfAPoint());
+
+    // If the original objects overlap
+    if (simplex.isFull() || distSquare <= MACHINE_EPSILON) {
+        return false;
+    }
+
+    inOutSeparatingAxis = v;
+    outDistance = std::max(decimal(0.0), distanceLowerBound - shape1->getMargin() - shape2->getMargin());
+    outNormal = shape1ToWorld.getOrientation() * (-v.getUnit());
+
+    return true;
+}
@@ -0,0 +1,450 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2022 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+// Libraries
+#include <reactphysics3d/collision/narrowphase/GenericConvexAlgorithm.h>
+#include <reactphysics3d/collision/narrowphase/GJK/GJKAlgorithm.h>
+#include <reactphysics3d/collision/narrowphase/EPA/EPAAlgorithm.h>
+#include <reactphysics3d/collision/narrowphase/NarrowPhaseInfoBatch.h>
+#include <reactphysics3d/collision/shapes/ConvexPolyhedronShape.h>
+#include <reactphysics3d/collision/shapes/CapsuleShape.h>
+#include <reactphysics3d/collision/shapes/CylinderShape.h>
+#include <reactphysics3d/collision/shapes/ConeShape.h>
+#include <reactphysics3d/collision/shapes/TriangleShape.h>
+#include <reactphysics3d/engine/OverlappingPairs.h>
+#include <reactphysics3d/mathematics/mathematics_functions.h>
+
+// We want to use the ReactPhysics3D namespace
+using namespace reactphysics3d;
+
+// Static variables initialization
+const decimal GenericConvexAlgorithm::FEATURE_MIN_COSINE = decimal(0.995);
+const uint32 GenericConvexAlgorithm::NB_CAP_POLYGON_VERTICES = 8;
+
+// Compute the narrow-phase collision detection between a generic convex shape and another convex shape
+bool GenericConvexAlgorithm::testCollision(NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint32 batchStartIndex, uint32 batchNbItems,
+                                           MemoryAllocator& memoryAllocator) {
+
+    // First, we run the GJK algorithm
+    GJKAlgorithm gjkAlgorithm;
+    EPAAlgorithm epaAlgorithm;
+
+#ifdef IS_RP3D_PROFILING_ENABLED
+
+
+    gjkAlgorithm.setProfiler(mProfiler);
+    epaAlgorithm.setProfiler(mProfiler);
+
+#endif
+
+    bool isCollisionFound = false;
+
+    Array<GJKAlgorithm::GJKResult> gjkResults(memoryAllocator, batchNbItems);
+    gjkAlgorithm.testCollision(narrowPhaseInfoBatch, batchStartIndex, batchNbItems, gjkResults);
+    assert(gjkResults.size() == batchNbItems);
+
+    // For each item in the batch
+    for (uint32 batchIndex = batchStartIndex; batchIndex < batchStartIndex + batchNbItems; batchIndex++) {
+
+        NarrowPhaseInfoBatch::NarrowPhaseInfo& narrowPhaseInfo = narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex];
+
+        assert(narrowPhaseInfo.collisionShape1->getType() == CollisionShapeType::GENERIC_CONVEX ||
+               narrowPhaseInfo.collisionShape2->getType() == CollisionShapeType::GENERIC_CONVEX);
+
+        // Get the last frame collision info
+        LastFrameCollisionInfo* lastFrameCollisionInfo = narrowPhaseInfo.lastFrameCollisionInfo;
+
+        lastFrameCollisionInfo->wasUsingGJK = true;
+        lastFrameCollisionInfo->wasUsingSAT = false;
+
+        // If we have found a contact point inside the margins (shallow penetration)
+        if (gjkResults[batchIndex] == GJKAlgorithm::GJKResult::COLLIDE_IN_MARGIN) {
+            narrowPhaseInfo.isColliding = true;
+        }
+        else if (gjkResults[batchIndex] == GJKAlgorithm::GJKResult::INTERPENETRATE) {
+
+            // If we have overlap even without the margins (deep penetration), we use the EPA algorithm
+            narrowPhaseInfo.isColliding = testCollisionEPA(epaAlgorithm, narrowPhaseInfoBatch, batchIndex);
+        }
+
+        if (narrowPhaseInfo.isColliding) {
+
+            isCollisionFound = true;
+
+            // Add more contact points if the contact is between two faces or edges
+            if (narrowPhaseInfo.reportContacts && narrowPhaseInfo.nbContactPoints == 1) {
+                computeFeatureContactPoints(narrowPhaseInfoBatch, batchIndex, memoryAllocator);
+            }
+        }
+    }
+
+    return isCollisionFound;
+}
+
+// Compute the contact with the EPA algorithm when the shapes overlap without their margins
+// The EPA algorithm computes the penetration depth between the internal cores of the shapes (without
+// margins). The margins are then added to the penetration depth and the contact points are moved from
+// the cores onto the surfaces of the shapes. If the cores are only touching, the penetration depth is
+// computed between the shapes enlarged by their margins. This method returns true if the shapes are colliding.
+bool GenericConvexAlgorithm::testCollisionEPA(const EPAAlgorithm& epaAlgorithm, NarrowPhaseInfoBatch& narrowPhaseInfoBatch,
+                                              uint32 batchIndex) const {
+
+    NarrowPhaseInfoBatch::NarrowPhaseInfo& narrowPhaseInfo = narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex];
+
+    const ConvexShape* shape1 = static_cast<const ConvexShape*>(narrowPhaseInfo.collisionShape1);
+    const ConvexShape* shape2 = static_cast<const ConvexShape*>(narrowPhaseInfo.collisionShape2);
+    const Transform& shape1ToWorld = narrowPhaseInfo.shape1ToWorldTransform;
+    const Transform& shape2ToWorld = narrowPhaseInfo.shape2ToWorldTransform;
+
+    LastFrameCollisionInfo* lastFrameCollisionInfo = narrowPhaseInfo.lastFrameCollisionInfo;
+
+    // Use the cached separating axis (in local-space of shape 1) as initial search direction
+    Vector3 separatingAxis = lastFrameCollisionInfo->isValid && lastFrameCollisionInfo->wasUsingGJK ?
+                             lastFrameCollisionInfo->gjkSeparatingAxis : Vector3::zero();
+
+    Vector3 normalShape1Space;
+    decimal penetrationDepth;
+    Vector3 contactPointShape1;
+    Vector3 contactPointShape2;
+    const EPAAlgorithm::EPAResult result = epaAlgorithm.computePenetrationDepth(shape1, shape1ToWorld, shape2, shape2ToWorld,
+                                                                               separatingAxis, normalShape1Space, penetrationDepth,
+                                                                               contactPointShape1, contactPointShape2);
+
+    // If the polytope is degenerate (the cores are only touching) or if the cores are separated because
+    // of numerical errors, the GJK algorithm has stopped on a degenerate simplex while the cores are closer
+    // than the sum of the margins. The EPA algorithm is then run on the shapes enlarged by their margins.
+    bool isMarginsContact = false;
+    if (result != EPAAlgorithm::EPAResult::INTERPENETRATE) {
+
+        separatingAxis = lastFrameCollisionInfo->isValid && lastFrameCollisionInfo->wasUsingGJK ?
+                         lastFrameCollisionInfo->gjkSeparatingAxis : Vector3::zero();
+        const EPAAlgorithm::EPAResult marginsResult = epaAlgorithm.computePenetrationDepth(shape1, shape1ToWorld, shape2, shape2ToWorld,
+                                                                                          separatingAxis, normalShape1Space, penetrationDepth,
+                                                                                          contactPointShape1, contactPointShape2, true);
+        if (marginsResult != EPAAlgorithm::EPAResult::INTERPENETRATE) {
+            return false;
+        }
+
+        isMarginsContact = true;
+    }
+
+    // Cache the separating axis for frame coherence
+    lastFrameCollisionInfo->gjkSeparatingAxis = separatingAxis;
+
+    // If we need to report contacts
+    if (narrowPhaseInfo.reportContacts) {
+
+        const Vector3 normalShape2Space = (shape2ToWorld.getOrientation().getInverse() * shape1ToWorld.getOrientation()) * normalShape1Space;
+
+        // Move the contact points from the cores onto the surfaces of the shapes (the contact points
+        // computed with the margins are already on the surfaces)
+        const decimal margin1 = isMarginsContact ? decimal(0.0) : shape1->getMargin();
+        const decimal margin2 = isMarginsContact ? decimal(0.0) : shape2->getMargin();
+        Vector3 contactPoint1 = contactPointShape1 + margin1 * normalShape1Space;
+        Vector3 contactPoint2 = contactPointShape2 - margin2 * normalShape2Space;
+        const decimal depth = penetrationDepth + margin1 + margin2;
+        Vector3 normalWorld = shape1ToWorld.getOrientation() * normalShape1Space;
+
+        // Compute smooth triangle mesh contact if one of the two collision shapes is a triangle
+        TriangleShape::computeSmoothTriangleMeshContact(shape1, shape2, contactPoint1, contactPoint2, shape1ToWorld, shape2ToWorld,
+                                                        depth, normalWorld);
+
+        narrowPhaseInfoBatch.addContactPoint(batchIndex, normalWorld, depth, contactPoint1, contactPoint2);
+    }
+
+    return true;
+}
+
+// Compute the contact feature (face, edge or vertex) of a convex shape in a given direction
+// The direction (in world-space) is the unit outward normal of the shape at the contact. The points of
+// the feature are returned in world-space. If the feature is a face, its outward normal is also returned.
+// The cap of a cylinder and the base of a cone are approximated with a regular polygon. The feature
+// is a single support point if no face or edge of the shape is almost aligned with the direction.
+void GenericConvexAlgorithm::computeContactFeature(const ConvexShape* shape, const Transform& shapeToWorld, const Vector3& direction,
+                                                   Array<Vector3>& outFeaturePoints, Vector3& outFaceNormal) const {
+
+    assert(outFeaturePoints.size() == 0);
+
+    const Vector3 localDirection = shapeToWorld.getOrientation().getInverse() * direction;
+    const decimal featureMaxSine = std::sqrt(decimal(1.0) - FEATURE_MIN_COSINE * FEATURE_MIN_COSINE);
+    const decimal lengthXZ = std::sqrt(localDirection.x * localDirection.x + localDirection.z * localDirection.z);
+
+    switch (shape->getName()) {
+
+        case CollisionShapeName::BOX:
+        case CollisionShapeName::CONVEX_MESH:
+        case CollisionShapeName::TRIANGLE:
+        {
+            const ConvexPolyhedronShape* polyhedron = static_cast<const ConvexPolyhedronShape*>(shape);
+
+            // Face of the polyhedron with the normal that is the most aligned with the direction
+            const uint32 faceIndex = polyhedron->findMostAntiParallelFace(-localDirection);
+            const Vector3 faceNormal = polyhedron->getFaceNormal(faceIndex);
+            if (faceNormal.dot(localDirection) >= FEATURE_MIN_COSINE) {
+
+                const HalfEdgeStructure::Face& face = polyhedron->getFace(faceIndex);
+                const uint32 nbFaceVertices = static_cast<uint32>(face.faceVertices.size());
+                for (uint32 i=0; i < nbFaceVertices; i++) {
+                    outFeaturePoints.add(shapeToWorld * polyhedron->getVertexPosition(face.faceVertices[i]));
+                }
+                outFaceNormal = shapeToWorld.getOrientation() * faceNormal;
+
+                return;
+            }
+
+            break;
+        }
+        case CollisionShapeName::CYLINDER:
+        {
+            const CylinderShape* cylinder = static_cast<const CylinderShape*>(shape);
+
+            // Flat part of the top or bottom cap (the edges are rounded by the margin)
+            if (std::abs(localDirection.y) >= FEATURE_MIN_COSINE) {
+
+                const decimal y = localDirection.y > decimal(0.0) ? cylinder->mHalfHeight : -cylinder->mHalfHeight;
+                const decimal coreRadius = cylinder->mRadius - cylinder->mMargin;
+                for (uint32 i=0; i < NB_CAP_POLYGON_VERTICES; i++) {
+                    const decimal angle = decimal(i) * PI_TIMES_2 / decimal(NB_CAP_POLYGON_VERTICES);
+                    outFeaturePoints.add(shapeToWorld * Vector3(coreRadius * std::cos(angle), y, coreRadius * std::sin(angle)));
+                }
+                outFaceNormal = shapeToWorld.getOrientation() * Vector3(0, y > decimal(0.0) ? decimal(1.0) : decimal(-1.0), 0);
+
+                return;
+            }
+
+            // Line segment on the side of the cylinder
+            if (std::abs(localDirection.y) <= featureMaxSine && lengthXZ > MACHINE_EPSILON) {
+
+                const decimal factor = cylinder->mRadius / lengthXZ;
+                const Vector3 sidePoint(localDirection.x * factor, decimal(0.0), localDirection.z * factor);
+                const Vector3 coreHalfHeight(decimal(0.0), cylinder->mHalfHeight - cylinder->mMargin, decimal(0.0));
+                outFeaturePoints.add(shapeToWorld * (sidePoint - coreHalfHeight));
+                outFeaturePoints.add(shapeToWorld * (sidePoint + coreHalfHeight));
+
+                return;
+            }
+
+            break;
+        }
+        case CollisionShapeName::CONE:
+        {
+            const ConeShape* cone = static_cast<const ConeShape*>(shape);
+
+            // Flat part of the base
+            if (-localDirection.y >= FEATURE_MIN_COSINE) {
+
+                const decimal y = decimal(-0.25) * cone->mHeight;
+                for (uint32 i=0; i < NB_CAP_POLYGON_VERTICES; i++) {
+                    const decimal angle = decimal(i) * PI_TIMES_2 / decimal(NB_CAP_POLYGON_VERTICES);
+                    outFeaturePoints.add(shapeToWorld * Vector3(cone->mCoreRadius * std::cos(angle), y, cone->mCoreRadius * std::sin(angle)));
+                }
+                outFaceNormal = shapeToWorld.getOrientation() * Vector3(0, -1, 0);
+
+                return;
+            }
+
+            // Line segment on the side of the cone (between the apex and the base)
+            if (lengthXZ > MACHINE_EPSILON) {
+
+                const decimal k = cone->mRadius / cone->mHeight;
+                const Vector3 radialUnit(localDirection.x / lengthXZ, decimal(0.0), localDirection.z / lengthXZ);
+                const Vector3 sideNormal = Vector3(radialUnit.x, k, radialUnit.z) / std::sqrt(decimal(1.0) + k * k);
+                if (sideNormal.dot(localDirection) >= FEATURE_MIN_COSINE) {
+
+                    // Segment of the core moved onto the surface of the cone by the margin
+                    const Vector3 offset = cone->mMargin * sideNormal;
+                    outFeaturePoints.add(shapeToWorld * (Vector3(0, cone->mCoreApexY, 0) + offset));
+                    outFeaturePoints.add(shapeToWorld * (cone->mCoreRadius * radialUnit + Vector3(0, cone->mCoreBaseY, 0) + offset));
+
+                    return;
+                }
+            }
+
+            break;
+        }
+        case CollisionShapeName::CAPSULE:
+        {
+            const CapsuleShape* capsule = static_cast<const CapsuleShape*>(shape);
+
+            // Line segment on the side of the capsule
+            if (std::abs(localDirection.y) <= featureMaxSine && lengthXZ > MACHINE_EPSILON) {
+
+                const decimal factor = capsule->getRadius() / lengthXZ;
+                const Vector3 sidePoint(localDirection.x * factor, decimal(0.0), localDirection.z * factor);
+                const Vector3 halfHeight(decimal(0.0), decimal(0.5) * capsule->getHeight(), decimal(0.0));
+                outFeaturePoints.add(shapeToWorld * (sidePoint - halfHeight));
+                outFeaturePoints.add(shapeToWorld * (sidePoint + halfHeight));
+
+                return;
+            }
+
+            break;
+        }
+        default:
+            break;
+    }
+
+    // Otherwise, the contact feature is the support point of the shape
+    outFeaturePoints.add(shapeToWorld * shape->getLocalSupportPointWithMargin(localDirection));
+}
+
+// Replace the contact point of a batch item with the contact points of the features of the shapes
+// The contact features of both shapes are computed using the contact normal. If one of the features is a
+// face (or if both features are almost parallel edges), it is used as reference feature and the incident
+// feature of the other shape is clipped against the side planes of the reference feature. The clipped points
+// below the reference face become the new contact points. This is similar to the face contact of the SAT
+// algorithm. If one of the features is a vertex, the contact point computed by GJK or EPA is kept.
+void GenericConvexAlgorithm::computeFeatureContactPoints(NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint32 batchIndex,
+                                                         MemoryAllocator& memoryAllocator) const {
+
+    NarrowPhaseInfoBatch::NarrowPhaseInfo& narrowPhaseInfo = narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex];
+
+    assert(narrowPhaseInfo.nbContactPoints == 1);
+
+    const ConvexShape* shape1 = static_cast<const ConvexShape*>(narrowPhaseInfo.collisionShape1);
+    const ConvexShape* shape2 = static_cast<const ConvexShape*>(narrowPhaseInfo.collisionShape2);
+    const Transform& shape1ToWorld = narrowPhaseInfo.shape1ToWorldTransform;
+    const Transform& shape2ToWorld = narrowPhaseInfo.shape2ToWorldTransform;
+
+    // Contact normal (from shape 1 towards shape 2) in world-space
+    const Vector3 normal = narrowPhaseInfo.contactPoints[0].normal;
+
+    // Compute the contact features of both shapes
+    Array<Vector3> featurePoints1(memoryAllocator, NB_CAP_POLYGON_VERTICES);
+    Array<Vector3> featurePoints2(memoryAllocator, NB_CAP_POLYGON_VERTICES);
+    Vector3 faceNormal1;
+    Vector3 faceNormal2;
+    computeContactFeature(shape1, shape1ToWorld, normal, featurePoints1, faceNormal1);
+    computeContactFeature(shape2, shape2ToWorld, -normal, featurePoints2, faceNormal2);
+
+    const uint32 nbFeaturePoints1 = static_cast<uint32>(featurePoints1.size());
+    const uint32 nbFeaturePoints2 = static_cast<uint32>(featurePoints2.size());
+
+    // If one of the features is a vertex, the current contact point is already correct
+    if (nbFeaturePoints1 == 1 || nbFeaturePoints2 == 1) return;
+
+    // Select the reference feature (a face if possible or the face that is the most aligned with the normal)
+    bool isShape1Reference = nbFeaturePoints1 >= nbFeaturePoints2;
+    if (nbFeaturePoints1 > 2 && nbFeaturePoints2 > 2) {
+        isShape1Reference = faceNormal1.dot(normal) >= -faceNormal2.dot(normal);
+    }
+
+    const Array<Vector3>& referencePoints = isShape1Reference ? featurePoints1 : featurePoints2;
+    const Array<Vector3>& incidentPoints = isShape1Reference ? featurePoints2 : featurePoints1;
+    const uint32 nbReferencePoints = static_cast<uint32>(referencePoints.size());
+
+    // Outward normal of the reference feature (towards the incident shape)
+    Vector3 referenceNormal;
+
+    // Compute the side planes of the reference feature (with normals pointing inside the feature)
+    Array<Vector3> planesPoints(memoryAllocator, nbReferencePoints);
+    Array<Vector3> planesNormals(memoryAllocator, nbReferencePoints);
+    if (nbReferencePoints > 2) {
+
+        referenceNormal = isShape1Reference ? faceNormal1 : faceNormal2;
+
+        Vector3 centroid(0, 0, 0);
+        for (uint32 i=0; i < nbReferencePoints; i++) {
+            centroid += referencePoints[i];
+        }
+        centroid /= decimal(nbReferencePoints);
+
+        for (uint32 i=0; i < nbReferencePoints; i++) {
+
+            const Vector3& vertex = referencePoints[i];
+            const Vector3 edge = referencePoints[i + 1 < nbReferencePoints ? i + 1 : 0] - vertex;
+            Vector3 planeNormal = referenceNormal.cross(edge);
+            if (planeNormal.dot(centroid - vertex) < decimal(0.0)) {
+                planeNormal = -planeNormal;
+            }
+
+            planesPoints.add(vertex);
+            planesNormals.add(planeNormal);
+        }
+    }
+    else {
+
+        // Two edges are only a contact feature if they are almost parallel
+        const Vector3 referenceEdge = referencePoints[1] - referencePoints[0];
+        const Vector3 incidentEdge = incidentPoints[1] - incidentPoints[0];
+        const decimal edgesLengths = referenceEdge.length() * incidentEdge.length();
+        if (edgesLengths < MACHINE_EPSILON || std::abs(referenceEdge.dot(incidentEdge)) < FEATURE_MIN_COSINE * edgesLengths) return;
+
+        // The reference normal is the contact normal made orthogonal to the reference edge
+        referenceNormal = isShape1Reference ? normal : -normal;
+        referenceNormal -= (referenceNormal.dot(referenceEdge) / referenceEdge.lengthSquare()) * referenceEdge;
+        if (referenceNormal.lengthSquare() < MACHINE_EPSILON) return;
+        referenceNormal.normalize();
+
+        planesPoints.add(referencePoints[0]);
+        planesNormals.add(referenceEdge);
+        planesPoints.add(referencePoints[1]);
+        planesNormals.add(-referenceEdge);
+    }
+
+    // Clip the incident feature with the side planes of the reference feature
+    Array<Vector3> clippedPoints(memoryAllocator, incidentPoints.size());
+    if (incidentPoints.size() == 2) {
+        clippedPoints = clipSegmentWithPlanes(incidentPoints[0], incidentPoints[1], planesPoints, planesNormals, memoryAllocator);
+    }
+    else {
+
+        Array<Vector3> polygon(incidentPoints);
+        const uint32 nbPlanes = static_cast<uint32>(planesPoints.size());
+        for (uint32 p=0; p < nbPlanes && polygon.size() > 0; p++) {
+            clippedPoints.clear();
+            clipPolygonWithPlane(polygon, planesPoints[p], planesNormals[p], clippedPoints);
+            polygon = clippedPoints;
+        }
+        clippedPoints = polygon;
+    }
+
+    // Keep the clipped points that are below the reference feature
+    const Vector3& referencePoint = referencePoints[0];
+    bool isFirstContactPoint = true;
+    const Transform worldToShape1 = shape1ToWorld.getInverse();
+    const Transform worldToShape2 = shape2ToWorld.getInverse();
+    const Vector3 contactNormal = isShape1Reference ? referenceNormal : -referenceNormal;
+    const uint32 nbClippedPoints = static_cast<uint32>(clippedPoints.size());
+    for (uint32 i=0; i < nbClippedPoints; i++) {
+
+        const Vector3& incidentPoint = clippedPoints[i];
+        const decimal penetrationDepth = (referencePoint - incidentPoint).dot(referenceNormal);
+        if (penetrationDepth <= decimal(0.0)) continue;
+
+        // Replace the previous contact point by the feature contact points
+        if (isFirstContactPoint) {
+            narrowPhaseInfoBatch.resetContactPoints(batchIndex);
+            isFirstContactPoint = false;
+        }
+
+        // Project the incident point onto the reference feature
+        const Vector3 referenceContactPoint = incidentPoint + penetrationDepth * referenceNormal;
+
+        const Vector3& contactPointShape1 = isShape1Reference ? referenceContactPoint : incidentPoint;
+        const Vector3& contactPointShape2 = isShape1Reference ? incidentPoint : referenceContactPoint;
+        narrowPhaseInfoBatch.addContactPoint(batchIndex, contactNormal, penetrationDepth, worldToShape1 * contactPointShape1,
+                                             worldToShape2 * contactPointShape2);
+    }
+}
@@ -33,7 +33,10 @@ NarrowPhaseInput::NarrowPhaseInput(MemoryAllocator& allocator, OverlappingPairs&
     :mSphereVsSphereBatch(overlappingPairs, allocator), mSphereVsCapsuleBatch(overlappingPairs, allocator),
      mCapsuleVsCapsuleBatch(overlappingPairs, allocator), mSphereVsConvexPolyhedronBatch(overlappingPairs, allocator),
      mCapsuleVsConvexPolyhedronBatch(overlappingPairs, allocator),
-     mConvexPolyhedronVsConvexPolyhedronBatch(overlappingPairs, allocator) {
+     mConvexPolyhedronVsConvexPolyhedronBatch(overlappingPairs, allocator), mBoxVsBoxBatch(overlappingPairs, allocator),
+     mSphereVsTriangleBatch(overlappingPairs, allocator), mCapsuleVsTriangleBatch(overlappingPairs, allocator),
+     mBoxVsTriangleBatch(overlappingPairs, allocator), mGenericConvexBatch(overlappingPairs, allocator),
+     mConvexVsConvexOverlapBatch(overlappingPairs, allocator) {
 
 }
 
@@ -46,6 +49,12 @@ void NarrowPhaseInput::reserveMemory() {
     mSphereVsConvexPolyhedronBatch.reserveMemory();
     mCapsuleVsConvexPolyhedronBatch.reserveMemory();
     mConvexPolyhedronVsConvexPolyhedronBatch.reserveMemory();
+    mBoxVsBoxBatch.reserveMemory();
+    mSphereVsTriangleBatch.reserveMemory();
+    mCapsuleVsTriangleBatch.reserveMemory();
+    mBoxVsTriangleBatch.reserveMemory();
+    mGenericConvexBatch.reserveMemory();
+    mConvexVsConvexOverlapBatch.reserveMemory();
 }
 
 // Clear
@@ -57,4 +66,10 @@ void NarrowPhaseInput::clear() {
     mSphereVsConvexPolyhedronBatch.clear();
     mCapsuleVsConvexPolyhedronBatch.clear();
     mConvexPolyhedronVsConvexPolyhedronBatch.clear();
+    mBoxVsBoxBatch.clear();
+    mSphereVsTriangleBatch.clear();
+    mCapsuleVsTriangleBatch.clear();
+    mBoxVsTriangleBatch.clear();
+    mGenericConvexBatch.clear();
+    mConvexVsConvexOverlapBatch.clear();
 }
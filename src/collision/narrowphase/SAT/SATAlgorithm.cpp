@@ -42,6 +42,7 @@ using namespace reactphysics3d;
 // Static variables initialization
 const decimal SATAlgorithm::SEPARATING_AXIS_RELATIVE_TOLERANCE = decimal(1.002);
 const decimal SATAlgorithm::SEPARATING_AXIS_ABSOLUTE_TOLERANCE = decimal(0.0005);
+const decimal SATAlgorithm::SAME_SEPARATING_AXIS_MIN_COSINE = decimal(0.998);
 
 // Constructor
 SATAlgorithm::SATAlgorithm(bool clipWithPreviousAxisIfStillColliding, MemoryAllocator& memoryAllocator)
@@ -516,6 +517,12 @@ bool SATAlgorithm::testCollisionConvexPolyhedronVsConvexPolyhedron(NarrowPhaseIn
             // axis. If it is the case, we directly report the collision without executing the whole SAT algorithm again. If
             // the shapes are still separated along this axis, we directly exit with no collision.
 
+            // The previous minimum penetration axis is only reused for clipping if it would
+            // still be selected as the minimum penetration axis by the whole SAT algorithm
+            const bool canClipWithPreviousAxis = lastFrameCollisionInfo->wasColliding && mClipWithPreviousAxisIfStillColliding &&
+                                                 isPreviousMinAxisStillValid(polyhedron1, polyhedron2, polyhedron1ToPolyhedron2,
+                                                                             polyhedron2ToPolyhedron1, lastFrameCollisionInfo);
+
             // If the previous separating axis (or axis with minimum penetration depth)
             // was a face normal of polyhedron 1
             if (lastFrameCollisionInfo->satIsAxisFacePolyhedron1) {
@@ -531,7 +538,7 @@ bool SATAlgorithm::testCollisionConvexPolyhedronVsConvexPolyhedron(NarrowPhaseIn
                 }
 
                 // The two shapes were overlapping in the previous frame and still seem to overlap in this one
-                if (lastFrameCollisionInfo->wasColliding && mClipWithPreviousAxisIfStillColliding && penetrationDepth > decimal(0.0)) {
+                if (canClipWithPreviousAxis && penetrationDepth > decimal(0.0)) {
 
                     minPenetrationDepth = penetrationDepth;
                     minFaceIndex = lastFrameCollisionInfo->satMinAxisFaceIndex;
@@ -571,7 +578,7 @@ bool SATAlgorithm::testCollisionConvexPolyhedronVsConvexPolyhedron(NarrowPhaseIn
                 }
 
                 // The two shapes were overlapping in the previous frame and still seem to overlap in this one
-                if (lastFrameCollisionInfo->wasColliding && mClipWithPreviousAxisIfStillColliding && penetrationDepth > decimal(0.0)) {
+                if (canClipWithPreviousAxis && penetrationDepth > decimal(0.0)) {
 
                     minPenetrationDepth = penetrationDepth;
                     minFaceIndex = lastFrameCollisionInfo->satMinAxisFaceIndex;
@@ -629,7 +636,7 @@ bool SATAlgorithm::testCollisionConvexPolyhedronVsConvexPolyhedron(NarrowPhaseIn
                     }
 
                     // If the shapes were overlapping on the previous axis and still seem to overlap in this frame
-                    if (lastFrameCollisionInfo->wasColliding && mClipWithPreviousAxisIfStillColliding && penetrationDepth > decimal(0.0) &&
+                    if (canClipWithPreviousAxis && penetrationDepth > decimal(0.0) &&
                         penetrationDepth < DECIMAL_LARGEST) {
 
                         // Compute the closest points between the two edges (in the local-space of poylhedron 2)
@@ -689,7 +696,9 @@ bool SATAlgorithm::testCollisionConvexPolyhedronVsConvexPolyhedron(NarrowPhaseIn
 
         // Test all the face normals of the polyhedron 1 for separating axis
         uint32 faceIndex1;
-        decimal penetrationDepth1 = testFacesDirectionPolyhedronVsPolyhedron(polyhedron1, polyhedron2, polyhedron1ToPolyhedron2, faceIndex1);
+        decimal secondMinPenetrationDepth1;
+        decimal penetrationDepth1 = testFacesDirectionPolyhedronVsPolyhedron(polyhedron1, polyhedron2, polyhedron1ToPolyhedron2, faceIndex1,
+                                                                             secondMinPenetrationDepth1);
         if (penetrationDepth1 <= decimal(0.0)) {
 
             lastFrameCollisionInfo->satIsAxisFacePolyhedron1 = true;
@@ -702,7 +711,9 @@ bool SATAlgorithm::testCollisionConvexPolyhedronVsConvexPolyhedron(NarrowPhaseIn
 
         // Test all the face normals of the polyhedron 2 for separating axis
         uint32 faceIndex2;
-        decimal penetrationDepth2 = testFacesDirectionPolyhedronVsPolyhedron(polyhedron2, polyhedron1, polyhedron2ToPolyhedron1, faceIndex2);
+        decimal secondMinPenetrationDepth2;
+        decimal penetrationDepth2 = testFacesDirectionPolyhedronVsPolyhedron(polyhedron2, polyhedron1, polyhedron2ToPolyhedron1, faceIndex2,
+                                                                             secondMinPenetrationDepth2);
         if (penetrationDepth2 <= decimal(0.0)) {
 
             lastFrameCollisionInfo->satIsAxisFacePolyhedron1 = false;
@@ -824,6 +835,13 @@ bool SATAlgorithm::testCollisionConvexPolyhedronVsConvexPolyhedron(NarrowPhaseIn
         // If the minimum separating axis is a face normal
         if (isMinPenetrationFaceNormal) {
 
+            // Keep how much the penetration depths can change before another axis becomes the minimum one
+            lastFrameCollisionInfo->satMinAxisPenetrationMargin = computeFaceAxisPenetrationMargin(isMinPenetrationFaceNormalPolyhedron1,
+                                                                        polyhedron1, polyhedron2, polyhedron1ToPolyhedron2,
+                                                                        faceIndex1, penetrationDepth1, secondMinPenetrationDepth1,
+                                                                        faceIndex2, penetrationDepth2, secondMinPenetrationDepth2);
+            lastFrameCollisionInfo->satReferenceTransform = polyhedron1ToPolyhedron2;
+
             // Compute the contact points between two faces of two convex polyhedra.
             bool contactsFound = computePolyhedronVsPolyhedronFaceContactPoints(isMinPenetrationFaceNormalPolyhedron1, polyhedron1,
                                                                                 polyhedron2, polyhedron1ToPolyhedron2, polyhedron2ToPolyhedron1,
@@ -876,6 +894,10 @@ bool SATAlgorithm::testCollisionConvexPolyhedronVsConvexPolyhedron(NarrowPhaseIn
             lastFrameCollisionInfo->satIsAxisFacePolyhedron2 = false;
             lastFrameCollisionInfo->satMinEdge1Index = minSeparatingEdge1Index;
             lastFrameCollisionInfo->satMinEdge2Index = minSeparatingEdge2Index;
+
+            // The penetration depths along the other edge-edge axes are not kept, therefore
+            // the whole SAT algorithm will run again in the next frame
+            lastFrameCollisionInfo->satMinAxisPenetrationMargin = decimal(0.0);
         }
 
         narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].isColliding = true;
@@ -1110,11 +1132,12 @@ decimal SATAlgorithm::testSingleFaceDirectionPolyhedronVsPolyhedron(const Convex
 decimal SATAlgorithm::testFacesDirectionPolyhedronVsPolyhedron(const ConvexPolyhedronShape* polyhedron1,
                                                                const ConvexPolyhedronShape* polyhedron2,
                                                                const Transform& polyhedron1ToPolyhedron2,
-                                                               uint& minFaceIndex) const {
+                                                               uint& minFaceIndex, decimal& secondMinPenetrationDepth) const {
 
     RP3D_PROFILE("SATAlgorithm::testFacesDirectionPolyhedronVsPolyhedron", mProfiler);
 
     decimal minPenetrationDepth = DECIMAL_LARGEST;
+    secondMinPenetrationDepth = DECIMAL_LARGEST;
 
     // For each face of the first polyhedron
     for (uint32 f = 0; f < polyhedron1->getNbFaces(); f++) {
@@ -1130,14 +1153,120 @@ decimal SATAlgorithm::testFacesDirectionPolyhedronVsPolyhedron(const ConvexPolyh
 
         // Check if we have found a new minimum penetration axis
         if (penetrationDepth < minPenetrationDepth) {
+            secondMinPenetrationDepth = minPenetrationDepth;
             minPenetrationDepth = penetrationDepth;
             minFaceIndex = f;
         }
+        else if (penetrationDepth < secondMinPenetrationDepth) {
+            secondMinPenetrationDepth = penetrationDepth;
+        }
     }
 
     return minPenetrationDepth;
 }
 
+// Return how much the penetration depths along the face normals of two polyhedra can change before
+// another face than the current minimum penetration face is selected by the SAT algorithm
+decimal SATAlgorithm::computeFaceAxisPenetrationMargin(bool isMinPenetrationFaceNormalPolyhedron1, const ConvexPolyhedronShape* polyhedron1,
+                                                       const ConvexPolyhedronShape* polyhedron2, const Transform& polyhedron1ToPolyhedron2,
+                                                       uint32 faceIndex1, decimal penetrationDepth1, decimal secondMinPenetrationDepth1,
+                                                       uint32 faceIndex2, decimal penetrationDepth2, decimal secondMinPenetrationDepth2) const {
+
+    // An edge-edge axis only replaces a face axis in the SAT algorithm based on the face penetration depths,
+    // therefore only the other face axes can compete with the minimum face axis. If the minimum penetration faces
+    // of the two polyhedra are parallel (resting contact), they represent the same axis
+    const Vector3 faceNormal1Polyhedron2Space = polyhedron1ToPolyhedron2.getOrientation() * polyhedron1->getFaceNormal(faceIndex1);
+    const bool areFacesParallel = std::abs(faceNormal1Polyhedron2Space.dot(polyhedron2->getFaceNormal(faceIndex2))) >=
+                                  SAME_SEPARATING_AXIS_MIN_COSINE;
+
+    if (isMinPenetrationFaceNormalPolyhedron1) {
+
+        const decimal otherPenetrationDepth = areFacesParallel ? secondMinPenetrationDepth2 : penetrationDepth2;
+        return std::min(secondMinPenetrationDepth1 - penetrationDepth1,
+                        otherPenetrationDepth * SEPARATING_AXIS_RELATIVE_TOLERANCE + SEPARATING_AXIS_ABSOLUTE_TOLERANCE - penetrationDepth1);
+    }
+
+    const decimal otherPenetrationDepth = areFacesParallel ? secondMinPenetrationDepth1 : penetrationDepth1;
+    return std::min(secondMinPenetrationDepth2 - penetrationDepth2,
+                    otherPenetrationDepth - (penetrationDepth2 * SEPARATING_AXIS_RELATIVE_TOLERANCE + SEPARATING_AXIS_ABSOLUTE_TOLERANCE));
+}
+
+// Return true if the previous minimum penetration axis of two polyhedra would still be selected as the
+// minimum penetration axis by the SAT algorithm. We first check if the relative motion since the last
+// time the penetration depths were computed is small enough for no other axis to become the minimum one.
+// Otherwise, we test the face normals of both polyhedra again (but not the expensive edge-edge axes).
+bool SATAlgorithm::isPreviousMinAxisStillValid(const ConvexPolyhedronShape* polyhedron1, const ConvexPolyhedronShape* polyhedron2,
+                                               const Transform& polyhedron1ToPolyhedron2, const Transform& polyhedron2ToPolyhedron1,
+                                               LastFrameCollisionInfo* lastFrameCollisionInfo) const {
+
+    RP3D_PROFILE("SATAlgorithm::isPreviousMinAxisStillValid()", mProfiler);
+
+    const Transform& referenceTransform = lastFrameCollisionInfo->satReferenceTransform;
+
+    // Relative translation and rotation of polyhedron 1 with respect to polyhedron 2 since the reference transform
+    const decimal translationDistance = (polyhedron1ToPolyhedron2.getPosition() - referenceTransform.getPosition()).length();
+    const decimal cosHalfAngle = std::min(std::abs(polyhedron1ToPolyhedron2.getOrientation().dot(referenceTransform.getOrientation())),
+                                          decimal(1.0));
+
+    // Maximum displacement of a point at unit distance from the center of the rotation
+    const decimal rotationChord = decimal(2.0) * std::sqrt(decimal(1.0) - cosHalfAngle * cosHalfAngle);
+
+    // Compute the radii of spheres around the local origins that contain the polyhedra
+    Vector3 min1, max1, min2, max2;
+    polyhedron1->getLocalBounds(min1, max1);
+    polyhedron2->getLocalBounds(min2, max2);
+    const decimal radius1 = Vector3::max(min1.getAbsoluteVector(), max1.getAbsoluteVector()).length();
+    const decimal radius2 = Vector3::max(min2.getAbsoluteVector(), max2.getAbsoluteVector()).length();
+
+    // Upper bound of the variation of the penetration depth along a face normal axis since the reference transform. A vertex
+    // of polyhedron 1 moves by at most (translation + chord * radius1) relative to the faces of polyhedron 2 and a vertex of
+    // polyhedron 2 moves by at most (translation + chord * (radius2 + distance between origins)) relative to the faces of polyhedron 1
+    const decimal maxPenetrationDepthVariation = translationDistance +
+                                                 rotationChord * std::max(radius1, radius2 + polyhedron1ToPolyhedron2.getPosition().length());
+
+    // The minimum axis and the closest competing axis can both move toward each other
+    if (decimal(2.0) * maxPenetrationDepthVariation < lastFrameCollisionInfo->satMinAxisPenetrationMargin) {
+        return true;
+    }
+
+    // The penetration depths along the edge-edge axes are not kept between frames
+    if (!lastFrameCollisionInfo->satIsAxisFacePolyhedron1 && !lastFrameCollisionInfo->satIsAxisFacePolyhedron2) {
+        return false;
+    }
+
+    // Test the face normals of both polyhedra again
+    uint32 faceIndex1 = 0, faceIndex2 = 0;
+    decimal secondMinPenetrationDepth1, secondMinPenetrationDepth2;
+    const decimal penetrationDepth1 = testFacesDirectionPolyhedronVsPolyhedron(polyhedron1, polyhedron2, polyhedron1ToPolyhedron2,
+                                                                               faceIndex1, secondMinPenetrationDepth1);
+    if (penetrationDepth1 <= decimal(0.0)) {
+        return false;
+    }
+    const decimal penetrationDepth2 = testFacesDirectionPolyhedronVsPolyhedron(polyhedron2, polyhedron1, polyhedron2ToPolyhedron1,
+                                                                               faceIndex2, secondMinPenetrationDepth2);
+    if (penetrationDepth2 <= decimal(0.0)) {
+        return false;
+    }
+
+    // Select the minimum penetration face the same way as the SAT algorithm does
+    const bool isMinPenetrationFaceNormalPolyhedron1 = penetrationDepth1 < penetrationDepth2 * SEPARATING_AXIS_RELATIVE_TOLERANCE +
+                                                                           SEPARATING_AXIS_ABSOLUTE_TOLERANCE;
+    const uint32 minFaceIndex = isMinPenetrationFaceNormalPolyhedron1 ? faceIndex1 : faceIndex2;
+    if (isMinPenetrationFaceNormalPolyhedron1 != lastFrameCollisionInfo->satIsAxisFacePolyhedron1 ||
+        minFaceIndex != lastFrameCollisionInfo->satMinAxisFaceIndex) {
+        return false;
+    }
+
+    // The previous axis is still the minimum one. We start again from the current relative transform
+    lastFrameCollisionInfo->satMinAxisPenetrationMargin = computeFaceAxisPenetrationMargin(isMinPenetrationFaceNormalPolyhedron1,
+                                                                polyhedron1, polyhedron2, polyhedron1ToPolyhedron2,
+                                                                faceIndex1, penetrationDepth1, secondMinPenetrationDepth1,
+                                                                faceIndex2, penetrationDepth2, secondMinPenetrationDepth2);
+    lastFrameCollisionInfo->satReferenceTransform = polyhedron1ToPolyhedron2;
+
+    return true;
+}
+
 
 // Return true if two edges of two polyhedrons build a minkowski face (and can therefore be a separating axis)
 bool SATAlgorithm::testEdgesBuildMinkowskiFace(const ConvexPolyhedronShape* polyhedron1, const HalfEdgeStructure::Edge& edge1,
@@ -0,0 +1,163 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2022 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+// Libraries
+#include <reactphysics3d/collision/narrowphase/SphereVsTriangleAlgorithm.h>
+#include <reactphysics3d/collision/narrowphase/TriangleNarrowPhaseInfoBatch.h>
+#include <reactphysics3d/collision/shapes/SphereShape.h>
+#include <reactphysics3d/collision/shapes/TriangleShape.h>
+#include <reactphysics3d/mathematics/mathematics_functions.h>
+#include <reactphysics3d/utils/Profiler.h>
+
+// We want to use the ReactPhysics3D namespace
+using namespace reactphysics3d;
+
+// Compute the narrow-phase collision detection between a sphere and triangles
+/// The contact normal is the smooth normal of the triangle mesh at the closest point of the triangle
+/// (see TriangleShape::computeSmoothMeshContact()) and the contact point on the sphere is re-aligned
+/// along this normal.
+bool SphereVsTriangleAlgorithm::testCollision(TriangleNarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint32 batchStartIndex,
+                                              uint32 batchNbItems, MemoryAllocator& /*memoryAllocator*/) {
+
+    RP3D_PROFILE("SphereVsTriangleAlgorithm::testCollision()", mProfiler);
+
+    bool isCollisionFound = false;
+
+    // The triangles of a given overlapping pair are consecutive in the batch and share the same
+    // transforms. Therefore, we only recompute the transforms when the overlapping pair changes.
+    const OverlappingPairs::OverlappingPair* currentPair = nullptr;
+    Transform triangleToSphereTransform;
+    Vector3 sphereCenter;
+
+    // For each item in the batch
+    for (uint32 batchIndex = batchStartIndex; batchIndex < batchStartIndex + batchNbItems; batchIndex++) {
+
+        NarrowPhaseInfoBatch::NarrowPhaseInfo& narrowPhaseInfo = narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex];
+
+        assert(narrowPhaseInfo.nbContactPoints == 0);
+        assert(!narrowPhaseInfo.isColliding);
+
+        // The collision shape of the triangle is null
+        const bool isSphereShape1 = narrowPhaseInfo.collisionShape1 != nullptr;
+        const SphereShape* sphereShape = static_cast<const SphereShape*>(isSphereShape1 ? narrowPhaseInfo.collisionShape1 : narrowPhaseInfo.collisionShape2);
+
+        assert(sphereShape != nullptr && sphereShape->getName() == CollisionShapeName::SPHERE);
+        assert(narrowPhaseInfo.collisionShape1 == nullptr || narrowPhaseInfo.collisionShape2 == nullptr);
+
+        const Transform& sphereToWorldTransform = isSphereShape1 ? narrowPhaseInfo.shape1ToWorldTransform : narrowPhaseInfo.shape2ToWorldTransform;
+        const Transform& triangleToWorldTransform = isSphereShape1 ? narrowPhaseInfo.shape2ToWorldTransform : narrowPhaseInfo.shape1ToWorldTransform;
+
+        if (narrowPhaseInfo.overlappingPair != currentPair) {
+
+            currentPair = narrowPhaseInfo.overlappingPair;
+
+            // Compute the center of the sphere in the local-space of the triangles
+            const Transform worldToTriangleTransform = triangleToWorldTransform.getInverse();
+            sphereCenter = worldToTriangleTransform * sphereToWorldTransform.getPosition();
+
+            triangleToSphereTransform = sphereToWorldTransform.getInverse() * triangleToWorldTransform;
+        }
+
+        const Vector3* vertices = narrowPhaseInfoBatch.getTriangleVertices(batchIndex);
+
+        // Compute the closest point of the triangle to the center of the sphere
+        decimal u, v, w;
+        const Vector3 closestPoint = computeClosestPointOnTriangle(vertices[0], vertices[1], vertices[2], sphereCenter, u, v, w);
+
+        const decimal radius = sphereShape->getRadius();
+        const Vector3 triangleToSphere = sphereCenter - closestPoint;
+        const decimal distanceSquare = triangleToSphere.lengthSquare();
+
+        // If the sphere does not overlap with the triangle
+        if (distanceSquare >= radius * radius) {
+            continue;
+        }
+
+        // Compute the triangle face normal
+        Vector3 faceNormal = (vertices[1] - vertices[0]).cross(vertices[2] - vertices[0]);
+        const decimal faceNormalLengthSquare = faceNormal.lengthSquare();
+
+        // Do not generate a contact with a degenerate triangle
+        if (faceNormalLengthSquare < MACHINE_EPSILON) {
+            continue;
+        }
+        faceNormal /= std::sqrt(faceNormalLengthSquare);
+
+        // Compute the penetration axis (from the triangle to the sphere) and depth
+        Vector3 penetrationAxis;
+        decimal penetrationDepth;
+        if (distanceSquare > MACHINE_EPSILON) {
+
+            const decimal distance = std::sqrt(distanceSquare);
+            penetrationAxis = triangleToSphere / distance;
+            penetrationDepth = radius - distance;
+        }
+        else {  // If the center of the sphere is on the triangle (deep penetration)
+
+            penetrationAxis = faceNormal;
+            penetrationDepth = radius;
+        }
+
+        // If the penetration depth is negative (due too numerical errors), there is no contact
+        if (penetrationDepth <= decimal(0.0)) {
+            continue;
+        }
+
+        // If we need to report contacts
+        if (narrowPhaseInfo.reportContacts) {
+
+            // Compute the smooth normal of the triangle mesh at the contact point. If the contact is in
+            // the middle of the triangle face or on an internal edge of the mesh we use the face normal,
+            // otherwise the contact is on a convex edge or vertex of the mesh and we use the penetration axis
+            Vector3 triangleNormal = faceNormal;
+            if (!TriangleShape::isFaceContactNormalAtPoint(u, v, w, narrowPhaseInfoBatch.getTriangleConvexEdges(batchIndex))) {
+                triangleNormal = penetrationAxis;
+            }
+
+            // The triangle normal should be the one in the direction out of the current colliding face of the triangle
+            if (triangleNormal.dot(penetrationAxis) < decimal(0.0)) {
+                triangleNormal = -triangleNormal;
+            }
+
+            // Re-align the contact point on the sphere such that it is aligned along the new contact normal
+            const Vector3 contactPointSphereLocal = triangleToSphereTransform * (closestPoint - triangleNormal * penetrationDepth);
+            const Vector3& contactPointTriangleLocal = closestPoint;
+
+            // Compute the world contact normal from shape 1 to shape 2
+            const Vector3 triangleWorldNormal = triangleToWorldTransform.getOrientation() * triangleNormal;
+            const Vector3 normalWorld = isSphereShape1 ? -triangleWorldNormal : triangleWorldNormal;
+
+            // Create the contact info object
+            narrowPhaseInfoBatch.addContactPoint(batchIndex, normalWorld, penetrationDepth,
+                                                 isSphereShape1 ? contactPointSphereLocal : contactPointTriangleLocal,
+                                                 isSphereShape1 ? contactPointTriangleLocal : contactPointSphereLocal);
+        }
+
+        narrowPhaseInfo.isColliding = true;
+        isCollisionFound = true;
+    }
+
+    return isCollisionFound;
+}
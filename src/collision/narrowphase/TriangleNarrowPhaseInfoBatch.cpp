@@ -0,0 +1,61 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2022 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+// Libraries
+#include <reactphysics3d/collision/narrowphase/TriangleNarrowPhaseInfoBatch.h>
+
+using namespace reactphysics3d;
+
+// Constructor
+TriangleNarrowPhaseInfoBatch::TriangleNarrowPhaseInfoBatch(OverlappingPairs& overlappingPairs, MemoryAllocator& allocator)
+                             : NarrowPhaseInfoBatch(overlappingPairs, allocator), trianglesVertices(allocator), trianglesConvexEdges(allocator) {
+
+}
+
+// Destructor
+TriangleNarrowPhaseInfoBatch::~TriangleNarrowPhaseInfoBatch() {
+    clear();
+}
+
+// Initialize the containers using cached capacity
+void TriangleNarrowPhaseInfoBatch::reserveMemory() {
+
+    NarrowPhaseInfoBatch::reserveMemory();
+    trianglesVertices.reserve(mCachedTrianglesCapacity);
+    trianglesConvexEdges.reserve(mCachedTrianglesCapacity / 3);
+}
+
+// Clear all the objects in the batch
+void TriangleNarrowPhaseInfoBatch::clear() {
+
+    // Note that there is no TriangleShape to release here (contrary to the base batch)
+
+    mCachedCapacity = static_cast<uint32>(narrowPhaseInfos.capacity());
+    mCachedTrianglesCapacity = static_cast<uint32>(trianglesVertices.capacity());
+
+    narrowPhaseInfos.clear(true);
+    trianglesVertices.clear(true);
+    trianglesConvexEdges.clear(true);
+}
@@ -27,27 +27,357 @@
 #include <reactphysics3d/collision/shapes/ConcaveMeshShape.h>
 #include <reactphysics3d/memory/MemoryManager.h>
 #include <reactphysics3d/collision/RaycastInfo.h>
+#include <reactphysics3d/collision/Collider.h>
 #include <reactphysics3d/collision/TriangleMesh.h>
 #include <reactphysics3d/utils/Profiler.h>
 #include <reactphysics3d/collision/TriangleVertexArray.h>
+#include <reactphysics3d/containers/Map.h>
+#include <cstdint>
+#include <cstring>
+#include <cmath>
 
 using namespace reactphysics3d;
 
+// Value used to identify the cooked data of a mesh ("RP3M")
+static const uint32 COOKED_DATA_MAGIC = 0x4D335052;
+
+// Version of the cooked data format
+static const uint32 COOKED_DATA_VERSION = 1;
+
 // Constructor
-ConcaveMeshShape::ConcaveMeshShape(TriangleMesh* triangleMesh, MemoryAllocator& allocator, HalfEdgeStructure& triangleHalfEdgeStructure, const Vector3& scaling)
-                 : ConcaveShape(CollisionShapeName::TRIANGLE_MESH, allocator, scaling), mDynamicAABBTree(allocator), mTriangleHalfEdgeStructure(triangleHalfEdgeStructure) {
+/// The data of the mesh is shared with the other shapes created from the same mesh. Only
+/// the scaling is specific to the shape.
+ConcaveMeshShape::ConcaveMeshShape(ConcaveMeshData* meshData, MemoryAllocator& allocator, HalfEdgeStructure& triangleHalfEdgeStructure,
+                                   const Vector3& scaling)
+                 : ConcaveShape(CollisionShapeName::TRIANGLE_MESH, allocator, scaling), mMeshData(meshData),
+                   mAllocator(allocator), mTriangleHalfEdgeStructure(triangleHalfEdgeStructure) {
 
-    mTriangleMesh = triangleMesh;
     mRaycastTestType = TriangleRaycastSide::FRONT;
+}
 
-    // Insert all the triangles into the dynamic AABB tree
+// Constructor
+/// If the vertices are compressed, the triangle mesh is only used during the creation of the data. The
+/// data then only uses the compressed vertices and its own copy of the triangles indices. Therefore, the
+/// triangle mesh and its vertices and indices arrays can be freed after the creation of the shape.
+ConcaveMeshData::ConcaveMeshData(TriangleMesh* triangleMesh, MemoryAllocator& allocator, bool compressVertices)
+                : mAllocator(allocator), mSource(triangleMesh), mTriangleMesh(triangleMesh), mSubpartsFirstTriangles(allocator),
+                  mSubpartsNbVertices(allocator), mAABBTree(allocator), mComputedTrianglesConvexEdges(allocator),
+                  mTrianglesConvexEdges(nullptr), mIsCreatedFromCookedData(false), mAreVerticesCompressed(compressVertices),
+                  mCompressedClusters(allocator), mCompressedVertices(allocator), mCompressedTrianglesVertices(allocator),
+                  mCompressedTrianglesIndices(allocator), mCompressedVerticesIndices(allocator), mNbShapes(0) {
+
+    initSubparts();
+
+    // Build the AABB tree with all the triangles
     initBVHTree();
+
+    // Precompute the convex edges of the triangles
+    computeTrianglesConvexEdges();
+    mTrianglesConvexEdges = mComputedTrianglesConvexEdges.size() > 0 ? &(mComputedTrianglesConvexEdges[0]) : nullptr;
+
+    if (mAreVerticesCompressed) {
+        computeCompressedVertices();
+
+        // The triangle mesh is not used anymore and can be freed by the user
+        mTriangleMesh = nullptr;
+    }
 }
 
-// Insert all the triangles into the dynamic AABB tree
-void ConcaveMeshShape::initBVHTree() {
+// Constructor from cooked data
+/// The cooked data must have been created with the ConcaveMeshShape::cook() method and must be valid (see
+/// ConcaveMeshShape::isCookedDataValid()). The cooked data is not copied or parsed. The vertices, normals,
+/// indices, AABB tree nodes and convex edges directly point into the cooked data. Therefore, the cooked data
+/// (a memory-mapped file for instance) must remain valid during the lifetime of the shapes using it.
+ConcaveMeshData::ConcaveMeshData(const void* cookedData, MemoryAllocator& allocator)
+                : mAllocator(allocator), mSource(cookedData), mTriangleMesh(nullptr), mSubpartsFirstTriangles(allocator),
+                  mSubpartsNbVertices(allocator), mAABBTree(allocator), mComputedTrianglesConvexEdges(allocator),
+                  mTrianglesConvexEdges(nullptr), mIsCreatedFromCookedData(true), mAreVerticesCompressed(false),
+                  mCompressedClusters(allocator), mCompressedVertices(allocator), mCompressedTrianglesVertices(allocator),
+                  mCompressedTrianglesIndices(allocator), mCompressedVerticesIndices(allocator), mNbShapes(0) {
+
+    const uchar* data = static_cast<const uchar*>(cookedData);
+    const ConcaveMeshShape::CookedDataHeader* header = static_cast<const ConcaveMeshShape::CookedDataHeader*>(cookedData);
+
+    size_t offset = ConcaveMeshShape::alignCookedDataOffset(sizeof(ConcaveMeshShape::CookedDataHeader));
+    const ConcaveMeshShape::CookedSubpart* subparts = static_cast<const ConcaveMeshShape::CookedSubpart*>(static_cast<const void*>(data + offset));
+    offset = ConcaveMeshShape::alignCookedDataOffset(offset + header->nbSubparts * sizeof(ConcaveMeshShape::CookedSubpart));
+
+    const TriangleVertexArray::VertexDataType vertexDataType = sizeof(decimal) == sizeof(float) ?
+                TriangleVertexArray::VertexDataType::VERTEX_FLOAT_TYPE : TriangleVertexArray::VertexDataType::VERTEX_DOUBLE_TYPE;
+    const TriangleVertexArray::NormalDataType normalDataType = sizeof(decimal) == sizeof(float) ?
+                TriangleVertexArray::NormalDataType::NORMAL_FLOAT_TYPE : TriangleVertexArray::NormalDataType::NORMAL_DOUBLE_TYPE;
+
+    // Create the triangle mesh with a triangle vertex array that points into the cooked data for each sub-part
+    mTriangleMesh = new (allocator.allocate(sizeof(TriangleMesh))) TriangleMesh(allocator);
+    for (uint32 subPart=0; subPart < header->nbSubparts; subPart++) {
+
+        const uint32 nbVertices = subparts[subPart].nbVertices;
+        const uint32 nbTriangles = subparts[subPart].nbTriangles;
+
+        const uchar* vertices = data + offset;
+        offset = ConcaveMeshShape::alignCookedDataOffset(offset + nbVertices * 3 * sizeof(decimal));
+        const uchar* normals = data + offset;
+        offset = ConcaveMeshShape::alignCookedDataOffset(offset + nbVertices * 3 * sizeof(decimal));
+        const uchar* indices = data + offset;
+        offset = ConcaveMeshShape::alignCookedDataOffset(offset + nbTriangles * 3 * sizeof(uint32));
+
+        TriangleVertexArray* triangleVertexArray = new (allocator.allocate(sizeof(TriangleVertexArray)))
+                TriangleVertexArray(nbVertices, vertices, 3 * sizeof(decimal), normals, 3 * sizeof(decimal), nbTriangles,
+                                    indices, 3 * sizeof(uint32), vertexDataType, normalDataType,
+                                    TriangleVertexArray::IndexDataType::INDEX_INTEGER_TYPE);
+        mTriangleMesh->addSubpart(triangleVertexArray);
+    }
+
+    initSubparts();
+
+    // Initialize the AABB tree with the nodes of the cooked data
+    const uint32 nbTreeNodes = header->nbTriangles > 1 ? header->nbTriangles - 1 : 0;
+    const StaticTreeNode* treeNodes = static_cast<const StaticTreeNode*>(static_cast<const void*>(data + offset));
+    offset = ConcaveMeshShape::alignCookedDataOffset(offset + nbTreeNodes * sizeof(StaticTreeNode));
+    const int32* treeObjectsData = static_cast<const int32*>(static_cast<const void*>(data + offset));
+    offset = ConcaveMeshShape::alignCookedDataOffset(offset + header->nbTriangles * 2 * sizeof(int32));
+    const AABB rootAABB(Vector3(header->rootAABB[0], header->rootAABB[1], header->rootAABB[2]),
+                        Vector3(header->rootAABB[3], header->rootAABB[4], header->rootAABB[5]));
+    mAABBTree.initFromData(treeNodes, treeObjectsData, header->nbTriangles, rootAABB);
+
+    mTrianglesConvexEdges = data + offset;
+}
+
+// Destructor
+ConcaveMeshData::~ConcaveMeshData() {
+
+    // If the data has been created from cooked data, it owns its triangle mesh
+    if (mIsCreatedFromCookedData) {
+
+        for (uint32 subPart=0; subPart < mTriangleMesh->getNbSubparts(); subPart++) {
+            TriangleVertexArray* triangleVertexArray = mTriangleMesh->getSubpart(subPart);
+            triangleVertexArray->~TriangleVertexArray();
+            mAllocator.release(triangleVertexArray, sizeof(TriangleVertexArray));
+        }
+
+        mTriangleMesh->~TriangleMesh();
+        mAllocator.release(mTriangleMesh, sizeof(TriangleMesh));
+    }
+}
+
+// Return the size (in bytes) of the cooked data of a mesh with the given sub-parts
+size_t ConcaveMeshShape::computeCookedDataSize(const CookedSubpart* subparts, uint32 nbSubparts, uint32 nbTriangles) {
+
+    size_t size = alignCookedDataOffset(sizeof(CookedDataHeader));
+    size = alignCookedDataOffset(size + nbSubparts * sizeof(CookedSubpart));
+
+    // Vertices, normals and indices of each sub-part
+    for (uint32 subPart=0; subPart < nbSubparts; subPart++) {
+        size = alignCookedDataOffset(size + subparts[subPart].nbVertices * 3 * sizeof(decimal));
+        size = alignCookedDataOffset(size + subparts[subPart].nbVertices * 3 * sizeof(decimal));
+        size = alignCookedDataOffset(size + subparts[subPart].nbTriangles * 3 * sizeof(uint32));
+    }
+
+    // Nodes and objects data of the AABB tree and convex edges of the triangles
+    const uint32 nbTreeNodes = nbTriangles > 1 ? nbTriangles - 1 : 0;
+    size = alignCookedDataOffset(size + nbTreeNodes * sizeof(StaticTreeNode));
+    size = alignCookedDataOffset(size + nbTriangles * 2 * sizeof(int32));
+    size += nbTriangles;
+
+    return size;
+}
+
+// Return true if the cooked data in parameter can be used to create a shape
+/// This method checks the header and the size of the cooked data. It also checks that the vertex indices
+/// of the triangles, the triangles referenced by the AABB tree and the children of the tree nodes are in
+/// range, so that a corrupted buffer cannot make the shape read out of the cooked data. This is linear in
+/// the size of the mesh. The vertices values are not checked. The cooked data must have been created with
+/// the cook() method by a library compiled with the same decimal precision on a platform with the same
+/// endianness. The cooked data must be aligned on 8 bytes.
+/**
+ * @param cookedData Pointer to the cooked data
+ * @param cookedDataSize Size (in bytes) of the cooked data
+ * @return True if the cooked data is valid
+ */
+bool ConcaveMeshShape::isCookedDataValid(const void* cookedData, size_t cookedDataSize) {
+
+    if (cookedData == nullptr || reinterpret_cast<std::uintptr_t>(cookedData) % 8 != 0) return false;
+
+    if (cookedDataSize < sizeof(CookedDataHeader)) return false;
+
+    const CookedDataHeader* header = static_cast<const CookedDataHeader*>(cookedData);
+    if (header->magic != COOKED_DATA_MAGIC || header->version != COOKED_DATA_VERSION ||
+        header->decimalSize != sizeof(decimal) || header->treeNodeSize != sizeof(StaticTreeNode)) {
+        return false;
+    }
+
+    const size_t subpartsOffset = alignCookedDataOffset(sizeof(CookedDataHeader));
+    if (cookedDataSize < subpartsOffset + header->nbSubparts * sizeof(CookedSubpart)) return false;
+
+    const uchar* data = static_cast<const uchar*>(cookedData);
+    const CookedSubpart* subparts = static_cast<const CookedSubpart*>(static_cast<const void*>(data + subpartsOffset));
+
+    // The total number of triangles must match the number of triangles of the sub-parts
+    uint64 nbTriangles = 0;
+    for (uint32 subPart=0; subPart < header->nbSubparts; subPart++) {
+        nbTriangles += subparts[subPart].nbTriangles;
+    }
+    if (nbTriangles != header->nbTriangles) return false;
+
+    if (computeCookedDataSize(subparts, header->nbSubparts, header->nbTriangles) > cookedDataSize) return false;
+
+    // The vertex indices of the triangles must be in the range of the vertices of their sub-part
+    size_t offset = alignCookedDataOffset(subpartsOffset + header->nbSubparts * sizeof(CookedSubpart));
+    for (uint32 subPart=0; subPart < header->nbSubparts; subPart++) {
+
+        const uint32 nbVertices = subparts[subPart].nbVertices;
+        offset = alignCookedDataOffset(offset + nbVertices * 3 * sizeof(decimal));
+        offset = alignCookedDataOffset(offset + nbVertices * 3 * sizeof(decimal));
+
+        const uint32* indices = static_cast<const uint32*>(static_cast<const void*>(data + offset));
+        for (uint32 i=0; i < subparts[subPart].nbTriangles * 3; i++) {
+            if (indices[i] >= nbVertices) return false;
+        }
+        offset = alignCookedDataOffset(offset + subparts[subPart].nbTriangles * 3 * sizeof(uint32));
+    }
+
+    // Each child of a tree node must be a triangle or a node after it in the depth-first order
+    const uint32 nbTreeNodes = header->nbTriangles > 1 ? header->nbTriangles - 1 : 0;
+    const StaticTreeNode* treeNodes = static_cast<const StaticTreeNode*>(static_cast<const void*>(data + offset));
+    for (uint32 node=0; node < nbTreeNodes; node++) {
+        for (uint32 c=0; c < 2; c++) {
+            const uint32 child = treeNodes[node].children[c];
+            if ((child & StaticTreeNode::LEAF_BIT) != 0) {
+                if ((child & ~StaticTreeNode::LEAF_BIT) >= header->nbTriangles) return false;
+            }
+            else if (child <= node || child >= nbTreeNodes) {
+                return false;
+            }
+        }
+    }
+    offset = alignCookedDataOffset(offset + nbTreeNodes * sizeof(StaticTreeNode));
+
+    // Each triangle of the tree must be a triangle of a sub-part
+    const int32* treeObjectsData = static_cast<const int32*>(static_cast<const void*>(data + offset));
+    for (uint32 i=0; i < header->nbTriangles; i++) {
+        const int32 subPart = treeObjectsData[i * 2];
+        if (subPart < 0 || static_cast<uint32>(subPart) >= header->nbSubparts) return false;
+        const int32 triangleIndex = treeObjectsData[i * 2 + 1];
+        if (triangleIndex < 0 || static_cast<uint32>(triangleIndex) >= subparts[subPart].nbTriangles) return false;
+    }
+
+    return true;
+}
+
+// Return the size (in bytes) of the cooked data of the shape
+/**
+ * @return The number of bytes of the buffer needed by the cook() method
+ */
+size_t ConcaveMeshShape::getCookedDataSize() const {
+
+    const uint32 nbSubparts = mMeshData->getNbSubparts();
+
+    Array<CookedSubpart> subparts(mAllocator, nbSubparts);
+    for (uint32 subPart=0; subPart < nbSubparts; subPart++) {
+        subparts.add(CookedSubpart{mMeshData->getNbVertices(subPart), mMeshData->getNbTriangles(subPart)});
+    }
+
+    return computeCookedDataSize(nbSubparts > 0 ? &(subparts[0]) : nullptr, nbSubparts, mMeshData->mAABBTree.getNbObjects());
+}
+
+// Write the cooked data of the shape into a buffer
+/// The cooked data contains the vertices, vertices normals and indices of the triangles, the nodes of the
+/// AABB tree and the convex edges of the triangles. It can be saved into a file and used later to
+/// create a ConcaveMeshShape with the PhysicsCommon::createConcaveMeshShapeFromCooked() method.
+/// If the vertices are compressed, the cooked data contains the decoded (quantized) vertices.
+/// The cooked data can only be used by a library compiled with the same decimal precision on a platform
+/// with the same endianness.
+/**
+ * @param outCookedData Pointer to a buffer of getCookedDataSize() bytes aligned on 8 bytes
+ */
+void ConcaveMeshShape::cook(void* outCookedData) const {
+
+    assert(reinterpret_cast<std::uintptr_t>(outCookedData) % 8 == 0);
+
+    uchar* data = static_cast<uchar*>(outCookedData);
+    const uint32 nbTriangles = mMeshData->mAABBTree.getNbObjects();
+
+    // Clear the padding bytes
+    std::memset(outCookedData, 0, getCookedDataSize());
+
+    // Write the header
+    CookedDataHeader* header = static_cast<CookedDataHeader*>(outCookedData);
+    header->magic = COOKED_DATA_MAGIC;
+    header->version = COOKED_DATA_VERSION;
+    header->decimalSize = sizeof(decimal);
+    header->treeNodeSize = sizeof(StaticTreeNode);
+    header->nbSubparts = mMeshData->getNbSubparts();
+    header->nbTriangles = nbTriangles;
+    const AABB& rootAABB = mMeshData->mAABBTree.getRootAABB();
+    for (int i=0; i < 3; i++) {
+        header->rootAABB[i] = rootAABB.getMin()[i];
+        header->rootAABB[3 + i] = rootAABB.getMax()[i];
+    }
+
+    size_t offset = alignCookedDataOffset(sizeof(CookedDataHeader));
+    CookedSubpart* subparts = static_cast<CookedSubpart*>(static_cast<void*>(data + offset));
+    offset = alignCookedDataOffset(offset + header->nbSubparts * sizeof(CookedSubpart));
+
+    Array<Vector3> subpartVertices(mAllocator);
+    Array<Vector3> subpartNormals(mAllocator);
+
+    // For each sub-part of the mesh
+    for (uint32 subPart=0; subPart < header->nbSubparts; subPart++) {
+
+        const uint32 nbVertices = mMeshData->getNbVertices(subPart);
+        subparts[subPart].nbVertices = nbVertices;
+        subparts[subPart].nbTriangles = mMeshData->getNbTriangles(subPart);
+
+        mMeshData->getSubpartVertices(subPart, subpartVertices, subpartNormals);
+
+        // Write the vertices
+        decimal* vertices = static_cast<decimal*>(static_cast<void*>(data + offset));
+        for (uint32 v=0; v < nbVertices; v++) {
+            vertices[v * 3] = subpartVertices[v].x;
+            vertices[v * 3 + 1] = subpartVertices[v].y;
+            vertices[v * 3 + 2] = subpartVertices[v].z;
+        }
+        offset = alignCookedDataOffset(offset + nbVertices * 3 * sizeof(decimal));
+
+        // Write the vertices normals
+        decimal* normals = static_cast<decimal*>(static_cast<void*>(data + offset));
+        for (uint32 v=0; v < nbVertices; v++) {
+            normals[v * 3] = subpartNormals[v].x;
+            normals[v * 3 + 1] = subpartNormals[v].y;
+            normals[v * 3 + 2] = subpartNormals[v].z;
+        }
+        offset = alignCookedDataOffset(offset + nbVertices * 3 * sizeof(decimal));
+
+        // Write the indices of the triangles
+        uint32* indices = static_cast<uint32*>(static_cast<void*>(data + offset));
+        for (uint32 t=0; t < subparts[subPart].nbTriangles; t++) {
+            mMeshData->getTriangleVerticesIndices(subPart, t, &(indices[t * 3]));
+        }
+        offset = alignCookedDataOffset(offset + subparts[subPart].nbTriangles * 3 * sizeof(uint32));
+    }
+
+    // Write the nodes and objects data of the AABB tree
+    const uint32 nbTreeNodes = mMeshData->mAABBTree.getNbNodes();
+    if (nbTreeNodes > 0) {
+        std::memcpy(data + offset, mMeshData->mAABBTree.getNodes(), nbTreeNodes * sizeof(StaticTreeNode));
+    }
+    offset = alignCookedDataOffset(offset + nbTreeNodes * sizeof(StaticTreeNode));
+    if (nbTriangles > 0) {
+        std::memcpy(data + offset, mMeshData->mAABBTree.getObjectsData(), nbTriangles * 2 * sizeof(int32));
+    }
+    offset = alignCookedDataOffset(offset + nbTriangles * 2 * sizeof(int32));
+
+    // Write the convex edges of the triangles
+    if (nbTriangles > 0) {
+        std::memcpy(data + offset, mMeshData->mTrianglesConvexEdges, nbTriangles);
+    }
+
+    assert(offset + nbTriangles == getCookedDataSize());
+}
 
-    // TODO : Try to randomly add the triangles into the tree to obtain a better tree
+// Build the AABB tree with all the triangles of the mesh
+/// The tree is built only once here because the mesh cannot be modified after the creation of the shapes
+void ConcaveMeshData::initBVHTree() {
 
     // For each sub-part of the mesh
     for (uint32 subPart=0; subPart<mTriangleMesh->getNbSubparts(); subPart++) {
@@ -66,20 +396,359 @@ void ConcaveMeshShape::initBVHTree() {
             // Create the AABB for the triangle
             AABB aabb = AABB::createAABBForTriangle(trianglePoints);
 
-            // Add the AABB with the index of the triangle into the dynamic AABB tree
-            mDynamicAABBTree.addObject(aabb, subPart, triangleIndex);
+            // Add the AABB with the index of the triangle into the AABB tree
+            mAABBTree.addObject(aabb, subPart, triangleIndex);
+        }
+    }
+
+    mAABBTree.build();
+}
+
+// Initialize the number of triangles and vertices of each sub-part from the triangle mesh
+/// This is stored in the data so that it does not depend on the triangle mesh when the vertices are compressed
+void ConcaveMeshData::initSubparts() {
+
+    const uint32 nbSubparts = mTriangleMesh->getNbSubparts();
+
+    mSubpartsFirstTriangles.reserve(nbSubparts + 1);
+    mSubpartsNbVertices.reserve(nbSubparts);
+
+    // The triangles shape ids of a sub-part are consecutive
+    uint32 nbTriangles = 0;
+    for (uint32 subPart=0; subPart < nbSubparts; subPart++) {
+
+        const TriangleVertexArray* triangleVertexArray = mTriangleMesh->getSubpart(subPart);
+
+        mSubpartsFirstTriangles.add(nbTriangles);
+        mSubpartsNbVertices.add(triangleVertexArray->getNbVertices());
+        nbTriangles += triangleVertexArray->getNbTriangles();
+    }
+    mSubpartsFirstTriangles.add(nbTriangles);
+}
+
+// Compute the convex edges of all the triangles of the mesh
+/// Two triangles of a sub-part sharing the same two vertex indices are neighbors. Their common edge is
+/// a convex edge if the opposite vertex of the neighbor triangle is below the plane of the triangle (with
+/// a small angle tolerance). Flat and concave edges and the edges without neighbor are not convex edges.
+/// A contact on an edge that is not convex will use the triangle face normal to avoid the internal edges
+/// issue. This is computed only once here so that the narrow-phase only needs a lookup in this table.
+/// Note that the vertices are not scaled here because a scaling does not change the side of a point
+/// with respect to a plane.
+void ConcaveMeshData::computeTrianglesConvexEdges() {
+
+    // Minimum sine of the angle between two neighbor triangles for their common edge to be convex
+    const decimal minSinAngleConvexEdge = decimal(0.01);
+
+    // Value in the edges map for an edge that has already been matched with two triangles
+    const uint32 matchedEdge = ~uint32(0);
+
+    // For each sub-part of the mesh
+    for (uint32 subPart=0; subPart<mTriangleMesh->getNbSubparts(); subPart++) {
+
+        // Get the triangle vertex array of the current sub-part
+        TriangleVertexArray* triangleVertexArray = mTriangleMesh->getSubpart(subPart);
+        const uint32 nbTriangles = triangleVertexArray->getNbTriangles();
+
+        // The triangles shape ids of a sub-part are consecutive
+        const uint32 startIndex = static_cast<uint32>(mComputedTrianglesConvexEdges.size());
+        for (uint32 triangleIndex=0; triangleIndex<nbTriangles; triangleIndex++) {
+            mComputedTrianglesConvexEdges.add(0);
+        }
+
+        // Map an edge (pair of sorted vertex indices) to the first triangle edge (3 * triangleIndex + edgeIndex) with this edge
+        Map<uint64, uint32> mapEdgeToTriangleEdge(mAllocator, nbTriangles * 3);
+
+        // For each triangle of the sub-part
+        for (uint32 triangleIndex=0; triangleIndex<nbTriangles; triangleIndex++) {
+
+            uint32 verticesIndices[3];
+            triangleVertexArray->getTriangleVerticesIndices(triangleIndex, verticesIndices);
+
+            // For each edge of the triangle
+            for (uint32 edgeIndex=0; edgeIndex<3; edgeIndex++) {
+
+                const uint32 v1 = verticesIndices[edgeIndex];
+                const uint32 v2 = verticesIndices[(edgeIndex + 1) % 3];
+                const uint64 edgeKey = v1 < v2 ? (static_cast<uint64>(v1) << 32) | v2 : (static_cast<uint64>(v2) << 32) | v1;
+
+                auto it = mapEdgeToTriangleEdge.find(edgeKey);
+                if (it == mapEdgeToTriangleEdge.end()) {
+                    mapEdgeToTriangleEdge.add(Pair<uint64, uint32>(edgeKey, 3 * triangleIndex + edgeIndex));
+                    continue;
+                }
+
+                // Only the two first triangles sharing an edge are considered
+                const uint32 neighborTriangleEdge = it->second;
+                if (neighborTriangleEdge == matchedEdge) continue;
+                mapEdgeToTriangleEdge[edgeKey] = matchedEdge;
+
+                const uint32 neighborTriangleIndex = neighborTriangleEdge / 3;
+                const uint32 neighborEdgeIndex = neighborTriangleEdge % 3;
+
+                Vector3 trianglePoints[3];
+                Vector3 neighborPoints[3];
+                triangleVertexArray->getTriangleVertices(triangleIndex, trianglePoints);
+                triangleVertexArray->getTriangleVertices(neighborTriangleIndex, neighborPoints);
+
+                // Vertices of each triangle that are not on the common edge
+                const Vector3& oppositePoint = trianglePoints[(edgeIndex + 2) % 3];
+                const Vector3& neighborOppositePoint = neighborPoints[(neighborEdgeIndex + 2) % 3];
+
+                // The edge is convex for a triangle if the opposite vertex of its neighbor is below its plane
+                const Vector3 triangleNormal = (trianglePoints[1] - trianglePoints[0]).cross(trianglePoints[2] - trianglePoints[0]);
+                const Vector3 neighborNormal = (neighborPoints[1] - neighborPoints[0]).cross(neighborPoints[2] - neighborPoints[0]);
+                const Vector3 toNeighborOpposite = neighborOppositePoint - trianglePoints[edgeIndex];
+                const Vector3 toOpposite = oppositePoint - neighborPoints[neighborEdgeIndex];
+
+                if (triangleNormal.dot(toNeighborOpposite) < -minSinAngleConvexEdge * triangleNormal.length() * toNeighborOpposite.length()) {
+                    mComputedTrianglesConvexEdges[startIndex + triangleIndex] |= static_cast<uint8>(1 << edgeIndex);
+                }
+                if (neighborNormal.dot(toOpposite) < -minSinAngleConvexEdge * neighborNormal.length() * toOpposite.length()) {
+                    mComputedTrianglesConvexEdges[startIndex + neighborTriangleIndex] |= static_cast<uint8>(1 << neighborEdgeIndex);
+                }
+            }
+        }
+    }
+}
+
+// Compute the compressed vertices of all the triangles of the mesh
+/// The triangles are grouped into clusters of consecutive triangles in the depth-first order of the leaves of
+/// the AABB tree. Each cluster stores its own vertices quantized on 16 bits relative to the AABB of the vertices
+/// of the cluster. Each triangle only stores the indices (on 8 bits) of its three vertices in its cluster.
+/// Because the coordinates are rounded to the nearest quantized value, a decoded vertex is at most half a cluster
+/// quantization step away from the original vertex. This is smaller than the margin of the quantized AABBs of
+/// the tree (one quantization step of the whole tree) and therefore, the AABB tree remains conservative.
+void ConcaveMeshData::computeCompressedVertices() {
+
+    const decimal quantizationMax = decimal(65535.0);
+
+    // Get the triangles in the order of the AABB tree (the index of an object of the tree is the triangle shape id)
+    const uint32 nbTriangles = mAABBTree.getNbObjects();
+    Array<uint32> orderedTriangles(mAllocator, nbTriangles);
+    mAABBTree.getObjectsInDepthFirstOrder(orderedTriangles);
+    assert(orderedTriangles.size() == nbTriangles);
+
+    mCompressedTrianglesVertices.reserve(nbTriangles * 3);
+    mCompressedTrianglesIndices.addWithoutInit(nbTriangles);
+    mCompressedClusters.reserve((nbTriangles + NB_TRIANGLES_PER_COMPRESSED_CLUSTER - 1) / NB_TRIANGLES_PER_COMPRESSED_CLUSTER);
+
+    // Map a vertex of the mesh (sub-part and vertex index) to its index in the current cluster
+    Map<uint64, uint8> mapVertexToClusterVertex(mAllocator, NB_TRIANGLES_PER_COMPRESSED_CLUSTER * 3);
+    Array<Vector3> clusterVertices(mAllocator, NB_TRIANGLES_PER_COMPRESSED_CLUSTER * 3);
+
+    // The number of vertices of the clusters is not known in advance. The compressed vertices are first added into
+    // temporary arrays and then copied into the arrays of the data with their exact size to avoid wasting memory.
+    Array<uint16> compressedVertices(mAllocator);
+    Array<uint32> compressedVerticesIndices(mAllocator);
+
+    // For each cluster
+    for (uint32 start=0; start < nbTriangles; start += NB_TRIANGLES_PER_COMPRESSED_CLUSTER) {
+
+        const uint32 end = std::min(start + NB_TRIANGLES_PER_COMPRESSED_CLUSTER, nbTriangles);
+
+        mapVertexToClusterVertex.clear();
+        clusterVertices.clear();
+
+        // For each triangle of the cluster
+        for (uint32 i=start; i < end; i++) {
+
+            const int32* data = mAABBTree.getObjectDataInt(static_cast<int32>(orderedTriangles[i]));
+            TriangleVertexArray* triangleVertexArray = mTriangleMesh->getSubpart(data[0]);
+
+            uint32 verticesIndices[3];
+            triangleVertexArray->getTriangleVerticesIndices(data[1], verticesIndices);
+
+            // Add the vertices of the triangle into the cluster
+            for (uint32 v=0; v < 3; v++) {
+
+                const uint64 key = (static_cast<uint64>(data[0]) << 32) | verticesIndices[v];
+
+                auto it = mapVertexToClusterVertex.find(key);
+                if (it == mapVertexToClusterVertex.end()) {
+
+                    assert(clusterVertices.size() < 256);
+
+                    const uint8 clusterVertex = static_cast<uint8>(clusterVertices.size());
+                    Vector3 vertex;
+                    triangleVertexArray->getVertex(verticesIndices[v], &vertex);
+                    clusterVertices.add(vertex);
+                    mapVertexToClusterVertex.add(Pair<uint64, uint8>(key, clusterVertex));
+                    mCompressedTrianglesVertices.add(clusterVertex);
+                    compressedVerticesIndices.add(verticesIndices[v]);
+                }
+                else {
+                    mCompressedTrianglesVertices.add(it->second);
+                }
+            }
+
+            mCompressedTrianglesIndices[orderedTriangles[i]] = i;
+        }
+
+        // Compute the AABB of the vertices of the cluster
+        Vector3 clusterMin = clusterVertices[0];
+        Vector3 clusterMax = clusterVertices[0];
+        for (uint32 v=1; v < clusterVertices.size(); v++) {
+            clusterMin = Vector3::min(clusterMin, clusterVertices[v]);
+            clusterMax = Vector3::max(clusterMax, clusterVertices[v]);
+        }
+
+        // Compute the quantization scale factors (a flat axis is always quantized to zero)
+        const Vector3 clusterExtent = clusterMax - clusterMin;
+        Vector3 quantizationScale;
+        Vector3 dequantizationScale;
+        for (int i=0; i < 3; i++) {
+            quantizationScale[i] = clusterExtent[i] > MACHINE_EPSILON ? quantizationMax / clusterExtent[i] : decimal(0.0);
+            dequantizationScale[i] = clusterExtent[i] > MACHINE_EPSILON ? clusterExtent[i] / quantizationMax : decimal(0.0);
+        }
+
+        mCompressedClusters.add(CompressedCluster{clusterMin, dequantizationScale, static_cast<uint32>(compressedVertices.size() / 3)});
+
+        // Quantize the vertices of the cluster (rounded to the nearest quantized value)
+        for (uint32 v=0; v < clusterVertices.size(); v++) {
+            for (int i=0; i < 3; i++) {
+                const decimal value = std::floor((clusterVertices[v][i] - clusterMin[i]) * quantizationScale[i] + decimal(0.5));
+                compressedVertices.add(static_cast<uint16>(clamp(value, decimal(0.0), quantizationMax)));
+            }
+        }
+    }
+
+    mCompressedVertices.reserve(compressedVertices.size());
+    mCompressedVertices.addRange(compressedVertices);
+    mCompressedVerticesIndices.reserve(compressedVerticesIndices.size());
+    mCompressedVerticesIndices.addRange(compressedVerticesIndices);
+}
+
+// Return the number of bytes of memory allocated by the data
+/// This does not include the triangle mesh or the cooked data used to create the data.
+size_t ConcaveMeshData::getSizeInBytes() const {
+
+    return sizeof(ConcaveMeshData) - sizeof(StaticAABBTree) + mAABBTree.getSizeInBytes() +
+           mSubpartsFirstTriangles.capacity() * sizeof(uint32) + mSubpartsNbVertices.capacity() * sizeof(uint32) +
+           mComputedTrianglesConvexEdges.capacity() * sizeof(uint8) + mCompressedClusters.capacity() * sizeof(CompressedCluster) +
+           mCompressedVertices.capacity() * sizeof(uint16) + mCompressedTrianglesVertices.capacity() * sizeof(uint8) +
+           mCompressedTrianglesIndices.capacity() * sizeof(uint32) + mCompressedVerticesIndices.capacity() * sizeof(uint32);
+}
+
+// Return the three vertices coordinates (without scaling) of a triangle
+void ConcaveMeshData::getTriangleVertices(uint32 subPart, uint32 triangleIndex, Vector3* outTriangleVertices) const {
+
+    // If the vertices are compressed, we decode the vertices of the triangle from its cluster
+    if (mAreVerticesCompressed) {
+
+        const uint32 compressedTriangle = mCompressedTrianglesIndices[computeTriangleShapeId(subPart, triangleIndex)];
+        const CompressedCluster& cluster = mCompressedClusters[compressedTriangle / NB_TRIANGLES_PER_COMPRESSED_CLUSTER];
+
+        for (uint32 v=0; v < 3; v++) {
+            const uint16* vertex = &(mCompressedVertices[(cluster.firstVertex + mCompressedTrianglesVertices[compressedTriangle * 3 + v]) * 3]);
+            outTriangleVertices[v].setAllValues(cluster.origin.x + vertex[0] * cluster.dequantizationScale.x,
+                                                cluster.origin.y + vertex[1] * cluster.dequantizationScale.y,
+                                                cluster.origin.z + vertex[2] * cluster.dequantizationScale.z);
+        }
+    }
+    else {
+
+        // Get the triangle vertex array of the current sub-part
+        TriangleVertexArray* triangleVertexArray = mTriangleMesh->getSubpart(subPart);
+
+        // Get the vertices coordinates of the triangle
+        triangleVertexArray->getTriangleVertices(triangleIndex, outTriangleVertices);
+    }
+}
+
+// Return the indices of the three vertices of a triangle in the vertex array of its sub-part
+void ConcaveMeshData::getTriangleVerticesIndices(uint32 subPart, uint32 triangleIndex, uint32* outVerticesIndices) const {
+
+    // If the vertices are compressed, we use the indices stored with the compressed vertices of the triangle
+    if (mAreVerticesCompressed) {
+
+        const uint32 compressedTriangle = mCompressedTrianglesIndices[computeTriangleShapeId(subPart, triangleIndex)];
+        const CompressedCluster& cluster = mCompressedClusters[compressedTriangle / NB_TRIANGLES_PER_COMPRESSED_CLUSTER];
+
+        for (uint32 v=0; v < 3; v++) {
+            outVerticesIndices[v] = mCompressedVerticesIndices[cluster.firstVertex + mCompressedTrianglesVertices[compressedTriangle * 3 + v]];
+        }
+    }
+    else {
+        mTriangleMesh->getSubpart(subPart)->getTriangleVerticesIndices(triangleIndex, outVerticesIndices);
+    }
+}
+
+// Return the vertices (without scaling) and the vertices normals of a sub-part
+/// If the vertices are compressed, the decoded vertices are gathered from the triangles of the sub-part (a vertex
+/// that is not used by any triangle is set to zero) and the vertices normals are computed from the decoded vertices
+/// in the same way as the TriangleVertexArray (sum of the faces normals weighted by the angle of the face at the vertex).
+void ConcaveMeshData::getSubpartVertices(uint32 subPart, Array<Vector3>& outVertices, Array<Vector3>& outNormals) const {
+
+    const uint32 nbVertices = getNbVertices(subPart);
+
+    outVertices.clear();
+    outNormals.clear();
+    outVertices.reserve(nbVertices);
+    outNormals.reserve(nbVertices);
+
+    if (!mAreVerticesCompressed) {
+
+        TriangleVertexArray* triangleVertexArray = mTriangleMesh->getSubpart(subPart);
+
+        for (uint32 v=0; v < nbVertices; v++) {
+            Vector3 vertex;
+            Vector3 normal;
+            triangleVertexArray->getVertex(v, &vertex);
+            triangleVertexArray->getNormal(v, &normal);
+            outVertices.add(vertex);
+            outNormals.add(normal);
+        }
+
+        return;
+    }
+
+    for (uint32 v=0; v < nbVertices; v++) {
+        outVertices.add(Vector3::zero());
+        outNormals.add(Vector3::zero());
+    }
+
+    // For each triangle of the sub-part
+    const uint32 nbTriangles = getNbTriangles(subPart);
+    for (uint32 t=0; t < nbTriangles; t++) {
+
+        uint32 verticesIndices[3];
+        Vector3 trianglePoints[3];
+        getTriangleVerticesIndices(subPart, t, verticesIndices);
+        getTriangleVertices(subPart, t, trianglePoints);
+
+        // Edges lengths
+        decimal edgesLengths[3];
+        edgesLengths[0] = (trianglePoints[1] - trianglePoints[0]).length();
+        edgesLengths[1] = (trianglePoints[2] - trianglePoints[1]).length();
+        edgesLengths[2] = (trianglePoints[0] - trianglePoints[2]).length();
+
+        // For each vertex of the triangle
+        for (uint32 v=0; v < 3; v++) {
+
+            outVertices[verticesIndices[v]] = trianglePoints[v];
+
+            const uint32 previousVertex = (v == 0) ? 2 : v - 1;
+            const uint32 nextVertex = (v == 2) ? 0 : v + 1;
+            const Vector3 crossProduct = (trianglePoints[nextVertex] - trianglePoints[v]).cross(trianglePoints[previousVertex] - trianglePoints[v]);
+            const decimal edgeLengths = edgesLengths[previousVertex] * edgesLengths[v];
+            if (edgeLengths > decimal(MACHINE_EPSILON)) {
+
+                const decimal sinA = clamp(crossProduct.length() / edgeLengths, decimal(0.0), decimal(1.0));
+                outNormals[verticesIndices[v]] += std::asin(sinA) * crossProduct;
+            }
         }
     }
+
+    // Normalize the vertices normals
+    for (uint32 v=0; v < nbVertices; v++) {
+        outNormals[v].normalize();
+    }
 }
 
 // Return the three vertices coordinates (in the array outTriangleVertices) of a triangle
 void ConcaveMeshShape::getTriangleVertices(uint32 subPart, uint32 triangleIndex, Vector3* outTriangleVertices) const {
 
-    // Get the triangle vertex array of the current sub-part
-    TriangleVertexArray* triangleVertexArray = mTriangleMesh->getSubpart(subPart);
-
-    // Get the vertices coordinates of the triangle
-    triangleVertexArray->getTriangleVertices(triangleIndex, outTriangleVertices);
+    mMeshData->getTriangleVertices(subPart, triangleIndex, outTriangleVertices);
 
     // Apply the scaling factor to the vertices
     outTriangleVertices[0].x *= mScale.x;
@@ -94,10 +763,26 @@ void ConcaveMeshShape::getTriangleVertices(uint32 subPart, uint32 triangleIndex,
 }
 
 // Return the three vertex normals (in the array outVerticesNormals) of a triangle
+/// If the vertices are compressed, the normals are computed from the decoded vertices of the whole sub-part.
 void ConcaveMeshShape::getTriangleVerticesNormals(uint32 subPart, uint32 triangleIndex, Vector3* outVerticesNormals) const {
 
+    if (mMeshData->mAreVerticesCompressed) {
+
+        Array<Vector3> subpartVertices(mAllocator);
+        Array<Vector3> subpartNormals(mAllocator);
+        mMeshData->getSubpartVertices(subPart, subpartVertices, subpartNormals);
+
+        uint32 verticesIndices[3];
+        mMeshData->getTriangleVerticesIndices(subPart, triangleIndex, verticesIndices);
+        for (uint32 v=0; v < 3; v++) {
+            outVerticesNormals[v] = subpartNormals[verticesIndices[v]];
+        }
+
+        return;
+    }
+
     // Get the triangle vertex array of the current sub-part
-    TriangleVertexArray* triangleVertexArray = mTriangleMesh->getSubpart(subPart);
+    TriangleVertexArray* triangleVertexArray = mMeshData->mTriangleMesh->getSubpart(subPart);
 
     // Get the vertices normals of the triangle
     triangleVertexArray->getTriangleVerticesNormals(triangleIndex, outVerticesNormals);
@@ -105,48 +790,56 @@ void ConcaveMeshShape::getTriangleVerticesNormals(uint32 subPart, uint32 triangl
 
 // Return the indices of the three vertices of a given triangle in the array
 void ConcaveMeshShape::getTriangleVerticesIndices(uint32 subPart, uint32 triangleIndex, uint32* outVerticesIndices) const {
+    mMeshData->getTriangleVerticesIndices(subPart, triangleIndex, outVerticesIndices);
+}
 
-    // Get the triangle vertex array of the current sub-part
-    TriangleVertexArray* triangleVertexArray = mTriangleMesh->getSubpart(subPart);
-
-    // Get the vertices normals of the triangle
-    triangleVertexArray->getTriangleVerticesIndices(triangleIndex, outVerticesIndices);
+// Return the number of bytes of memory used by the data of the mesh
+/// This is the memory allocated for the AABB tree, the convex edges and the compressed vertices of the mesh.
+/// Note that this data is shared by all the shapes created from the same mesh (or cooked data). The triangle
+/// mesh (or cooked data) used to create the shape is not included.
+/**
+ * @return The number of bytes used by the data of the mesh
+ */
+size_t ConcaveMeshShape::getMeshDataSizeInBytes() const {
+    return mMeshData->getSizeInBytes();
 }
 
 // Return the number of sub parts contained in this mesh
 uint32 ConcaveMeshShape::getNbSubparts() const
 {
-	return mTriangleMesh->getNbSubparts();
+	return mMeshData->getNbSubparts();
 }
 		
 // Return the number of triangles in a sub part of the mesh
 uint32 ConcaveMeshShape::getNbTriangles(uint32 subPart) const
 {
-	assert(mTriangleMesh->getSubpart(subPart));
-	return mTriangleMesh->getSubpart(subPart)->getNbTriangles();
+	return mMeshData->getNbTriangles(subPart);
 }
 
 // Compute all the triangles of the mesh that are overlapping with the AABB in parameter
 void ConcaveMeshShape::computeOverlappingTriangles(const AABB& localAABB, Array<Vector3>& triangleVertices,
-                                                   Array<Vector3>& triangleVerticesNormals, Array<uint32>& shapeIds,
+                                                   Array<uint8>& trianglesConvexEdges, Array<uint32>& shapeIds,
                                                    MemoryAllocator& allocator) const {
 
     RP3D_PROFILE("ConcaveMeshShape::computeOverlappingTriangles()", mProfiler);
 
     // Scale the input AABB with the inverse scale of the concave mesh (because
-    // we store the vertices without scale inside the dynamic AABB tree
+    // we store the vertices without scale inside the AABB tree
     AABB aabb(localAABB);
     aabb.applyScale(Vector3(decimal(1.0) / mScale.x, decimal(1.0) / mScale.y, decimal(1.0) / mScale.z));
 
     // Compute the nodes of the internal AABB tree that are overlapping with the AABB
     Array<int> overlappingNodes(allocator, 64);
-    mDynamicAABBTree.reportAllShapesOverlappingWithAABB(aabb, overlappingNodes);
+    mMeshData->mAABBTree.reportAllShapesOverlappingWithAABB(aabb, overlappingNodes);
 
     const uint32 nbOverlappingNodes = static_cast<uint32>(overlappingNodes.size());
 
-    // Add space in the array of triangles vertices/normals for the new triangles
+    // The new triangles are added after the triangles already in the arrays
+    const uint32 startIndex = static_cast<uint32>(triangleVertices.size());
+    assert(trianglesConvexEdges.size() * 3 == startIndex);
+
+    // Add space in the array of triangles vertices for the new triangles
     triangleVertices.addWithoutInit(nbOverlappingNodes * 3);
-    triangleVerticesNormals.addWithoutInit(nbOverlappingNodes * 3);
 
     // For each overlapping node
     for (uint32 i=0; i < nbOverlappingNodes; i++) {
@@ -154,16 +847,17 @@ void ConcaveMeshShape::computeOverlappingTriangles(const AABB& localAABB, Array<
         int nodeId = overlappingNodes[i];
 
         // Get the node data (triangle index and mesh subpart index)
-        int32* data = mDynamicAABBTree.getNodeDataInt(nodeId);
+        const int32* data = mMeshData->mAABBTree.getObjectDataInt(nodeId);
 
         // Get the triangle vertices for this node from the concave mesh shape
-        getTriangleVertices(data[0], data[1], &(triangleVertices[i * 3]));
-
-        // Get the vertices normals of the triangle
-        getTriangleVerticesNormals(data[0], data[1], &(triangleVerticesNormals[i * 3]));
+        getTriangleVertices(data[0], data[1], &(triangleVertices[startIndex + i * 3]));
 
         // Compute the triangle shape ID
-        shapeIds.add(computeTriangleShapeId(data[0], data[1]));
+        const uint32 shapeId = computeTriangleShapeId(data[0], data[1]);
+        shapeIds.add(shapeId);
+
+        // Get the precomputed convex edges of the triangle
+        trianglesConvexEdges.add(mMeshData->mTrianglesConvexEdges[shapeId]);
     }
 }
 
@@ -175,12 +869,12 @@ bool ConcaveMeshShape::raycast(const Ray& ray, RaycastInfo& raycastInfo, Collide
     RP3D_PROFILE("ConcaveMeshShape::raycast()", mProfiler);
 
     // Apply the concave mesh inverse scale factor because the mesh is stored without scaling
-    // inside the dynamic AABB tree
+    // inside the AABB tree
     const Vector3 inverseScale(decimal(1.0) / mScale.x, decimal(1.0) / mScale.y, decimal(1.0) / mScale.z);
     Ray scaledRay(ray.point1 * inverseScale, ray.point2 * inverseScale, ray.maxFraction);
 
     // Create the callback object that will compute ray casting against triangles
-    ConcaveMeshRaycastCallback raycastCallback(mDynamicAABBTree, *this, collider, raycastInfo, scaledRay, mScale, allocator);
+    ConcaveMeshRaycastCallback raycastCallback(mMeshData->mAABBTree, *this, collider, raycastInfo, scaledRay, mScale, allocator);
 
 #ifdef IS_RP3D_PROFILING_ENABLED
 
@@ -190,10 +884,10 @@ bool ConcaveMeshShape::raycast(const Ray& ray, RaycastInfo& raycastInfo, Collide
 
 #endif
 
-    // Ask the Dynamic AABB Tree to report all AABB nodes that are hit by the ray.
+    // Ask the AABB Tree to report all the triangles whose AABB is hit by the ray.
     // The raycastCallback object will then compute ray casting against the triangles
     // in the hit AABBs.
-    mDynamicAABBTree.raycast(scaledRay, raycastCallback);
+    mMeshData->mAABBTree.raycast(scaledRay, raycastCallback);
 
     raycastCallback.raycastTriangles();
 
@@ -205,20 +899,10 @@ uint32 ConcaveMeshShape::computeTriangleShapeId(uint32 subPart, uint32 triangleI
 
     RP3D_PROFILE("ConcaveMeshShape::computeTriangleShapeId()", mProfiler);
 
-    uint32 shapeId = 0;
-
-    uint32 i=0;
-    while (i < subPart) {
-
-        shapeId += mTriangleMesh->getSubpart(i)->getNbTriangles();
-
-        i++;
-    }
-
-    return shapeId + triangleIndex;
+    return mMeshData->computeTriangleShapeId(subPart, triangleIndex);
 }
 
-// Collect all the AABB nodes that are hit by the ray in the Dynamic AABB Tree
+// Collect all the triangles whose AABB is hit by the ray in the AABB tree
 decimal ConcaveMeshRaycastCallback::raycastBroadPhaseShape(int32 nodeId, const Ray& ray) {
 
     // Add the id of the hit AABB node into
@@ -233,52 +917,54 @@ void ConcaveMeshRaycastCallback::raycastTriangles() {
     Array<int>::Iterator it;
     decimal smallestHitFraction = mRay.maxFraction;
 
+    const Vector3 rayDirection = mRay.point2 - mRay.point1;
+    const TriangleRaycastSide raycastSide = mConcaveMeshShape.getRaycastTestType();
+
+    // Mesh subpart, triangle index and vertices of the closest hit triangle
+    int32 hitTriangleData[2] = {-1, -1};
+    Vector3 hitTrianglePoints[3];
+
     for (it = mHitAABBNodes.begin(); it != mHitAABBNodes.end(); ++it) {
 
         // Get the node data (triangle index and mesh subpart index)
-        int32* data = mDynamicAABBTree.getNodeDataInt(*it);
+        const int32* data = mAABBTree.getObjectDataInt(*it);
 
-        // Get the triangle vertices for this node from the concave mesh shape
+        // Get the triangle vertices (without scaling, like the ray) for this node from the mesh data
         Vector3 trianglePoints[3];
-        mConcaveMeshShape.getTriangleVertices(data[0], data[1], trianglePoints);
+        mConcaveMeshShape.mMeshData->getTriangleVertices(data[0], data[1], trianglePoints);
 
-        // Get the vertices normals of the triangle
-        Vector3 verticesNormals[3];
-        mConcaveMeshShape.getTriangleVerticesNormals(data[0], data[1], verticesNormals);
+        // Ray casting test against the triangle (without creating a triangle shape)
+        decimal hitFraction;
+        if (TriangleShape::computeRayIntersection(mRay.point1, rayDirection, smallestHitFraction, trianglePoints[0],
+                                                  trianglePoints[1], trianglePoints[2], raycastSide, hitFraction)) {
 
-        // Create a triangle collision shape
-        TriangleShape triangleShape(trianglePoints, verticesNormals, mConcaveMeshShape.computeTriangleShapeId(data[0], data[1]), mConcaveMeshShape.mTriangleHalfEdgeStructure, mAllocator);
-        triangleShape.setRaycastTestType(mConcaveMeshShape.getRaycastTestType());
-		
-#ifdef IS_RP3D_PROFILING_ENABLED
-
-
-		// Set the profiler to the triangle shape
-		triangleShape.setProfiler(mProfiler);
-
-#endif
-
-        // Ray casting test against the collision shape
-        RaycastInfo raycastInfo;
-        bool isTriangleHit = triangleShape.raycast(mRay, raycastInfo, mCollider, mAllocator);
+            hitTriangleData[0] = data[0];
+            hitTriangleData[1] = data[1];
+            hitTrianglePoints[0] = trianglePoints[0];
+            hitTrianglePoints[1] = trianglePoints[1];
+            hitTrianglePoints[2] = trianglePoints[2];
 
-        // If the ray hit the collision shape
-        if (isTriangleHit && raycastInfo.hitFraction <= smallestHitFraction) {
-
-            assert(raycastInfo.hitFraction >= decimal(0.0));
-
-            mRaycastInfo.body = raycastInfo.body;
-            mRaycastInfo.collider = raycastInfo.collider;
-            mRaycastInfo.hitFraction = raycastInfo.hitFraction;
-            mRaycastInfo.worldPoint = raycastInfo.worldPoint * mMeshScale;
-            mRaycastInfo.worldNormal = raycastInfo.worldNormal;
-            mRaycastInfo.meshSubpart = data[0];
-            mRaycastInfo.triangleIndex = data[1];
-
-            smallestHitFraction = raycastInfo.hitFraction;
+            smallestHitFraction = hitFraction;
             mIsHit = true;
         }
     }
+
+    if (mIsHit) {
+
+        // Compute the normal of the hit triangle with the mesh scaling (the triangles are stored without scaling)
+        Vector3 normal = (hitTrianglePoints[1] - hitTrianglePoints[0]).cross(hitTrianglePoints[2] - hitTrianglePoints[0]);
+        normal = Vector3(normal.x / mMeshScale.x, normal.y / mMeshScale.y, normal.z / mMeshScale.z);
+        normal.normalize();
+        normal = normal.dot(rayDirection * mMeshScale) > decimal(0.0) ? -normal : normal;
+
+        mRaycastInfo.body = mCollider->getBody();
+        mRaycastInfo.collider = mCollider;
+        mRaycastInfo.hitFraction = smallestHitFraction;
+        mRaycastInfo.worldPoint = (mRay.point1 + smallestHitFraction * rayDirection) * mMeshScale;
+        mRaycastInfo.worldNormal = normal;
+        mRaycastInfo.meshSubpart = hitTriangleData[0];
+        mRaycastInfo.triangleIndex = hitTriangleData[1];
+    }
 }
 
 // Return the string representation of the shape
@@ -287,40 +973,34 @@ std::string ConcaveMeshShape::to_string() const {
     std::stringstream ss;
 
     ss << "ConcaveMeshShape{" << std::endl;
-    ss << "nbSubparts=" << mTriangleMesh->getNbSubparts() << std::endl;
+    ss << "nbSubparts=" << mMeshData->getNbSubparts() << std::endl;
+
+    Array<Vector3> vertices(mAllocator);
+    Array<Vector3> normals(mAllocator);
 
     // Vertices array
-    for (uint32 subPart=0; subPart<mTriangleMesh->getNbSubparts(); subPart++) {
+    for (uint32 subPart=0; subPart<mMeshData->getNbSubparts(); subPart++) {
 
-        // Get the triangle vertex array of the current sub-part
-        TriangleVertexArray* triangleVertexArray = mTriangleMesh->getSubpart(subPart);
+        mMeshData->getSubpartVertices(subPart, vertices, normals);
 
         ss << "subpart" << subPart << "={" << std::endl;
-        ss << "nbVertices=" << triangleVertexArray->getNbVertices() << std::endl;
-        ss << "nbTriangles=" << triangleVertexArray->getNbTriangles() << std::endl;
+        ss << "nbVertices=" << mMeshData->getNbVertices(subPart) << std::endl;
+        ss << "nbTriangles=" << mMeshData->getNbTriangles(subPart) << std::endl;
 
         ss << "vertices=[";
 
-        // For each triangle of the concave mesh
-        for (uint32 v=0; v<triangleVertexArray->getNbVertices(); v++) {
-
-            Vector3 vertex;
-            triangleVertexArray->getVertex(v, &vertex);
-
-            ss << vertex.to_string() << ", ";
+        // For each vertex of the sub-part
+        for (uint32 v=0; v<vertices.size(); v++) {
+            ss << vertices[v].to_string() << ", ";
         }
 
         ss << "], " << std::endl;
 
         ss << "normals=[";
 
-        // For each triangle of the concave mesh
-        for (uint32 v=0; v<triangleVertexArray->getNbVertices(); v++) {
-
-            Vector3 normal;
-            triangleVertexArray->getNormal(v, &normal);
-
-            ss << normal.to_string() << ", ";
+        // For each vertex of the sub-part
+        for (uint32 v=0; v<normals.size(); v++) {
+            ss << normals[v].to_string() << ", ";
         }
 
         ss << "], " << std::endl;
@@ -328,12 +1008,11 @@ std::string ConcaveMeshShape::to_string() const {
         ss << "triangles=[";
 
         // For each triangle of the concave mesh
-        // For each triangle of the concave mesh
-        for (uint32 triangleIndex=0; triangleIndex<triangleVertexArray->getNbTriangles(); triangleIndex++) {
+        for (uint32 triangleIndex=0; triangleIndex<mMeshData->getNbTriangles(subPart); triangleIndex++) {
 
             uint32 indices[3];
 
-            triangleVertexArray->getTriangleVerticesIndices(triangleIndex, indices);
+            mMeshData->getTriangleVerticesIndices(subPart, triangleIndex, indices);
 
             ss << "(" << indices[0] << "," << indices[1] << "," << indices[2] << "), ";
         }
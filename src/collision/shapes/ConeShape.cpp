@@ -0,0 +1,188 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2022 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+// Libraries
+#include <reactphysics3d/collision/shapes/ConeShape.h>
+#include <reactphysics3d/collision/Collider.h>
+#include <reactphysics3d/configuration.h>
+#include <reactphysics3d/collision/RaycastInfo.h>
+#include <cassert>
+
+using namespace reactphysics3d;
+
+// Constructor
+/**
+ * @param radius The radius of the base of the cone (in meters)
+ * @param height The height of the cone (in meters)
+ */
+ConeShape::ConeShape(decimal radius, decimal height, MemoryAllocator& allocator)
+          : ConvexShape(CollisionShapeName::CONE, CollisionShapeType::GENERIC_CONVEX, allocator),
+            mRadius(radius), mHeight(height) {
+
+    assert(radius > decimal(0.0));
+    assert(height > decimal(0.0));
+
+    updateCore();
+}
+
+// Compute the margin and the internal core of the cone from its dimensions
+/// The internal core is the set of points of the cone at a distance larger than the margin from its
+/// boundary. It is a smaller cone with the same apex angle: its base is moved up by the margin and
+/// its apex is moved down by margin / sin(alpha) where alpha is the half angle at the apex.
+void ConeShape::updateCore() {
+
+    mMargin = std::min(GENERIC_CONVEX_SHAPE_MAX_MARGIN, decimal(0.1) * std::min(mRadius, decimal(0.5) * mHeight));
+
+    const decimal sinHalfAngle = mRadius / std::sqrt(mRadius * mRadius + mHeight * mHeight);
+
+    mCoreBaseY = decimal(-0.25) * mHeight + mMargin;
+    mCoreApexY = decimal(0.75) * mHeight - mMargin / sinHalfAngle;
+    mCoreRadius = mRadius * (mCoreApexY - mCoreBaseY) / mHeight;
+
+    assert(mCoreApexY > mCoreBaseY);
+}
+
+// Return the local inertia tensor of the cone (around its center of mass)
+/**
+ * @param mass Mass to use to compute the inertia tensor of the collision shape
+ */
+Vector3 ConeShape::getLocalInertiaTensor(decimal mass) const {
+
+    const decimal radiusSquare = mRadius * mRadius;
+    const decimal IxxAndzz = mass * (decimal(3.0 / 20.0) * radiusSquare + decimal(3.0 / 80.0) * mHeight * mHeight);
+    const decimal Iyy = decimal(0.3) * mass * radiusSquare;
+    return Vector3(IxxAndzz, Iyy, IxxAndzz);
+}
+
+// Return true if a point is inside the collision shape
+bool ConeShape::testPointInside(const Vector3& localPoint, Collider* /*collider*/) const {
+
+    const decimal apexY = decimal(0.75) * mHeight;
+    const decimal baseY = decimal(-0.25) * mHeight;
+
+    if (localPoint.y >= apexY || localPoint.y <= baseY) return false;
+
+    // Radius of the cone at the height of the point
+    const decimal radius = mRadius * (apexY - localPoint.y) / mHeight;
+
+    return localPoint.x * localPoint.x + localPoint.z * localPoint.z < radius * radius;
+}
+
+// Raycast method with feedback information
+/// The ray is tested against the side of the cone (infinite double cone limited between the base
+/// and the apex) and against the base. If the origin of the ray is inside the cone, we return no hit.
+bool ConeShape::raycast(const Ray& ray, RaycastInfo& raycastInfo, Collider* collider, MemoryAllocator& /*allocator*/) const {
+
+    const Vector3& p = ray.point1;
+    const Vector3 d = ray.point2 - ray.point1;
+
+    // If the origin of the ray is inside the cone, we return no hit
+    if (testPointInside(p, collider)) return false;
+
+    const decimal apexY = decimal(0.75) * mHeight;
+    const decimal baseY = decimal(-0.25) * mHeight;
+
+    // Ratio between the radius and the distance to the apex along the axis
+    const decimal k = mRadius / mHeight;
+    const decimal kSquare = k * k;
+
+    decimal hitFraction = ray.maxFraction;
+    Vector3 hitNormal;
+    bool isHit = false;
+
+    // Intersection with the side of the cone. A point is on the infinite double cone
+    // if x^2 + z^2 = k^2 * (apexY - y)^2 which gives a quadratic equation in t
+    const decimal q = apexY - p.y;
+    const decimal a = d.x * d.x + d.z * d.z - kSquare * d.y * d.y;
+    const decimal b = p.x * d.x + p.z * d.z + kSquare * q * d.y;
+    const decimal c = p.x * p.x + p.z * p.z - kSquare * q * q;
+
+    decimal roots[2];
+    uint32 nbRoots = 0;
+    if (std::abs(a) > MACHINE_EPSILON) {
+
+        const decimal discriminant = b * b - a * c;
+        if (discriminant >= decimal(0.0)) {
+
+            const decimal sqrtDiscriminant = std::sqrt(discriminant);
+            const decimal t1 = (-b - sqrtDiscriminant) / a;
+            const decimal t2 = (-b + sqrtDiscriminant) / a;
+            roots[0] = std::min(t1, t2);
+            roots[1] = std::max(t1, t2);
+            nbRoots = 2;
+        }
+    }
+    else if (std::abs(b) > MACHINE_EPSILON) {
+
+        // The ray is parallel to a line of the cone
+        roots[0] = -c / (decimal(2.0) * b);
+        nbRoots = 1;
+    }
+
+    for (uint32 i = 0; i < nbRoots; i++) {
+
+        const decimal t = roots[i];
+        if (t < decimal(0.0) || t > hitFraction) continue;
+
+        // The hit point must be on the real cone (between the base and the apex)
+        const Vector3 point = p + t * d;
+        if (point.y < baseY || point.y > apexY) continue;
+
+        hitFraction = t;
+        isHit = true;
+
+        // The outward normal of the side is (x / r, k, z / r) normalized
+        const decimal radius = std::sqrt(point.x * point.x + point.z * point.z);
+        hitNormal = radius > MACHINE_EPSILON ? Vector3(point.x / radius, k, point.z / radius) : Vector3(0, 1, 0);
+        hitNormal.normalize();
+
+        break;
+    }
+
+    // Intersection with the base of the cone
+    if (p.y <= baseY && d.y > MACHINE_EPSILON) {
+
+        const decimal t = (baseY - p.y) / d.y;
+        if (t >= decimal(0.0) && t <= hitFraction) {
+
+            const decimal x = p.x + t * d.x;
+            const decimal z = p.z + t * d.z;
+            if (x * x + z * z <= mRadius * mRadius) {
+                hitFraction = t;
+                hitNormal = Vector3(0, -1, 0);
+                isHit = true;
+            }
+        }
+    }
+
+    if (!isHit) return false;
+
+    raycastInfo.body = collider->getBody();
+    raycastInfo.collider = collider;
+    raycastInfo.hitFraction = hitFraction;
+    raycastInfo.worldPoint = p + hitFraction * d;
+    raycastInfo.worldNormal = hitNormal;
+
+    return true;
+}
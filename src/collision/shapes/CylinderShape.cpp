@@ -0,0 +1,133 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2022 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+// Libraries
+#include <reactphysics3d/collision/shapes/CylinderShape.h>
+#include <reactphysics3d/collision/Collider.h>
+#include <reactphysics3d/configuration.h>
+#include <reactphysics3d/collision/RaycastInfo.h>
+#include <cassert>
+
+using namespace reactphysics3d;
+
+// Constructor
+/**
+ * @param radius The radius of the cylinder (in meters)
+ * @param height The height of the cylinder (in meters)
+ */
+CylinderShape::CylinderShape(decimal radius, decimal height, MemoryAllocator& allocator)
+            : ConvexShape(CollisionShapeName::CYLINDER, CollisionShapeType::GENERIC_CONVEX, allocator),
+              mRadius(radius), mHalfHeight(height * decimal(0.5)) {
+
+    assert(radius > decimal(0.0));
+    assert(height > decimal(0.0));
+
+    updateMargin();
+}
+
+// Return the local inertia tensor of the cylinder
+/**
+ * @param mass Mass to use to compute the inertia tensor of the collision shape
+ */
+Vector3 CylinderShape::getLocalInertiaTensor(decimal mass) const {
+
+    const decimal radiusSquare = mRadius * mRadius;
+    const decimal height = mHalfHeight + mHalfHeight;
+    const decimal IxxAndzz = mass * (decimal(3.0) * radiusSquare + height * height) / decimal(12.0);
+    const decimal Iyy = decimal(0.5) * mass * radiusSquare;
+    return Vector3(IxxAndzz, Iyy, IxxAndzz);
+}
+
+// Return true if a point is inside the collision shape
+bool CylinderShape::testPointInside(const Vector3& localPoint, Collider* /*collider*/) const {
+
+    return localPoint.x * localPoint.x + localPoint.z * localPoint.z < mRadius * mRadius &&
+           localPoint.y < mHalfHeight && localPoint.y > -mHalfHeight;
+}
+
+// Raycast method with feedback information
+/// The ray is tested against the side of the cylinder (infinite cylinder limited to the height of
+/// the shape) and against the cap that is on the same side as the origin of the ray. If the origin
+/// of the ray is inside the cylinder, we return no hit.
+bool CylinderShape::raycast(const Ray& ray, RaycastInfo& raycastInfo, Collider* collider, MemoryAllocator& /*allocator*/) const {
+
+    const Vector3& p = ray.point1;
+    const Vector3 d = ray.point2 - ray.point1;
+    const decimal radiusSquare = mRadius * mRadius;
+    const decimal pSquareXZ = p.x * p.x + p.z * p.z;
+
+    // If the origin of the ray is inside the cylinder, we return no hit
+    if (pSquareXZ < radiusSquare && std::abs(p.y) < mHalfHeight) return false;
+
+    decimal hitFraction = ray.maxFraction;
+    Vector3 hitNormal;
+    bool isHit = false;
+
+    // Intersection with the side of the cylinder
+    const decimal a = d.x * d.x + d.z * d.z;
+    if (a > MACHINE_EPSILON) {
+
+        const decimal b = p.x * d.x + p.z * d.z;
+        const decimal c = pSquareXZ - radiusSquare;
+        const decimal discriminant = b * b - a * c;
+
+        if (discriminant >= decimal(0.0)) {
+
+            // Smallest root (where the ray enters the infinite cylinder)
+            const decimal t = (-b - std::sqrt(discriminant)) / a;
+            if (t >= decimal(0.0) && t <= hitFraction && std::abs(p.y + t * d.y) <= mHalfHeight) {
+                hitFraction = t;
+                hitNormal = Vector3(p.x + t * d.x, decimal(0.0), p.z + t * d.z) / mRadius;
+                isHit = true;
+            }
+        }
+    }
+
+    // Intersection with the cap that is on the side of the origin of the ray
+    if (std::abs(p.y) >= mHalfHeight && std::abs(d.y) > MACHINE_EPSILON) {
+
+        const decimal capY = p.y > decimal(0.0) ? mHalfHeight : -mHalfHeight;
+        const decimal t = (capY - p.y) / d.y;
+        if (t >= decimal(0.0) && t <= hitFraction) {
+
+            const decimal x = p.x + t * d.x;
+            const decimal z = p.z + t * d.z;
+            if (x * x + z * z <= radiusSquare) {
+                hitFraction = t;
+                hitNormal = Vector3(decimal(0.0), capY > decimal(0.0) ? decimal(1.0) : decimal(-1.0), decimal(0.0));
+                isHit = true;
+            }
+        }
+    }
+
+    if (!isHit) return false;
+
+    raycastInfo.body = collider->getBody();
+    raycastInfo.collider = collider;
+    raycastInfo.hitFraction = hitFraction;
+    raycastInfo.worldPoint = p + hitFraction * d;
+    raycastInfo.worldNormal = hitNormal;
+
+    return true;
+}
@@ -26,7 +26,9 @@
 // Libraries
 #include <reactphysics3d/collision/shapes/HeightFieldShape.h>
 #include <reactphysics3d/collision/RaycastInfo.h>
+#include <reactphysics3d/collision/Collider.h>
 #include <reactphysics3d/utils/Profiler.h>
+#include <reactphysics3d/containers/Stack.h>
 #include <iostream>
 
 using namespace reactphysics3d;
@@ -38,18 +40,22 @@ using namespace reactphysics3d;
  * @param minHeight Minimum height value of the height field
  * @param maxHeight Maximum height value of the height field
  * @param heightFieldData Pointer to the first height value data (note that values are shared and not copied)
- * @param dataType Data type for the height values (int, float, double)
+ * @param dataType Data type for the height values (int, uint16, float, double)
  * @param upAxis Integer representing the up axis direction (0 for x, 1 for y and 2 for z)
  * @param integerHeightScale Scaling factor used to scale the height values (only when height values type is integer)
+ * @param scaling Scaling factor of the vertices of the height field
+ * @param integerHeightOffset Offset added to the scaled height values (only when height values type is integer)
  */
 HeightFieldShape::HeightFieldShape(int nbGridColumns, int nbGridRows, decimal minHeight, decimal maxHeight,
                                    const void* heightFieldData, HeightDataType dataType, MemoryAllocator& allocator,
                                    HalfEdgeStructure& triangleHalfEdgeStructure, int upAxis,
-                                   decimal integerHeightScale, const Vector3& scaling)
+                                   decimal integerHeightScale, const Vector3& scaling, decimal integerHeightOffset)
                  : ConcaveShape(CollisionShapeName::HEIGHTFIELD, allocator, scaling), mNbColumns(nbGridColumns), mNbRows(nbGridRows),
                    mWidth(static_cast<decimal>(nbGridColumns - 1)), mLength(static_cast<decimal>(nbGridRows - 1)), mMinHeight(minHeight),
                    mMaxHeight(maxHeight), mUpAxis(upAxis), mIntegerHeightScale(integerHeightScale),
-                   mHeightDataType(dataType), mTriangleHalfEdgeStructure(triangleHalfEdgeStructure) {
+                   mIntegerHeightOffset(integerHeightOffset),
+                   mHeightDataType(dataType), mTriangleHalfEdgeStructure(triangleHalfEdgeStructure), mHeightPyramid(allocator),
+                   mHeightPyramidLevels(allocator) {
 
     assert(nbGridColumns >= 2);
     assert(nbGridRows >= 2);
@@ -76,6 +82,141 @@ HeightFieldShape::HeightFieldShape(int nbGridColumns, int nbGridRows, decimal mi
         mAABB.setMin(Vector3(-mWidth * decimal(0.5), -mLength * decimal(0.5), -halfHeight));
         mAABB.setMax(Vector3(mWidth * decimal(0.5), mLength * decimal(0.5), halfHeight));
     }
+
+    buildHeightPyramid();
+}
+
+// Build the min/max height pyramid
+/// Each block of the first level of the pyramid contains the minimum and maximum heights of the grid points
+/// of HEIGHT_PYRAMID_BLOCK_SIZE x HEIGHT_PYRAMID_BLOCK_SIZE grid cells. Each block of the next levels contains
+/// the minimum and maximum heights of 2 x 2 blocks of the previous level. The last level contains a single block.
+void HeightFieldShape::buildHeightPyramid() {
+
+    const int nbCellsI = mNbColumns - 1;
+    const int nbCellsJ = mNbRows - 1;
+
+    // Compute the number of blocks of each level
+    int nbBlocksI = (nbCellsI + HEIGHT_PYRAMID_BLOCK_SIZE - 1) / HEIGHT_PYRAMID_BLOCK_SIZE;
+    int nbBlocksJ = (nbCellsJ + HEIGHT_PYRAMID_BLOCK_SIZE - 1) / HEIGHT_PYRAMID_BLOCK_SIZE;
+    uint32 nbBlocks = 0;
+    while (true) {
+
+        mHeightPyramidLevels.add(HeightPyramidLevel{nbBlocksI, nbBlocksJ, nbBlocks});
+        nbBlocks += static_cast<uint32>(nbBlocksI * nbBlocksJ);
+
+        if (nbBlocksI == 1 && nbBlocksJ == 1) break;
+
+        nbBlocksI = (nbBlocksI + 1) / 2;
+        nbBlocksJ = (nbBlocksJ + 1) / 2;
+    }
+
+    mHeightPyramid.addWithoutInit(nbBlocks * 2);
+
+    // Compute the minimum and maximum heights of all the blocks
+    updateHeightPyramid(0, mHeightPyramidLevels[0].nbBlocksI - 1, 0, mHeightPyramidLevels[0].nbBlocksJ - 1);
+}
+
+// Recompute the minimum and maximum heights of a range of blocks of the first level of the pyramid and of their parents
+void HeightFieldShape::updateHeightPyramid(int blockIMin, int blockIMax, int blockJMin, int blockJMax) {
+
+    switch (mHeightDataType) {
+        case HeightDataType::HEIGHT_FLOAT_TYPE: updateHeightPyramidWithHeightType<float>(blockIMin, blockIMax, blockJMin, blockJMax); break;
+        case HeightDataType::HEIGHT_DOUBLE_TYPE: updateHeightPyramidWithHeightType<double>(blockIMin, blockIMax, blockJMin, blockJMax); break;
+        case HeightDataType::HEIGHT_INT_TYPE: updateHeightPyramidWithHeightType<int>(blockIMin, blockIMax, blockJMin, blockJMax); break;
+        case HeightDataType::HEIGHT_UINT16_TYPE: updateHeightPyramidWithHeightType<uint16>(blockIMin, blockIMax, blockJMin, blockJMax); break;
+    }
+}
+
+// Recompute the minimum and maximum heights of a range of blocks of the pyramid with a given type of height values
+/// The range of blocks of the first level is given with inclusive indices. The range of the parent blocks
+/// to update is divided by two at each next level of the pyramid.
+template<typename HeightType>
+void HeightFieldShape::updateHeightPyramidWithHeightType(int blockIMin, int blockIMax, int blockJMin, int blockJMax) {
+
+    const int nbCellsI = mNbColumns - 1;
+    const int nbCellsJ = mNbRows - 1;
+
+    // Compute the minimum and maximum heights of the blocks of the first level
+    const HeightPyramidLevel& firstLevel = mHeightPyramidLevels[0];
+    for (int bj=blockJMin; bj <= blockJMax; bj++) {
+        for (int bi=blockIMin; bi <= blockIMax; bi++) {
+
+            const int iEnd = std::min((bi + 1) * HEIGHT_PYRAMID_BLOCK_SIZE, nbCellsI);
+            const int jEnd = std::min((bj + 1) * HEIGHT_PYRAMID_BLOCK_SIZE, nbCellsJ);
+
+            decimal minHeight = DECIMAL_LARGEST;
+            decimal maxHeight = -DECIMAL_LARGEST;
+            for (int j = bj * HEIGHT_PYRAMID_BLOCK_SIZE; j <= jEnd; j++) {
+                for (int i = bi * HEIGHT_PYRAMID_BLOCK_SIZE; i <= iEnd; i++) {
+                    const decimal height = getHeightValueAt<HeightType>(i, j);
+                    minHeight = std::min(minHeight, height);
+                    maxHeight = std::max(maxHeight, height);
+                }
+            }
+
+            const uint32 blockIndex = firstLevel.offset + static_cast<uint32>(bj * firstLevel.nbBlocksI + bi);
+            mHeightPyramid[blockIndex * 2] = minHeight;
+            mHeightPyramid[blockIndex * 2 + 1] = maxHeight;
+        }
+    }
+
+    // Compute the minimum and maximum heights of the parent blocks of the next levels
+    for (uint32 l=1; l < mHeightPyramidLevels.size(); l++) {
+
+        const HeightPyramidLevel& level = mHeightPyramidLevels[l];
+        const HeightPyramidLevel& previousLevel = mHeightPyramidLevels[l - 1];
+
+        blockIMin /= 2;
+        blockIMax /= 2;
+        blockJMin /= 2;
+        blockJMax /= 2;
+
+        for (int bj=blockJMin; bj <= blockJMax; bj++) {
+            for (int bi=blockIMin; bi <= blockIMax; bi++) {
+
+                decimal minHeight = DECIMAL_LARGEST;
+                decimal maxHeight = -DECIMAL_LARGEST;
+                for (int j = bj * 2; j < std::min(bj * 2 + 2, previousLevel.nbBlocksJ); j++) {
+                    for (int i = bi * 2; i < std::min(bi * 2 + 2, previousLevel.nbBlocksI); i++) {
+                        const uint32 childIndex = previousLevel.offset + static_cast<uint32>(j * previousLevel.nbBlocksI + i);
+                        minHeight = std::min(minHeight, mHeightPyramid[childIndex * 2]);
+                        maxHeight = std::max(maxHeight, mHeightPyramid[childIndex * 2 + 1]);
+                    }
+                }
+
+                const uint32 blockIndex = level.offset + static_cast<uint32>(bj * level.nbBlocksI + bi);
+                mHeightPyramid[blockIndex * 2] = minHeight;
+                mHeightPyramid[blockIndex * 2 + 1] = maxHeight;
+            }
+        }
+    }
+}
+
+// Notify the height field that the height values of a rectangular region of the grid have been modified
+/// Only the blocks of the min/max height pyramid that contain a modified grid point are recomputed. The
+/// new height values must stay inside the [minHeight, maxHeight] range given when the shape was created
+/// because the AABB of the height field (and therefore its position in the broad-phase) is not modified.
+/**
+ * @param minColumn Index of the first modified column of the grid
+ * @param minRow Index of the first modified row of the grid
+ * @param maxColumn Index of the last modified column of the grid (inclusive)
+ * @param maxRow Index of the last modified row of the grid (inclusive)
+ */
+void HeightFieldShape::updateHeights(int minColumn, int minRow, int maxColumn, int maxRow) {
+
+    RP3D_PROFILE("HeightFieldShape::updateHeights()", mProfiler);
+
+    assert(minColumn >= 0 && minColumn <= maxColumn && maxColumn < mNbColumns);
+    assert(minRow >= 0 && minRow <= maxRow && maxRow < mNbRows);
+
+    // A grid point on the boundary of two blocks belongs to both blocks
+    const HeightPyramidLevel& firstLevel = mHeightPyramidLevels[0];
+    const int blockIMin = std::max(minColumn - 1, 0) / HEIGHT_PYRAMID_BLOCK_SIZE;
+    const int blockIMax = std::min(maxColumn / HEIGHT_PYRAMID_BLOCK_SIZE, firstLevel.nbBlocksI - 1);
+    const int blockJMin = std::max(minRow - 1, 0) / HEIGHT_PYRAMID_BLOCK_SIZE;
+    const int blockJMax = std::min(maxRow / HEIGHT_PYRAMID_BLOCK_SIZE, firstLevel.nbBlocksJ - 1);
+
+    updateHeightPyramid(blockIMin, blockIMax, blockJMin, blockJMax);
 }
 
 // Return the local bounds of the shape in x, y and z directions.
@@ -93,12 +234,37 @@ void HeightFieldShape::getLocalBounds(Vector3& min, Vector3& max) const {
 // of the body when need to test and see against which triangles of the height-field we need
 // to test for collision. We compute the sub-grid points that are inside the other body's AABB
 // and then for each rectangle in the sub-grid we generate two triangles that we use to test collision.
+/// The blocks of the min/max height pyramid whose heights are all above or all below the AABB are skipped
+/// and so are the grid cells whose four grid points are all above or all below the AABB.
 void HeightFieldShape::computeOverlappingTriangles(const AABB& localAABB, Array<Vector3>& triangleVertices,
-                                                   Array<Vector3>& triangleVerticesNormals, Array<uint32>& shapeIds,
-                                                   MemoryAllocator& /*allocator*/) const {
+                                                   Array<uint8>& trianglesConvexEdges, Array<uint32>& shapeIds,
+                                                   MemoryAllocator& allocator) const {
 
     RP3D_PROFILE("HeightFieldShape::computeOverlappingTriangles()", mProfiler);
 
+    // Select the loops compiled for the type of the height values
+    switch (mHeightDataType) {
+        case HeightDataType::HEIGHT_FLOAT_TYPE:
+            computeOverlappingTrianglesWithHeightType<float>(localAABB, triangleVertices, trianglesConvexEdges, shapeIds, allocator);
+            break;
+        case HeightDataType::HEIGHT_DOUBLE_TYPE:
+            computeOverlappingTrianglesWithHeightType<double>(localAABB, triangleVertices, trianglesConvexEdges, shapeIds, allocator);
+            break;
+        case HeightDataType::HEIGHT_INT_TYPE:
+            computeOverlappingTrianglesWithHeightType<int>(localAABB, triangleVertices, trianglesConvexEdges, shapeIds, allocator);
+            break;
+        case HeightDataType::HEIGHT_UINT16_TYPE:
+            computeOverlappingTrianglesWithHeightType<uint16>(localAABB, triangleVertices, trianglesConvexEdges, shapeIds, allocator);
+            break;
+    }
+}
+
+// Compute the triangles of the height field overlapping a given AABB with a given type of height values
+template<typename HeightType>
+void HeightFieldShape::computeOverlappingTrianglesWithHeightType(const AABB& localAABB, Array<Vector3>& triangleVertices,
+                                                                 Array<uint8>& trianglesConvexEdges, Array<uint32>& shapeIds,
+                                                                 MemoryAllocator& allocator) const {
+
    // Compute the non-scaled AABB
    Vector3 inverseScale(decimal(1.0) / mScale.x, decimal(1.0) / mScale.y, decimal(1.0) / mScale.z);
    AABB aabb(localAABB.getMin() * inverseScale, localAABB.getMax() * inverseScale);
@@ -136,59 +302,99 @@ void HeightFieldShape::computeOverlappingTriangles(const AABB& localAABB, Array<
    assert(jMin >= 0 && jMin < mNbRows);
    assert(jMax >= 0 && jMax < mNbRows);
 
-   // For each sub-grid points (except the last ones one each dimension)
-   for (int i = iMin; i < iMax; i++) {
-       for (int j = jMin; j < jMax; j++) {
-
-           // Compute the four point of the current quad
-           const Vector3 p1 = getVertexAt(i, j);
-           const Vector3 p2 = getVertexAt(i, j + 1);
-           const Vector3 p3 = getVertexAt(i + 1, j);
-           const Vector3 p4 = getVertexAt(i + 1, j + 1);
-
-           // Generate the first triangle for the current grid rectangle
-           triangleVertices.add(p1);
-           triangleVertices.add(p2);
-           triangleVertices.add(p3);
-
-           // Compute the triangle normal
-           Vector3 triangle1Normal = (p2 - p1).cross(p3 - p1).getUnit();
-
-           // Use the triangle face normal as vertices normals (this is an aproximation. The correct
-           // solution would be to compute all the normals of the neighbor triangles and use their
-           // weighted average (with incident angle as weight) at the vertices. However, this solution
-           // seems too expensive (it requires to compute the normal of all neighbor triangles instead
-           // and compute the angle of incident edges with asin(). Maybe we could also precompute the
-           // vertices normal at the HeightFieldShape constructor but it will require extra memory to
-           // store them.
-           triangleVerticesNormals.add(triangle1Normal);
-           triangleVerticesNormals.add(triangle1Normal);
-           triangleVerticesNormals.add(triangle1Normal);
-
-           // Compute the shape ID
-           shapeIds.add(computeTriangleShapeId(i, j, 0));
-
-           // Generate the second triangle for the current grid rectangle
-           triangleVertices.add(p3);
-           triangleVertices.add(p2);
-           triangleVertices.add(p4);
-
-           // Compute the triangle normal
-           Vector3 triangle2Normal = (p2 - p3).cross(p4 - p3).getUnit();
-
-           // Use the triangle face normal as vertices normals (this is an aproximation. The correct
-           // solution would be to compute all the normals of the neighbor triangles and use their
-           // weighted average (with incident angle as weight) at the vertices. However, this solution
-           // seems too expensive (it requires to compute the normal of all neighbor triangles instead
-           // and compute the angle of incident edges with asin(). Maybe we could also precompute the
-           // vertices normal at the HeightFieldShape constructor but it will require extra memory to
-           // store them.
-           triangleVerticesNormals.add(triangle2Normal);
-           triangleVerticesNormals.add(triangle2Normal);
-           triangleVerticesNormals.add(triangle2Normal);
-
-           // Compute the shape ID
-           shapeIds.add(computeTriangleShapeId(i, j, 1));
+   // Range of height values (not translated) of the AABB
+   const decimal heightOrigin = -(mMaxHeight - mMinHeight) * decimal(0.5) - mMinHeight;
+   const decimal aabbMinHeight = aabb.getMin()[mUpAxis] - heightOrigin;
+   const decimal aabbMaxHeight = aabb.getMax()[mUpAxis] - heightOrigin;
+
+   // Visit the blocks of the min/max height pyramid from the top level (a block is a level index
+   // followed by the block coordinates in the stack)
+   Stack<int> stack(allocator, 64);
+   stack.push(static_cast<int>(mHeightPyramidLevels.size()) - 1);
+   stack.push(0);
+   stack.push(0);
+
+   while (stack.size() > 0) {
+
+       const int bj = stack.pop();
+       const int bi = stack.pop();
+       const int level = stack.pop();
+
+       const HeightPyramidLevel& pyramidLevel = mHeightPyramidLevels[level];
+       const int blockSize = HEIGHT_PYRAMID_BLOCK_SIZE << level;
+
+       // Compute the cells of the block that are inside the sub-grid
+       const int blockIMin = std::max(bi * blockSize, iMin);
+       const int blockIMax = std::min((bi + 1) * blockSize, iMax);
+       const int blockJMin = std::max(bj * blockSize, jMin);
+       const int blockJMax = std::min((bj + 1) * blockSize, jMax);
+       if (blockIMin >= blockIMax || blockJMin >= blockJMax) continue;
+
+       // If all the heights of the block are above or below the AABB, we skip the block
+       const uint32 blockIndex = pyramidLevel.offset + static_cast<uint32>(bj * pyramidLevel.nbBlocksI + bi);
+       if (mHeightPyramid[blockIndex * 2] > aabbMaxHeight || mHeightPyramid[blockIndex * 2 + 1] < aabbMinHeight) continue;
+
+       // If the block is not in the first level, we visit its children blocks
+       if (level > 0) {
+
+           const HeightPyramidLevel& childLevel = mHeightPyramidLevels[level - 1];
+           for (int j = bj * 2; j < std::min(bj * 2 + 2, childLevel.nbBlocksJ); j++) {
+               for (int i = bi * 2; i < std::min(bi * 2 + 2, childLevel.nbBlocksI); i++) {
+                   stack.push(level - 1);
+                   stack.push(i);
+                   stack.push(j);
+               }
+           }
+
+           continue;
+       }
+
+       // For each cell of the block inside the sub-grid
+       for (int i = blockIMin; i < blockIMax; i++) {
+           for (int j = blockJMin; j < blockJMax; j++) {
+
+               // If the four points of the cell are above or below the AABB, we skip the cell
+               const decimal h1 = getHeightValueAt<HeightType>(i, j);
+               const decimal h2 = getHeightValueAt<HeightType>(i, j + 1);
+               const decimal h3 = getHeightValueAt<HeightType>(i + 1, j);
+               const decimal h4 = getHeightValueAt<HeightType>(i + 1, j + 1);
+               if (std::min(std::min(h1, h2), std::min(h3, h4)) > aabbMaxHeight ||
+                   std::max(std::max(h1, h2), std::max(h3, h4)) < aabbMinHeight) {
+                   continue;
+               }
+
+               // Compute the four point of the current quad
+               const Vector3 p1 = computeVertexAt<HeightType>(i, j);
+               const Vector3 p2 = computeVertexAt<HeightType>(i, j + 1);
+               const Vector3 p3 = computeVertexAt<HeightType>(i + 1, j);
+               const Vector3 p4 = computeVertexAt<HeightType>(i + 1, j + 1);
+
+               // Generate the first triangle for the current grid rectangle
+               triangleVertices.add(p1);
+               triangleVertices.add(p2);
+               triangleVertices.add(p3);
+
+               // No edge is considered as a convex edge and the triangle face normal is always used as
+               // contact normal (this is an aproximation. The correct solution would be to compute the
+               // convexity of the edges with the neighbor triangles but this seems too expensive. Maybe we
+               // could also precompute them at the HeightFieldShape constructor but it will require extra
+               // memory to store them.
+               trianglesConvexEdges.add(0);
+
+               // Compute the shape ID
+               shapeIds.add(computeTriangleShapeId(i, j, 0));
+
+               // Generate the second triangle for the current grid rectangle
+               triangleVertices.add(p3);
+               triangleVertices.add(p2);
+               triangleVertices.add(p4);
+
+               // No edge is considered as a convex edge (see the first triangle)
+               trianglesConvexEdges.add(0);
+
+               // Compute the shape ID
+               shapeIds.add(computeTriangleShapeId(i, j, 1));
+           }
        }
    }
 }
@@ -237,6 +443,20 @@ bool HeightFieldShape::raycast(const Ray& ray, RaycastInfo& raycastInfo, Collide
 
     RP3D_PROFILE("HeightFieldShape::raycast()", mProfiler);
 
+    // Select the loops compiled for the type of the height values
+    switch (mHeightDataType) {
+        case HeightDataType::HEIGHT_FLOAT_TYPE: return raycastWithHeightType<float>(ray, raycastInfo, collider, allocator);
+        case HeightDataType::HEIGHT_DOUBLE_TYPE: return raycastWithHeightType<double>(ray, raycastInfo, collider, allocator);
+        case HeightDataType::HEIGHT_INT_TYPE: return raycastWithHeightType<int>(ray, raycastInfo, collider, allocator);
+        case HeightDataType::HEIGHT_UINT16_TYPE: return raycastWithHeightType<uint16>(ray, raycastInfo, collider, allocator);
+        default: assert(false); return false;
+    }
+}
+
+// Raycast method with a given type of height values
+template<typename HeightType>
+bool HeightFieldShape::raycastWithHeightType(const Ray& ray, RaycastInfo& raycastInfo, Collider* collider, MemoryAllocator& allocator) const {
+
     // Apply the concave mesh inverse scale factor because the mesh is stored without scaling
     // inside the dynamic AABB tree
     const Vector3 inverseScale(decimal(1.0) / mScale.x, decimal(1.0) / mScale.y, decimal(1.0) / mScale.z);
@@ -244,84 +464,98 @@ bool HeightFieldShape::raycast(const Ray& ray, RaycastInfo& raycastInfo, Collide
 
     bool isHit = false;
 
-    // Compute the grid coordinates where the ray is entering the AABB of the height field
-    int i, j;
-    Vector3 outHitGridPoint;
-    if (computeEnteringRayGridCoordinates(scaledRay, i, j, outHitGridPoint)) {
-
-        const int nbCellsI = mNbColumns - 1;
-        const int nbCellsJ = mNbRows - 1;
-
-        const Vector3 aabbSize = mAABB.getExtent();
-
-        const Vector3 rayDirection = scaledRay.point2 - scaledRay.point1;
-
-        int stepI, stepJ;
-        decimal tMaxI, tMaxJ, nextI, nextJ, tDeltaI, tDeltaJ, sizeI, sizeJ;
-
-        switch(mUpAxis) {
-            case 0 : stepI = rayDirection.y > 0 ? 1 : (rayDirection.y < 0 ? -1 : 0);
-                     stepJ = rayDirection.z > 0 ? 1 : (rayDirection.z < 0 ? -1 : 0);
-                     nextI = static_cast<decimal>(stepI >= 0 ? i + 1 : i);
-                     nextJ = static_cast<decimal>(stepJ >= 0 ? j + 1 : j);
-                     sizeI = aabbSize.y / nbCellsI;
-                     sizeJ = aabbSize.z / nbCellsJ;
-                     tMaxI = ((nextI * sizeI) - outHitGridPoint.y) / rayDirection.y;
-                     tMaxJ = ((nextJ * sizeJ) - outHitGridPoint.z) / rayDirection.z;
-                     tDeltaI = sizeI / std::abs(rayDirection.y);
-                     tDeltaJ = sizeJ / std::abs(rayDirection.z);
-                     break;
-            case 1 : stepI = rayDirection.x > 0 ? 1 : (rayDirection.x < 0 ? -1 : 0);
-                     stepJ = rayDirection.z > 0 ? 1 : (rayDirection.z < 0 ? -1 : 0);
-                     nextI = static_cast<decimal>(stepI >= 0 ? i + 1 : i);
-                     nextJ = static_cast<decimal>(stepJ >= 0 ? j + 1 : j);
-                     sizeI = aabbSize.x / nbCellsI;
-                     sizeJ = aabbSize.z / nbCellsJ;
-                     tMaxI = ((nextI * sizeI) - outHitGridPoint.x) / rayDirection.x;
-                     tMaxJ = ((nextJ * sizeJ) - outHitGridPoint.z) / rayDirection.z;
-                     tDeltaI = sizeI / std::abs(rayDirection.x);
-                     tDeltaJ = sizeJ / std::abs(rayDirection.z);
-                     break;
-            case 2 : stepI = rayDirection.x > 0 ? 1 : (rayDirection.x < 0 ? -1 : 0);
-                     stepJ = rayDirection.y > 0 ? 1 : (rayDirection.y < 0 ? -1 : 0);
-                     nextI = static_cast<decimal>(stepI >= 0 ? i + 1 : i);
-                     nextJ = static_cast<decimal>(stepJ >= 0 ? j + 1 : j);
-                     sizeI = aabbSize.x / nbCellsI;
-                     sizeJ = aabbSize.y / nbCellsJ;
-                     tMaxI = ((nextI * sizeI) - outHitGridPoint.x) / rayDirection.x;
-                     tMaxJ = ((nextJ * sizeJ) - outHitGridPoint.y) / rayDirection.y;
-                     tDeltaI = sizeI / std::abs(rayDirection.x);
-                     tDeltaJ = sizeJ / std::abs(rayDirection.y);
-                     break;
-        }
+    const Vector3 rayDirection = scaledRay.point2 - scaledRay.point1;
+    const Vector3 rayDirectionInverse(decimal(1.0) / rayDirection.x, decimal(1.0) / rayDirection.y, decimal(1.0) / rayDirection.z);
+
+    decimal smallestHitFraction = ray.maxFraction;
+
+    // Test if the ray hits the top block of the min/max height pyramid
+    const int topLevel = static_cast<int>(mHeightPyramidLevels.size()) - 1;
+    const HeightPyramidLevel& pyramidTopLevel = mHeightPyramidLevels[topLevel];
+    decimal entryFraction;
+    if (!computeRayEntryFraction(scaledRay.point1, rayDirectionInverse,
+                                 computeGridAABB(0, mNbColumns - 1, 0, mNbRows - 1, mHeightPyramid[pyramidTopLevel.offset * 2],
+                                                 mHeightPyramid[pyramidTopLevel.offset * 2 + 1]),
+                                 smallestHitFraction, entryFraction)) {
+        return false;
+    }
 
-        decimal smallestHitFraction = ray.maxFraction;
+    // Visit the blocks of the pyramid hit by the ray from the nearest to the farthest
+    Stack<HeightPyramidBlock> stack(allocator, 64);
+    stack.push(HeightPyramidBlock{topLevel, 0, 0, entryFraction});
 
-        while (i >= 0 && i < nbCellsI && j >= 0 && j < nbCellsJ) {
+    while (stack.size() > 0) {
 
-           // Compute the four point of the current quad
-           const Vector3 p1 = getVertexAt(i, j);
-           const Vector3 p2 = getVertexAt(i, j + 1);
-           const Vector3 p3 = getVertexAt(i + 1, j);
-           const Vector3 p4 = getVertexAt(i + 1, j + 1);
+        const HeightPyramidBlock block = stack.pop();
 
-           // Raycast against the first triangle of the cell
-           uint32 shapeId = computeTriangleShapeId(i, j, 0);
-           isHit |= raycastTriangle(ray, p1, p2, p3, shapeId, collider, raycastInfo, smallestHitFraction, allocator);
+        // If a closer triangle has already been hit, we skip the block
+        if (block.entryFraction > smallestHitFraction) continue;
 
-           // Raycast against the second triangle of the cell
-           shapeId = computeTriangleShapeId(i, j, 1);
-           isHit |= raycastTriangle(ray, p3, p2, p4, shapeId, collider, raycastInfo, smallestHitFraction, allocator);
+        // If the block is not in the first level
+        if (block.level > 0) {
 
-           if (stepI == 0 && stepJ == 0) break;
+            const HeightPyramidLevel& childLevel = mHeightPyramidLevels[block.level - 1];
+            const int childBlockSize = HEIGHT_PYRAMID_BLOCK_SIZE << (block.level - 1);
 
-           if (tMaxI < tMaxJ) {
-                tMaxI += tDeltaI;
-                i += stepI;
+            // Compute the children blocks hit by the ray
+            HeightPyramidBlock hitChildren[4];
+            int nbHitChildren = 0;
+            for (int j = block.j * 2; j < std::min(block.j * 2 + 2, childLevel.nbBlocksJ); j++) {
+                for (int i = block.i * 2; i < std::min(block.i * 2 + 2, childLevel.nbBlocksI); i++) {
+
+                    const uint32 childIndex = childLevel.offset + static_cast<uint32>(j * childLevel.nbBlocksI + i);
+                    const AABB childAABB = computeGridAABB(i * childBlockSize, std::min((i + 1) * childBlockSize, mNbColumns - 1),
+                                                           j * childBlockSize, std::min((j + 1) * childBlockSize, mNbRows - 1),
+                                                           mHeightPyramid[childIndex * 2], mHeightPyramid[childIndex * 2 + 1]);
+
+                    if (computeRayEntryFraction(scaledRay.point1, rayDirectionInverse, childAABB, smallestHitFraction, entryFraction)) {
+
+                        // Insert the child such that the children are sorted from the farthest to the nearest
+                        int k = nbHitChildren;
+                        while (k > 0 && hitChildren[k - 1].entryFraction < entryFraction) {
+                            hitChildren[k] = hitChildren[k - 1];
+                            k--;
+                        }
+                        hitChildren[k] = HeightPyramidBlock{block.level - 1, i, j, entryFraction};
+                        nbHitChildren++;
+                    }
+                }
+            }
+
+            // Push the nearest child last so that it is visited first
+            for (int k=0; k < nbHitChildren; k++) {
+                stack.push(hitChildren[k]);
             }
-            else {
-                tMaxJ += tDeltaJ;
-                j += stepJ;
+
+            continue;
+        }
+
+        // For each cell of the block of the first level
+        const int iEnd = std::min((block.i + 1) * HEIGHT_PYRAMID_BLOCK_SIZE, mNbColumns - 1);
+        const int jEnd = std::min((block.j + 1) * HEIGHT_PYRAMID_BLOCK_SIZE, mNbRows - 1);
+        for (int i = block.i * HEIGHT_PYRAMID_BLOCK_SIZE; i < iEnd; i++) {
+            for (int j = block.j * HEIGHT_PYRAMID_BLOCK_SIZE; j < jEnd; j++) {
+
+                // Test if the ray hits the AABB of the cell
+                const decimal h1 = getHeightValueAt<HeightType>(i, j);
+                const decimal h2 = getHeightValueAt<HeightType>(i, j + 1);
+                const decimal h3 = getHeightValueAt<HeightType>(i + 1, j);
+                const decimal h4 = getHeightValueAt<HeightType>(i + 1, j + 1);
+                const AABB cellAABB = computeGridAABB(i, i + 1, j, j + 1, std::min(std::min(h1, h2), std::min(h3, h4)),
+                                                      std::max(std::max(h1, h2), std::max(h3, h4)));
+                if (!computeRayEntryFraction(scaledRay.point1, rayDirectionInverse, cellAABB, smallestHitFraction, entryFraction)) continue;
+
+                // Compute the four point of the current quad
+                const Vector3 p1 = computeVertexAt<HeightType>(i, j);
+                const Vector3 p2 = computeVertexAt<HeightType>(i, j + 1);
+                const Vector3 p3 = computeVertexAt<HeightType>(i + 1, j);
+                const Vector3 p4 = computeVertexAt<HeightType>(i + 1, j + 1);
+
+                // Raycast against the first triangle of the cell
+                isHit |= raycastTriangle(ray, p1, p2, p3, collider, raycastInfo, smallestHitFraction);
+
+                // Raycast against the second triangle of the cell
+                isHit |= raycastTriangle(ray, p3, p2, p4, collider, raycastInfo, smallestHitFraction);
             }
         }
     }
@@ -329,43 +563,79 @@ bool HeightFieldShape::raycast(const Ray& ray, RaycastInfo& raycastInfo, Collide
     return isHit;
 }
 
-// Raycast a single triangle of the height-field
-bool HeightFieldShape::raycastTriangle(const Ray& ray, const Vector3& p1, const Vector3& p2, const Vector3& p3, uint32 shapeId,
-                                       Collider* collider, RaycastInfo& raycastInfo, decimal& smallestHitFraction, MemoryAllocator& allocator) const {
+// Return the local AABB (without scaling) of a range of grid points with given minimum and maximum heights
+/// The AABB is slightly enlarged so that a ray that hits a triangle on the boundary of the AABB also hits the AABB
+AABB HeightFieldShape::computeGridAABB(int iMin, int iMax, int jMin, int jMax, decimal minHeight, decimal maxHeight) const {
+
+    const decimal margin = decimal(0.001);
 
-   // Generate the first triangle for the current grid rectangle
-   Vector3 triangleVertices[3] = {p1, p2, p3};
+    // Height values origin
+    const decimal heightOrigin = -(mMaxHeight - mMinHeight) * decimal(0.5) - mMinHeight;
 
-    // Create a triangle collision shape
-    TriangleShape triangleShape(triangleVertices, shapeId, mTriangleHalfEdgeStructure, allocator);
-    triangleShape.setRaycastTestType(getRaycastTestType());
+    const decimal minI = -mWidth * decimal(0.5) + iMin - margin;
+    const decimal maxI = -mWidth * decimal(0.5) + iMax + margin;
+    const decimal minJ = -mLength * decimal(0.5) + jMin - margin;
+    const decimal maxJ = -mLength * decimal(0.5) + jMax + margin;
+    const decimal minH = heightOrigin + minHeight - margin;
+    const decimal maxH = heightOrigin + maxHeight + margin;
 
-#ifdef IS_RP3D_PROFILING_ENABLED
+    switch (mUpAxis) {
+        case 0: return AABB(Vector3(minH, minI, minJ), Vector3(maxH, maxI, maxJ));
+        case 1: return AABB(Vector3(minI, minH, minJ), Vector3(maxI, maxH, maxJ));
+        case 2: return AABB(Vector3(minI, minJ, minH), Vector3(maxI, maxJ, maxH));
+        default: assert(false); return mAABB;
+    }
+}
 
+// Compute the hit fraction where a ray enters an AABB
+/// This method returns false if the ray does not hit the AABB before the maximum fraction. The entry
+/// fraction is zero if the origin of the ray is inside the AABB. See AABB::testRayIntersect()
+/// for the handling of a ray parallel to a slab of the AABB.
+bool HeightFieldShape::computeRayEntryFraction(const Vector3& rayOrigin, const Vector3& rayDirectionInverse, const AABB& aabb,
+                                               decimal maxFraction, decimal& outEntryFraction) {
 
-    // Set the profiler to the triangle shape
-    triangleShape.setProfiler(mProfiler);
+    decimal tMin = decimal(0.0);
+    decimal tMax = maxFraction;
 
-#endif
+    for (int i = 0; i < 3; i++) {
 
-    // Ray casting test against the collision shape
-    RaycastInfo triangleRaycastInfo;
-    bool isTriangleHit = triangleShape.raycast(ray, triangleRaycastInfo, collider, allocator);
+        const decimal t1 = (aabb.getMin()[i] - rayOrigin[i]) * rayDirectionInverse[i];
+        const decimal t2 = (aabb.getMax()[i] - rayOrigin[i]) * rayDirectionInverse[i];
 
-    // If the ray hit the collision shape
-    if (isTriangleHit && triangleRaycastInfo.hitFraction <= smallestHitFraction) {
+        tMin = std::max(tMin, std::min(t1, t2));
+        tMax = std::min(tMax, std::max(t1, t2));
+    }
 
-        assert(triangleRaycastInfo.hitFraction >= decimal(0.0));
+    outEntryFraction = tMin;
 
-        raycastInfo.body = triangleRaycastInfo.body;
-        raycastInfo.collider = triangleRaycastInfo.collider;
-        raycastInfo.hitFraction = triangleRaycastInfo.hitFraction;
-        raycastInfo.worldPoint = triangleRaycastInfo.worldPoint;
-        raycastInfo.worldNormal = triangleRaycastInfo.worldNormal;
+    return tMax >= tMin;
+}
+
+// Raycast a single triangle of the height-field
+bool HeightFieldShape::raycastTriangle(const Ray& ray, const Vector3& p1, const Vector3& p2, const Vector3& p3,
+                                       Collider* collider, RaycastInfo& raycastInfo, decimal& smallestHitFraction) const {
+
+    const Vector3 rayDirection = ray.point2 - ray.point1;
+
+    // Ray casting test against the triangle (without creating a triangle shape)
+    decimal hitFraction;
+    if (TriangleShape::computeRayIntersection(ray.point1, rayDirection, smallestHitFraction, p1, p2, p3,
+                                              getRaycastTestType(), hitFraction)) {
+
+        // Compute the triangle face normal
+        Vector3 normal = (p2 - p1).cross(p3 - p1);
+        normal.normalize();
+        normal = normal.dot(rayDirection) > decimal(0.0) ? -normal : normal;
+
+        raycastInfo.body = collider->getBody();
+        raycastInfo.collider = collider;
+        raycastInfo.hitFraction = hitFraction;
+        raycastInfo.worldPoint = ray.point1 + hitFraction * rayDirection;
+        raycastInfo.worldNormal = normal;
         raycastInfo.meshSubpart = -1;
         raycastInfo.triangleIndex = -1;
 
-        smallestHitFraction = triangleRaycastInfo.hitFraction;
+        smallestHitFraction = hitFraction;
 
         return true;
     }
@@ -373,55 +643,24 @@ bool HeightFieldShape::raycastTriangle(const Ray& ray, const Vector3& p1, const
     return false;
 }
 
-// Compute the first grid cell of the heightfield intersected by a ray.
-/// This method returns true if the ray hit the AABB of the height field and false otherwise
-bool HeightFieldShape::computeEnteringRayGridCoordinates(const Ray& ray, int& i, int& j, Vector3& outHitGridPoint) const {
-    
-    decimal stepI, stepJ;
-    const Vector3 aabbSize = mAABB.getExtent();
-
-    assert(mNbColumns > 0);
-    assert(mNbRows > 0);
-
-    const int nbCellsI = mNbColumns - 1;
-    const int nbCellsJ = mNbRows - 1;
-
-    if (mAABB.raycast(ray, outHitGridPoint)) {
-
-        // Map the hit point into the grid range [0, mNbColumns - 1], [0, mNbRows - 1]
-        outHitGridPoint -= mAABB.getMin();
-
-        switch(mUpAxis) {
-            case 0 : stepI = aabbSize.y / nbCellsI;
-                     stepJ = aabbSize.z / nbCellsJ;
-                     i = clamp(int(outHitGridPoint.y / stepI), 0, nbCellsI - 1);
-                     j = clamp(int(outHitGridPoint.z / stepJ), 0, nbCellsJ - 1);
-                     break;
-            case 1 : stepI = aabbSize.x / nbCellsI;
-                     stepJ = aabbSize.z / nbCellsJ;
-                     i = clamp(int(outHitGridPoint.x / stepI), 0, nbCellsI - 1);
-                     j = clamp(int(outHitGridPoint.z / stepJ), 0, nbCellsJ - 1);
-                     break;
-            case 2 : stepI = aabbSize.x / nbCellsI;
-                     stepJ = aabbSize.y / nbCellsJ;
-                     i = clamp(int(outHitGridPoint.x / stepI), 0, nbCellsI - 1);
-                     j = clamp(int(outHitGridPoint.y / stepJ), 0, nbCellsJ - 1);
-                     break;
-        }
+// Return the vertex (local-coordinates) of the height field at a given (x,y) position
+Vector3 HeightFieldShape::getVertexAt(int x, int y) const {
 
-        assert(i >= 0 && i < nbCellsI);
-        assert(j >= 0 && j < nbCellsJ);
-        return true;
+    switch (mHeightDataType) {
+        case HeightDataType::HEIGHT_FLOAT_TYPE: return computeVertexAt<float>(x, y);
+        case HeightDataType::HEIGHT_DOUBLE_TYPE: return computeVertexAt<double>(x, y);
+        case HeightDataType::HEIGHT_INT_TYPE: return computeVertexAt<int>(x, y);
+        case HeightDataType::HEIGHT_UINT16_TYPE: return computeVertexAt<uint16>(x, y);
+        default: assert(false); return Vector3::zero();
     }
-    
-    return false;
 }
 
-// Return the vertex (local-coordinates) of the height field at a given (x,y) position
-Vector3 HeightFieldShape::getVertexAt(int x, int y) const {
+// Return the vertex (local-coordinates) of the height field at a given (x,y) position with a given type of height values
+template<typename HeightType>
+Vector3 HeightFieldShape::computeVertexAt(int x, int y) const {
 
     // Get the height value
-    const decimal height = getHeightAt(x, y);
+    const decimal height = getHeightValueAt<HeightType>(x, y);
 
     // Height values origin
     const decimal heightOrigin = -(mMaxHeight - mMinHeight) * decimal(0.5) - mMinHeight;
@@ -457,6 +696,7 @@ std::string HeightFieldShape::to_string() const {
     ss << ", maxHeight=" << mMaxHeight << std::endl;
     ss << ", upAxis=" << mUpAxis << std::endl;
     ss << ", integerHeightScale=" << mIntegerHeightScale << std::endl;
+    ss << ", integerHeightOffset=" << mIntegerHeightOffset << std::endl;
     ss << "}";
 
     return ss.str();
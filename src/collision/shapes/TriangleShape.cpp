@@ -37,7 +37,7 @@ using namespace reactphysics3d;
 
 
 // Constructor
-TriangleShape::TriangleShape(const Vector3* vertices, const Vector3* verticesNormals, uint32 shapeId, HalfEdgeStructure& triangleHalfEdgeStructure, MemoryAllocator& allocator)
+TriangleShape::TriangleShape(const Vector3* vertices, uint8 convexEdges, uint32 shapeId, HalfEdgeStructure& triangleHalfEdgeStructure, MemoryAllocator& allocator)
     : ConvexPolyhedronShape(CollisionShapeName::TRIANGLE, allocator), mTriangleHalfEdgeStructure(triangleHalfEdgeStructure) {
 
     mPoints[0] = vertices[0];
@@ -48,9 +48,7 @@ TriangleShape::TriangleShape(const Vector3* vertices, const Vector3* verticesNor
     mNormal = (vertices[1] - vertices[0]).cross(vertices[2] - vertices[0]);
     mNormal.normalize();
 
-    mVerticesNormals[0] = verticesNormals[0];
-    mVerticesNormals[1] = verticesNormals[1];
-    mVerticesNormals[2] = verticesNormals[2];
+    mConvexEdges = convexEdges;
 
     mRaycastTestType = TriangleRaycastSide::FRONT;
 
@@ -68,10 +66,8 @@ TriangleShape::TriangleShape(const Vector3* vertices, uint32 shapeId, HalfEdgeSt
     // The normal is not used when creating the triangle shape with this constructor (for raycasting for instance)
     mNormal = Vector3(0, 0, 0);
 
-    // Interpolated normals are not used in this constructor (for raycasting for instance)
-    mVerticesNormals[0] = mNormal;
-    mVerticesNormals[1] = mNormal;
-    mVerticesNormals[2] = mNormal;
+    // Convex edges are not used in this constructor (for raycasting for instance)
+    mConvexEdges = 0;
 
     mRaycastTestType = TriangleRaycastSide::FRONT;
 
@@ -80,16 +76,26 @@ TriangleShape::TriangleShape(const Vector3* vertices, uint32 shapeId, HalfEdgeSt
 
 // This method implements the technique described in Game Physics Pearl book
 // by Gino van der Bergen and Dirk Gregorius to get smooth triangle mesh collision. The idea is
-// to replace the contact normal of the triangle shape with the precomputed normal of the triangle
-// mesh at this point. Then, we need to recompute the contact point on the other shape in order to
+// to replace the contact normal of the triangle shape with the normal of the triangle mesh at
+// this point. Then, we need to recompute the contact point on the other shape in order to
 // stay aligned with the new contact normal. This method will return the new smooth world contact
 // normal of the triangle and the the local contact point on the other shape.
 void TriangleShape::computeSmoothMeshContact(Vector3 localContactPointTriangle, const Transform& triangleShapeToWorldTransform,
                                              const Transform& worldToOtherShapeTransform, decimal penetrationDepth, bool isTriangleShape1,
                                              Vector3& outNewLocalContactPointOtherShape, Vector3& outSmoothWorldContactTriangleNormal) const {
 
-    // Get the smooth contact normal of the mesh at the contact point on the triangle
-    Vector3 triangleLocalNormal = computeSmoothLocalContactNormalForTriangle(localContactPointTriangle);
+    assert(mNormal.length() > decimal(0.0));
+
+    // Compute the barycentric coordinates of the contact point in the triangle
+    decimal u, v, w;
+    computeBarycentricCoordinatesInTriangle(mPoints[0], mPoints[1], mPoints[2], localContactPointTriangle, u, v, w);
+
+    // If the contact is on a convex edge or vertex of the mesh, we keep the computed contact
+    if (!isFaceContactNormalAtPoint(u, v, w, mConvexEdges)) {
+        return;
+    }
+
+    Vector3 triangleLocalNormal = mNormal;
 
     // Convert the local contact normal into world-space
     Vector3 triangleWorldNormal = triangleShapeToWorldTransform.getOrientation() * triangleLocalNormal;
@@ -134,65 +140,19 @@ void TriangleShape::computeAABB(AABB& aabb, const Transform& transform) const {
 }
 
 // Raycast method with feedback information
-/// This method use the line vs triangle raycasting technique described in
-/// Real-time Collision Detection by Christer Ericson.
+/// See TriangleShape::computeRayIntersection().
 bool TriangleShape::raycast(const Ray& ray, RaycastInfo& raycastInfo, Collider* collider, MemoryAllocator& /*allocator*/) const {
 
     RP3D_PROFILE("TriangleShape::raycast()", mProfiler);
 
     const Vector3 pq = ray.point2 - ray.point1;
-    const Vector3 pa = mPoints[0] - ray.point1;
-    const Vector3 pb = mPoints[1] - ray.point1;
-    const Vector3 pc = mPoints[2] - ray.point1;
-
-    // Test if the line PQ is inside the eges BC, CA and AB. We use the triple
-    // product for this test.
-    const Vector3 m = pq.cross(pc);
-    decimal u = pb.dot(m);
-    if (mRaycastTestType == TriangleRaycastSide::FRONT) {
-        if (u < decimal(0.0)) return false;
-    }
-    else if (mRaycastTestType == TriangleRaycastSide::BACK) {
-        if (u > decimal(0.0)) return false;
-    }
 
-    decimal v = -pa.dot(m);
-    if (mRaycastTestType == TriangleRaycastSide::FRONT) {
-        if (v < decimal(0.0)) return false;
-    }
-    else if (mRaycastTestType == TriangleRaycastSide::BACK) {
-        if (v > decimal(0.0)) return false;
-    }
-    else if (mRaycastTestType == TriangleRaycastSide::FRONT_AND_BACK) {
-        if (!sameSign(u, v)) return false;
+    decimal hitFraction;
+    if (!computeRayIntersection(ray.point1, pq, ray.maxFraction, mPoints[0], mPoints[1], mPoints[2], mRaycastTestType, hitFraction)) {
+        return false;
     }
 
-    decimal w = pa.dot(pq.cross(pb));
-    if (mRaycastTestType == TriangleRaycastSide::FRONT) {
-        if (w < decimal(0.0)) return false;
-    }
-    else if (mRaycastTestType == TriangleRaycastSide::BACK) {
-        if (w > decimal(0.0)) return false;
-    }
-    else if (mRaycastTestType == TriangleRaycastSide::FRONT_AND_BACK) {
-        if (!sameSign(u, w)) return false;
-    }
-
-    // If the line PQ is in the triangle plane (case where u=v=w=0)
-    if (approxEqual(u, 0) && approxEqual(v, 0) && approxEqual(w, 0)) return false;
-
-    // Compute the barycentric coordinates (u, v, w) to determine the
-    // intersection point R, R = u * a + v * b + w * c
-    decimal denom = decimal(1.0) / (u + v + w);
-    u *= denom;
-    v *= denom;
-    w *= denom;
-
-    // Compute the local hit point using the barycentric coordinates
-    const Vector3 localHitPoint = u * mPoints[0] + v * mPoints[1] + w * mPoints[2];
-    const decimal hitFraction = (localHitPoint - ray.point1).length() / pq.length();
-
-    if (hitFraction < decimal(0.0) || hitFraction > ray.maxFraction) return false;
+    const Vector3 localHitPoint = ray.point1 + hitFraction * pq;
 
     // Compute the triangle face normal
     Vector3 normal = (mPoints[1] - mPoints[0]).cross(mPoints[2] - mPoints[0]);
@@ -36,8 +36,8 @@ using namespace reactphysics3d;
 // Constructor
 ColliderComponents::ColliderComponents(MemoryAllocator& allocator)
                     :Components(allocator, sizeof(Entity) + sizeof(Entity) + sizeof(Collider*) + sizeof(int32) +
-                sizeof(Transform) + sizeof(CollisionShape*) + sizeof(unsigned short) +
-                sizeof(unsigned short) + sizeof(Transform) + sizeof(Array<uint64>) + sizeof(bool) +
+                sizeof(Transform) + sizeof(CollisionShape*) + sizeof(uint64) +
+                sizeof(uint64) + sizeof(int32) + sizeof(Transform) + sizeof(Array<uint64>) + sizeof(bool) +
                 sizeof(bool) + sizeof(Material)) {
 
     // Allocate memory for the components data
@@ -63,9 +63,10 @@ void ColliderComponents::allocate(uint32 nbComponentsToAllocate) {
     int32* newBroadPhaseIds = reinterpret_cast<int32*>(newColliders + nbComponentsToAllocate);
     Transform* newLocalToBodyTransforms = reinterpret_cast<Transform*>(newBroadPhaseIds + nbComponentsToAllocate);
     CollisionShape** newCollisionShapes = reinterpret_cast<CollisionShape**>(newLocalToBodyTransforms + nbComponentsToAllocate);
-    unsigned short* newCollisionCategoryBits = reinterpret_cast<unsigned short*>(newCollisionShapes + nbComponentsToAllocate);
-    unsigned short* newCollideWithMaskBits = reinterpret_cast<unsigned short*>(newCollisionCategoryBits + nbComponentsToAllocate);
-    Transform* newLocalToWorldTransforms = reinterpret_cast<Transform*>(newCollideWithMaskBits + nbComponentsToAllocate);
+    uint64* newCollisionCategoryBits = reinterpret_cast<uint64*>(newCollisionShapes + nbComponentsToAllocate);
+    uint64* newCollideWithMaskBits = reinterpret_cast<uint64*>(newCollisionCategoryBits + nbComponentsToAllocate);
+    int32* newCollisionGroups = reinterpret_cast<int32*>(newCollideWithMaskBits + nbComponentsToAllocate);
+    Transform* newLocalToWorldTransforms = reinterpret_cast<Transform*>(newCollisionGroups + nbComponentsToAllocate);
     Array<uint64>* newOverlappingPairs = reinterpret_cast<Array<uint64>*>(newLocalToWorldTransforms + nbComponentsToAllocate);
     bool* hasCollisionShapeChangedSize = reinterpret_cast<bool*>(newOverlappingPairs + nbComponentsToAllocate);
     bool* isTrigger = reinterpret_cast<bool*>(hasCollisionShapeChangedSize + nbComponentsToAllocate);
@@ -81,8 +82,9 @@ void ColliderComponents::allocate(uint32 nbComponentsToAllocate) {
         memcpy(newBroadPhaseIds, mBroadPhaseIds, mNbComponents * sizeof(int32));
         memcpy(newLocalToBodyTransforms, mLocalToBodyTransforms, mNbComponents * sizeof(Transform));
         memcpy(newCollisionShapes, mCollisionShapes, mNbComponents * sizeof(CollisionShape*));
-        memcpy(newCollisionCategoryBits, mCollisionCategoryBits, mNbComponents * sizeof(unsigned short));
-        memcpy(newCollideWithMaskBits, mCollideWithMaskBits, mNbComponents * sizeof(unsigned short));
+        memcpy(newCollisionCategoryBits, mCollisionCategoryBits, mNbComponents * sizeof(uint64));
+        memcpy(newCollideWithMaskBits, mCollideWithMaskBits, mNbComponents * sizeof(uint64));
+        memcpy(newCollisionGroups, mCollisionGroups, mNbComponents * sizeof(int32));
         memcpy(newLocalToWorldTransforms, mLocalToWorldTransforms, mNbComponents * sizeof(Transform));
         memcpy(newOverlappingPairs, mOverlappingPairs, mNbComponents * sizeof(Array<uint64>));
         memcpy(hasCollisionShapeChangedSize, mHasCollisionShapeChangedSize, mNbComponents * sizeof(bool));
@@ -103,6 +105,7 @@ void ColliderComponents::allocate(uint32 nbComponentsToAllocate) {
     mCollisionShapes = newCollisionShapes;
     mCollisionCategoryBits = newCollisionCategoryBits;
     mCollideWithMaskBits = newCollideWithMaskBits;
+    mCollisionGroups = newCollisionGroups;
     mLocalToWorldTransforms = newLocalToWorldTransforms;
     mOverlappingPairs = newOverlappingPairs;
     mHasCollisionShapeChangedSize = hasCollisionShapeChangedSize;
@@ -125,8 +128,9 @@ void ColliderComponents::addComponent(Entity colliderEntity, bool isSleeping, co
     new (mBroadPhaseIds + index) int32(-1);
     new (mLocalToBodyTransforms + index) Transform(component.localToBodyTransform);
     mCollisionShapes[index] = component.collisionShape;
-    new (mCollisionCategoryBits + index) unsigned short(component.collisionCategoryBits);
-    new (mCollideWithMaskBits + index) unsigned short(component.collideWithMaskBits);
+    new (mCollisionCategoryBits + index) uint64(component.collisionCategoryBits);
+    new (mCollideWithMaskBits + index) uint64(component.collideWithMaskBits);
+    new (mCollisionGroups + index) int32(0);
     new (mLocalToWorldTransforms + index) Transform(component.localToWorldTransform);
     new (mOverlappingPairs + index) Array<uint64>(mMemoryAllocator);
     mHasCollisionShapeChangedSize[index] = false;
@@ -154,8 +158,9 @@ void ColliderComponents::moveComponentToIndex(uint32 srcIndex, uint32 destIndex)
     new (mBroadPhaseIds + destIndex) int32(mBroadPhaseIds[srcIndex]);
     new (mLocalToBodyTransforms + destIndex) Transform(mLocalToBodyTransforms[srcIndex]);
     mCollisionShapes[destIndex] = mCollisionShapes[srcIndex];
-    new (mCollisionCategoryBits + destIndex) unsigned short(mCollisionCategoryBits[srcIndex]);
-    new (mCollideWithMaskBits + destIndex) unsigned short(mCollideWithMaskBits[srcIndex]);
+    new (mCollisionCategoryBits + destIndex) uint64(mCollisionCategoryBits[srcIndex]);
+    new (mCollideWithMaskBits + destIndex) uint64(mCollideWithMaskBits[srcIndex]);
+    new (mCollisionGroups + destIndex) int32(mCollisionGroups[srcIndex]);
     new (mLocalToWorldTransforms + destIndex) Transform(mLocalToWorldTransforms[srcIndex]);
     new (mOverlappingPairs + destIndex) Array<uint64>(mOverlappingPairs[srcIndex]);
     mHasCollisionShapeChangedSize[destIndex] = mHasCollisionShapeChangedSize[srcIndex];
@@ -183,8 +188,9 @@ void ColliderComponents::swapComponents(uint32 index1, uint32 index2) {
     int32 broadPhaseId1 = mBroadPhaseIds[index1];
     Transform localToBodyTransform1 = mLocalToBodyTransforms[index1];
     CollisionShape* collisionShape1 = mCollisionShapes[index1];
-    unsigned short collisionCategoryBits1 = mCollisionCategoryBits[index1];
-    unsigned short collideWithMaskBits1 = mCollideWithMaskBits[index1];
+    uint64 collisionCategoryBits1 = mCollisionCategoryBits[index1];
+    uint64 collideWithMaskBits1 = mCollideWithMaskBits[index1];
+    int32 collisionGroup1 = mCollisionGroups[index1];
     Transform localToWorldTransform1 = mLocalToWorldTransforms[index1];
     Array<uint64> overlappingPairs = mOverlappingPairs[index1];
     bool hasCollisionShapeChangedSize = mHasCollisionShapeChangedSize[index1];
@@ -203,8 +209,9 @@ void ColliderComponents::swapComponents(uint32 index1, uint32 index2) {
     new (mBroadPhaseIds + index2) int32(broadPhaseId1);
     new (mLocalToBodyTransforms + index2) Transform(localToBodyTransform1);
     mCollisionShapes[index2] = collisionShape1;
-    new (mCollisionCategoryBits + index2) unsigned short(collisionCategoryBits1);
-    new (mCollideWithMaskBits + index2) unsigned short(collideWithMaskBits1);
+    new (mCollisionCategoryBits + index2) uint64(collisionCategoryBits1);
+    new (mCollideWithMaskBits + index2) uint64(collideWithMaskBits1);
+    new (mCollisionGroups + index2) int32(collisionGroup1);
     new (mLocalToWorldTransforms + index2) Transform(localToWorldTransform1);
     new (mOverlappingPairs + index2) Array<uint64>(overlappingPairs);
     mHasCollisionShapeChangedSize[index2] = hasCollisionShapeChangedSize;
@@ -34,7 +34,7 @@ using namespace reactphysics3d;
 
 // Constructor
 HingeJointComponents::HingeJointComponents(MemoryAllocator& allocator)
-                    :Components(allocator, sizeof(Entity) + sizeof(HingeJoint*) + sizeof(Vector3) +
+                    :Components(allocator, sizeof(Entity) + sizeof(HingeJoint*) + sizeof(uint32) + sizeof(uint32) + sizeof(Vector3) +
                                 sizeof(Vector3) + sizeof(Vector3) + sizeof(Vector3) +
                                 sizeof(Matrix3x3) + sizeof(Matrix3x3) + sizeof(Vector3) +
                                 sizeof(Vector2) + sizeof(Matrix3x3) + sizeof(Matrix2x2) +
@@ -64,7 +64,9 @@ void HingeJointComponents::allocate(uint32 nbComponentsToAllocate) {
     // New pointers to components data
     Entity* newJointEntities = static_cast<Entity*>(newBuffer);
     HingeJoint** newJoints = reinterpret_cast<HingeJoint**>(newJointEntities + nbComponentsToAllocate);
-    Vector3* newLocalAnchorPointBody1 = reinterpret_cast<Vector3*>(newJoints + nbComponentsToAllocate);
+    uint32* newSolverBodyIndexBody1 = reinterpret_cast<uint32*>(newJoints + nbComponentsToAllocate);
+    uint32* newSolverBodyIndexBody2 = reinterpret_cast<uint32*>(newSolverBodyIndexBody1 + nbComponentsToAllocate);
+    Vector3* newLocalAnchorPointBody1 = reinterpret_cast<Vector3*>(newSolverBodyIndexBody2 + nbComponentsToAllocate);
     Vector3* newLocalAnchorPointBody2 = reinterpret_cast<Vector3*>(newLocalAnchorPointBody1 + nbComponentsToAllocate);
     Vector3* newR1World = reinterpret_cast<Vector3*>(newLocalAnchorPointBody2 + nbComponentsToAllocate);
     Vector3* newR2World = reinterpret_cast<Vector3*>(newR1World + nbComponentsToAllocate);
@@ -104,6 +106,8 @@ void HingeJointComponents::allocate(uint32 nbComponentsToAllocate) {
         // Copy component data from the previous buffer to the new one
         memcpy(newJointEntities, mJointEntities, mNbComponents * sizeof(Entity));
         memcpy(newJoints, mJoints, mNbComponents * sizeof(HingeJoint*));
+        memcpy(newSolverBodyIndexBody1, mSolverBodyIndexBody1, mNbComponents * sizeof(uint32));
+        memcpy(newSolverBodyIndexBody2, mSolverBodyIndexBody2, mNbComponents * sizeof(uint32));
         memcpy(newLocalAnchorPointBody1, mLocalAnchorPointBody1, mNbComponents * sizeof(Vector3));
         memcpy(newLocalAnchorPointBody2, mLocalAnchorPointBody2, mNbComponents * sizeof(Vector3));
         memcpy(newR1World, mR1World, mNbComponents * sizeof(Vector3));
@@ -145,6 +149,8 @@ void HingeJointComponents::allocate(uint32 nbComponentsToAllocate) {
     mBuffer = newBuffer;
     mJointEntities = newJointEntities;
     mJoints = newJoints;
+    mSolverBodyIndexBody1 = newSolverBodyIndexBody1;
+    mSolverBodyIndexBody2 = newSolverBodyIndexBody2;
     mNbAllocatedComponents = nbComponentsToAllocate;
     mLocalAnchorPointBody1 = newLocalAnchorPointBody1;
     mLocalAnchorPointBody2 = newLocalAnchorPointBody2;
@@ -190,6 +196,8 @@ void HingeJointComponents::addComponent(Entity jointEntity, bool isSleeping, con
     // Insert the new component data
     new (mJointEntities + index) Entity(jointEntity);
     mJoints[index] = nullptr;
+    mSolverBodyIndexBody1[index] = 0;
+    mSolverBodyIndexBody2[index] = 0;
     new (mLocalAnchorPointBody1 + index) Vector3(0, 0, 0);
     new (mLocalAnchorPointBody2 + index) Vector3(0, 0, 0);
     new (mR1World + index) Vector3(0, 0, 0);
@@ -242,6 +250,8 @@ void HingeJointComponents::moveComponentToIndex(uint32 srcIndex, uint32 destInde
     // Copy the data of the source component to the destination location
     new (mJointEntities + destIndex) Entity(mJointEntities[srcIndex]);
     mJoints[destIndex] = mJoints[srcIndex];
+    mSolverBodyIndexBody1[destIndex] = mSolverBodyIndexBody1[srcIndex];
+    mSolverBodyIndexBody2[destIndex] = mSolverBodyIndexBody2[srcIndex];
     new (mLocalAnchorPointBody1 + destIndex) Vector3(mLocalAnchorPointBody1[srcIndex]);
     new (mLocalAnchorPointBody2 + destIndex) Vector3(mLocalAnchorPointBody2[srcIndex]);
     new (mR1World + destIndex) Vector3(mR1World[srcIndex]);
@@ -293,6 +303,8 @@ void HingeJointComponents::swapComponents(uint32 index1, uint32 index2) {
     // Copy component 1 data
     Entity jointEntity1(mJointEntities[index1]);
     HingeJoint* joint1 = mJoints[index1];
+    uint32 solverBodyIndexBody1(mSolverBodyIndexBody1[index1]);
+    uint32 solverBodyIndexBody2(mSolverBodyIndexBody2[index1]);
     Vector3 localAnchorPointBody1(mLocalAnchorPointBody1[index1]);
     Vector3 localAnchorPointBody2(mLocalAnchorPointBody2[index1]);
     Vector3 r1World1(mR1World[index1]);
@@ -335,6 +347,8 @@ void HingeJointComponents::swapComponents(uint32 index1, uint32 index2) {
     // Reconstruct component 1 at component 2 location
     new (mJointEntities + index2) Entity(jointEntity1);
     mJoints[index2] = joint1;
+    mSolverBodyIndexBody1[index2] = solverBodyIndexBody1;
+    mSolverBodyIndexBody2[index2] = solverBodyIndexBody2;
     new (mLocalAnchorPointBody1 + index2) Vector3(localAnchorPointBody1);
     new (mLocalAnchorPointBody2 + index2) Vector3(localAnchorPointBody2);
     new (mR1World + index2) Vector3(r1World1);
@@ -43,7 +43,7 @@ RigidBodyComponents::RigidBodyComponents(MemoryAllocator& allocator)
                                 sizeof(Vector3) + + sizeof(Matrix3x3) + sizeof(Vector3) + sizeof(Vector3) +
                                 sizeof(Vector3) + sizeof(Vector3) + sizeof(Vector3) +
                                 sizeof(Quaternion) + sizeof(Vector3) + sizeof(Vector3) +
-                                sizeof(bool) + sizeof(bool) + sizeof(Array<Entity>) + sizeof(Array<uint>) +
+                                sizeof(bool) + sizeof(bool) + sizeof(bool) + sizeof(Array<Entity>) + sizeof(Array<uint>) +
                                 sizeof(Vector3) + sizeof(Vector3)) {
 
     // Allocate memory for the components data
@@ -90,7 +90,8 @@ void RigidBodyComponents::allocate(uint32 nbComponentsToAllocate) {
     Vector3* newCentersOfMassWorld = reinterpret_cast<Vector3*>(newCentersOfMassLocal + nbComponentsToAllocate);
     bool* newIsGravityEnabled = reinterpret_cast<bool*>(newCentersOfMassWorld + nbComponentsToAllocate);
     bool* newIsAlreadyInIsland = reinterpret_cast<bool*>(newIsGravityEnabled + nbComponentsToAllocate);
-    Array<Entity>* newJoints = reinterpret_cast<Array<Entity>*>(newIsAlreadyInIsland + nbComponentsToAllocate);
+    bool* newIsContinuousCollisionDetectionEnabled = reinterpret_cast<bool*>(newIsAlreadyInIsland + nbComponentsToAllocate);
+    Array<Entity>* newJoints = reinterpret_cast<Array<Entity>*>(newIsContinuousCollisionDetectionEnabled + nbComponentsToAllocate);
     Array<uint>* newContactPairs = reinterpret_cast<Array<uint>*>(newJoints + nbComponentsToAllocate);
     Vector3* newLinearLockAxisFactors = reinterpret_cast<Vector3*>(newContactPairs + nbComponentsToAllocate);
     Vector3* newAngularLockAxisFactors = reinterpret_cast<Vector3*>(newLinearLockAxisFactors + nbComponentsToAllocate);
@@ -126,6 +127,7 @@ void RigidBodyComponents::allocate(uint32 nbComponentsToAllocate) {
         memcpy(newCentersOfMassWorld, mCentersOfMassWorld, mNbComponents * sizeof(Vector3));
         memcpy(newIsGravityEnabled, mIsGravityEnabled, mNbComponents * sizeof(bool));
         memcpy(newIsAlreadyInIsland, mIsAlreadyInIsland, mNbComponents * sizeof(bool));
+        memcpy(newIsContinuousCollisionDetectionEnabled, mIsContinuousCollisionDetectionEnabled, mNbComponents * sizeof(bool));
         memcpy(newJoints, mJoints, mNbComponents * sizeof(Array<Entity>));
         memcpy(newContactPairs, mContactPairs, mNbComponents * sizeof(Array<uint>));
         memcpy(newLinearLockAxisFactors, mLinearLockAxisFactors, mNbComponents * sizeof(Vector3));
@@ -164,6 +166,7 @@ void RigidBodyComponents::allocate(uint32 nbComponentsToAllocate) {
     mCentersOfMassWorld = newCentersOfMassWorld;
     mIsGravityEnabled = newIsGravityEnabled;
     mIsAlreadyInIsland = newIsAlreadyInIsland;
+    mIsContinuousCollisionDetectionEnabled = newIsContinuousCollisionDetectionEnabled;
     mJoints = newJoints;
     mContactPairs = newContactPairs;
     mLinearLockAxisFactors = newLinearLockAxisFactors;
@@ -204,6 +207,7 @@ void RigidBodyComponents::addComponent(Entity bodyEntity, bool isSleeping, const
     new (mCentersOfMassWorld + index) Vector3(component.worldPosition);
     mIsGravityEnabled[index] = true;
     mIsAlreadyInIsland[index] = false;
+    mIsContinuousCollisionDetectionEnabled[index] = false;
     new (mJoints + index) Array<Entity>(mMemoryAllocator);
     new (mContactPairs + index) Array<uint>(mMemoryAllocator);
     new (mLinearLockAxisFactors + index) Vector3(1, 1, 1);
@@ -252,6 +256,7 @@ void RigidBodyComponents::moveComponentToIndex(uint32 srcIndex, uint32 destIndex
     new (mCentersOfMassWorld + destIndex) Vector3(mCentersOfMassWorld[srcIndex]);
     mIsGravityEnabled[destIndex] = mIsGravityEnabled[srcIndex];
     mIsAlreadyInIsland[destIndex] = mIsAlreadyInIsland[srcIndex];
+    mIsContinuousCollisionDetectionEnabled[destIndex] = mIsContinuousCollisionDetectionEnabled[srcIndex];
     new (mJoints + destIndex) Array<Entity>(mJoints[srcIndex]);
     new (mContactPairs + destIndex) Array<uint>(mContactPairs[srcIndex]);
     new (mLinearLockAxisFactors + destIndex) Vector3(mLinearLockAxisFactors[srcIndex]);
@@ -299,6 +304,7 @@ void RigidBodyComponents::swapComponents(uint32 index1, uint32 index2) {
     Vector3 centerOfMassWorld1 = mCentersOfMassWorld[index1];
     bool isGravityEnabled1 = mIsGravityEnabled[index1];
     bool isAlreadyInIsland1 = mIsAlreadyInIsland[index1];
+    bool isContinuousCollisionDetectionEnabled1 = mIsContinuousCollisionDetectionEnabled[index1];
     Array<Entity> joints1 = mJoints[index1];
     Array<uint> contactPairs1 = mContactPairs[index1];
     Vector3 linearLockAxisFactor1(mLinearLockAxisFactors[index1]);
@@ -337,6 +343,7 @@ void RigidBodyComponents::swapComponents(uint32 index1, uint32 index2) {
     mCentersOfMassWorld[index2] = centerOfMassWorld1;
     mIsGravityEnabled[index2] = isGravityEnabled1;
     mIsAlreadyInIsland[index2] = isAlreadyInIsland1;
+    mIsContinuousCollisionDetectionEnabled[index2] = isContinuousCollisionDetectionEnabled1;
     new (mJoints + index2) Array<Entity>(joints1);
     new (mContactPairs + index2) Array<uint>(contactPairs1);
     new (mLinearLockAxisFactors + index2) Vector3(linearLockAxisFactor1);
@@ -34,7 +34,7 @@ using namespace reactphysics3d;
 
 // Constructor
 SliderJointComponents::SliderJointComponents(MemoryAllocator& allocator)
-                    :Components(allocator, sizeof(Entity) + sizeof(SliderJoint*) + sizeof(Vector3) +
+                    :Components(allocator, sizeof(Entity) + sizeof(SliderJoint*) + sizeof(uint32) + sizeof(uint32) + sizeof(Vector3) +
                                 sizeof(Vector3) +
                                 sizeof(Matrix3x3) + sizeof(Matrix3x3) + sizeof(Vector2) +
                                 sizeof(Vector3) + sizeof(Matrix2x2) + sizeof(Matrix3x3) +
@@ -66,7 +66,9 @@ void SliderJointComponents::allocate(uint32 nbComponentsToAllocate) {
     // New pointers to components data
     Entity* newJointEntities = static_cast<Entity*>(newBuffer);
     SliderJoint** newJoints = reinterpret_cast<SliderJoint**>(newJointEntities + nbComponentsToAllocate);
-    Vector3* newLocalAnchorPointBody1 = reinterpret_cast<Vector3*>(newJoints + nbComponentsToAllocate);
+    uint32* newSolverBodyIndexBody1 = reinterpret_cast<uint32*>(newJoints + nbComponentsToAllocate);
+    uint32* newSolverBodyIndexBody2 = reinterpret_cast<uint32*>(newSolverBodyIndexBody1 + nbComponentsToAllocate);
+    Vector3* newLocalAnchorPointBody1 = reinterpret_cast<Vector3*>(newSolverBodyIndexBody2 + nbComponentsToAllocate);
     Vector3* newLocalAnchorPointBody2 = reinterpret_cast<Vector3*>(newLocalAnchorPointBody1 + nbComponentsToAllocate);
     Matrix3x3* newI1 = reinterpret_cast<Matrix3x3*>(newLocalAnchorPointBody2 + nbComponentsToAllocate);
     Matrix3x3* newI2 = reinterpret_cast<Matrix3x3*>(newI1 + nbComponentsToAllocate);
@@ -111,6 +113,8 @@ void SliderJointComponents::allocate(uint32 nbComponentsToAllocate) {
         // Copy component data from the previous buffer to the new one
         memcpy(newJointEntities, mJointEntities, mNbComponents * sizeof(Entity));
         memcpy(newJoints, mJoints, mNbComponents * sizeof(SliderJoint*));
+        memcpy(newSolverBodyIndexBody1, mSolverBodyIndexBody1, mNbComponents * sizeof(uint32));
+        memcpy(newSolverBodyIndexBody2, mSolverBodyIndexBody2, mNbComponents * sizeof(uint32));
         memcpy(newLocalAnchorPointBody1, mLocalAnchorPointBody1, mNbComponents * sizeof(Vector3));
         memcpy(newLocalAnchorPointBody2, mLocalAnchorPointBody2, mNbComponents * sizeof(Vector3));
         memcpy(newI1, mI1, mNbComponents * sizeof(Matrix3x3));
@@ -157,6 +161,8 @@ void SliderJointComponents::allocate(uint32 nbComponentsToAllocate) {
     mBuffer = newBuffer;
     mJointEntities = newJointEntities;
     mJoints = newJoints;
+    mSolverBodyIndexBody1 = newSolverBodyIndexBody1;
+    mSolverBodyIndexBody2 = newSolverBodyIndexBody2;
     mNbAllocatedComponents = nbComponentsToAllocate;
     mLocalAnchorPointBody1 = newLocalAnchorPointBody1;
     mLocalAnchorPointBody2 = newLocalAnchorPointBody2;
@@ -207,6 +213,8 @@ void SliderJointComponents::addComponent(Entity jointEntity, bool isSleeping, co
     // Insert the new component data
     new (mJointEntities + index) Entity(jointEntity);
     mJoints[index] = nullptr;
+    mSolverBodyIndexBody1[index] = 0;
+    mSolverBodyIndexBody2[index] = 0;
     new (mLocalAnchorPointBody1 + index) Vector3(0, 0, 0);
     new (mLocalAnchorPointBody2 + index) Vector3(0, 0, 0);
     new (mI1 + index) Matrix3x3();
@@ -264,6 +272,8 @@ void SliderJointComponents::moveComponentToIndex(uint32 srcIndex, uint32 destInd
     // Copy the data of the source component to the destination location
     new (mJointEntities + destIndex) Entity(mJointEntities[srcIndex]);
     mJoints[destIndex] = mJoints[srcIndex];
+    mSolverBodyIndexBody1[destIndex] = mSolverBodyIndexBody1[srcIndex];
+    mSolverBodyIndexBody2[destIndex] = mSolverBodyIndexBody2[srcIndex];
     new (mLocalAnchorPointBody1 + destIndex) Vector3(mLocalAnchorPointBody1[srcIndex]);
     new (mLocalAnchorPointBody2 + destIndex) Vector3(mLocalAnchorPointBody2[srcIndex]);
     new (mI1 + destIndex) Matrix3x3(mI1[srcIndex]);
@@ -320,6 +330,8 @@ void SliderJointComponents::swapComponents(uint32 index1, uint32 index2) {
     // Copy component 1 data
     Entity jointEntity1(mJointEntities[index1]);
     SliderJoint* joint1 = mJoints[index1];
+    uint32 solverBodyIndexBody1(mSolverBodyIndexBody1[index1]);
+    uint32 solverBodyIndexBody2(mSolverBodyIndexBody2[index1]);
     Vector3 localAnchorPointBody1(mLocalAnchorPointBody1[index1]);
     Vector3 localAnchorPointBody2(mLocalAnchorPointBody2[index1]);
     Matrix3x3 i11(mI1[index1]);
@@ -367,6 +379,8 @@ void SliderJointComponents::swapComponents(uint32 index1, uint32 index2) {
     // Reconstruct component 1 at component 2 location
     new (mJointEntities + index2) Entity(jointEntity1);
     mJoints[index2] = joint1;
+    mSolverBodyIndexBody1[index2] = solverBodyIndexBody1;
+    mSolverBodyIndexBody2[index2] = solverBodyIndexBody2;
     new (mLocalAnchorPointBody1 + index2) Vector3(localAnchorPointBody1);
     new (mLocalAnchorPointBody2 + index2) Vector3(localAnchorPointBody2);
     new (mI1 + index2) Matrix3x3(i11);
@@ -157,7 +157,7 @@ uint64 OverlappingPairs::addPair(uint32 collider1Index, uint32 collider2Index, b
     if (isConvexVsConvex) {
 
         assert(!mMapConvexPairIdToPairIndex.containsKey(pairId));
-        NarrowPhaseAlgorithmType algorithmType = mCollisionDispatch.selectNarrowPhaseAlgorithm(collisionShape1->getType(), collisionShape2->getType());
+        NarrowPhaseAlgorithmType algorithmType = mCollisionDispatch.selectNarrowPhaseAlgorithm(collisionShape1, collisionShape2);
 
         // Map the entity with the new component lookup index
         mMapConvexPairIdToPairIndex.add(Pair<uint64, uint64>(pairId, mConvexPairs.size()));
@@ -170,8 +170,7 @@ uint64 OverlappingPairs::addPair(uint32 collider1Index, uint32 collider2Index, b
         const bool isShape1Convex = collisionShape1->isConvex();
 
         assert(!mMapConcavePairIdToPairIndex.containsKey(pairId));
-        NarrowPhaseAlgorithmType algorithmType = mCollisionDispatch.selectNarrowPhaseAlgorithm(isShape1Convex ? collisionShape1->getType() : collisionShape2->getType(),
-                                                                      CollisionShapeType::CONVEX_POLYHEDRON);
+        NarrowPhaseAlgorithmType algorithmType = mCollisionDispatch.selectConvexVsConcaveNarrowPhaseAlgorithm(isShape1Convex ? collisionShape1 : collisionShape2);
         // Map the entity with the new component lookup index
         mMapConcavePairIdToPairIndex.add(Pair<uint64, uint64>(pairId, mConcavePairs.size()));
 
@@ -39,7 +39,9 @@ PhysicsCommon::PhysicsCommon(MemoryAllocator* baseMemoryAllocator)
               : mMemoryManager(baseMemoryAllocator),
                 mPhysicsWorlds(mMemoryManager.getHeapAllocator()), mSphereShapes(mMemoryManager.getHeapAllocator()),
                 mBoxShapes(mMemoryManager.getHeapAllocator()), mCapsuleShapes(mMemoryManager.getHeapAllocator()),
+                mCylinderShapes(mMemoryManager.getHeapAllocator()), mConeShapes(mMemoryManager.getHeapAllocator()),
                 mConvexMeshShapes(mMemoryManager.getHeapAllocator()), mConcaveMeshShapes(mMemoryManager.getHeapAllocator()),
+                mConcaveMeshesData(mMemoryManager.getHeapAllocator()),
                 mHeightFieldShapes(mMemoryManager.getHeapAllocator()), mPolyhedronMeshes(mMemoryManager.getHeapAllocator()),
                 mTriangleMeshes(mMemoryManager.getHeapAllocator()),
                 mProfilers(mMemoryManager.getHeapAllocator()), mDefaultLoggers(mMemoryManager.getHeapAllocator()),
@@ -154,6 +156,18 @@ void PhysicsCommon::release() {
     }
     mCapsuleShapes.clear();
 
+    // Destroy the cylinder shapes
+    for (auto it = mCylinderShapes.begin(); it != mCylinderShapes.end(); ++it) {
+        deleteCylinderShape(*it);
+    }
+    mCylinderShapes.clear();
+
+    // Destroy the cone shapes
+    for (auto it = mConeShapes.begin(); it != mConeShapes.end(); ++it) {
+        deleteConeShape(*it);
+    }
+    mConeShapes.clear();
+
     // Destroy the convex mesh shapes
     for (auto it = mConvexMeshShapes.begin(); it != mConvexMeshShapes.end(); ++it) {
         deleteConvexMeshShape(*it);
@@ -412,6 +426,122 @@ void PhysicsCommon::deleteCapsuleShape(CapsuleShape* capsuleShape) {
    mMemoryManager.release(MemoryManager::AllocationType::Pool, capsuleShape, sizeof(CapsuleShape));
 }
 
+// Create and return a cylinder shape
+/**
+ * @param radius The radius of the cylinder shape
+ * @param height The height of the cylinder shape (along the local y axis)
+ * @return cylinderShape A pointer to the created cylinder shape
+ */
+CylinderShape* PhysicsCommon::createCylinderShape(decimal radius, decimal height) {
+
+    if (radius <= decimal(0.0)) {
+
+        RP3D_LOG("PhysicsCommon", Logger::Level::Error, Logger::Category::PhysicCommon,
+                 "Error when creating a CylinderShape: radius must be a positive value",  __FILE__, __LINE__);
+    }
+
+    if (height <= decimal(0.0)) {
+
+        RP3D_LOG("PhysicsCommon", Logger::Level::Error, Logger::Category::PhysicCommon,
+                 "Error when creating a CylinderShape: height must be a positive value",  __FILE__, __LINE__);
+    }
+
+    CylinderShape* shape = new (mMemoryManager.allocate(MemoryManager::AllocationType::Pool, sizeof(CylinderShape))) CylinderShape(radius, height, mMemoryManager.getHeapAllocator());
+
+    mCylinderShapes.add(shape);
+
+    return shape;
+}
+
+// Destroy a cylinder collision shape
+/**
+ * @param cylinderShape A pointer to the cylinder shape to destroy
+ */
+void PhysicsCommon::destroyCylinderShape(CylinderShape* cylinderShape) {
+
+    deleteCylinderShape(cylinderShape);
+
+    mCylinderShapes.remove(cylinderShape);
+}
+
+// Delete a cylinder collision shape
+/**
+ * @param cylinderShape A pointer to the cylinder shape to destroy
+ */
+void PhysicsCommon::deleteCylinderShape(CylinderShape* cylinderShape) {
+
+    // If the shape is still part of some colliders
+    if (cylinderShape->mColliders.size() > 0) {
+
+        RP3D_LOG("PhysicsCommon", Logger::Level::Error, Logger::Category::PhysicCommon,
+                 "Error when destroying the CylinderShape because it is still used by some colliders",  __FILE__, __LINE__);
+    }
+
+   // Call the destructor of the shape
+   cylinderShape->~CylinderShape();
+
+   // Release allocated memory
+   mMemoryManager.release(MemoryManager::AllocationType::Pool, cylinderShape, sizeof(CylinderShape));
+}
+
+// Create and return a cone shape
+/**
+ * @param radius The radius of the base of the cone shape
+ * @param height The height of the cone shape (distance between the base and the apex)
+ * @return coneShape A pointer to the created cone shape
+ */
+ConeShape* PhysicsCommon::createConeShape(decimal radius, decimal height) {
+
+    if (radius <= decimal(0.0)) {
+
+        RP3D_LOG("PhysicsCommon", Logger::Level::Error, Logger::Category::PhysicCommon,
+                 "Error when creating a ConeShape: radius must be a positive value",  __FILE__, __LINE__);
+    }
+
+    if (height <= decimal(0.0)) {
+
+        RP3D_LOG("PhysicsCommon", Logger::Level::Error, Logger::Category::PhysicCommon,
+                 "Error when creating a ConeShape: height must be a positive value",  __FILE__, __LINE__);
+    }
+
+    ConeShape* shape = new (mMemoryManager.allocate(MemoryManager::AllocationType::Pool, sizeof(ConeShape))) ConeShape(radius, height, mMemoryManager.getHeapAllocator());
+
+    mConeShapes.add(shape);
+
+    return shape;
+}
+
+// Destroy a cone collision shape
+/**
+ * @param coneShape A pointer to the cone shape to destroy
+ */
+void PhysicsCommon::destroyConeShape(ConeShape* coneShape) {
+
+    deleteConeShape(coneShape);
+
+    mConeShapes.remove(coneShape);
+}
+
+// Delete a cone collision shape
+/**
+ * @param coneShape A pointer to the cone shape to destroy
+ */
+void PhysicsCommon::deleteConeShape(ConeShape* coneShape) {
+
+    // If the shape is still part of some colliders
+    if (coneShape->mColliders.size() > 0) {
+
+        RP3D_LOG("PhysicsCommon", Logger::Level::Error, Logger::Category::PhysicCommon,
+                 "Error when destroying the ConeShape because it is still used by some colliders",  __FILE__, __LINE__);
+    }
+
+   // Call the destructor of the shape
+   coneShape->~ConeShape();
+
+   // Release allocated memory
+   mMemoryManager.release(MemoryManager::AllocationType::Pool, coneShape, sizeof(ConeShape));
+}
+
 // Create and return a convex mesh shape
 /**
  * @param polyhedronMesh A pointer to the polyhedron mesh used to create the convex shape
@@ -465,17 +595,21 @@ void PhysicsCommon::deleteConvexMeshShape(ConvexMeshShape* convexMeshShape) {
  * @param minHeight Minimum height value of the height field
  * @param maxHeight Maximum height value of the height field
  * @param heightFieldData Pointer to the first height value data (note that values are shared and not copied)
- * @param dataType Data type for the height values (int, float, double)
+ * @param dataType Data type for the height values (int, uint16, float, double)
  * @param upAxis Integer representing the up axis direction (0 for x, 1 for y and 2 for z)
  * @param integerHeightScale Scaling factor used to scale the height values (only when height values type is integer)
+ * @param scaling Scaling factor of the vertices of the height field
+ * @param integerHeightOffset Offset added to the scaled height values (only when height values type is integer)
  * @return A pointer to the created height field shape
  */
 HeightFieldShape* PhysicsCommon::createHeightFieldShape(int nbGridColumns, int nbGridRows, decimal minHeight, decimal maxHeight,
                                          const void* heightFieldData, HeightFieldShape::HeightDataType dataType,
-                                         int upAxis, decimal integerHeightScale, const Vector3& scaling) {
+                                         int upAxis, decimal integerHeightScale, const Vector3& scaling,
+                                         decimal integerHeightOffset) {
 
     HeightFieldShape* shape = new (mMemoryManager.allocate(MemoryManager::AllocationType::Pool, sizeof(HeightFieldShape))) HeightFieldShape(nbGridColumns, nbGridRows, minHeight, maxHeight,
-                                         heightFieldData, dataType, mMemoryManager.getHeapAllocator(), mTriangleShapeHalfEdgeStructure, upAxis, integerHeightScale, scaling);
+                                         heightFieldData, dataType, mMemoryManager.getHeapAllocator(), mTriangleShapeHalfEdgeStructure, upAxis, integerHeightScale, scaling,
+                                         integerHeightOffset);
 
     mHeightFieldShapes.add(shape);
 
@@ -514,15 +648,80 @@ void PhysicsCommon::deleteHeightFieldShape(HeightFieldShape* heightFieldShape) {
 }
 
 // Create and return a concave mesh shape
+/// The AABB tree and the convex edges of the triangles are shared by all the shapes created
+/// from the same triangle mesh (with the same compressVertices value) whatever their scaling.
 /**
  * @param triangleMesh A pointer to the triangle mesh to use to create the concave mesh shape
  * @param scaling An optional scaling factor to scale the triangle mesh
+ * @param compressVertices True if the shape must store a compressed copy (quantized on 16 bits) of the vertices
+ *                         of the mesh. In this case, the triangle mesh is only used to create the shape and it can be
+ *                         destroyed (and its vertices and indices arrays freed) after the creation of the shape.
  * @return A pointer to the created concave mesh shape
  */
-ConcaveMeshShape* PhysicsCommon::createConcaveMeshShape(TriangleMesh* triangleMesh, const Vector3& scaling) {
+ConcaveMeshShape* PhysicsCommon::createConcaveMeshShape(TriangleMesh* triangleMesh, const Vector3& scaling, bool compressVertices) {
+
+    // Get the data of the mesh if it has already been created for another shape
+    ConcaveMeshData* meshData;
+    auto it = mConcaveMeshesData.find(Pair<const void*, bool>(triangleMesh, compressVertices));
+    if (it != mConcaveMeshesData.end()) {
+        meshData = it->second;
+    }
+    else {
+
+        // Create the data of the mesh (AABB tree, convex edges and compressed vertices)
+        meshData = new (mMemoryManager.allocate(MemoryManager::AllocationType::Pool, sizeof(ConcaveMeshData)))
+                ConcaveMeshData(triangleMesh, mMemoryManager.getHeapAllocator(), compressVertices);
+
+        mConcaveMeshesData.add(Pair<Pair<const void*, bool>, ConcaveMeshData*>(Pair<const void*, bool>(triangleMesh, compressVertices), meshData));
+    }
+
+    return createConcaveMeshShapeWithData(meshData, scaling);
+}
+
+// Create and return a concave mesh shape from cooked data
+/// The cooked data must have been created with the ConcaveMeshShape::cook() method. The cooked
+/// data is not copied and must remain valid until the shape is destroyed. This allows to
+/// use a memory-mapped file that is shared between several processes for instance.
+/**
+ * @param cookedData A pointer to the cooked data of the mesh (aligned on 8 bytes)
+ * @param cookedDataSize The size (in bytes) of the cooked data
+ * @param scaling An optional scaling factor to scale the triangle mesh
+ * @return A pointer to the created concave mesh shape or nullptr if the cooked data is not valid
+ */
+ConcaveMeshShape* PhysicsCommon::createConcaveMeshShapeFromCooked(const void* cookedData, size_t cookedDataSize, const Vector3& scaling) {
+
+    if (!ConcaveMeshShape::isCookedDataValid(cookedData, cookedDataSize)) {
+
+        RP3D_LOG("PhysicsCommon", Logger::Level::Error, Logger::Category::PhysicCommon,
+                 "Error when creating a ConcaveMeshShape: the cooked data is not valid",  __FILE__, __LINE__);
 
-    ConcaveMeshShape* shape = new (mMemoryManager.allocate(MemoryManager::AllocationType::Pool, sizeof(ConcaveMeshShape))) ConcaveMeshShape(triangleMesh,
+        return nullptr;
+    }
+
+    // Get the data of the mesh if it has already been created for another shape
+    ConcaveMeshData* meshData;
+    auto it = mConcaveMeshesData.find(Pair<const void*, bool>(cookedData, false));
+    if (it != mConcaveMeshesData.end()) {
+        meshData = it->second;
+    }
+    else {
+
+        // Create the data of the mesh that points into the cooked data
+        meshData = new (mMemoryManager.allocate(MemoryManager::AllocationType::Pool, sizeof(ConcaveMeshData)))
+                ConcaveMeshData(cookedData, mMemoryManager.getHeapAllocator());
+
+        mConcaveMeshesData.add(Pair<Pair<const void*, bool>, ConcaveMeshData*>(Pair<const void*, bool>(cookedData, false), meshData));
+    }
+
+    return createConcaveMeshShapeWithData(meshData, scaling);
+}
+
+// Create a concave mesh shape using the shared data of a mesh
+ConcaveMeshShape* PhysicsCommon::createConcaveMeshShapeWithData(ConcaveMeshData* meshData, const Vector3& scaling) {
+
+    ConcaveMeshShape* shape = new (mMemoryManager.allocate(MemoryManager::AllocationType::Pool, sizeof(ConcaveMeshShape))) ConcaveMeshShape(meshData,
                                                                                                                                             mMemoryManager.getHeapAllocator(), mTriangleShapeHalfEdgeStructure, scaling);
+    meshData->mNbShapes++;
 
     mConcaveMeshShapes.add(shape);
 
@@ -553,11 +752,27 @@ void PhysicsCommon::deleteConcaveMeshShape(ConcaveMeshShape* concaveMeshShape) {
                  "Error when destroying the ConcaveMeshShape because it is still used by some colliders",  __FILE__, __LINE__);
     }
 
+   ConcaveMeshData* meshData = concaveMeshShape->mMeshData;
+
    // Call the destructor of the shape
    concaveMeshShape->~ConcaveMeshShape();
 
    // Release allocated memory
    mMemoryManager.release(MemoryManager::AllocationType::Pool, concaveMeshShape, sizeof(ConcaveMeshShape));
+
+   // If it was the last shape using the data of the mesh, we destroy the data
+   assert(meshData->mNbShapes > 0);
+   meshData->mNbShapes--;
+   if (meshData->mNbShapes == 0) {
+
+       // The data is not in the map anymore if its triangle mesh has already been destroyed
+       if (meshData->mSource != nullptr) {
+           mConcaveMeshesData.remove(Pair<const void*, bool>(meshData->mSource, meshData->mAreVerticesCompressed));
+       }
+
+       meshData->~ConcaveMeshData();
+       mMemoryManager.release(MemoryManager::AllocationType::Pool, meshData, sizeof(ConcaveMeshData));
+   }
 }
 
 // Create a polyhedron mesh
@@ -579,6 +794,33 @@ PolyhedronMesh* PhysicsCommon::createPolyhedronMesh(PolygonVertexArray* polygonV
     return mesh;
 }
 
+// Create a polyhedron mesh from the convex hull of a cloud of points
+/// The hull is computed with the Quickhull algorithm and its coplanar faces are merged. The
+/// polyhedron mesh owns the vertices and faces of the hull, so the points do not have to remain
+/// valid after this call. With a maximum number of vertices, the farthest points are added first
+/// and the result is a simplified hull with fewer vertices and faces, which is faster for the
+/// collision detection.
+/**
+ * @param points Pointer to the array of points
+ * @param nbPoints Number of points in the array
+ * @param maxNbVertices Maximum number of vertices of the hull (zero for no limit)
+ * @return A pointer to the created polyhedron mesh or nullptr if the points are all coplanar
+ */
+PolyhedronMesh* PhysicsCommon::createConvexHull(const Vector3* points, uint32 nbPoints, uint32 maxNbVertices) {
+
+    // Create the polyhedron mesh
+    PolyhedronMesh* mesh = PolyhedronMesh::createConvexHull(points, nbPoints, maxNbVertices, mMemoryManager.getPoolAllocator(),
+                                                            mMemoryManager.getHeapAllocator());
+
+    // If the mesh is valid
+    if (mesh != nullptr) {
+
+        mPolyhedronMeshes.add(mesh);
+    }
+
+    return mesh;
+}
+
 // Destroy a polyhedron mesh
 /**
  * @param polyhedronMesh A pointer to the polyhedron mesh to destroy
@@ -622,6 +864,14 @@ TriangleMesh* PhysicsCommon::createTriangleMesh() {
  */
 void PhysicsCommon::destroyTriangleMesh(TriangleMesh* triangleMesh) {
 
+    // The compressed data of the mesh does not use the triangle mesh and remains valid for its shapes. We
+    // only remove it from the map so that it is not shared with a new triangle mesh at the same address.
+    auto it = mConcaveMeshesData.find(Pair<const void*, bool>(triangleMesh, true));
+    if (it != mConcaveMeshesData.end()) {
+        it->second->mSource = nullptr;
+        mConcaveMeshesData.remove(it);
+    }
+
     deleteTriangleMesh(triangleMesh);
 
     mTriangleMeshes.remove(triangleMesh);
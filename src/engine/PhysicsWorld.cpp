@@ -65,9 +65,10 @@ PhysicsWorld::PhysicsWorld(MemoryManager& memoryManager, PhysicsCommon& physicsC
                                         mMemoryManager, physicsCommon.mTriangleShapeHalfEdgeStructure),
                 mCollisionBodies(mMemoryManager.getHeapAllocator()), mEventListener(nullptr),
                 mName(worldSettings.worldName),  mIslands(mMemoryManager.getSingleFrameAllocator()), mProcessContactPairsOrderIslands(mMemoryManager.getSingleFrameAllocator()),
-                mContactSolverSystem(mMemoryManager, *this, mIslands, mCollisionBodyComponents, mRigidBodyComponents,
+                mSolverBodies(mMemoryManager.getSingleFrameAllocator(), mRigidBodyComponents),
+                mContactSolverSystem(mMemoryManager, *this, mIslands, mSolverBodies, mCollisionBodyComponents, mRigidBodyComponents,
                                mCollidersComponents, mConfig.restitutionVelocityThreshold),
-                mConstraintSolverSystem(*this, mIslands, mRigidBodyComponents, mTransformComponents, mJointsComponents,
+                mConstraintSolverSystem(*this, mIslands, mSolverBodies, mRigidBodyComponents, mTransformComponents, mJointsComponents,
                                         mBallAndSocketJointsComponents, mFixedJointsComponents, mHingeJointsComponents,
                                         mSliderJointsComponents),
                 mDynamicsSystem(*this, mCollisionBodyComponents, mRigidBodyComponents, mTransformComponents, mCollidersComponents, mIsGravityEnabled, mConfig.gravity),
@@ -219,6 +220,8 @@ void PhysicsWorld::destroyCollisionBody(CollisionBody* collisionBody) {
     // Remove all the collision shapes of the body
     collisionBody->removeAllColliders();
 
+    mCollisionDetection.setIsBodyCompound(collisionBody->getEntity(), false);
+
     mCollisionBodyComponents.removeComponent(collisionBody->getEntity());
     mTransformComponents.removeComponent(collisionBody->getEntity());
     mEntityManager.destroyEntity(collisionBody->getEntity());
@@ -351,6 +354,9 @@ void PhysicsWorld::update(decimal timeStep) {
     // Solve the position correction for constraints
     solvePositionCorrection();
 
+    // Prevent the fast bodies from tunneling through static bodies
+    solveContinuousCollisionDetection();
+
     // Update the state (positions and velocities) of the bodies
     mDynamicsSystem.updateBodiesState();
 
@@ -394,6 +400,9 @@ void PhysicsWorld::solveContactsAndConstraints(decimal timeStep) {
 
     // ---------- Solve velocity constraints for joints and contacts ---------- //
 
+    // Copy the state of the bodies of the islands into the solver bodies
+    mSolverBodies.create(mIslands);
+
     // Initialize the contact solver
     mContactSolverSystem.init(mCollisionDetection.mCurrentContactManifolds, mCollisionDetection.mCurrentContactPoints, timeStep);
 
@@ -410,6 +419,10 @@ void PhysicsWorld::solveContactsAndConstraints(decimal timeStep) {
 
     mContactSolverSystem.storeImpulses();
 
+    // Copy the solved velocities back into the rigid body components
+    mSolverBodies.storeVelocities();
+    mSolverBodies.clear();
+
     // Reset the contact solver
     mContactSolverSystem.reset();
 }
@@ -429,6 +442,96 @@ void PhysicsWorld::solvePositionCorrection() {
     }
 }
 
+// Clamp the motion of the fast bodies with continuous collision detection enabled
+/// A body that moves farther than the distance between its center of mass and the closest face
+/// of its local AABB during the step could skip over a thin static body. For such a body, the
+/// colliders are swept along the translation of the body (with their orientation at the end of
+/// the step) and the time of impact against the colliders of the static bodies (convex or concave)
+/// is computed with the GJK conservative advancement. The body is then stopped slightly inside the
+/// first static collider hit. The velocities are kept so that the discrete contact created at the
+/// next step resolves the impact. The angular motion is not swept and the collisions between
+/// dynamic bodies are left to the discrete collision detection.
+void PhysicsWorld::solveContinuousCollisionDetection() {
+
+    RP3D_PROFILE("PhysicsWorld::solveContinuousCollisionDetection()", mProfiler);
+
+    const uint32 nbRigidBodyComponents = mRigidBodyComponents.getNbEnabledComponents();
+    for (uint32 i=0; i < nbRigidBodyComponents; i++) {
+
+        if (!mRigidBodyComponents.mIsContinuousCollisionDetectionEnabled[i] ||
+            mRigidBodyComponents.mBodyTypes[i] != BodyType::DYNAMIC) {
+            continue;
+        }
+
+        const Vector3& startPosition = mRigidBodyComponents.mCentersOfMassWorld[i];
+        const Vector3 motion = mRigidBodyComponents.mConstrainedPositions[i] - startPosition;
+        const decimal motionLengthSquare = motion.lengthSquare();
+        if (motionLengthSquare < MACHINE_EPSILON) continue;
+
+        const Entity bodyEntity = mRigidBodyComponents.mBodiesEntities[i];
+        const Array<Entity>& colliderEntities = mCollisionBodyComponents.getColliders(bodyEntity);
+        if (colliderEntities.size() == 0) continue;
+
+        // Compute the local-space AABB of the body
+        AABB bodyAABB;
+        bool hasSolidCollider = false;
+        for (uint32 c=0; c < colliderEntities.size(); c++) {
+
+            const uint32 colliderIndex = mCollidersComponents.getEntityIndex(colliderEntities[c]);
+            if (mCollidersComponents.mIsTrigger[colliderIndex]) continue;
+
+            AABB colliderAABB;
+            mCollidersComponents.mCollisionShapes[colliderIndex]->computeAABB(colliderAABB, mCollidersComponents.mLocalToBodyTransforms[colliderIndex]);
+            if (!hasSolidCollider) {
+                bodyAABB = colliderAABB;
+                hasSolidCollider = true;
+            }
+            else {
+                bodyAABB.mergeWithAABB(colliderAABB);
+            }
+        }
+        if (!hasSolidCollider) continue;
+
+        // Distance from the center of mass to the closest face of the body AABB
+        const Vector3& centerOfMassLocal = mRigidBodyComponents.mCentersOfMassLocal[i];
+        const Vector3 distancesToMin = centerOfMassLocal - bodyAABB.getMin();
+        const Vector3 distancesToMax = bodyAABB.getMax() - centerOfMassLocal;
+        const decimal radius = std::max(decimal(0.0), std::min(distancesToMin.getMinValue(), distancesToMax.getMinValue()));
+
+        // If the body moves less than its radius, the discrete collision detection cannot miss a collision
+        if (motionLengthSquare <= radius * radius) continue;
+
+        // Transform of the body at the start of the motion (with its orientation at the end of the step)
+        const Quaternion& orientation = mRigidBodyComponents.mConstrainedOrientations[i];
+        const Transform bodyStartToWorld(startPosition - orientation * centerOfMassLocal, orientation);
+
+        // Compute the first time of impact of the colliders of the body against the static colliders
+        decimal timeOfImpact = decimal(1.0);
+        Vector3 normal;
+        bool isHit = false;
+        for (uint32 c=0; c < colliderEntities.size(); c++) {
+
+            const uint32 colliderIndex = mCollidersComponents.getEntityIndex(colliderEntities[c]);
+            if (mCollidersComponents.mIsTrigger[colliderIndex]) continue;
+
+            const Transform colliderStartToWorld = bodyStartToWorld * mCollidersComponents.mLocalToBodyTransforms[colliderIndex];
+            if (mCollisionDetection.computeTimeOfImpactWithStaticColliders(colliderEntities[c], colliderStartToWorld, motion,
+                                                                           timeOfImpact, normal)) {
+                isHit = true;
+            }
+        }
+
+        if (isHit) {
+
+            // Stop the body slightly inside the static collider so that a contact is created at the next step
+            const decimal approachSpeed = motion.dot(normal);
+            const decimal time = std::min(decimal(1.0), timeOfImpact + CCD_PENETRATION_DEPTH / approachSpeed);
+
+            mRigidBodyComponents.mConstrainedPositions[i] = startPosition + time * motion;
+        }
+    }
+}
+
 // Enable or disable the joints
 void PhysicsWorld::enableDisableJoints() {
 
@@ -523,6 +626,8 @@ void PhysicsWorld::destroyRigidBody(RigidBody* rigidBody) {
     // Remove all the collision shapes of the body
     rigidBody->removeAllColliders();
 
+    mCollisionDetection.setIsBodyCompound(rigidBody->getEntity(), false);
+
     // Destroy all the joints in which the rigid body to be destroyed is involved
     const Array<Entity>& joints = mRigidBodyComponents.getJoints(rigidBody->getEntity());
     while (joints.size() > 0) {
@@ -0,0 +1,135 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2022 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+// Libraries
+#include <reactphysics3d/engine/SolverBodies.h>
+#include <reactphysics3d/engine/Islands.h>
+#include <reactphysics3d/components/RigidBodyComponents.h>
+
+using namespace reactphysics3d;
+
+// Static variables definition
+const uint32 SolverBodies::INVALID_INDEX = ~uint32(0);
+
+// Constructor
+SolverBodies::SolverBodies(MemoryAllocator& allocator, RigidBodyComponents& rigidBodyComponents)
+             : mRigidBodyComponents(rigidBodyComponents), mSolverBodyIndices(allocator), mNbBodiesPreviousFrame(32),
+               rigidBodyComponentIndices(allocator), linearVelocities(allocator), angularVelocities(allocator),
+               splitLinearVelocities(allocator), splitAngularVelocities(allocator), inverseMasses(allocator),
+               inverseInertiaTensorsWorld(allocator), linearLockAxisFactors(allocator), angularLockAxisFactors(allocator) {
+
+}
+
+// Create the solver bodies of all the bodies of the islands
+/// The bodies are added in the order of the islands. A static body can be part of several
+/// islands but it is only added once.
+void SolverBodies::create(const Islands& islands) {
+
+    assert(getNbBodies() == 0);
+
+    // Reset the solver index of all the rigid body components
+    const uint32 nbRigidBodyComponents = mRigidBodyComponents.getNbComponents();
+    mSolverBodyIndices.reserve(nbRigidBodyComponents);
+    mSolverBodyIndices.addWithoutInit(nbRigidBodyComponents);
+    for (uint32 i=0; i < nbRigidBodyComponents; i++) {
+        mSolverBodyIndices[i] = INVALID_INDEX;
+    }
+
+    // Reserve memory for the solver bodies
+    rigidBodyComponentIndices.reserve(mNbBodiesPreviousFrame);
+    linearVelocities.reserve(mNbBodiesPreviousFrame);
+    angularVelocities.reserve(mNbBodiesPreviousFrame);
+    splitLinearVelocities.reserve(mNbBodiesPreviousFrame);
+    splitAngularVelocities.reserve(mNbBodiesPreviousFrame);
+    inverseMasses.reserve(mNbBodiesPreviousFrame);
+    inverseInertiaTensorsWorld.reserve(mNbBodiesPreviousFrame);
+    linearLockAxisFactors.reserve(mNbBodiesPreviousFrame);
+    angularLockAxisFactors.reserve(mNbBodiesPreviousFrame);
+
+    // For each body of the islands
+    const uint32 nbBodyEntities = static_cast<uint32>(islands.bodyEntities.size());
+    for (uint32 b=0; b < nbBodyEntities; b++) {
+
+        const uint32 rigidBodyIndex = mRigidBodyComponents.getEntityIndex(islands.bodyEntities[b]);
+
+        // If the body has not been added yet (static bodies can be in several islands)
+        if (mSolverBodyIndices[rigidBodyIndex] == INVALID_INDEX) {
+            addBody(rigidBodyIndex);
+        }
+    }
+}
+
+// Add the body of a rigid body component as a new solver body and return its index
+uint32 SolverBodies::addBody(uint32 rigidBodyComponentIndex) {
+
+    assert(mSolverBodyIndices[rigidBodyComponentIndex] == INVALID_INDEX);
+
+    const uint32 solverBodyIndex = getNbBodies();
+    mSolverBodyIndices[rigidBodyComponentIndex] = solverBodyIndex;
+
+    rigidBodyComponentIndices.add(rigidBodyComponentIndex);
+    linearVelocities.add(mRigidBodyComponents.mConstrainedLinearVelocities[rigidBodyComponentIndex]);
+    angularVelocities.add(mRigidBodyComponents.mConstrainedAngularVelocities[rigidBodyComponentIndex]);
+    splitLinearVelocities.add(mRigidBodyComponents.mSplitLinearVelocities[rigidBodyComponentIndex]);
+    splitAngularVelocities.add(mRigidBodyComponents.mSplitAngularVelocities[rigidBodyComponentIndex]);
+    inverseMasses.add(mRigidBodyComponents.mInverseMasses[rigidBodyComponentIndex]);
+    inverseInertiaTensorsWorld.add(mRigidBodyComponents.mInverseInertiaTensorsWorld[rigidBodyComponentIndex]);
+    linearLockAxisFactors.add(mRigidBodyComponents.mLinearLockAxisFactors[rigidBodyComponentIndex]);
+    angularLockAxisFactors.add(mRigidBodyComponents.mAngularLockAxisFactors[rigidBodyComponentIndex]);
+
+    return solverBodyIndex;
+}
+
+// Copy the velocities of the solver bodies back into the rigid body components
+void SolverBodies::storeVelocities() {
+
+    const uint32 nbBodies = getNbBodies();
+    for (uint32 i=0; i < nbBodies; i++) {
+
+        const uint32 rigidBodyIndex = rigidBodyComponentIndices[i];
+
+        mRigidBodyComponents.mConstrainedLinearVelocities[rigidBodyIndex] = linearVelocities[i];
+        mRigidBodyComponents.mConstrainedAngularVelocities[rigidBodyIndex] = angularVelocities[i];
+        mRigidBodyComponents.mSplitLinearVelocities[rigidBodyIndex] = splitLinearVelocities[i];
+        mRigidBodyComponents.mSplitAngularVelocities[rigidBodyIndex] = splitAngularVelocities[i];
+    }
+}
+
+// Clear all the solver bodies
+void SolverBodies::clear() {
+
+    mNbBodiesPreviousFrame = getNbBodies();
+
+    mSolverBodyIndices.clear(true);
+    rigidBodyComponentIndices.clear(true);
+    linearVelocities.clear(true);
+    angularVelocities.clear(true);
+    splitLinearVelocities.clear(true);
+    splitAngularVelocities.clear(true);
+    inverseMasses.clear(true);
+    inverseInertiaTensorsWorld.clear(true);
+    linearLockAxisFactors.clear(true);
+    angularLockAxisFactors.clear(true);
+}
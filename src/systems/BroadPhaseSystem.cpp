@@ -40,7 +40,9 @@ BroadPhaseSystem::BroadPhaseSystem(CollisionDetectionSystem& collisionDetection,
                     :mDynamicAABBTree(collisionDetection.getMemoryManager().getHeapAllocator(), DYNAMIC_TREE_FAT_AABB_INFLATE_PERCENTAGE),
                      mCollidersComponents(collidersComponents), mTransformsComponents(transformComponents),
                      mRigidBodyComponents(rigidBodyComponents), mMovedShapes(collisionDetection.getMemoryManager().getHeapAllocator()),
-                     mCollisionDetection(collisionDetection) {
+                     mCollisionDetection(collisionDetection), mAllocator(collisionDetection.getMemoryManager().getHeapAllocator()),
+                     mMapBodyToCompound(mAllocator), mMapWorldNodeToCompound(mAllocator), mCompoundChildren(mAllocator),
+                     mFreeCompoundChildren(mAllocator) {
 
 #ifdef IS_RP3D_PROFILING_ENABLED
 
@@ -51,6 +53,19 @@ BroadPhaseSystem::BroadPhaseSystem(CollisionDetectionSystem& collisionDetection,
 
 }
 
+// Destructor
+BroadPhaseSystem::~BroadPhaseSystem() {
+
+    // Destroy the proxies of the compound bodies
+    for (auto it = mMapBodyToCompound.begin(); it != mMapBodyToCompound.end(); ++it) {
+
+        CompoundProxy* compound = it->second;
+        compound->collidersTree->~DynamicAABBTree();
+        mAllocator.release(compound->collidersTree, sizeof(DynamicAABBTree));
+        mAllocator.release(compound, sizeof(CompoundProxy));
+    }
+}
+
 // Return true if the two broad-phase collision shapes are overlapping
 bool BroadPhaseSystem::testOverlappingShapes(int32 shape1BroadPhaseId, int32 shape2BroadPhaseId) const {
 
@@ -59,19 +74,19 @@ bool BroadPhaseSystem::testOverlappingShapes(int32 shape1BroadPhaseId, int32 sha
     assert(shape1BroadPhaseId != -1 && shape2BroadPhaseId != -1);
 
     // Get the two AABBs of the collision shapes
-    const AABB& aabb1 = mDynamicAABBTree.getFatAABB(shape1BroadPhaseId);
-    const AABB& aabb2 = mDynamicAABBTree.getFatAABB(shape2BroadPhaseId);
+    const AABB& aabb1 = getFatAABB(shape1BroadPhaseId);
+    const AABB& aabb2 = getFatAABB(shape2BroadPhaseId);
 
     // Check if the two AABBs are overlapping
     return aabb1.testCollision(aabb2);
 }
 
 // Ray casting method
-void BroadPhaseSystem::raycast(const Ray& ray, RaycastTest& raycastTest, unsigned short raycastWithCategoryMaskBits) const {
+void BroadPhaseSystem::raycast(const Ray& ray, RaycastTest& raycastTest, uint64 raycastWithCategoryMaskBits) const {
 
     RP3D_PROFILE("BroadPhaseSystem::raycast()", mProfiler);
 
-    BroadPhaseRaycastCallback broadPhaseRaycastCallback(mDynamicAABBTree, raycastWithCategoryMaskBits, raycastTest);
+    BroadPhaseRaycastCallback broadPhaseRaycastCallback(mDynamicAABBTree, raycastWithCategoryMaskBits, raycastTest, this);
 
     // Compute the inverse ray direction
     const Vector3 rayDirection = ray.point2 - ray.point1;
@@ -80,13 +95,52 @@ void BroadPhaseSystem::raycast(const Ray& ray, RaycastTest& raycastTest, unsigne
     mDynamicAABBTree.raycast(ray, broadPhaseRaycastCallback);
 }
 
+// Report all the colliders with a fat AABB overlapping with a given AABB
+/// The colliders trees of the compound bodies overlapping with the AABB are also searched
+void BroadPhaseSystem::reportAllCollidersOverlappingWithAABB(const AABB& aabb, Array<Collider*>& overlappingColliders,
+                                                             MemoryAllocator& allocator) const {
+
+    RP3D_PROFILE("BroadPhaseSystem::reportAllCollidersOverlappingWithAABB()", mProfiler);
+
+    Array<int32> overlappingNodes(allocator, 16);
+    mDynamicAABBTree.reportAllShapesOverlappingWithAABB(aabb, overlappingNodes);
+
+    Array<int32> compoundOverlappingNodes(allocator);
+    for (uint32 i=0; i < overlappingNodes.size(); i++) {
+
+        // If the node is a compound body, we search its colliders tree
+        const DynamicAABBTree* compoundCollidersTree = getCompoundCollidersTree(overlappingNodes[i]);
+        if (compoundCollidersTree != nullptr) {
+
+            compoundOverlappingNodes.clear();
+            compoundCollidersTree->reportAllShapesOverlappingWithAABB(aabb, compoundOverlappingNodes);
+            for (uint32 j=0; j < compoundOverlappingNodes.size(); j++) {
+                overlappingColliders.add(static_cast<Collider*>(compoundCollidersTree->getNodeDataPointer(compoundOverlappingNodes[j])));
+            }
+        }
+        else {
+            overlappingColliders.add(static_cast<Collider*>(mDynamicAABBTree.getNodeDataPointer(overlappingNodes[i])));
+        }
+    }
+}
+
 // Add a collider into the broad-phase collision detection
 void BroadPhaseSystem::addCollider(Collider* collider, const AABB& aabb) {
 
     assert(collider->getBroadPhaseId() == -1);
 
-    // Add the collision shape into the dynamic AABB tree and get its broad-phase ID
-    int nodeId = mDynamicAABBTree.addObject(aabb, collider);
+    int nodeId;
+
+    // If the collider belongs to a compound body, we add it into the colliders tree of the body
+    auto it = mMapBodyToCompound.size() > 0 ? mMapBodyToCompound.find(collider->getBody()->getEntity()) : mMapBodyToCompound.end();
+    if (it != mMapBodyToCompound.end()) {
+        nodeId = addCompoundChild(it->second, collider, aabb);
+    }
+    else {
+
+        // Add the collision shape into the dynamic AABB tree and get its broad-phase ID
+        nodeId = mDynamicAABBTree.addObject(aabb, collider);
+    }
 
     // Set the broad-phase ID of the collider
     mCollidersComponents.setBroadPhaseId(collider->getEntity(), nodeId);
@@ -105,8 +159,16 @@ void BroadPhaseSystem::removeCollider(Collider* collider) {
 
     mCollidersComponents.setBroadPhaseId(collider->getEntity(), -1);
 
-    // Remove the collision shape from the dynamic AABB tree
-    mDynamicAABBTree.removeObject(broadPhaseID);
+    if (isCompoundChild(broadPhaseID)) {
+
+        // Remove the collider from the colliders tree of its compound body
+        removeCompoundChild(broadPhaseID);
+    }
+    else {
+
+        // Remove the collision shape from the dynamic AABB tree
+        mDynamicAABBTree.removeObject(broadPhaseID);
+    }
 
     // Remove the collision shape into the array of shapes that have moved (or have been created)
     // during the last simulation step
@@ -142,8 +204,22 @@ void BroadPhaseSystem::updateColliderInternal(int32 broadPhaseId, Collider* coll
 
     assert(broadPhaseId >= 0);
 
-    // Update the dynamic AABB tree according to the movement of the collision shape
-    bool hasBeenReInserted = mDynamicAABBTree.updateObject(broadPhaseId, aabb, forceReInsert);
+    bool hasBeenReInserted;
+
+    if (isCompoundChild(broadPhaseId)) {
+
+        // Update the colliders tree of the compound body and the node of the body in the world tree
+        const CompoundChild& child = mCompoundChildren[broadPhaseId & ~COMPOUND_CHILD_ID_BIT];
+        hasBeenReInserted = child.compound->collidersTree->updateObject(child.nodeId, aabb, forceReInsert);
+        if (hasBeenReInserted) {
+            updateCompoundWorldNode(child.compound);
+        }
+    }
+    else {
+
+        // Update the dynamic AABB tree according to the movement of the collision shape
+        hasBeenReInserted = mDynamicAABBTree.updateObject(broadPhaseId, aabb, forceReInsert);
+    }
 
     // If the collision shape has moved out of its fat AABB (and therefore has been reinserted
     // into the tree).
@@ -216,14 +292,188 @@ void BroadPhaseSystem::computeOverlappingPairs(MemoryManager& memoryManager, Arr
     // Get the array of the colliders that have moved or have been created in the last frame
     Array<int> shapesToTest = mMovedShapes.toArray(memoryManager.getHeapAllocator());
 
-    // Ask the dynamic AABB tree to report all collision shapes that overlap with the shapes to test
-    mDynamicAABBTree.reportAllShapesOverlappingWithShapes(shapesToTest, 0, static_cast<uint32>(shapesToTest.size()), overlappingNodes);
+    // If there are no compound bodies, all the colliders are in the world tree
+    if (mMapBodyToCompound.size() == 0) {
+
+        // Ask the dynamic AABB tree to report all collision shapes that overlap with the shapes to test
+        mDynamicAABBTree.reportAllShapesOverlappingWithShapes(shapesToTest, 0, static_cast<uint32>(shapesToTest.size()), overlappingNodes);
+    }
+    else {
+
+        // Move the colliders of compound bodies at the end of the array of colliders to test
+        uint32 nbWorldShapesToTest = 0;
+        for (uint32 i=0; i < shapesToTest.size(); i++) {
+            if (!isCompoundChild(shapesToTest[i])) {
+                std::swap(shapesToTest[i], shapesToTest[nbWorldShapesToTest]);
+                nbWorldShapesToTest++;
+            }
+        }
+
+        // Report the nodes of the world tree overlapping with the colliders in the world tree
+        const uint32 startPairIndex = overlappingNodes.size();
+        mDynamicAABBTree.reportAllShapesOverlappingWithShapes(shapesToTest, 0, nbWorldShapesToTest, overlappingNodes);
+
+        // Replace the pairs with a compound body node by the pairs with the colliders of the compound body
+        Array<int> overlappingNodesInCompound(memoryManager.getHeapAllocator());
+        const uint32 endPairIndex = overlappingNodes.size();
+        for (uint32 i=startPairIndex; i < endPairIndex; i++) {
+
+            auto it = mMapWorldNodeToCompound.find(overlappingNodes[i].second);
+            if (it != mMapWorldNodeToCompound.end()) {
+                reportCompoundChildrenOverlappingWithCollider(it->second, overlappingNodes[i].first, overlappingNodesInCompound, overlappingNodes);
+
+                // Mark the pair as a pair with the same node so that it is ignored
+                overlappingNodes[i].second = overlappingNodes[i].first;
+            }
+        }
+
+        // For each collider of a compound body to test
+        Array<int> overlappingWorldNodes(memoryManager.getHeapAllocator());
+        for (uint32 i=nbWorldShapesToTest; i < shapesToTest.size(); i++) {
+
+            const int32 broadPhaseId = shapesToTest[i];
+            const CompoundProxy* compound = mCompoundChildren[broadPhaseId & ~COMPOUND_CHILD_ID_BIT].compound;
+
+            // Report the nodes of the world tree overlapping with the collider
+            overlappingWorldNodes.clear();
+            mDynamicAABBTree.reportAllShapesOverlappingWithAABB(getFatAABB(broadPhaseId), overlappingWorldNodes);
+
+            for (uint32 j=0; j < overlappingWorldNodes.size(); j++) {
+
+                auto it = mMapWorldNodeToCompound.find(overlappingWorldNodes[j]);
+                if (it == mMapWorldNodeToCompound.end()) {
+                    overlappingNodes.add(Pair<int32, int32>(broadPhaseId, overlappingWorldNodes[j]));
+                }
+                else if (it->second != compound) {
+
+                    // Report the colliders of the other compound body overlapping with the collider
+                    reportCompoundChildrenOverlappingWithCollider(it->second, broadPhaseId, overlappingNodesInCompound, overlappingNodes);
+                }
+            }
+        }
+    }
 
     // Reset the array of collision shapes that have move (or have been created) during the
     // last simulation step
     mMovedShapes.clear();
 }
 
+// Report the overlapping pairs between a collider and the colliders of a compound body
+void BroadPhaseSystem::reportCompoundChildrenOverlappingWithCollider(const CompoundProxy* compound, int32 broadPhaseId,
+                                                                     Array<int>& overlappingNodes,
+                                                                     Array<Pair<int32, int32>>& outOverlappingPairs) const {
+
+    overlappingNodes.clear();
+    compound->collidersTree->reportAllShapesOverlappingWithAABB(getFatAABB(broadPhaseId), overlappingNodes);
+
+    for (uint32 i=0; i < overlappingNodes.size(); i++) {
+        const Collider* childCollider = static_cast<Collider*>(compound->collidersTree->getNodeDataPointer(overlappingNodes[i]));
+        outOverlappingPairs.add(Pair<int32, int32>(broadPhaseId, childCollider->getBroadPhaseId()));
+    }
+}
+
+// Set whether the colliders of a body are grouped into a single compound node of the world tree
+/// The colliders of the body must not be in the broad-phase when this method is called.
+void BroadPhaseSystem::setIsBodyCompound(Entity bodyEntity, bool isCompound) {
+
+    if (isCompound == isBodyCompound(bodyEntity)) return;
+
+    if (isCompound) {
+
+        // Create the proxy of the compound body
+        CompoundProxy* compound = static_cast<CompoundProxy*>(mAllocator.allocate(sizeof(CompoundProxy)));
+        compound->bodyEntity = bodyEntity;
+        compound->collidersTree = new (mAllocator.allocate(sizeof(DynamicAABBTree))) DynamicAABBTree(mAllocator, DYNAMIC_TREE_FAT_AABB_INFLATE_PERCENTAGE);
+        compound->worldNodeId = -1;
+        compound->nbColliders = 0;
+
+#ifdef IS_RP3D_PROFILING_ENABLED
+
+        compound->collidersTree->setProfiler(mProfiler);
+
+#endif
+
+        mMapBodyToCompound.add(Pair<Entity, CompoundProxy*>(bodyEntity, compound));
+    }
+    else {
+
+        CompoundProxy* compound = mMapBodyToCompound[bodyEntity];
+
+        assert(compound->worldNodeId == -1);
+
+        // Destroy the proxy of the compound body
+        mMapBodyToCompound.remove(bodyEntity);
+        compound->collidersTree->~DynamicAABBTree();
+        mAllocator.release(compound->collidersTree, sizeof(DynamicAABBTree));
+        mAllocator.release(compound, sizeof(CompoundProxy));
+    }
+}
+
+// Add a collider into the colliders tree of a compound body and return its broad-phase id
+int32 BroadPhaseSystem::addCompoundChild(CompoundProxy* compound, Collider* collider, const AABB& aabb) {
+
+    // Get an unused compound child
+    uint32 childIndex;
+    if (mFreeCompoundChildren.size() > 0) {
+        childIndex = mFreeCompoundChildren[mFreeCompoundChildren.size() - 1];
+        mFreeCompoundChildren.removeAt(mFreeCompoundChildren.size() - 1);
+    }
+    else {
+        childIndex = mCompoundChildren.size();
+        mCompoundChildren.add(CompoundChild());
+    }
+
+    assert(childIndex < static_cast<uint32>(COMPOUND_CHILD_ID_BIT));
+
+    mCompoundChildren[childIndex].compound = compound;
+    mCompoundChildren[childIndex].nodeId = compound->collidersTree->addObject(aabb, collider);
+    compound->nbColliders++;
+
+    updateCompoundWorldNode(compound);
+
+    return static_cast<int32>(childIndex) | COMPOUND_CHILD_ID_BIT;
+}
+
+// Remove a collider from the colliders tree of its compound body
+void BroadPhaseSystem::removeCompoundChild(int32 broadPhaseId) {
+
+    const uint32 childIndex = static_cast<uint32>(broadPhaseId & ~COMPOUND_CHILD_ID_BIT);
+    CompoundChild& child = mCompoundChildren[childIndex];
+    CompoundProxy* compound = child.compound;
+
+    compound->collidersTree->removeObject(child.nodeId);
+    compound->nbColliders--;
+
+    child.compound = nullptr;
+    child.nodeId = -1;
+    mFreeCompoundChildren.add(childIndex);
+
+    updateCompoundWorldNode(compound);
+}
+
+// Update the node of a compound body in the world tree after its colliders tree has changed
+/// The world node of the body contains the AABBs of all its colliders. The body is removed
+/// from the world tree when it has no collider anymore.
+void BroadPhaseSystem::updateCompoundWorldNode(CompoundProxy* compound) {
+
+    if (compound->nbColliders == 0) {
+
+        if (compound->worldNodeId != -1) {
+            mMapWorldNodeToCompound.remove(compound->worldNodeId);
+            mDynamicAABBTree.removeObject(compound->worldNodeId);
+            compound->worldNodeId = -1;
+        }
+    }
+    else if (compound->worldNodeId == -1) {
+
+        compound->worldNodeId = mDynamicAABBTree.addObject(compound->collidersTree->getRootAABB(), compound);
+        mMapWorldNodeToCompound.add(Pair<int32, CompoundProxy*>(compound->worldNodeId, compound));
+    }
+    else {
+        mDynamicAABBTree.updateObject(compound->worldNodeId, compound->collidersTree->getRootAABB(), false);
+    }
+}
+
 // Called when a overlapping node has been found during the call to
 // DynamicAABBTree:reportAllShapesOverlappingWithAABB()
 void AABBOverlapCallback::notifyOverlappingNode(int nodeId) {
@@ -235,6 +485,19 @@ decimal BroadPhaseRaycastCallback::raycastBroadPhaseShape(int32 nodeId, const Ra
 
     decimal hitFraction = decimal(-1.0);
 
+    // If the node is a compound body, we raycast the colliders tree of the body
+    const DynamicAABBTree* compoundCollidersTree = mBroadPhaseSystem != nullptr ? mBroadPhaseSystem->getCompoundCollidersTree(nodeId) : nullptr;
+    if (compoundCollidersTree != nullptr) {
+
+        BroadPhaseRaycastCallback compoundRaycastCallback(*compoundCollidersTree, mRaycastWithCategoryMaskBits, mRaycastTest);
+        compoundCollidersTree->raycast(ray, compoundRaycastCallback);
+
+        if (compoundRaycastCallback.mIsStopped) return decimal(0.0);
+        if (compoundRaycastCallback.mSmallestHitFraction != DECIMAL_LARGEST) return compoundRaycastCallback.mSmallestHitFraction;
+
+        return decimal(-1.0);
+    }
+
     // Get the collider from the node
     Collider* collider = static_cast<Collider*>(mDynamicAABBTree.getNodeDataPointer(nodeId));
 
@@ -245,6 +508,14 @@ decimal BroadPhaseRaycastCallback::raycastBroadPhaseShape(int32 nodeId, const Ra
         // the collider of this node because the ray is overlapping
         // with the shape in the broad-phase
         hitFraction = mRaycastTest.raycastAgainstShape(collider, ray);
+
+        // Keep track of the result in case we are raycasting the colliders tree of a compound body
+        if (hitFraction == decimal(0.0)) {
+            mIsStopped = true;
+        }
+        else if (hitFraction > decimal(0.0)) {
+            mSmallestHitFraction = std::min(mSmallestHitFraction, hitFraction);
+        }
     }
 
     return hitFraction;
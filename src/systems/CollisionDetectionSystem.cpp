@@ -29,6 +29,7 @@
 #include <reactphysics3d/collision/OverlapCallback.h>
 #include <reactphysics3d/collision/shapes/BoxShape.h>
 #include <reactphysics3d/collision/shapes/ConcaveShape.h>
+#include <reactphysics3d/collision/shapes/TriangleShape.h>
 #include <reactphysics3d/collision/ContactManifoldInfo.h>
 #include <reactphysics3d/constraint/ContactPoint.h>
 #include <reactphysics3d/body/RigidBody.h>
@@ -36,6 +37,7 @@
 #include <reactphysics3d/collision/CollisionCallback.h>
 #include <reactphysics3d/collision/OverlapCallback.h>
 #include <reactphysics3d/collision/narrowphase/NarrowPhaseInfoBatch.h>
+#include <reactphysics3d/collision/narrowphase/GJK/GJKAlgorithm.h>
 #include <reactphysics3d/collision/ContactManifold.h>
 #include <reactphysics3d/utils/Profiler.h>
 #include <reactphysics3d/engine/EventListener.h>
@@ -63,11 +65,16 @@ CollisionDetectionSystem::CollisionDetectionSystem(PhysicsWorld* world, Collider
                      mNarrowPhaseInput(mMemoryManager.getSingleFrameAllocator(), mOverlappingPairs), mPotentialContactPoints(mMemoryManager.getSingleFrameAllocator()),
                      mPotentialContactManifolds(mMemoryManager.getSingleFrameAllocator()), mContactPairs1(mMemoryManager.getPoolAllocator()),
                      mContactPairs2(mMemoryManager.getPoolAllocator()), mPreviousContactPairs(&mContactPairs1), mCurrentContactPairs(&mContactPairs2),
-                     mLostContactPairs(mMemoryManager.getSingleFrameAllocator()), mPreviousMapPairIdToContactPairIndex(mMemoryManager.getHeapAllocator()),
+                     mLostContactPairs(mMemoryManager.getSingleFrameAllocator()),
                      mContactManifolds1(mMemoryManager.getPoolAllocator()), mContactManifolds2(mMemoryManager.getPoolAllocator()),
                      mPreviousContactManifolds(&mContactManifolds1), mCurrentContactManifolds(&mContactManifolds2),
                      mContactPoints1(mMemoryManager.getPoolAllocator()), mContactPoints2(mMemoryManager.getPoolAllocator()),
                      mPreviousContactPoints(&mContactPoints1), mCurrentContactPoints(&mContactPoints2), mCollisionBodyContactPairsIndices(mMemoryManager.getSingleFrameAllocator()),
+                     mPersistentPotentialContactManifoldsIndices(mMemoryManager.getSingleFrameAllocator()),
+                     mPersistentOverlappingPairs(mMemoryManager.getSingleFrameAllocator()),
+                     mOverlappingTrianglesShapeIds(mMemoryManager.getHeapAllocator(), 64),
+                     mOverlappingTrianglesVertices(mMemoryManager.getHeapAllocator(), 64 * 3),
+                     mOverlappingTrianglesConvexEdges(mMemoryManager.getHeapAllocator(), 64),
                      mNbPreviousPotentialContactManifolds(0), mNbPreviousPotentialContactPoints(0), mTriangleHalfEdgeStructure(triangleHalfEdgeStructure) {
 
 #ifdef IS_RP3D_PROFILING_ENABLED
@@ -79,6 +86,8 @@ CollisionDetectionSystem::CollisionDetectionSystem(PhysicsWorld* world, Collider
 
 #endif
 
+    // Use the EPA algorithm instead of the SAT algorithm for large convex polyhedra if requested in the world settings
+    mCollisionDispatch.getConvexPolyhedronVsConvexPolyhedronAlgorithm()->setMinNbVerticesForEPA(world->mConfig.minNbPolyhedronVerticesForEPA);
 }
 
 // Compute the collision detection
@@ -90,7 +99,7 @@ void CollisionDetectionSystem::computeCollisionDetection() {
     computeBroadPhase();
 
     // Compute the middle-phase collision detection
-    computeMiddlePhase(mNarrowPhaseInput, true);
+    computeMiddlePhase(mNarrowPhaseInput, true, mWorld->mConfig.isContactManifoldPersistenceEnabled);
     
     // Compute the narrow-phase collision detection
     computeNarrowPhase();
@@ -274,11 +283,13 @@ void CollisionDetectionSystem::updateOverlappingPairs(const Array<Pair<int32, in
                 const bool isBody1Active = isBody1Enabled && !isBody1Static;
                 const bool isBody2Active = isBody2Enabled && !isBody2Static;
 
-                if (isBody1Active || isBody2Active) {
+                // Check if the collision filtering (collision groups, category and mask bits) allows collision
+                // between the two colliders. This test does not need any hashing and is therefore done first.
+                if ((isBody1Active || isBody2Active) && mCollidersComponents.canCollide(collider1Index, collider2Index)) {
 
                     // Check if the bodies are in the set of bodies that cannot collide between each other
-                    const bodypair bodiesIndex = OverlappingPairs::computeBodiesIndexPair(body1Entity, body2Entity);
-                    if (!mNoCollisionPairs.contains(bodiesIndex)) {
+                    if (mNoCollisionPairs.size() == 0 ||
+                        !mNoCollisionPairs.contains(OverlappingPairs::computeBodiesIndexPair(body1Entity, body2Entity))) {
 
                         // Compute the overlapping pair ID
                         const uint64 pairId = pairNumbers(std::max(nodePair.first, nodePair.second), std::min(nodePair.first, nodePair.second));
@@ -287,27 +298,16 @@ void CollisionDetectionSystem::updateOverlappingPairs(const Array<Pair<int32, in
                         OverlappingPairs::OverlappingPair* overlappingPair = mOverlappingPairs.getOverlappingPair(pairId);
                         if (overlappingPair == nullptr) {
 
-                            const unsigned short shape1CollideWithMaskBits = mCollidersComponents.mCollideWithMaskBits[collider1Index];
-                            const unsigned short shape2CollideWithMaskBits = mCollidersComponents.mCollideWithMaskBits[collider2Index];
+                            Collider* shape1 = mCollidersComponents.mColliders[collider1Index];
+                            Collider* shape2 = mCollidersComponents.mColliders[collider2Index];
 
-                            const unsigned short shape1CollisionCategoryBits = mCollidersComponents.mCollisionCategoryBits[collider1Index];
-                            const unsigned short shape2CollisionCategoryBits = mCollidersComponents.mCollisionCategoryBits[collider2Index];
+                            // Check that at least one collision shape is convex
+                            const bool isShape1Convex = shape1->getCollisionShape()->isConvex();
+                            const bool isShape2Convex = shape2->getCollisionShape()->isConvex();
+                            if (isShape1Convex || isShape2Convex) {
 
-                            // Check if the collision filtering allows collision between the two shapes
-                            if ((shape1CollideWithMaskBits & shape2CollisionCategoryBits) != 0 &&
-                                (shape1CollisionCategoryBits & shape2CollideWithMaskBits) != 0) {
-
-                                Collider* shape1 = mCollidersComponents.mColliders[collider1Index];
-                                Collider* shape2 = mCollidersComponents.mColliders[collider2Index];
-
-                                // Check that at least one collision shape is convex
-                                const bool isShape1Convex = shape1->getCollisionShape()->isConvex();
-                                const bool isShape2Convex = shape2->getCollisionShape()->isConvex();
-                                if (isShape1Convex || isShape2Convex) {
-
-                                    // Add the new overlapping pair
-                                    mOverlappingPairs.addPair(collider1Index, collider2Index, isShape1Convex && isShape2Convex);
-                                }
+                                // Add the new overlapping pair
+                                mOverlappingPairs.addPair(collider1Index, collider2Index, isShape1Convex && isShape2Convex);
                             }
                         }
                         else {
@@ -323,7 +323,7 @@ void CollisionDetectionSystem::updateOverlappingPairs(const Array<Pair<int32, in
 }
 
 // Compute the middle-phase collision detection
-void CollisionDetectionSystem::computeMiddlePhase(NarrowPhaseInput& narrowPhaseInput, bool needToReportContacts) {
+void CollisionDetectionSystem::computeMiddlePhase(NarrowPhaseInput& narrowPhaseInput, bool needToReportContacts, bool reusePreviousContacts) {
 
     RP3D_PROFILE("CollisionDetectionSystem::computeMiddlePhase()", mProfiler);
 
@@ -333,6 +333,9 @@ void CollisionDetectionSystem::computeMiddlePhase(NarrowPhaseInput& narrowPhaseI
     // Remove the obsolete last frame collision infos and mark all the others as obsolete
     mOverlappingPairs.clearObsoleteLastFrameCollisionInfos();
 
+    // Cosine of the half maximum relative rotation angle to reuse the contacts of a pair
+    const decimal minCosHalfAngle = std::cos(mWorld->mConfig.contactManifoldPersistenceAngleThreshold * decimal(0.5));
+
     // For each possible convex vs convex pair of bodies
     const uint64 nbConvexVsConvexPairs = mOverlappingPairs.mConvexPairs.size();
     for (uint64 i=0; i < nbConvexVsConvexPairs; i++) {
@@ -359,9 +362,17 @@ void CollisionDetectionSystem::computeMiddlePhase(NarrowPhaseInput& narrowPhaseI
         const bool isCollider2Trigger = mCollidersComponents.mIsTrigger[collider2Index];
         const bool reportContacts = needToReportContacts && !isCollider1Trigger && !isCollider2Trigger;
 
+        // If the two colliders have almost not moved relative to each other, we reuse the
+        // contacts of the previous frame and we skip the narrow-phase for this pair
+        if (reusePreviousContacts && reportContacts &&
+            reusePreviousFrameContacts(overlappingPair, mCollidersComponents.mLocalToWorldTransforms[collider1Index],
+                                       mCollidersComponents.mLocalToWorldTransforms[collider2Index], minCosHalfAngle)) {
+            continue;
+        }
+
         // No middle-phase is necessary, simply create a narrow phase info
         // for the narrow-phase collision detection
-        narrowPhaseInput.addNarrowPhaseTest(overlappingPair.pairID, collider1Entity, collider2Entity, collisionShape1, collisionShape2,
+        narrowPhaseInput.addNarrowPhaseTest(&overlappingPair, collider1Entity, collider2Entity, collisionShape1, collisionShape2,
                                             mCollidersComponents.mLocalToWorldTransforms[collider1Index],
                                             mCollidersComponents.mLocalToWorldTransforms[collider2Index],
                                             algorithmType, reportContacts, &overlappingPair.lastFrameCollisionInfo,
@@ -386,6 +397,136 @@ void CollisionDetectionSystem::computeMiddlePhase(NarrowPhaseInput& narrowPhaseI
     }
 }
 
+// Try to reuse the contacts of the previous frame for a convex pair instead of computing its narrow-phase
+/// If the relative transform between the two colliders has changed less than the persistence thresholds since
+/// the last time the narrow-phase has been computed for the pair, the contact points of the previous frame are
+/// re-projected using the current transforms of the colliders and added as a potential contact manifold. This
+/// method returns true if the contacts have been reused (the pair does not need to be tested in narrow-phase).
+bool CollisionDetectionSystem::reusePreviousFrameContacts(OverlappingPairs::ConvexOverlappingPair& overlappingPair,
+                                                          const Transform& shape1ToWorldTransform, const Transform& shape2ToWorldTransform,
+                                                          decimal minCosHalfAngle) {
+
+    RP3D_PROFILE("CollisionDetectionSystem::reusePreviousFrameContacts()", mProfiler);
+
+    const Transform relativeTransform = shape1ToWorldTransform.getInverse() * shape2ToWorldTransform;
+    const Quaternion previousOrientation1 = overlappingPair.previousContactsOrientation1;
+    overlappingPair.previousContactsOrientation1 = shape1ToWorldTransform.getOrientation();
+
+    bool areContactsReused = false;
+
+    // Find the corresponding contact pair in the previous frame (if any). Note that the contacts of the previous
+    // frame are still in the "current" arrays here because those arrays are swapped at the beginning of the narrow-phase
+    const uint32 previousContactPairIndex = overlappingPair.contactPairIndex;
+    if (overlappingPair.isPersistenceDataValid && overlappingPair.collidingInPreviousFrame &&
+        previousContactPairIndex < mCurrentContactPairs->size() &&
+        (*mCurrentContactPairs)[previousContactPairIndex].pairId == overlappingPair.pairID) {
+
+        const ContactPair& previousContactPair = (*mCurrentContactPairs)[previousContactPairIndex];
+
+        // Compute the relative displacement and rotation of the colliders since the last narrow-phase of the pair
+        const decimal distanceThreshold = mWorld->mConfig.contactManifoldPersistenceDistanceThreshold;
+        const decimal deltaPositionSquare = (relativeTransform.getPosition() - overlappingPair.narrowPhaseRelativeTransform.getPosition()).lengthSquare();
+        const decimal cosHalfDeltaAngle = std::abs(relativeTransform.getOrientation().dot(overlappingPair.narrowPhaseRelativeTransform.getOrientation()));
+
+        if (!previousContactPair.isTrigger && previousContactPair.nbContactManifolds == 1 &&
+            deltaPositionSquare <= distanceThreshold * distanceThreshold && cosHalfDeltaAngle >= minCosHalfAngle) {
+
+            const ContactManifold& previousContactManifold = (*mCurrentContactManifolds)[previousContactPair.contactManifoldsIndex];
+            const Quaternion inversePreviousOrientation1 = previousOrientation1.getInverse();
+
+            // Create a new potential contact manifold for the overlapping pair
+            const uint32 contactManifoldIndex = static_cast<uint32>(mPotentialContactManifolds.size());
+            mPotentialContactManifolds.emplace(overlappingPair.pairID);
+            ContactManifoldInfo& contactManifoldInfo = mPotentialContactManifolds[contactManifoldIndex];
+
+            // For each contact point of the previous frame
+            const uint32 contactPointsIndex = previousContactManifold.contactPointsIndex;
+            for (uint32 c=contactPointsIndex; c < contactPointsIndex + previousContactManifold.nbContactPoints; c++) {
+
+                const ContactPoint& previousContactPoint = (*mCurrentContactPoints)[c];
+
+                // Re-project the contact point using the current transforms of the two colliders. The contact
+                // normal is fixed in the local-space of the first collider.
+                ContactPointInfo contactPoint;
+                contactPoint.normal = shape1ToWorldTransform.getOrientation() * (inversePreviousOrientation1 * previousContactPoint.getNormal());
+                contactPoint.localPoint1 = previousContactPoint.getLocalPointOnShape1();
+                contactPoint.localPoint2 = previousContactPoint.getLocalPointOnShape2();
+                contactPoint.penetrationDepth = (shape1ToWorldTransform * contactPoint.localPoint1 -
+                                                 shape2ToWorldTransform * contactPoint.localPoint2).dot(contactPoint.normal);
+
+                // We only keep the contact points that are still penetrating
+                if (contactPoint.penetrationDepth > decimal(0.0)) {
+
+                    contactManifoldInfo.potentialContactPointsIndices[contactManifoldInfo.nbPotentialContactPoints] = static_cast<uint32>(mPotentialContactPoints.size());
+                    contactManifoldInfo.nbPotentialContactPoints++;
+                    mPotentialContactPoints.add(contactPoint);
+                }
+            }
+
+            // If some contact points remain, the contacts are reused
+            if (contactManifoldInfo.nbPotentialContactPoints > 0) {
+
+                mPersistentPotentialContactManifoldsIndices.add(contactManifoldIndex);
+                mPersistentOverlappingPairs.add(&overlappingPair);
+                overlappingPair.collidingInCurrentFrame = true;
+                areContactsReused = true;
+            }
+            else {
+
+                // Otherwise, we need to compute the narrow-phase for the pair
+                mPotentialContactManifolds.removeAt(contactManifoldIndex);
+            }
+        }
+    }
+
+    // If the narrow-phase needs to be computed, we keep the relative transform of the colliders at this time
+    if (!areContactsReused) {
+        overlappingPair.narrowPhaseRelativeTransform = relativeTransform;
+        overlappingPair.isPersistenceDataValid = true;
+    }
+
+    return areContactsReused;
+}
+
+// Add the contact pairs of the overlapping pairs that have reused their contacts from the previous frame
+/// Those pairs have not been tested in narrow-phase and therefore, we directly create a contact
+/// pair with the potential contact manifold that has been re-projected during the middle-phase
+void CollisionDetectionSystem::addPersistentContactPairs(Array<ContactPair>* contactPairs) {
+
+    RP3D_PROFILE("CollisionDetectionSystem::addPersistentContactPairs()", mProfiler);
+
+    const uint32 nbPersistentManifolds = static_cast<uint32>(mPersistentPotentialContactManifoldsIndices.size());
+    for (uint32 i=0; i < nbPersistentManifolds; i++) {
+
+        const uint32 contactManifoldIndex = mPersistentPotentialContactManifoldsIndices[i];
+        const uint64 pairId = mPotentialContactManifolds[contactManifoldIndex].pairId;
+
+        OverlappingPairs::ConvexOverlappingPair* overlappingPair = mPersistentOverlappingPairs[i];
+        assert(overlappingPair->pairID == pairId);
+
+        const uint32 collider1Index = mCollidersComponents.getEntityIndex(overlappingPair->collider1);
+        const uint32 collider2Index = mCollidersComponents.getEntityIndex(overlappingPair->collider2);
+
+        const Entity body1Entity = mCollidersComponents.mBodiesEntities[collider1Index];
+        const Entity body2Entity = mCollidersComponents.mBodiesEntities[collider2Index];
+
+        // Create a new ContactPair
+        const uint32 newContactPairIndex = static_cast<uint32>(contactPairs->size());
+        contactPairs->emplace(pairId, body1Entity, body2Entity, overlappingPair->collider1, overlappingPair->collider2,
+                              newContactPairIndex, overlappingPair->collidingInPreviousFrame, false);
+
+        // Add the contact manifold to the contact pair
+        ContactPair& contactPair = (*contactPairs)[newContactPairIndex];
+        contactPair.potentialContactManifoldsIndices[0] = contactManifoldIndex;
+        contactPair.nbPotentialContactManifolds = 1;
+
+        linkContactPairWithPreviousOne(*overlappingPair, contactPair);
+    }
+
+    mPersistentPotentialContactManifoldsIndices.clear(true);
+    mPersistentOverlappingPairs.clear(true);
+}
+
 // Compute the middle-phase collision detection
 void CollisionDetectionSystem::computeMiddlePhaseCollisionSnapshot(Array<uint64>& convexPairs, Array<uint64>& concavePairs,
                                                                    NarrowPhaseInput& narrowPhaseInput, bool reportContacts) {
@@ -424,7 +565,7 @@ void CollisionDetectionSystem::computeMiddlePhaseCollisionSnapshot(Array<uint64>
 
         // No middle-phase is necessary, simply create a narrow phase info
         // for the narrow-phase collision detection
-        narrowPhaseInput.addNarrowPhaseTest(pairId, collider1Entity, collider2Entity, collisionShape1, collisionShape2,
+        narrowPhaseInput.addNarrowPhaseTest(&mOverlappingPairs.mConvexPairs[pairIndex], collider1Entity, collider2Entity, collisionShape1, collisionShape2,
                                                   mCollidersComponents.mLocalToWorldTransforms[collider1Index],
                                                   mCollidersComponents.mLocalToWorldTransforms[collider2Index],
                                                   algorithmType, reportContacts, &mOverlappingPairs.mConvexPairs[pairIndex].lastFrameCollisionInfo, mMemoryManager.getSingleFrameAllocator());
@@ -484,21 +625,52 @@ void CollisionDetectionSystem::computeConvexVsConcaveMiddlePhase(OverlappingPair
     AABB aabb;
     convexShape->computeAABB(aabb, convexToConcaveTransform);
 
-    // Compute the concave shape triangles that are overlapping with the convex mesh AABB
-    Array<Vector3> triangleVertices(allocator, 64);
-    Array<Vector3> triangleVerticesNormals(allocator, 64);
-    Array<uint> shapeIds(allocator, 64);
-    concaveShape->computeOverlappingTriangles(aabb, triangleVertices, triangleVerticesNormals, shapeIds, allocator);
-
-    assert(triangleVertices.size() == triangleVerticesNormals.size());
-    assert(shapeIds.size() == triangleVertices.size() / 3);
-    assert(triangleVertices.size() % 3 == 0);
-    assert(triangleVerticesNormals.size() % 3 == 0);
-
     const bool isCollider1Trigger = mCollidersComponents.mIsTrigger[collider1Index];
     const bool isCollider2Trigger = mCollidersComponents.mIsTrigger[collider2Index];
     reportContacts = reportContacts && !isCollider1Trigger && !isCollider2Trigger;
 
+    // The arrays of overlapping triangles are reused for each pair to avoid allocating them again
+    mOverlappingTrianglesShapeIds.clear();
+
+    // If the convex shape is a sphere, a capsule or a box, the overlapping triangles are directly written
+    // into the arrays of the corresponding triangle batch and no TriangleShape is created
+    TriangleNarrowPhaseInfoBatch* trianglesBatch = nullptr;
+    switch (overlappingPair.narrowPhaseAlgorithmType) {
+        case NarrowPhaseAlgorithmType::SphereVsTriangle:
+            trianglesBatch = &narrowPhaseInput.getSphereVsTriangleBatch();
+            break;
+        case NarrowPhaseAlgorithmType::CapsuleVsTriangle:
+            trianglesBatch = &narrowPhaseInput.getCapsuleVsTriangleBatch();
+            break;
+        case NarrowPhaseAlgorithmType::BoxVsTriangle:
+            trianglesBatch = &narrowPhaseInput.getBoxVsTriangleBatch();
+            break;
+        default:
+            break;
+    }
+
+    if (trianglesBatch != nullptr) {
+
+        concaveShape->computeOverlappingTriangles(aabb, trianglesBatch->trianglesVertices, trianglesBatch->trianglesConvexEdges,
+                                                  mOverlappingTrianglesShapeIds, allocator);
+
+        // Create a narrow phase info for each new triangle
+        trianglesBatch->addTrianglesNarrowPhaseInfos(&overlappingPair, collider1, collider2, convexShape, overlappingPair.isShape1Convex,
+                                                     shape1LocalToWorldTransform, shape2LocalToWorldTransform, reportContacts, allocator);
+
+        return;
+    }
+
+    // Compute the concave shape triangles that are overlapping with the convex mesh AABB
+    mOverlappingTrianglesVertices.clear();
+    mOverlappingTrianglesConvexEdges.clear();
+    concaveShape->computeOverlappingTriangles(aabb, mOverlappingTrianglesVertices, mOverlappingTrianglesConvexEdges,
+                                              mOverlappingTrianglesShapeIds, allocator);
+
+    assert(mOverlappingTrianglesConvexEdges.size() == mOverlappingTrianglesShapeIds.size());
+    assert(mOverlappingTrianglesShapeIds.size() == mOverlappingTrianglesVertices.size() / 3);
+    assert(mOverlappingTrianglesVertices.size() % 3 == 0);
+
     CollisionShape* shape1;
     CollisionShape* shape2;
 
@@ -510,13 +682,14 @@ void CollisionDetectionSystem::computeConvexVsConcaveMiddlePhase(OverlappingPair
     }
 
     // For each overlapping triangle
-    const uint32 nbShapeIds = static_cast<uint32>(shapeIds.size());
+    const uint32 nbShapeIds = static_cast<uint32>(mOverlappingTrianglesShapeIds.size());
     for (uint32 i=0; i < nbShapeIds; i++) {
 
         // Create a triangle collision shape (the allocated memory for the TriangleShape will be released in the
         // destructor of the corresponding NarrowPhaseInfo.
         TriangleShape* triangleShape = new (allocator.allocate(sizeof(TriangleShape)))
-                                       TriangleShape(&(triangleVertices[i * 3]), &(triangleVerticesNormals[i * 3]), shapeIds[i], mTriangleHalfEdgeStructure, allocator);
+                                       TriangleShape(&(mOverlappingTrianglesVertices[i * 3]), mOverlappingTrianglesConvexEdges[i],
+                                                     mOverlappingTrianglesShapeIds[i], mTriangleHalfEdgeStructure, allocator);
 
     #ifdef IS_RP3D_PROFILING_ENABLED
 
@@ -537,7 +710,7 @@ void CollisionDetectionSystem::computeConvexVsConcaveMiddlePhase(OverlappingPair
         LastFrameCollisionInfo* lastFrameInfo = overlappingPair.addLastFrameInfoIfNecessary(shape1->getId(), shape2->getId());
 
         // Create a narrow phase info for the narrow-phase collision detection
-        narrowPhaseInput.addNarrowPhaseTest(overlappingPair.pairID, collider1, collider2, shape1, shape2,
+        narrowPhaseInput.addNarrowPhaseTest(&overlappingPair, collider1, collider2, shape1, shape2,
                                             shape1LocalToWorldTransform, shape2LocalToWorldTransform,
                                             overlappingPair.narrowPhaseAlgorithmType, reportContacts, lastFrameInfo, allocator);
     }
@@ -556,6 +729,11 @@ bool CollisionDetectionSystem::testNarrowPhaseCollision(NarrowPhaseInput& narrow
     SphereVsConvexPolyhedronAlgorithm* sphereVsConvexPolyAlgo = mCollisionDispatch.getSphereVsConvexPolyhedronAlgorithm();
     CapsuleVsConvexPolyhedronAlgorithm* capsuleVsConvexPolyAlgo = mCollisionDispatch.getCapsuleVsConvexPolyhedronAlgorithm();
     ConvexPolyhedronVsConvexPolyhedronAlgorithm* convexPolyVsConvexPolyAlgo = mCollisionDispatch.getConvexPolyhedronVsConvexPolyhedronAlgorithm();
+    BoxVsBoxAlgorithm* boxVsBoxAlgo = mCollisionDispatch.getBoxVsBoxAlgorithm();
+    SphereVsTriangleAlgorithm* sphereVsTriangleAlgo = mCollisionDispatch.getSphereVsTriangleAlgorithm();
+    CapsuleVsTriangleAlgorithm* capsuleVsTriangleAlgo = mCollisionDispatch.getCapsuleVsTriangleAlgorithm();
+    BoxVsTriangleAlgorithm* boxVsTriangleAlgo = mCollisionDispatch.getBoxVsTriangleAlgorithm();
+    GenericConvexAlgorithm* genericConvexAlgo = mCollisionDispatch.getGenericConvexAlgorithm();
 
     // get the narrow-phase batches to test for collision for contacts
     NarrowPhaseInfoBatch& sphereVsSphereBatchContacts = narrowPhaseInput.getSphereVsSphereBatch();
@@ -564,6 +742,12 @@ bool CollisionDetectionSystem::testNarrowPhaseCollision(NarrowPhaseInput& narrow
     NarrowPhaseInfoBatch& sphereVsConvexPolyhedronBatchContacts = narrowPhaseInput.getSphereVsConvexPolyhedronBatch();
     NarrowPhaseInfoBatch& capsuleVsConvexPolyhedronBatchContacts = narrowPhaseInput.getCapsuleVsConvexPolyhedronBatch();
     NarrowPhaseInfoBatch& convexPolyhedronVsConvexPolyhedronBatchContacts = narrowPhaseInput.getConvexPolyhedronVsConvexPolyhedronBatch();
+    NarrowPhaseInfoBatch& boxVsBoxBatchContacts = narrowPhaseInput.getBoxVsBoxBatch();
+    TriangleNarrowPhaseInfoBatch& sphereVsTriangleBatchContacts = narrowPhaseInput.getSphereVsTriangleBatch();
+    TriangleNarrowPhaseInfoBatch& capsuleVsTriangleBatchContacts = narrowPhaseInput.getCapsuleVsTriangleBatch();
+    TriangleNarrowPhaseInfoBatch& boxVsTriangleBatchContacts = narrowPhaseInput.getBoxVsTriangleBatch();
+    NarrowPhaseInfoBatch& genericConvexBatchContacts = narrowPhaseInput.getGenericConvexBatch();
+    NarrowPhaseInfoBatch& convexVsConvexOverlapBatch = narrowPhaseInput.getConvexVsConvexOverlapBatch();
 
     // Compute the narrow-phase collision detection for each kind of collision shapes (for contacts)
     if (sphereVsSphereBatchContacts.getNbObjects() > 0) {
@@ -584,20 +768,51 @@ bool CollisionDetectionSystem::testNarrowPhaseCollision(NarrowPhaseInput& narrow
     if (convexPolyhedronVsConvexPolyhedronBatchContacts.getNbObjects() > 0) {
         contactFound |= convexPolyVsConvexPolyAlgo->testCollision(convexPolyhedronVsConvexPolyhedronBatchContacts, 0, convexPolyhedronVsConvexPolyhedronBatchContacts.getNbObjects(), clipWithPreviousAxisIfStillColliding, allocator);
     }
+    if (boxVsBoxBatchContacts.getNbObjects() > 0) {
+        contactFound |= boxVsBoxAlgo->testCollision(boxVsBoxBatchContacts, 0, boxVsBoxBatchContacts.getNbObjects(), clipWithPreviousAxisIfStillColliding, allocator);
+    }
+    if (sphereVsTriangleBatchContacts.getNbObjects() > 0) {
+        contactFound |= sphereVsTriangleAlgo->testCollision(sphereVsTriangleBatchContacts, 0, sphereVsTriangleBatchContacts.getNbObjects(), allocator);
+    }
+    if (capsuleVsTriangleBatchContacts.getNbObjects() > 0) {
+        contactFound |= capsuleVsTriangleAlgo->testCollision(capsuleVsTriangleBatchContacts, 0, capsuleVsTriangleBatchContacts.getNbObjects(), allocator);
+    }
+    if (boxVsTriangleBatchContacts.getNbObjects() > 0) {
+        contactFound |= boxVsTriangleAlgo->testCollision(boxVsTriangleBatchContacts, 0, boxVsTriangleBatchContacts.getNbObjects(), allocator);
+    }
+    if (genericConvexBatchContacts.getNbObjects() > 0) {
+        contactFound |= genericConvexAlgo->testCollision(genericConvexBatchContacts, 0, genericConvexBatchContacts.getNbObjects(), allocator);
+    }
+
+    // Test the pairs that do not need to report contacts for overlap only
+    if (convexVsConvexOverlapBatch.getNbObjects() > 0) {
+
+        GJKAlgorithm gjkAlgorithm;
+
+#ifdef IS_RP3D_PROFILING_ENABLED
+
+
+        gjkAlgorithm.setProfiler(mProfiler);
+
+#endif
+
+        contactFound |= gjkAlgorithm.testOverlap(convexVsConvexOverlapBatch, 0, convexVsConvexOverlapBatch.getNbObjects());
+    }
 
     return contactFound;
 }
 
 // Process the potential contacts after narrow-phase collision detection
-void CollisionDetectionSystem::processAllPotentialContacts(NarrowPhaseInput& narrowPhaseInput, bool updateLastFrameInfo,
+/// The contact pairs are linked with the ones of the previous frame (for the reuse of the persistent contacts)
+/// only if linkContactPairs is true. This must only be done by the narrow-phase of the world and not by
+/// the collision snapshots (testCollision() methods) that would overwrite the links between two frames.
+void CollisionDetectionSystem::processAllPotentialContacts(NarrowPhaseInput& narrowPhaseInput, bool updateLastFrameInfo, bool linkContactPairs,
                                                      Array<ContactPointInfo>& potentialContactPoints,
                                                      Array<ContactManifoldInfo>& potentialContactManifolds,
                                                      Array<ContactPair>* contactPairs) {
 
     assert(contactPairs->size() == 0);
 
-    Map<uint64, uint> mapPairIdToContactPairIndex(mMemoryManager.getHeapAllocator(), mPreviousMapPairIdToContactPairIndex.size());
-
     // get the narrow-phase batches to test for collision
     NarrowPhaseInfoBatch& sphereVsSphereBatch = narrowPhaseInput.getSphereVsSphereBatch();
     NarrowPhaseInfoBatch& sphereVsCapsuleBatch = narrowPhaseInput.getSphereVsCapsuleBatch();
@@ -605,15 +820,33 @@ void CollisionDetectionSystem::processAllPotentialContacts(NarrowPhaseInput& nar
     NarrowPhaseInfoBatch& sphereVsConvexPolyhedronBatch = narrowPhaseInput.getSphereVsConvexPolyhedronBatch();
     NarrowPhaseInfoBatch& capsuleVsConvexPolyhedronBatch = narrowPhaseInput.getCapsuleVsConvexPolyhedronBatch();
     NarrowPhaseInfoBatch& convexPolyhedronVsConvexPolyhedronBatch = narrowPhaseInput.getConvexPolyhedronVsConvexPolyhedronBatch();
+    NarrowPhaseInfoBatch& boxVsBoxBatch = narrowPhaseInput.getBoxVsBoxBatch();
+    NarrowPhaseInfoBatch& sphereVsTriangleBatch = narrowPhaseInput.getSphereVsTriangleBatch();
+    NarrowPhaseInfoBatch& capsuleVsTriangleBatch = narrowPhaseInput.getCapsuleVsTriangleBatch();
+    NarrowPhaseInfoBatch& boxVsTriangleBatch = narrowPhaseInput.getBoxVsTriangleBatch();
+    NarrowPhaseInfoBatch& genericConvexBatch = narrowPhaseInput.getGenericConvexBatch();
+    NarrowPhaseInfoBatch& convexVsConvexOverlapBatch = narrowPhaseInput.getConvexVsConvexOverlapBatch();
 
     // Process the potential contacts
-    processPotentialContacts(sphereVsSphereBatch, updateLastFrameInfo, potentialContactPoints, potentialContactManifolds, mapPairIdToContactPairIndex, contactPairs);
-    processPotentialContacts(sphereVsCapsuleBatch, updateLastFrameInfo, potentialContactPoints, potentialContactManifolds, mapPairIdToContactPairIndex, contactPairs);
-    processPotentialContacts(capsuleVsCapsuleBatch, updateLastFrameInfo, potentialContactPoints, potentialContactManifolds, mapPairIdToContactPairIndex, contactPairs);
-    processPotentialContacts(sphereVsConvexPolyhedronBatch, updateLastFrameInfo, potentialContactPoints, potentialContactManifolds, mapPairIdToContactPairIndex, contactPairs);
-    processPotentialContacts(capsuleVsConvexPolyhedronBatch, updateLastFrameInfo, potentialContactPoints, potentialContactManifolds, mapPairIdToContactPairIndex, contactPairs);
-    processPotentialContacts(convexPolyhedronVsConvexPolyhedronBatch, updateLastFrameInfo, potentialContactPoints,
-                             potentialContactManifolds, mapPairIdToContactPairIndex, contactPairs);
+    processPotentialContacts(sphereVsSphereBatch, updateLastFrameInfo, linkContactPairs, potentialContactPoints, potentialContactManifolds, contactPairs);
+    processPotentialContacts(sphereVsCapsuleBatch, updateLastFrameInfo, linkContactPairs, potentialContactPoints, potentialContactManifolds, contactPairs);
+    processPotentialContacts(capsuleVsCapsuleBatch, updateLastFrameInfo, linkContactPairs, potentialContactPoints, potentialContactManifolds, contactPairs);
+    processPotentialContacts(sphereVsConvexPolyhedronBatch, updateLastFrameInfo, linkContactPairs, potentialContactPoints, potentialContactManifolds, contactPairs);
+    processPotentialContacts(capsuleVsConvexPolyhedronBatch, updateLastFrameInfo, linkContactPairs, potentialContactPoints, potentialContactManifolds, contactPairs);
+    processPotentialContacts(convexPolyhedronVsConvexPolyhedronBatch, updateLastFrameInfo, linkContactPairs, potentialContactPoints,
+                             potentialContactManifolds, contactPairs);
+    processPotentialContacts(boxVsBoxBatch, updateLastFrameInfo, linkContactPairs, potentialContactPoints,
+                             potentialContactManifolds, contactPairs);
+    processPotentialContacts(sphereVsTriangleBatch, updateLastFrameInfo, linkContactPairs, potentialContactPoints,
+                             potentialContactManifolds, contactPairs);
+    processPotentialContacts(capsuleVsTriangleBatch, updateLastFrameInfo, linkContactPairs, potentialContactPoints,
+                             potentialContactManifolds, contactPairs);
+    processPotentialContacts(boxVsTriangleBatch, updateLastFrameInfo, linkContactPairs, potentialContactPoints,
+                             potentialContactManifolds, contactPairs);
+    processPotentialContacts(genericConvexBatch, updateLastFrameInfo, linkContactPairs, potentialContactPoints,
+                             potentialContactManifolds, contactPairs);
+    processPotentialContacts(convexVsConvexOverlapBatch, updateLastFrameInfo, linkContactPairs, potentialContactPoints,
+                             potentialContactManifolds, contactPairs);
 }
 
 // Compute the narrow-phase collision detection
@@ -633,9 +866,12 @@ void CollisionDetectionSystem::computeNarrowPhase() {
     testNarrowPhaseCollision(mNarrowPhaseInput, true, allocator);
 
     // Process all the potential contacts after narrow-phase collision
-    processAllPotentialContacts(mNarrowPhaseInput, true, mPotentialContactPoints,
+    processAllPotentialContacts(mNarrowPhaseInput, true, true, mPotentialContactPoints,
                                 mPotentialContactManifolds, mCurrentContactPairs);
 
+    // Add the contact pairs that have reused their contacts from the previous frame
+    addPersistentContactPairs(mCurrentContactPairs);
+
     // Reduce the number of contact points in the manifolds
     reducePotentialContactManifolds(mCurrentContactPairs, mPotentialContactManifolds, mPotentialContactPoints);
 
@@ -674,14 +910,19 @@ void CollisionDetectionSystem::addContactPairsToBodies() {
     }
 }
 
-// Compute the map from contact pairs ids to contact pair for the next frame
-void CollisionDetectionSystem::computeMapPreviousContactPairs() {
+// Link a new contact pair of the current frame with the contact pair of the previous frame of its overlapping pair
+/// The overlapping pair stores the index of its last contact pair. This index refers to the contact pair of the
+/// previous frame only if the contact pair at this index in the previous frame array has the same pair id.
+void CollisionDetectionSystem::linkContactPairWithPreviousOne(OverlappingPairs::OverlappingPair& overlappingPair, ContactPair& contactPair) {
 
-    mPreviousMapPairIdToContactPairIndex.clear();
-    const uint32 nbCurrentContactPairs = static_cast<uint32>(mCurrentContactPairs->size());
-    for (uint32 i=0; i < nbCurrentContactPairs; i++) {
-        mPreviousMapPairIdToContactPairIndex.add(Pair<uint64, uint>((*mCurrentContactPairs)[i].pairId, i));
+    const uint32 previousContactPairIndex = overlappingPair.contactPairIndex;
+    if (previousContactPairIndex < mPreviousContactPairs->size() &&
+        (*mPreviousContactPairs)[previousContactPairIndex].pairId == overlappingPair.pairID) {
+
+        contactPair.previousContactPairIndex = previousContactPairIndex;
     }
+
+    overlappingPair.contactPairIndex = contactPair.contactPairIndex;
 }
 
 // Compute the narrow-phase collision detection for the testOverlap() methods.
@@ -721,6 +962,12 @@ void CollisionDetectionSystem::computeOverlapSnapshotContactPairs(NarrowPhaseInp
     NarrowPhaseInfoBatch& sphereVsConvexPolyhedronBatch = narrowPhaseInput.getSphereVsConvexPolyhedronBatch();
     NarrowPhaseInfoBatch& capsuleVsConvexPolyhedronBatch = narrowPhaseInput.getCapsuleVsConvexPolyhedronBatch();
     NarrowPhaseInfoBatch& convexPolyhedronVsConvexPolyhedronBatch = narrowPhaseInput.getConvexPolyhedronVsConvexPolyhedronBatch();
+    NarrowPhaseInfoBatch& boxVsBoxBatch = narrowPhaseInput.getBoxVsBoxBatch();
+    NarrowPhaseInfoBatch& sphereVsTriangleBatch = narrowPhaseInput.getSphereVsTriangleBatch();
+    NarrowPhaseInfoBatch& capsuleVsTriangleBatch = narrowPhaseInput.getCapsuleVsTriangleBatch();
+    NarrowPhaseInfoBatch& boxVsTriangleBatch = narrowPhaseInput.getBoxVsTriangleBatch();
+    NarrowPhaseInfoBatch& genericConvexBatch = narrowPhaseInput.getGenericConvexBatch();
+    NarrowPhaseInfoBatch& convexVsConvexOverlapBatch = narrowPhaseInput.getConvexVsConvexOverlapBatch();
 
     // Process the potential contacts
     computeOverlapSnapshotContactPairs(sphereVsSphereBatch, contactPairs, setOverlapContactPairId);
@@ -729,6 +976,12 @@ void CollisionDetectionSystem::computeOverlapSnapshotContactPairs(NarrowPhaseInp
     computeOverlapSnapshotContactPairs(sphereVsConvexPolyhedronBatch, contactPairs, setOverlapContactPairId);
     computeOverlapSnapshotContactPairs(capsuleVsConvexPolyhedronBatch, contactPairs, setOverlapContactPairId);
     computeOverlapSnapshotContactPairs(convexPolyhedronVsConvexPolyhedronBatch, contactPairs, setOverlapContactPairId);
+    computeOverlapSnapshotContactPairs(boxVsBoxBatch, contactPairs, setOverlapContactPairId);
+    computeOverlapSnapshotContactPairs(sphereVsTriangleBatch, contactPairs, setOverlapContactPairId);
+    computeOverlapSnapshotContactPairs(capsuleVsTriangleBatch, contactPairs, setOverlapContactPairId);
+    computeOverlapSnapshotContactPairs(boxVsTriangleBatch, contactPairs, setOverlapContactPairId);
+    computeOverlapSnapshotContactPairs(genericConvexBatch, contactPairs, setOverlapContactPairId);
+    computeOverlapSnapshotContactPairs(convexVsConvexOverlapBatch, contactPairs, setOverlapContactPairId);
 }
 
 // Notify that the overlapping pairs where a given collider is involved need to be tested for overlap
@@ -805,7 +1058,8 @@ bool CollisionDetectionSystem::computeNarrowPhaseCollisionSnapshot(NarrowPhaseIn
         Array<ContactPoint> contactPoints(allocator);
 
         // Process all the potential contacts after narrow-phase collision
-        processAllPotentialContacts(narrowPhaseInput, true, potentialContactPoints, potentialContactManifolds, &contactPairs);
+        // The contact pairs are not linked with the ones of the previous frame of the world
+        processAllPotentialContacts(narrowPhaseInput, true, false, potentialContactPoints, potentialContactManifolds, &contactPairs);
 
         // Reduce the number of contact points in the manifolds
         reducePotentialContactManifolds(&contactPairs, potentialContactManifolds, potentialContactPoints);
@@ -915,9 +1169,6 @@ void CollisionDetectionSystem::createContacts() {
     mPotentialContactPoints.clear(true);
     mPotentialContactManifolds.clear(true);
 
-    // Compute the map from contact pairs ids to contact pair for the next frame
-    computeMapPreviousContactPairs();
-
     mCollisionBodyContactPairsIndices.clear(true);
 
     mNarrowPhaseInput.clear();
@@ -989,7 +1240,7 @@ void CollisionDetectionSystem::createSnapshotContacts(Array<ContactPair>& contac
 
             // Start index and number of contact points for this manifold
             const uint32 contactPointsIndex = static_cast<uint32>(contactPoints.size());
-            const uint8 nbContactPoints = potentialManifold.nbPotentialContactPoints;
+            const uint8 nbContactPoints = static_cast<uint8>(potentialManifold.nbPotentialContactPoints);
             contactPair.nbToTalContactPoints += nbContactPoints;
 
             // Create and add the contact manifold
@@ -1024,13 +1275,10 @@ void CollisionDetectionSystem::initContactsWithPreviousOnes() {
 
         ContactPair& currentContactPair = (*mCurrentContactPairs)[i];
 
-        // Find the corresponding contact pair in the previous frame (if any)
-        auto itPrevContactPair = mPreviousMapPairIdToContactPairIndex.find(currentContactPair.pairId);
-
         // If we have found a corresponding contact pair in the previous frame
-        if (itPrevContactPair != mPreviousMapPairIdToContactPairIndex.end()) {
+        const uint32 previousContactPairIndex = currentContactPair.previousContactPairIndex;
+        if (previousContactPairIndex != ContactPair::INVALID_INDEX) {
 
-            const uint32 previousContactPairIndex = itPrevContactPair->second;
             ContactPair& previousContactPair = (*mPreviousContactPairs)[previousContactPairIndex];
 
             // --------------------- Contact Manifolds --------------------- //
@@ -1132,7 +1380,7 @@ void CollisionDetectionSystem::removeCollider(Collider* collider) {
 }
 
 // Ray casting method
-void CollisionDetectionSystem::raycast(RaycastCallback* raycastCallback, const Ray& ray, unsigned short raycastWithCategoryMaskBits) const {
+void CollisionDetectionSystem::raycast(RaycastCallback* raycastCallback, const Ray& ray, uint64 raycastWithCategoryMaskBits) const {
 
     RP3D_PROFILE("CollisionDetectionSystem::raycast()", mProfiler);
 
@@ -1143,11 +1391,122 @@ void CollisionDetectionSystem::raycast(RaycastCallback* raycastCallback, const R
     mBroadPhaseSystem.raycast(ray, rayCastTest, raycastWithCategoryMaskBits);
 }
 
+// Compute the time of impact of a moving collider against the colliders of the static bodies
+/// The collider is translated from its start transform (its orientation does not change). The colliders
+/// of the static rigid bodies overlapping with the AABB swept by the collider are found with the broad-phase
+/// and the time of impact against each of them is computed with the GJK conservative advancement. For a
+/// concave collider, each triangle overlapping with the swept AABB is tested. This method returns true if
+/// the collider hits a static collider before the time of impact in parameter (between zero and one),
+/// which is then replaced by the new time of impact. The normal at the impact (from the moving collider
+/// towards the static one in world-space) is also returned.
+bool CollisionDetectionSystem::computeTimeOfImpactWithStaticColliders(Entity colliderEntity, const Transform& colliderStartToWorld,
+                                                                      const Vector3& translation, decimal& inOutTimeOfImpact,
+                                                                      Vector3& outNormal) {
+
+    RP3D_PROFILE("CollisionDetectionSystem::computeTimeOfImpactWithStaticColliders()", mProfiler);
+
+    const uint32 colliderIndex = mCollidersComponents.getEntityIndex(colliderEntity);
+    const CollisionShape* collisionShape = mCollidersComponents.mCollisionShapes[colliderIndex];
+
+    // Only a convex collider can be swept
+    if (!collisionShape->isConvex()) return false;
+
+    const ConvexShape* convexShape = static_cast<const ConvexShape*>(collisionShape);
+    const Entity bodyEntity = mCollidersComponents.mBodiesEntities[colliderIndex];
+
+    MemoryAllocator& allocator = mMemoryManager.getSingleFrameAllocator();
+
+    // Compute the world-space AABB swept by the collider
+    AABB sweptAABB;
+    convexShape->computeAABB(sweptAABB, colliderStartToWorld);
+    sweptAABB.mergeWithAABB(AABB(sweptAABB.getMin() + translation, sweptAABB.getMax() + translation));
+
+    // Find the colliders overlapping with the swept AABB in the broad-phase
+    Array<Collider*> overlappingColliders(allocator, 16);
+    mBroadPhaseSystem.reportAllCollidersOverlappingWithAABB(sweptAABB, overlappingColliders, allocator);
+
+    GJKAlgorithm gjkAlgorithm;
+
+#ifdef IS_RP3D_PROFILING_ENABLED
+
+    gjkAlgorithm.setProfiler(mProfiler);
+
+#endif
+
+    bool isHit = false;
+    decimal timeOfImpact;
+    Vector3 normal;
+
+    for (uint32 i=0; i < overlappingColliders.size(); i++) {
+
+        const uint32 otherColliderIndex = mCollidersComponents.getEntityIndex(overlappingColliders[i]->getEntity());
+        const Entity otherBodyEntity = mCollidersComponents.mBodiesEntities[otherColliderIndex];
+
+        // Only the colliders of the static rigid bodies that can collide with the moving collider are considered
+        if (otherBodyEntity == bodyEntity || mCollidersComponents.mIsTrigger[otherColliderIndex] ||
+            !mRigidBodyComponents.hasComponent(otherBodyEntity) ||
+            mRigidBodyComponents.getBodyType(otherBodyEntity) != BodyType::STATIC ||
+            !mCollidersComponents.canCollide(colliderIndex, otherColliderIndex)) {
+
+            continue;
+        }
+
+        const Transform& otherColliderToWorld = mCollidersComponents.mLocalToWorldTransforms[otherColliderIndex];
+        const CollisionShape* otherCollisionShape = mCollidersComponents.mCollisionShapes[otherColliderIndex];
+
+        if (otherCollisionShape->isConvex()) {
+
+            if (gjkAlgorithm.computeTimeOfImpact(convexShape, colliderStartToWorld, translation,
+                                                 static_cast<const ConvexShape*>(otherCollisionShape), otherColliderToWorld,
+                                                 CCD_DISTANCE_TOLERANCE, timeOfImpact, normal) && timeOfImpact < inOutTimeOfImpact) {
+
+                inOutTimeOfImpact = timeOfImpact;
+                outNormal = normal;
+                isHit = true;
+            }
+        }
+        else {
+
+            // Compute the AABB swept by the collider in local-space of the concave shape
+            const Transform colliderStartToConcave = otherColliderToWorld.getInverse() * colliderStartToWorld;
+            const Vector3 localTranslation = otherColliderToWorld.getOrientation().getInverse() * translation;
+            AABB localSweptAABB;
+            convexShape->computeAABB(localSweptAABB, colliderStartToConcave);
+            localSweptAABB.mergeWithAABB(AABB(localSweptAABB.getMin() + localTranslation, localSweptAABB.getMax() + localTranslation));
+
+            // Compute the triangles of the concave shape overlapping with the swept AABB
+            mOverlappingTrianglesShapeIds.clear();
+            mOverlappingTrianglesVertices.clear();
+            mOverlappingTrianglesConvexEdges.clear();
+            static_cast<const ConcaveShape*>(otherCollisionShape)->computeOverlappingTriangles(localSweptAABB, mOverlappingTrianglesVertices,
+                                                                                             mOverlappingTrianglesConvexEdges,
+                                                                                             mOverlappingTrianglesShapeIds, allocator);
+
+            // For each overlapping triangle
+            for (uint32 t=0; t < mOverlappingTrianglesShapeIds.size(); t++) {
+
+                const TriangleShape triangleShape(&(mOverlappingTrianglesVertices[t * 3]), mOverlappingTrianglesShapeIds[t],
+                                                  mTriangleHalfEdgeStructure, allocator);
+
+                if (gjkAlgorithm.computeTimeOfImpact(convexShape, colliderStartToWorld, translation, &triangleShape,
+                                                     otherColliderToWorld, CCD_DISTANCE_TOLERANCE, timeOfImpact, normal) &&
+                    timeOfImpact < inOutTimeOfImpact) {
+
+                    inOutTimeOfImpact = timeOfImpact;
+                    outNormal = normal;
+                    isHit = true;
+                }
+            }
+        }
+    }
+
+    return isHit;
+}
+
 // Convert the potential contact into actual contacts
-void CollisionDetectionSystem::processPotentialContacts(NarrowPhaseInfoBatch& narrowPhaseInfoBatch, bool updateLastFrameInfo,
+void CollisionDetectionSystem::processPotentialContacts(NarrowPhaseInfoBatch& narrowPhaseInfoBatch, bool updateLastFrameInfo, bool linkContactPairs,
                                                         Array<ContactPointInfo>& potentialContactPoints,
                                                         Array<ContactManifoldInfo>& potentialContactManifolds,
-                                                        Map<uint64, uint>& mapPairIdToContactPairIndex,
                                                         Array<ContactPair>* contactPairs) {
 
     RP3D_PROFILE("CollisionDetectionSystem::processPotentialContacts()", mProfiler);
@@ -1159,10 +1518,16 @@ void CollisionDetectionSystem::processPotentialContacts(NarrowPhaseInfoBatch& na
         // For each narrow phase info object
         for(uint32 i=0; i < nbObjects; i++) {
 
-            narrowPhaseInfoBatch.narrowPhaseInfos[i].lastFrameCollisionInfo->wasColliding = narrowPhaseInfoBatch.narrowPhaseInfos[i].isColliding;
+            LastFrameCollisionInfo* lastFrameCollisionInfo = narrowPhaseInfoBatch.narrowPhaseInfos[i].lastFrameCollisionInfo;
+
+            // The triangles of the sphere vs triangle batch do not have a last frame collision info
+            if (lastFrameCollisionInfo != nullptr) {
 
-            // The previous frame collision info is now valid
-            narrowPhaseInfoBatch.narrowPhaseInfos[i].lastFrameCollisionInfo->isValid = true;
+                lastFrameCollisionInfo->wasColliding = narrowPhaseInfoBatch.narrowPhaseInfos[i].isColliding;
+
+                // The previous frame collision info is now valid
+                lastFrameCollisionInfo->isValid = true;
+            }
         }
     }
 
@@ -1173,8 +1538,8 @@ void CollisionDetectionSystem::processPotentialContacts(NarrowPhaseInfoBatch& na
         if (narrowPhaseInfoBatch.narrowPhaseInfos[i].isColliding) {
 
             const uint64 pairId = narrowPhaseInfoBatch.narrowPhaseInfos[i].overlappingPairId;
-            OverlappingPairs::OverlappingPair* overlappingPair = mOverlappingPairs.getOverlappingPair(pairId);
-            assert(overlappingPair != nullptr);
+            OverlappingPairs::OverlappingPair* overlappingPair = narrowPhaseInfoBatch.narrowPhaseInfos[i].overlappingPair;
+            assert(overlappingPair != nullptr && overlappingPair->pairID == pairId);
 
             overlappingPair->collidingInCurrentFrame = true;
 
@@ -1203,6 +1568,15 @@ void CollisionDetectionSystem::processPotentialContacts(NarrowPhaseInfoBatch& na
 
                 ContactPair* pairContact = &((*contactPairs)[newContactPairIndex]);
 
+                if (linkContactPairs) {
+                    linkContactPairWithPreviousOne(*overlappingPair, *pairContact);
+                }
+
+                // A pair that does not report contacts (trigger) only needs its contact pair
+                if (!narrowPhaseInfoBatch.narrowPhaseInfos[i].reportContacts) {
+                    continue;
+                }
+
                 // Create a new potential contact manifold for the overlapping pair
                 uint32 contactManifoldIndex = static_cast<uint>(potentialContactManifolds.size());
                 potentialContactManifolds.emplace(pairId);
@@ -1233,10 +1607,11 @@ void CollisionDetectionSystem::processPotentialContacts(NarrowPhaseInfoBatch& na
             }
             else {
 
-                // If there is not already a contact pair for this overlapping pair
-                auto it = mapPairIdToContactPairIndex.find(pairId);
+                // The narrow-phase infos of the triangles of a concave overlapping pair are contiguous in the batch.
+                // Therefore, if a contact pair already exists for this overlapping pair, it is the last one of the array
                 ContactPair* pairContact = nullptr;
-                if (it == mapPairIdToContactPairIndex.end()) {
+                const uint32 nbContactPairs = static_cast<uint32>(contactPairs->size());
+                if (nbContactPairs == 0 || (*contactPairs)[nbContactPairs - 1].pairId != pairId) {
 
                     // Create a new ContactPair
 
@@ -1248,15 +1623,14 @@ void CollisionDetectionSystem::processPotentialContacts(NarrowPhaseInfoBatch& na
                     contactPairs->emplace(pairId, body1Entity, body2Entity, collider1Entity, collider2Entity,
                                                        newContactPairIndex, overlappingPair->collidingInPreviousFrame , isTrigger);
                     pairContact = &((*contactPairs)[newContactPairIndex]);
-                    mapPairIdToContactPairIndex.add(Pair<uint64, uint>(pairId, newContactPairIndex));
 
+                    if (linkContactPairs) {
+                        linkContactPairWithPreviousOne(*overlappingPair, *pairContact);
+                    }
                 }
                 else { // If a ContactPair already exists for this overlapping pair, we use this one
 
-                    assert(it->first == pairId);
-
-                    const uint32 pairContactIndex = it->second;
-                    pairContact = &((*contactPairs)[pairContactIndex]);
+                    pairContact = &((*contactPairs)[nbContactPairs - 1]);
                 }
 
                 assert(pairContact != nullptr);
@@ -1277,27 +1651,31 @@ void CollisionDetectionSystem::processPotentialContacts(NarrowPhaseInfoBatch& na
                     for (uint32 m=0; m < pairContact->nbPotentialContactManifolds; m++) {
 
                        uint32 contactManifoldIndex = pairContact->potentialContactManifoldsIndices[m];
+                       ContactManifoldInfo& contactManifoldInfo = potentialContactManifolds[contactManifoldIndex];
 
-                       if (potentialContactManifolds[contactManifoldIndex].nbPotentialContactPoints < NB_MAX_CONTACT_POINTS_IN_POTENTIAL_MANIFOLD) {
+                       // Get the first contact point of the current manifold
+                       assert(contactManifoldInfo.nbPotentialContactPoints > 0);
+                       const uint manifoldContactPointIndex = contactManifoldInfo.potentialContactPointsIndices[0];
+                       const ContactPointInfo& manifoldContactPoint = potentialContactPoints[manifoldContactPointIndex];
 
-                           // Get the first contact point of the current manifold
-                           assert(potentialContactManifolds[contactManifoldIndex].nbPotentialContactPoints > 0);
-                           const uint manifoldContactPointIndex = potentialContactManifolds[contactManifoldIndex].potentialContactPointsIndices[0];
-                           const ContactPointInfo& manifoldContactPoint = potentialContactPoints[manifoldContactPointIndex];
+                        // If we have found a corresponding manifold for the new contact point
+                        // (a manifold with a similar contact normal direction)
+                        if (manifoldContactPoint.normal.dot(contactPoint.normal) >= mWorld->mConfig.cosAngleSimilarContactManifold) {
 
-                            // If we have found a corresponding manifold for the new contact point
-                            // (a manifold with a similar contact normal direction)
-                            if (manifoldContactPoint.normal.dot(contactPoint.normal) >= mWorld->mConfig.cosAngleSimilarContactManifold) {
+                            // If the manifold is full, we reduce its contact points now (instead of dropping the new point)
+                            if (contactManifoldInfo.nbPotentialContactPoints == NB_MAX_CONTACT_POINTS_IN_POTENTIAL_MANIFOLD) {
+                                reduceContactPoints(contactManifoldInfo, narrowPhaseInfoBatch.narrowPhaseInfos[i].shape1ToWorldTransform,
+                                                    potentialContactPoints);
+                            }
 
-                                // Add the contact point to the manifold
-                                potentialContactManifolds[contactManifoldIndex].potentialContactPointsIndices[potentialContactManifolds[contactManifoldIndex].nbPotentialContactPoints] = contactPointIndex;
-                                potentialContactManifolds[contactManifoldIndex].nbPotentialContactPoints++;
+                            // Add the contact point to the manifold
+                            contactManifoldInfo.potentialContactPointsIndices[contactManifoldInfo.nbPotentialContactPoints] = contactPointIndex;
+                            contactManifoldInfo.nbPotentialContactPoints++;
 
-                                similarManifoldFound = true;
+                            similarManifoldFound = true;
 
-                                break;
-                            }
-                       }
+                            break;
+                        }
                     }
 
                     // If we have not found a manifold with a similar contact normal for the contact point
@@ -1425,20 +1803,24 @@ void CollisionDetectionSystem::reduceContactPoints(ContactManifoldInfo& manifold
     // The following algorithm only works to reduce to a maximum of 4 contact points
     assert(MAX_CONTACT_POINTS_IN_MANIFOLD == 4);
 
-    // Array of the candidate contact points indices in the manifold. Every time that we have found a
-    // point we want to keep, we will remove it from this array
-    uint candidatePointsIndices[NB_MAX_CONTACT_POINTS_IN_POTENTIAL_MANIFOLD];
-    uint8 nbCandidatePoints = manifold.nbPotentialContactPoints;
-    for (uint8 i=0 ; i < manifold.nbPotentialContactPoints; i++) {
-        candidatePointsIndices[i] = manifold.potentialContactPointsIndices[i];
+    const uint32 nbPoints = manifold.nbPotentialContactPoints;
+
+    // Copy the local points (on shape 1) of the contact points into a structure of arrays. This way, the
+    // metric of each pass below is computed for all the points with a single loop over contiguous data
+    // that the compiler can vectorize. The selected points are then found with a scan of the metrics.
+    decimal pointsX[NB_MAX_CONTACT_POINTS_IN_POTENTIAL_MANIFOLD];
+    decimal pointsY[NB_MAX_CONTACT_POINTS_IN_POTENTIAL_MANIFOLD];
+    decimal pointsZ[NB_MAX_CONTACT_POINTS_IN_POTENTIAL_MANIFOLD];
+    decimal metrics[NB_MAX_CONTACT_POINTS_IN_POTENTIAL_MANIFOLD];
+    for (uint32 i=0; i < nbPoints; i++) {
+        const Vector3& point = potentialContactPoints[manifold.potentialContactPointsIndices[i]].localPoint1;
+        pointsX[i] = point.x;
+        pointsY[i] = point.y;
+        pointsZ[i] = point.z;
     }
 
-    int8 nbReducedPoints = 0;
-
-    uint32 pointsToKeepIndices[MAX_CONTACT_POINTS_IN_MANIFOLD];
-    for (int8 i=0; i<MAX_CONTACT_POINTS_IN_MANIFOLD; i++) {
-        pointsToKeepIndices[i] = 0;
-    }
+    // Indices (in the manifold) of the contact points we keep
+    uint32 pointsToKeep[MAX_CONTACT_POINTS_IN_MANIFOLD];
 
     //  Compute the initial contact point we need to keep.
     // The first point we keep is always the point in a given
@@ -1449,148 +1831,107 @@ void CollisionDetectionSystem::reduceContactPoints(ContactManifoldInfo& manifold
 
     // Compute the contact normal of the manifold (we use the first contact point)
     // in the local-space of the first collision shape
-    const Vector3 contactNormalShape1Space = worldToShape1Transform.getOrientation() * potentialContactPoints[candidatePointsIndices[0]].normal;
-
-    // Compute a search direction
-    const Vector3 searchDirection(1, 1, 1);
-    decimal maxDotProduct = DECIMAL_SMALLEST;
-    uint32 elementIndexToKeep = 0;
-    for (uint32 i=0; i < nbCandidatePoints; i++) {
-
-        const ContactPointInfo& element = potentialContactPoints[candidatePointsIndices[i]];
-        decimal dotProduct = searchDirection.dot(element.localPoint1);
-        if (dotProduct > maxDotProduct) {
-            maxDotProduct = dotProduct;
-            elementIndexToKeep = i;
-            nbReducedPoints = 1;
+    const Vector3 contactNormalShape1Space = worldToShape1Transform.getOrientation() *
+                                             potentialContactPoints[manifold.potentialContactPointsIndices[0]].normal;
+
+    // The search direction is (1, 1, 1)
+    for (uint32 i=0; i < nbPoints; i++) {
+        metrics[i] = pointsX[i] + pointsY[i] + pointsZ[i];
+    }
+    pointsToKeep[0] = 0;
+    for (uint32 i=1; i < nbPoints; i++) {
+        if (metrics[i] > metrics[pointsToKeep[0]]) {
+            pointsToKeep[0] = i;
         }
     }
-    pointsToKeepIndices[0] = candidatePointsIndices[elementIndexToKeep];
-    removeItemAtInArray(candidatePointsIndices, elementIndexToKeep, nbCandidatePoints);
-    //candidatePointsIndices.removeAt(elementIndexToKeep);
-    assert(nbReducedPoints == 1);
 
     // Compute the second contact point we need to keep.
     // The second point we keep is the one farthest away from the first point.
 
-    decimal maxDistance = decimal(0.0);
-    elementIndexToKeep = 0;
-    for (uint32 i=0; i < nbCandidatePoints; i++) {
-
-        const ContactPointInfo& element = potentialContactPoints[candidatePointsIndices[i]];
-        const ContactPointInfo& pointToKeep0 = potentialContactPoints[pointsToKeepIndices[0]];
-
-        assert(candidatePointsIndices[i] != pointsToKeepIndices[0]);
-
-        const decimal distance = (pointToKeep0.localPoint1 - element.localPoint1).lengthSquare();
-        if (distance >= maxDistance) {
-            maxDistance = distance;
-            elementIndexToKeep = i;
-            nbReducedPoints = 2;
+    const decimal firstX = pointsX[pointsToKeep[0]];
+    const decimal firstY = pointsY[pointsToKeep[0]];
+    const decimal firstZ = pointsZ[pointsToKeep[0]];
+    for (uint32 i=0; i < nbPoints; i++) {
+        const decimal dx = pointsX[i] - firstX;
+        const decimal dy = pointsY[i] - firstY;
+        const decimal dz = pointsZ[i] - firstZ;
+        metrics[i] = dx * dx + dy * dy + dz * dz;
+    }
+    pointsToKeep[1] = pointsToKeep[0] == 0 ? 1 : 0;
+    for (uint32 i=0; i < nbPoints; i++) {
+        if (i != pointsToKeep[0] && metrics[i] >= metrics[pointsToKeep[1]]) {
+            pointsToKeep[1] = i;
         }
-
     }
-    pointsToKeepIndices[1] = candidatePointsIndices[elementIndexToKeep];
-    removeItemAtInArray(candidatePointsIndices, elementIndexToKeep, nbCandidatePoints);
-    assert(nbReducedPoints == 2);
 
     // Compute the third contact point we need to keep.
     // The third point is the one producing the triangle with the larger area
     // with first and second point.
 
+    // The signed area of the triangle (first, second, point) along the contact normal is an affine
+    // function of the point: n.((first - p) x (second - p)) = n.(first x second) + p.(n x (second - first))
+    const Vector3 first(firstX, firstY, firstZ);
+    const Vector3 second(pointsX[pointsToKeep[1]], pointsY[pointsToKeep[1]], pointsZ[pointsToKeep[1]]);
+    computeTriangleAreas(first, second, contactNormalShape1Space, pointsX, pointsY, pointsZ, nbPoints, metrics);
+
     // We compute the most positive or most negative triangle area (depending on winding)
     uint32 thirdPointMaxAreaIndex = 0;
     uint32 thirdPointMinAreaIndex = 0;
     decimal minArea = decimal(0.0);
     decimal maxArea = decimal(0.0);
-    bool isPreviousAreaPositive = true;
-    for (uint32 i=0; i < nbCandidatePoints; i++) {
-
-        const ContactPointInfo& element = potentialContactPoints[candidatePointsIndices[i]];
-        const ContactPointInfo& pointToKeep0 = potentialContactPoints[pointsToKeepIndices[0]];
-        const ContactPointInfo& pointToKeep1 = potentialContactPoints[pointsToKeepIndices[1]];
+    for (uint32 i=0; i < nbPoints; i++) {
 
-        assert(candidatePointsIndices[i] != pointsToKeepIndices[0]);
-        assert(candidatePointsIndices[i] != pointsToKeepIndices[1]);
+        if (i == pointsToKeep[0] || i == pointsToKeep[1]) continue;
 
-        const Vector3 newToFirst = pointToKeep0.localPoint1 - element.localPoint1;
-        const Vector3 newToSecond = pointToKeep1.localPoint1 - element.localPoint1;
-
-        // Compute the triangle area
-        decimal area = newToFirst.cross(newToSecond).dot(contactNormalShape1Space);
-
-        if (area >= maxArea) {
-            maxArea = area;
+        if (metrics[i] >= maxArea) {
+            maxArea = metrics[i];
             thirdPointMaxAreaIndex = i;
         }
-        if (area <= minArea) {
-            minArea = area;
+        if (metrics[i] <= minArea) {
+            minArea = metrics[i];
             thirdPointMinAreaIndex = i;
         }
     }
-    assert(minArea <= decimal(0.0));
-    assert(maxArea >= decimal(0.0));
-    if (maxArea > (-minArea)) {
-        isPreviousAreaPositive = true;
-        pointsToKeepIndices[2] = candidatePointsIndices[thirdPointMaxAreaIndex];
-        removeItemAtInArray(candidatePointsIndices, thirdPointMaxAreaIndex, nbCandidatePoints);
-    }
-    else {
-        isPreviousAreaPositive = false;
-        pointsToKeepIndices[2] = candidatePointsIndices[thirdPointMinAreaIndex];
-        removeItemAtInArray(candidatePointsIndices, thirdPointMinAreaIndex, nbCandidatePoints);
-    }
-    nbReducedPoints = 3;
+    const bool isPreviousAreaPositive = maxArea > (-minArea);
+    pointsToKeep[2] = isPreviousAreaPositive ? thirdPointMaxAreaIndex : thirdPointMinAreaIndex;
+    assert(pointsToKeep[2] != pointsToKeep[0] && pointsToKeep[2] != pointsToKeep[1]);
 
     // Compute the 4th point by choosing the triangle that adds the most
-    // triangle area to the previous triangle and has opposite sign area (opposite winding)
-
-    decimal largestArea = decimal(0.0); // Largest area (positive or negative)
-    elementIndexToKeep = 0;
-    nbReducedPoints = 4;
-    decimal area;
-
-    // For each remaining candidate points
-    for (uint32 i=0; i < nbCandidatePoints; i++) {
-
-        const ContactPointInfo& element = potentialContactPoints[candidatePointsIndices[i]];
-
-        assert(candidatePointsIndices[i] != pointsToKeepIndices[0]);
-        assert(candidatePointsIndices[i] != pointsToKeepIndices[1]);
-        assert(candidatePointsIndices[i] != pointsToKeepIndices[2]);
-
-        // For each edge of the triangle made by the first three points
-        for (uint32 j=0; j<3; j++) {
-
-            uint32 edgeVertex1Index = j;
-            uint32 edgeVertex2Index = j < 2 ? j + 1 : 0;
-
-            const ContactPointInfo& pointToKeepEdgeV1 = potentialContactPoints[pointsToKeepIndices[edgeVertex1Index]];
-            const ContactPointInfo& pointToKeepEdgeV2 = potentialContactPoints[pointsToKeepIndices[edgeVertex2Index]];
+    // triangle area to the previous triangle and has opposite sign area (opposite winding).
+    // If the previous area is positive, we are looking at negative area now.
+    // If the previous area is negative, we are looking at the positive area now.
+
+    // The areas of the triangles with the first edge (first, second) are already in the metrics array
+    const Vector3 third(pointsX[pointsToKeep[2]], pointsY[pointsToKeep[2]], pointsZ[pointsToKeep[2]]);
+    decimal edgeMetrics[NB_MAX_CONTACT_POINTS_IN_POTENTIAL_MANIFOLD];
+    computeTriangleAreas(second, third, contactNormalShape1Space, pointsX, pointsY, pointsZ, nbPoints, edgeMetrics);
+    const decimal sign = isPreviousAreaPositive ? decimal(-1.0) : decimal(1.0);
+    for (uint32 i=0; i < nbPoints; i++) {
+        metrics[i] = std::max(sign * metrics[i], sign * edgeMetrics[i]);
+    }
+    computeTriangleAreas(third, first, contactNormalShape1Space, pointsX, pointsY, pointsZ, nbPoints, edgeMetrics);
+    for (uint32 i=0; i < nbPoints; i++) {
+        metrics[i] = std::max(metrics[i], sign * edgeMetrics[i]);
+    }
 
-            const Vector3 newToFirst = pointToKeepEdgeV1.localPoint1 - element.localPoint1;
-            const Vector3 newToSecond = pointToKeepEdgeV2.localPoint1 - element.localPoint1;
+    decimal largestArea = decimal(0.0); // Largest area (with the opposite sign of the previous area)
+    pointsToKeep[3] = nbPoints;
+    for (uint32 i=0; i < nbPoints; i++) {
 
-            // Compute the triangle area
-            area = newToFirst.cross(newToSecond).dot(contactNormalShape1Space);
+        if (i == pointsToKeep[0] || i == pointsToKeep[1] || i == pointsToKeep[2]) continue;
 
-            // We are looking at the triangle with maximal area (positive or negative).
-            // If the previous area is positive, we are looking at negative area now.
-            // If the previous area is negative, we are looking at the positive area now.
-            if (isPreviousAreaPositive && area <= largestArea) {
-                largestArea = area;
-                elementIndexToKeep = i;
-            }
-            else if (!isPreviousAreaPositive && area >= largestArea) {
-                largestArea = area;
-                elementIndexToKeep = i;
-            }
+        // By default, we keep the first remaining candidate point
+        if (pointsToKeep[3] == nbPoints || metrics[i] >= largestArea) {
+            largestArea = std::max(metrics[i], largestArea);
+            pointsToKeep[3] = i;
         }
     }
-    pointsToKeepIndices[3] = candidatePointsIndices[elementIndexToKeep];
-    removeItemAtInArray(candidatePointsIndices, elementIndexToKeep, nbCandidatePoints);
 
     // Only keep the four selected contact points in the manifold
+    const uint32 pointsToKeepIndices[MAX_CONTACT_POINTS_IN_MANIFOLD] = {manifold.potentialContactPointsIndices[pointsToKeep[0]],
+                                                                        manifold.potentialContactPointsIndices[pointsToKeep[1]],
+                                                                        manifold.potentialContactPointsIndices[pointsToKeep[2]],
+                                                                        manifold.potentialContactPointsIndices[pointsToKeep[3]]};
     manifold.potentialContactPointsIndices[0] = pointsToKeepIndices[0];
     manifold.potentialContactPointsIndices[1] = pointsToKeepIndices[1];
     manifold.potentialContactPointsIndices[2] = pointsToKeepIndices[2];
@@ -1598,12 +1939,16 @@ void CollisionDetectionSystem::reduceContactPoints(ContactManifoldInfo& manifold
     manifold.nbPotentialContactPoints = 4;
 }
 
-// Remove an element in an array (and replace it by the last one in the array)
-void CollisionDetectionSystem::removeItemAtInArray(uint array[], uint8 index, uint8& arraySize) const {
-    assert(index < arraySize);
-    assert(arraySize > 0);
-    array[index] = array[arraySize - 1];
-    arraySize--;
+// Compute the signed areas (along a normal) of the triangles made by an edge and each point of a structure of arrays
+// The area of the triangle (a, b, p) is n.((a - p) x (b - p)) = n.(a x b) + p.(n x (b - a))
+void CollisionDetectionSystem::computeTriangleAreas(const Vector3& a, const Vector3& b, const Vector3& normal, const decimal pointsX[],
+                                                    const decimal pointsY[], const decimal pointsZ[], uint32 nbPoints, decimal outAreas[]) {
+
+    const decimal constantTerm = normal.dot(a.cross(b));
+    const Vector3 gradient = normal.cross(b - a);
+    for (uint32 i=0; i < nbPoints; i++) {
+        outAreas[i] = constantTerm + pointsX[i] * gradient.x + pointsY[i] * gradient.y + pointsZ[i] * gradient.z;
+    }
 }
 
 // Remove the duplicated contact points in a given contact manifold
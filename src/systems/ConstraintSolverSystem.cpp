@@ -33,7 +33,8 @@
 using namespace reactphysics3d;
 
 // Constructor
-ConstraintSolverSystem::ConstraintSolverSystem(PhysicsWorld& world, Islands& islands, RigidBodyComponents& rigidBodyComponents,
+ConstraintSolverSystem::ConstraintSolverSystem(PhysicsWorld& world, Islands& islands, SolverBodies& solverBodies,
+                                               RigidBodyComponents& rigidBodyComponents,
                                                TransformComponents& transformComponents,
                                                JointComponents& jointComponents,
                                                BallAndSocketJointComponents& ballAndSocketJointComponents,
@@ -42,10 +43,10 @@ ConstraintSolverSystem::ConstraintSolverSystem(PhysicsWorld& world, Islands& isl
                                                SliderJointComponents& sliderJointComponents)
                  : mIsWarmStartingActive(true), mIslands(islands),
                    mConstraintSolverData(rigidBodyComponents, jointComponents),
-                   mSolveBallAndSocketJointSystem(world, rigidBodyComponents, transformComponents, jointComponents, ballAndSocketJointComponents),
-                   mSolveFixedJointSystem(world, rigidBodyComponents, transformComponents, jointComponents, fixedJointComponents),
-                   mSolveHingeJointSystem(world, rigidBodyComponents, transformComponents, jointComponents, hingeJointComponents),
-                   mSolveSliderJointSystem(world, rigidBodyComponents, transformComponents, jointComponents, sliderJointComponents) {
+                   mSolveBallAndSocketJointSystem(world, solverBodies, rigidBodyComponents, transformComponents, jointComponents, ballAndSocketJointComponents),
+                   mSolveFixedJointSystem(world, solverBodies, rigidBodyComponents, transformComponents, jointComponents, fixedJointComponents),
+                   mSolveHingeJointSystem(world, solverBodies, rigidBodyComponents, transformComponents, jointComponents, hingeJointComponents),
+                   mSolveSliderJointSystem(world, solverBodies, rigidBodyComponents, transformComponents, jointComponents, sliderJointComponents) {
 
 #ifdef IS_RP3D_PROFILING_ENABLED
 
@@ -34,6 +34,7 @@
 #include <reactphysics3d/components/CollisionBodyComponents.h>
 #include <reactphysics3d/components/ColliderComponents.h>
 #include <reactphysics3d/collision/ContactManifold.h>
+#include <reactphysics3d/engine/SolverBodies.h>
 #include <algorithm>
 
 using namespace reactphysics3d;
@@ -43,14 +44,15 @@ using namespace std;
 const decimal ContactSolverSystem::BETA = decimal(0.2);
 const decimal ContactSolverSystem::BETA_SPLIT_IMPULSE = decimal(0.2);
 const decimal ContactSolverSystem::SLOP = decimal(0.01);
+const uint32 ContactSolverSystem::NB_MAX_SEARCHED_CONTACT_BATCHES = 8;
 
 // Constructor
 ContactSolverSystem::ContactSolverSystem(MemoryManager& memoryManager, PhysicsWorld& world, Islands& islands,
-                                         CollisionBodyComponents& bodyComponents, RigidBodyComponents& rigidBodyComponents,
+                                         SolverBodies& solverBodies, CollisionBodyComponents& bodyComponents, RigidBodyComponents& rigidBodyComponents,
                                          ColliderComponents& colliderComponents, decimal& restitutionVelocityThreshold)
               :mMemoryManager(memoryManager), mWorld(world), mRestitutionVelocityThreshold(restitutionVelocityThreshold),
-               mContactConstraints(nullptr), mContactPoints(nullptr),
-               mIslands(islands), mAllContactManifolds(nullptr), mAllContactPoints(nullptr),
+               mContactConstraints(nullptr), mContactPoints(nullptr), mContactBatches(nullptr), mNbContactBatches(0),
+               mIslands(islands), mSolverBodies(solverBodies), mAllContactManifolds(nullptr), mAllContactPoints(nullptr),
                mBodyComponents(bodyComponents), mRigidBodyComponents(rigidBodyComponents),
                mColliderComponents(colliderComponents), mIsSplitImpulseActive(true) {
 
@@ -76,9 +78,11 @@ void ContactSolverSystem::init(Array<ContactManifold>* contactManifolds, Array<C
 
     mNbContactManifolds = 0;
     mNbContactPoints = 0;
+    mNbContactBatches = 0;
 
     mContactConstraints = nullptr;
     mContactPoints = nullptr;
+    mContactBatches = nullptr;
 
     if (nbContactManifolds == 0 || nbContactPoints == 0) return;
 
@@ -101,6 +105,9 @@ void ContactSolverSystem::init(Array<ContactManifold>* contactManifolds, Array<C
 
     // Warmstarting
     warmStart();
+
+    // Pack the contact constraints into batches for the solver
+    createContactBatches();
 }
 
 // Release allocated memory
@@ -108,6 +115,7 @@ void ContactSolverSystem::reset() {
 
     if (mAllContactPoints->size() > 0) mMemoryManager.release(MemoryManager::AllocationType::Frame, mContactPoints, sizeof(ContactPointSolver) * mAllContactPoints->size());
     if (mAllContactManifolds->size() > 0) mMemoryManager.release(MemoryManager::AllocationType::Frame, mContactConstraints, sizeof(ContactManifoldSolver) * mAllContactManifolds->size());
+    if (mNbContactBatches > 0) mMemoryManager.release(MemoryManager::AllocationType::Frame, mContactBatches, sizeof(ContactBatchSolver) * mNbContactBatches);
 }
 
 // Initialize the constraint solver for a given island
@@ -129,6 +137,8 @@ void ContactSolverSystem::initializeForIsland(uint32 islandIndex) {
 
         const uint32 rigidBodyIndex1 = mRigidBodyComponents.getEntityIndex(externalManifold.bodyEntity1);
         const uint32 rigidBodyIndex2 = mRigidBodyComponents.getEntityIndex(externalManifold.bodyEntity2);
+        const uint32 solverBodyIndex1 = mSolverBodies.getSolverBodyIndex(rigidBodyIndex1);
+        const uint32 solverBodyIndex2 = mSolverBodies.getSolverBodyIndex(rigidBodyIndex2);
 
         // Get the two bodies of the contact
         assert(!mBodyComponents.getIsEntityDisabled(externalManifold.bodyEntity1));
@@ -143,16 +153,16 @@ void ContactSolverSystem::initializeForIsland(uint32 islandIndex) {
 
         // Initialize the internal contact manifold structure using the external contact manifold
         new (mContactConstraints + mNbContactManifolds) ContactManifoldSolver();
-        mContactConstraints[mNbContactManifolds].rigidBodyComponentIndexBody1 = rigidBodyIndex1;
-        mContactConstraints[mNbContactManifolds].rigidBodyComponentIndexBody2 = rigidBodyIndex2;
-        mContactConstraints[mNbContactManifolds].inverseInertiaTensorBody1 = mRigidBodyComponents.mInverseInertiaTensorsWorld[rigidBodyIndex1];
-        mContactConstraints[mNbContactManifolds].inverseInertiaTensorBody2 = mRigidBodyComponents.mInverseInertiaTensorsWorld[rigidBodyIndex2];
-        mContactConstraints[mNbContactManifolds].massInverseBody1 = mRigidBodyComponents.mInverseMasses[rigidBodyIndex1];
-        mContactConstraints[mNbContactManifolds].massInverseBody2 = mRigidBodyComponents.mInverseMasses[rigidBodyIndex2];
-        mContactConstraints[mNbContactManifolds].linearLockAxisFactorBody1 = mRigidBodyComponents.mLinearLockAxisFactors[rigidBodyIndex1];
-        mContactConstraints[mNbContactManifolds].linearLockAxisFactorBody2 = mRigidBodyComponents.mLinearLockAxisFactors[rigidBodyIndex2];
-        mContactConstraints[mNbContactManifolds].angularLockAxisFactorBody1 = mRigidBodyComponents.mAngularLockAxisFactors[rigidBodyIndex1];
-        mContactConstraints[mNbContactManifolds].angularLockAxisFactorBody2 = mRigidBodyComponents.mAngularLockAxisFactors[rigidBodyIndex2];
+        mContactConstraints[mNbContactManifolds].solverBodyIndexBody1 = solverBodyIndex1;
+        mContactConstraints[mNbContactManifolds].solverBodyIndexBody2 = solverBodyIndex2;
+        mContactConstraints[mNbContactManifolds].inverseInertiaTensorBody1 = mSolverBodies.inverseInertiaTensorsWorld[solverBodyIndex1];
+        mContactConstraints[mNbContactManifolds].inverseInertiaTensorBody2 = mSolverBodies.inverseInertiaTensorsWorld[solverBodyIndex2];
+        mContactConstraints[mNbContactManifolds].massInverseBody1 = mSolverBodies.inverseMasses[solverBodyIndex1];
+        mContactConstraints[mNbContactManifolds].massInverseBody2 = mSolverBodies.inverseMasses[solverBodyIndex2];
+        mContactConstraints[mNbContactManifolds].linearLockAxisFactorBody1 = mSolverBodies.linearLockAxisFactors[solverBodyIndex1];
+        mContactConstraints[mNbContactManifolds].linearLockAxisFactorBody2 = mSolverBodies.linearLockAxisFactors[solverBodyIndex2];
+        mContactConstraints[mNbContactManifolds].angularLockAxisFactorBody1 = mSolverBodies.angularLockAxisFactors[solverBodyIndex1];
+        mContactConstraints[mNbContactManifolds].angularLockAxisFactorBody2 = mSolverBodies.angularLockAxisFactors[solverBodyIndex2];
         mContactConstraints[mNbContactManifolds].nbContacts = externalManifold.nbContactPoints;
         mContactConstraints[mNbContactManifolds].frictionCoefficient = computeMixedFrictionCoefficient(mColliderComponents.mMaterials[collider1Index], mColliderComponents.mMaterials[collider2Index]);
         mContactConstraints[mNbContactManifolds].externalContactManifold = &externalManifold;
@@ -342,8 +352,8 @@ void ContactSolverSystem::warmStart() {
             // If it is not a new contact (this contact was already existing at last time step)
             if (mContactPoints[contactPointIndex].isRestingContact) {
 
-                const uint32 rigidBody1Index = mContactConstraints[c].rigidBodyComponentIndexBody1;
-                const uint32 rigidBody2Index = mContactConstraints[c].rigidBodyComponentIndexBody2;
+                const uint32 solverBody1Index = mContactConstraints[c].solverBodyIndexBody1;
+                const uint32 solverBody2Index = mContactConstraints[c].solverBodyIndexBody2;
 
                 atLeastOneRestingContactPoint = true;
 
@@ -353,22 +363,22 @@ void ContactSolverSystem::warmStart() {
                 Vector3 impulsePenetration(mContactPoints[contactPointIndex].normal.x * mContactPoints[contactPointIndex].penetrationImpulse,
                                            mContactPoints[contactPointIndex].normal.y * mContactPoints[contactPointIndex].penetrationImpulse,
                                            mContactPoints[contactPointIndex].normal.z * mContactPoints[contactPointIndex].penetrationImpulse);
-                mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody1Index].x -= mContactConstraints[c].massInverseBody1 * impulsePenetration.x * mContactConstraints[c].linearLockAxisFactorBody1.x;
-                mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody1Index].y -= mContactConstraints[c].massInverseBody1 * impulsePenetration.y * mContactConstraints[c].linearLockAxisFactorBody1.y;
-                mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody1Index].z -= mContactConstraints[c].massInverseBody1 * impulsePenetration.z * mContactConstraints[c].linearLockAxisFactorBody1.z;
+                mSolverBodies.linearVelocities[solverBody1Index].x -= mContactConstraints[c].massInverseBody1 * impulsePenetration.x * mContactConstraints[c].linearLockAxisFactorBody1.x;
+                mSolverBodies.linearVelocities[solverBody1Index].y -= mContactConstraints[c].massInverseBody1 * impulsePenetration.y * mContactConstraints[c].linearLockAxisFactorBody1.y;
+                mSolverBodies.linearVelocities[solverBody1Index].z -= mContactConstraints[c].massInverseBody1 * impulsePenetration.z * mContactConstraints[c].linearLockAxisFactorBody1.z;
 
-                mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody1Index].x -= mContactPoints[contactPointIndex].i1TimesR1CrossN.x * mContactConstraints[c].angularLockAxisFactorBody1.x * mContactPoints[contactPointIndex].penetrationImpulse;
-                mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody1Index].y -= mContactPoints[contactPointIndex].i1TimesR1CrossN.y * mContactConstraints[c].angularLockAxisFactorBody1.y * mContactPoints[contactPointIndex].penetrationImpulse;
-                mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody1Index].z -= mContactPoints[contactPointIndex].i1TimesR1CrossN.z * mContactConstraints[c].angularLockAxisFactorBody1.z * mContactPoints[contactPointIndex].penetrationImpulse;
+                mSolverBodies.angularVelocities[solverBody1Index].x -= mContactPoints[contactPointIndex].i1TimesR1CrossN.x * mContactConstraints[c].angularLockAxisFactorBody1.x * mContactPoints[contactPointIndex].penetrationImpulse;
+                mSolverBodies.angularVelocities[solverBody1Index].y -= mContactPoints[contactPointIndex].i1TimesR1CrossN.y * mContactConstraints[c].angularLockAxisFactorBody1.y * mContactPoints[contactPointIndex].penetrationImpulse;
+                mSolverBodies.angularVelocities[solverBody1Index].z -= mContactPoints[contactPointIndex].i1TimesR1CrossN.z * mContactConstraints[c].angularLockAxisFactorBody1.z * mContactPoints[contactPointIndex].penetrationImpulse;
 
                 // Update the velocities of the body 2 by applying the impulse P
-                mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody2Index].x += mContactConstraints[c].massInverseBody2 * impulsePenetration.x * mContactConstraints[c].linearLockAxisFactorBody2.x;
-                mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody2Index].y += mContactConstraints[c].massInverseBody2 * impulsePenetration.y * mContactConstraints[c].linearLockAxisFactorBody2.y;
-                mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody2Index].z += mContactConstraints[c].massInverseBody2 * impulsePenetration.z * mContactConstraints[c].linearLockAxisFactorBody2.z;
+                mSolverBodies.linearVelocities[solverBody2Index].x += mContactConstraints[c].massInverseBody2 * impulsePenetration.x * mContactConstraints[c].linearLockAxisFactorBody2.x;
+                mSolverBodies.linearVelocities[solverBody2Index].y += mContactConstraints[c].massInverseBody2 * impulsePenetration.y * mContactConstraints[c].linearLockAxisFactorBody2.y;
+                mSolverBodies.linearVelocities[solverBody2Index].z += mContactConstraints[c].massInverseBody2 * impulsePenetration.z * mContactConstraints[c].linearLockAxisFactorBody2.z;
 
-                mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody2Index].x += mContactPoints[contactPointIndex].i2TimesR2CrossN.x * mContactConstraints[c].angularLockAxisFactorBody2.x * mContactPoints[contactPointIndex].penetrationImpulse;
-                mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody2Index].y += mContactPoints[contactPointIndex].i2TimesR2CrossN.y * mContactConstraints[c].angularLockAxisFactorBody2.y * mContactPoints[contactPointIndex].penetrationImpulse;
-                mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody2Index].z += mContactPoints[contactPointIndex].i2TimesR2CrossN.z * mContactConstraints[c].angularLockAxisFactorBody2.z * mContactPoints[contactPointIndex].penetrationImpulse;
+                mSolverBodies.angularVelocities[solverBody2Index].x += mContactPoints[contactPointIndex].i2TimesR2CrossN.x * mContactConstraints[c].angularLockAxisFactorBody2.x * mContactPoints[contactPointIndex].penetrationImpulse;
+                mSolverBodies.angularVelocities[solverBody2Index].y += mContactPoints[contactPointIndex].i2TimesR2CrossN.y * mContactConstraints[c].angularLockAxisFactorBody2.y * mContactPoints[contactPointIndex].penetrationImpulse;
+                mSolverBodies.angularVelocities[solverBody2Index].z += mContactPoints[contactPointIndex].i2TimesR2CrossN.z * mContactConstraints[c].angularLockAxisFactorBody2.z * mContactPoints[contactPointIndex].penetrationImpulse;
             }
             else {  // If it is a new contact point
 
@@ -407,16 +417,16 @@ void ContactSolverSystem::warmStart() {
                                         mContactConstraints[c].r2CrossT1.y * mContactConstraints[c].friction1Impulse,
                                         mContactConstraints[c].r2CrossT1.z * mContactConstraints[c].friction1Impulse);
 
-            const uint32 rigidBody1Index = mContactConstraints[c].rigidBodyComponentIndexBody1;
-            const uint32 rigidBody2Index = mContactConstraints[c].rigidBodyComponentIndexBody2;
+            const uint32 solverBody1Index = mContactConstraints[c].solverBodyIndexBody1;
+            const uint32 solverBody2Index = mContactConstraints[c].solverBodyIndexBody2;
 
             // Update the velocities of the body 1 by applying the impulse P
-            mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody1Index] -= mContactConstraints[c].massInverseBody1 * linearImpulseBody2 * mContactConstraints[c].linearLockAxisFactorBody1;
-            mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody1Index] += mContactConstraints[c].angularLockAxisFactorBody1 * (mContactConstraints[c].inverseInertiaTensorBody1 * angularImpulseBody1);
+            mSolverBodies.linearVelocities[solverBody1Index] -= mContactConstraints[c].massInverseBody1 * linearImpulseBody2 * mContactConstraints[c].linearLockAxisFactorBody1;
+            mSolverBodies.angularVelocities[solverBody1Index] += mContactConstraints[c].angularLockAxisFactorBody1 * (mContactConstraints[c].inverseInertiaTensorBody1 * angularImpulseBody1);
 
             // Update the velocities of the body 1 by applying the impulse P
-            mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody2Index] += mContactConstraints[c].massInverseBody2 * linearImpulseBody2 * mContactConstraints[c].linearLockAxisFactorBody2;
-            mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody2Index] += mContactConstraints[c].angularLockAxisFactorBody2 * (mContactConstraints[c].inverseInertiaTensorBody2 * angularImpulseBody2);
+            mSolverBodies.linearVelocities[solverBody2Index] += mContactConstraints[c].massInverseBody2 * linearImpulseBody2 * mContactConstraints[c].linearLockAxisFactorBody2;
+            mSolverBodies.angularVelocities[solverBody2Index] += mContactConstraints[c].angularLockAxisFactorBody2 * (mContactConstraints[c].inverseInertiaTensorBody2 * angularImpulseBody2);
 
             // ------ Second friction constraint at the center of the contact manifold ----- //
 
@@ -432,18 +442,18 @@ void ContactSolverSystem::warmStart() {
             angularImpulseBody2.z = mContactConstraints[c].r2CrossT2.z * mContactConstraints[c].friction2Impulse;
 
             // Update the velocities of the body 1 by applying the impulse P
-            mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody1Index].x -= mContactConstraints[c].massInverseBody1 * linearImpulseBody2.x * mContactConstraints[c].linearLockAxisFactorBody1.x;
-            mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody1Index].y -= mContactConstraints[c].massInverseBody1 * linearImpulseBody2.y * mContactConstraints[c].linearLockAxisFactorBody1.y;
-            mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody1Index].z -= mContactConstraints[c].massInverseBody1 * linearImpulseBody2.z * mContactConstraints[c].linearLockAxisFactorBody1.z;
+            mSolverBodies.linearVelocities[solverBody1Index].x -= mContactConstraints[c].massInverseBody1 * linearImpulseBody2.x * mContactConstraints[c].linearLockAxisFactorBody1.x;
+            mSolverBodies.linearVelocities[solverBody1Index].y -= mContactConstraints[c].massInverseBody1 * linearImpulseBody2.y * mContactConstraints[c].linearLockAxisFactorBody1.y;
+            mSolverBodies.linearVelocities[solverBody1Index].z -= mContactConstraints[c].massInverseBody1 * linearImpulseBody2.z * mContactConstraints[c].linearLockAxisFactorBody1.z;
 
-            mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody1Index] += mContactConstraints[c].angularLockAxisFactorBody1 * (mContactConstraints[c].inverseInertiaTensorBody1 * angularImpulseBody1);
+            mSolverBodies.angularVelocities[solverBody1Index] += mContactConstraints[c].angularLockAxisFactorBody1 * (mContactConstraints[c].inverseInertiaTensorBody1 * angularImpulseBody1);
 
             // Update the velocities of the body 2 by applying the impulse P
-            mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody2Index].x += mContactConstraints[c].massInverseBody2 * linearImpulseBody2.x * mContactConstraints[c].linearLockAxisFactorBody2.x;
-            mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody2Index].y += mContactConstraints[c].massInverseBody2 * linearImpulseBody2.y * mContactConstraints[c].linearLockAxisFactorBody2.y;
-            mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody2Index].z += mContactConstraints[c].massInverseBody2 * linearImpulseBody2.z * mContactConstraints[c].linearLockAxisFactorBody2.z;
+            mSolverBodies.linearVelocities[solverBody2Index].x += mContactConstraints[c].massInverseBody2 * linearImpulseBody2.x * mContactConstraints[c].linearLockAxisFactorBody2.x;
+            mSolverBodies.linearVelocities[solverBody2Index].y += mContactConstraints[c].massInverseBody2 * linearImpulseBody2.y * mContactConstraints[c].linearLockAxisFactorBody2.y;
+            mSolverBodies.linearVelocities[solverBody2Index].z += mContactConstraints[c].massInverseBody2 * linearImpulseBody2.z * mContactConstraints[c].linearLockAxisFactorBody2.z;
 
-            mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody2Index] += mContactConstraints[c].angularLockAxisFactorBody2 * (mContactConstraints[c].inverseInertiaTensorBody2 * angularImpulseBody2);
+            mSolverBodies.angularVelocities[solverBody2Index] += mContactConstraints[c].angularLockAxisFactorBody2 * (mContactConstraints[c].inverseInertiaTensorBody2 * angularImpulseBody2);
 
             // ------ Twist friction constraint at the center of the contact manifold ------ //
 
@@ -457,16 +467,16 @@ void ContactSolverSystem::warmStart() {
             angularImpulseBody2.z = mContactConstraints[c].normal.z * mContactConstraints[c].frictionTwistImpulse;
 
             // Update the velocities of the body 1 by applying the impulse P
-            mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody1Index] += mContactConstraints[c].angularLockAxisFactorBody1 * (mContactConstraints[c].inverseInertiaTensorBody1 *  angularImpulseBody1);
+            mSolverBodies.angularVelocities[solverBody1Index] += mContactConstraints[c].angularLockAxisFactorBody1 * (mContactConstraints[c].inverseInertiaTensorBody1 *  angularImpulseBody1);
 
             // Update the velocities of the body 2 by applying the impulse P
-            mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody2Index] += mContactConstraints[c].angularLockAxisFactorBody2 * (mContactConstraints[c].inverseInertiaTensorBody2 * angularImpulseBody2);
+            mSolverBodies.angularVelocities[solverBody2Index] += mContactConstraints[c].angularLockAxisFactorBody2 * (mContactConstraints[c].inverseInertiaTensorBody2 * angularImpulseBody2);
 
             // Update the velocities of the body 1 by applying the impulse P
-            mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody1Index] -= mContactConstraints[c].angularLockAxisFactorBody1 * (mContactConstraints[c].inverseInertiaTensorBody1 * angularImpulseBody2);
+            mSolverBodies.angularVelocities[solverBody1Index] -= mContactConstraints[c].angularLockAxisFactorBody1 * (mContactConstraints[c].inverseInertiaTensorBody1 * angularImpulseBody2);
 
             // Update the velocities of the body 1 by applying the impulse P
-            mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody2Index] += mContactConstraints[c].angularLockAxisFactorBody2 * (mContactConstraints[c].inverseInertiaTensorBody2 * angularImpulseBody2);
+            mSolverBodies.angularVelocities[solverBody2Index] += mContactConstraints[c].angularLockAxisFactorBody2 * (mContactConstraints[c].inverseInertiaTensorBody2 * angularImpulseBody2);
         }
         else {  // If it is a new contact manifold
 
@@ -478,286 +488,241 @@ void ContactSolverSystem::warmStart() {
     }
 }
 
-// Solve the contacts
-void ContactSolverSystem::solve() {
+// Pack the contact constraints into contact batches
+/// Each contact manifold is added to the first batch with a free lane that comes after the
+/// batches of the previous manifolds of its dynamic bodies. Static and kinematic bodies can be
+/// shared by the lanes of a batch because the contacts never change their velocities.
+void ContactSolverSystem::createContactBatches() {
 
-    RP3D_PROFILE("ContactSolverSystem::solve()", mProfiler);
+    RP3D_PROFILE("ContactSolver::createContactBatches()", mProfiler);
 
-    decimal deltaLambda;
-    decimal lambdaTemp;
-    uint32 contactPointIndex = 0;
+    MemoryAllocator& allocator = mMemoryManager.getSingleFrameAllocator();
 
-    const decimal beta = mIsSplitImpulseActive ? BETA_SPLIT_IMPULSE : BETA;
+    // Batch index and lane (batch * NB_CONTACT_SOLVER_LANES + lane) of each contact manifold
+    Array<uint32> manifoldsLanes(allocator, mNbContactManifolds);
+
+    // Number of used lanes of each batch
+    Array<uint8> batchesNbLanes(allocator, mNbContactManifolds);
+
+    // For each body, one plus the index of the last batch that contains the body. We only
+    // reset the entries of the bodies that are involved in a contact
+    const uint32 nbSolverBodies = mSolverBodies.getNbBodies();
+    Array<uint32> bodiesNextBatch(allocator, nbSolverBodies);
+    bodiesNextBatch.addWithoutInit(nbSolverBodies);
+    for (uint32 c=0; c < mNbContactManifolds; c++) {
+        bodiesNextBatch[mContactConstraints[c].solverBodyIndexBody1] = 0;
+        bodiesNextBatch[mContactConstraints[c].solverBodyIndexBody2] = 0;
+    }
+
+    uint32 firstNonFullBatch = 0;
 
     // For each contact manifold
-    for (uint32 c=0; c<mNbContactManifolds; c++) {
+    for (uint32 c=0; c < mNbContactManifolds; c++) {
+
+        const uint32 solverBody1Index = mContactConstraints[c].solverBodyIndexBody1;
+        const uint32 solverBody2Index = mContactConstraints[c].solverBodyIndexBody2;
+        const bool isBody1Dynamic = mRigidBodyComponents.mBodyTypes[mSolverBodies.rigidBodyComponentIndices[solverBody1Index]] == BodyType::DYNAMIC;
+        const bool isBody2Dynamic = mRigidBodyComponents.mBodyTypes[mSolverBodies.rigidBodyComponentIndices[solverBody2Index]] == BodyType::DYNAMIC;
+
+        // The manifold must be solved after the batches that already contain one of its dynamic bodies
+        uint32 batch = firstNonFullBatch;
+        if (isBody1Dynamic) batch = std::max(batch, bodiesNextBatch[solverBody1Index]);
+        if (isBody2Dynamic) batch = std::max(batch, bodiesNextBatch[solverBody2Index]);
+
+        // Find a batch with a free lane or create a new batch
+        const uint32 nbBatches = static_cast<uint32>(batchesNbLanes.size());
+        const uint32 lastSearchedBatch = std::min(batch + NB_MAX_SEARCHED_CONTACT_BATCHES, nbBatches);
+        while (batch < lastSearchedBatch && batchesNbLanes[batch] == NB_CONTACT_SOLVER_LANES) {
+            batch++;
+        }
+        if (batch == lastSearchedBatch) {
+            batch = nbBatches;
+            batchesNbLanes.add(0);
+        }
 
-        decimal sumPenetrationImpulse = 0.0;
+        manifoldsLanes.add(batch * NB_CONTACT_SOLVER_LANES + batchesNbLanes[batch]);
+        batchesNbLanes[batch]++;
 
-        const uint32 rigidBody1Index = mContactConstraints[c].rigidBodyComponentIndexBody1;
-        const uint32 rigidBody2Index = mContactConstraints[c].rigidBodyComponentIndexBody2;
+        if (isBody1Dynamic) bodiesNextBatch[solverBody1Index] = batch + 1;
+        if (isBody2Dynamic) bodiesNextBatch[solverBody2Index] = batch + 1;
 
-        // Get the constrained velocities
-        const Vector3& v1 = mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody1Index];
-        const Vector3& w1 = mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody1Index];
-        const Vector3& v2 = mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody2Index];
-        const Vector3& w2 = mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody2Index];
+        while (firstNonFullBatch < batchesNbLanes.size() && batchesNbLanes[firstNonFullBatch] == NB_CONTACT_SOLVER_LANES) {
+            firstNonFullBatch++;
+        }
+    }
 
-        for (short int i=0; i<mContactConstraints[c].nbContacts; i++) {
+    mNbContactBatches = static_cast<uint32>(batchesNbLanes.size());
+    mContactBatches = static_cast<ContactBatchSolver*>(mMemoryManager.allocate(MemoryManager::AllocationType::Frame,
+                                                                               sizeof(ContactBatchSolver) * mNbContactBatches));
+    assert(mContactBatches != nullptr);
 
-            // --------- Penetration --------- //
-
-            // Compute J*v
-            //Vector3 deltaV = v2 + w2.cross(mContactPoints[contactPointIndex].r2) - v1 - w1.cross(mContactPoints[contactPointIndex].r1);
-            Vector3 deltaV(v2.x + w2.y * mContactPoints[contactPointIndex].r2.z - w2.z * mContactPoints[contactPointIndex].r2.y - v1.x -
-                           w1.y * mContactPoints[contactPointIndex].r1.z + w1.z * mContactPoints[contactPointIndex].r1.y,
-                           v2.y + w2.z * mContactPoints[contactPointIndex].r2.x - w2.x * mContactPoints[contactPointIndex].r2.z - v1.y -
-                           w1.z * mContactPoints[contactPointIndex].r1.x + w1.x * mContactPoints[contactPointIndex].r1.z,
-                           v2.z + w2.x * mContactPoints[contactPointIndex].r2.y - w2.y * mContactPoints[contactPointIndex].r2.x - v1.z -
-                           w1.x * mContactPoints[contactPointIndex].r1.y + w1.y * mContactPoints[contactPointIndex].r1.x);
-            decimal deltaVDotN = deltaV.x * mContactPoints[contactPointIndex].normal.x + deltaV.y * mContactPoints[contactPointIndex].normal.y +
-                                 deltaV.z * mContactPoints[contactPointIndex].normal.z;
-            decimal Jv = deltaVDotN;
-
-            // Compute the bias "b" of the constraint
-            decimal biasPenetrationDepth = 0.0;
-            if (mContactPoints[contactPointIndex].penetrationDepth > SLOP) {
-                biasPenetrationDepth = -(beta/mTimeStep) * std::max(0.0f, float(mContactPoints[contactPointIndex].penetrationDepth - SLOP));
-            }
-            decimal b = biasPenetrationDepth + mContactPoints[contactPointIndex].restitutionBias;
+    // The unused lanes and contact points of the batches are set to zero
+    for (uint32 b=0; b < mNbContactBatches; b++) {
+        new (mContactBatches + b) ContactBatchSolver();
+        mContactBatches[b].nbLanes = batchesNbLanes[b];
+    }
 
-            // Compute the Lagrange multiplier lambda
-            if (mIsSplitImpulseActive) {
-                deltaLambda = - (Jv + mContactPoints[contactPointIndex].restitutionBias) *
-                        mContactPoints[contactPointIndex].inversePenetrationMass;
-            }
-            else {
-                deltaLambda = - (Jv + b) * mContactPoints[contactPointIndex].inversePenetrationMass;
-            }
-            lambdaTemp = mContactPoints[contactPointIndex].penetrationImpulse;
-            mContactPoints[contactPointIndex].penetrationImpulse = std::max(mContactPoints[contactPointIndex].penetrationImpulse +
-                                                       deltaLambda, decimal(0.0));
-            deltaLambda = mContactPoints[contactPointIndex].penetrationImpulse - lambdaTemp;
+    const decimal beta = mIsSplitImpulseActive ? BETA_SPLIT_IMPULSE : BETA;
 
-            Vector3 linearImpulse(mContactPoints[contactPointIndex].normal.x * deltaLambda,
-                                  mContactPoints[contactPointIndex].normal.y * deltaLambda,
-                                  mContactPoints[contactPointIndex].normal.z * deltaLambda);
+    // Copy the contact constraints into the lanes of the batches
+    uint32 contactPointIndex = 0;
+    for (uint32 c=0; c < mNbContactManifolds; c++) {
 
-            // Update the velocities of the body 1 by applying the impulse P
-            mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody1Index].x -= mContactConstraints[c].massInverseBody1 * linearImpulse.x * mContactConstraints[c].linearLockAxisFactorBody1.x;
-            mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody1Index].y -= mContactConstraints[c].massInverseBody1 * linearImpulse.y * mContactConstraints[c].linearLockAxisFactorBody1.y;
-            mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody1Index].z -= mContactConstraints[c].massInverseBody1 * linearImpulse.z * mContactConstraints[c].linearLockAxisFactorBody1.z;
+        const uint32 batch = manifoldsLanes[c] / NB_CONTACT_SOLVER_LANES;
+        const uint8 lane = static_cast<uint8>(manifoldsLanes[c] % NB_CONTACT_SOLVER_LANES);
+        initializeBatchLane(mContactBatches[batch], lane, c, contactPointIndex, beta);
 
-            mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody1Index].x -= mContactPoints[contactPointIndex].i1TimesR1CrossN.x * mContactConstraints[c].angularLockAxisFactorBody1.x * deltaLambda;
-            mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody1Index].y -= mContactPoints[contactPointIndex].i1TimesR1CrossN.y * mContactConstraints[c].angularLockAxisFactorBody1.y * deltaLambda;
-            mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody1Index].z -= mContactPoints[contactPointIndex].i1TimesR1CrossN.z * mContactConstraints[c].angularLockAxisFactorBody1.z * deltaLambda;
+        contactPointIndex += mContactConstraints[c].nbContacts;
+    }
+}
 
-            // Update the velocities of the body 2 by applying the impulse P
-            mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody2Index].x += mContactConstraints[c].massInverseBody2 * linearImpulse.x * mContactConstraints[c].linearLockAxisFactorBody2.x;
-            mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody2Index].y += mContactConstraints[c].massInverseBody2 * linearImpulse.y * mContactConstraints[c].linearLockAxisFactorBody2.y;
-            mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody2Index].z += mContactConstraints[c].massInverseBody2 * linearImpulse.z * mContactConstraints[c].linearLockAxisFactorBody2.z;
-
-            mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody2Index].x += mContactPoints[contactPointIndex].i2TimesR2CrossN.x * mContactConstraints[c].angularLockAxisFactorBody2.x * deltaLambda;
-            mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody2Index].y += mContactPoints[contactPointIndex].i2TimesR2CrossN.y * mContactConstraints[c].angularLockAxisFactorBody2.y * deltaLambda;
-            mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody2Index].z += mContactPoints[contactPointIndex].i2TimesR2CrossN.z * mContactConstraints[c].angularLockAxisFactorBody2.z * deltaLambda;
-
-            sumPenetrationImpulse += mContactPoints[contactPointIndex].penetrationImpulse;
-
-            // If the split impulse position correction is active
-            if (mIsSplitImpulseActive) {
-
-                // Split impulse (position correction)
-                const Vector3& v1Split = mRigidBodyComponents.mSplitLinearVelocities[rigidBody1Index];
-                const Vector3& w1Split = mRigidBodyComponents.mSplitAngularVelocities[rigidBody1Index];
-                const Vector3& v2Split = mRigidBodyComponents.mSplitLinearVelocities[rigidBody2Index];
-                const Vector3& w2Split = mRigidBodyComponents.mSplitAngularVelocities[rigidBody2Index];
-
-                //Vector3 deltaVSplit = v2Split + w2Split.cross(mContactPoints[contactPointIndex].r2) - v1Split - w1Split.cross(mContactPoints[contactPointIndex].r1);
-                Vector3 deltaVSplit(v2Split.x + w2Split.y * mContactPoints[contactPointIndex].r2.z - w2Split.z * mContactPoints[contactPointIndex].r2.y - v1Split.x -
-                                    w1Split.y * mContactPoints[contactPointIndex].r1.z + w1Split.z * mContactPoints[contactPointIndex].r1.y,
-                                    v2Split.y + w2Split.z * mContactPoints[contactPointIndex].r2.x - w2Split.x * mContactPoints[contactPointIndex].r2.z - v1Split.y -
-                                    w1Split.z * mContactPoints[contactPointIndex].r1.x + w1Split.x * mContactPoints[contactPointIndex].r1.z,
-                                    v2Split.z + w2Split.x * mContactPoints[contactPointIndex].r2.y - w2Split.y * mContactPoints[contactPointIndex].r2.x - v1Split.z -
-                                    w1Split.x * mContactPoints[contactPointIndex].r1.y + w1Split.y * mContactPoints[contactPointIndex].r1.x);
-                decimal JvSplit = deltaVSplit.x * mContactPoints[contactPointIndex].normal.x +
-                                  deltaVSplit.y * mContactPoints[contactPointIndex].normal.y +
-                                  deltaVSplit.z * mContactPoints[contactPointIndex].normal.z;
-                decimal deltaLambdaSplit = - (JvSplit + biasPenetrationDepth) *
-                        mContactPoints[contactPointIndex].inversePenetrationMass;
-                decimal lambdaTempSplit = mContactPoints[contactPointIndex].penetrationSplitImpulse;
-                mContactPoints[contactPointIndex].penetrationSplitImpulse = std::max(
-                            mContactPoints[contactPointIndex].penetrationSplitImpulse +
-                            deltaLambdaSplit, decimal(0.0));
-                deltaLambdaSplit = mContactPoints[contactPointIndex].penetrationSplitImpulse - lambdaTempSplit;
-
-                Vector3 linearImpulse(mContactPoints[contactPointIndex].normal.x * deltaLambdaSplit,
-                                      mContactPoints[contactPointIndex].normal.y * deltaLambdaSplit,
-                                      mContactPoints[contactPointIndex].normal.z * deltaLambdaSplit);
+// Copy a contact constraint into a lane of a contact batch
+void ContactSolverSystem::initializeBatchLane(ContactBatchSolver& batch, uint8 lane, uint32 contactManifoldIndex,
+                                              uint32 contactPointIndex, decimal beta) {
 
-                // Update the velocities of the body 1 by applying the impulse P
-                mRigidBodyComponents.mSplitLinearVelocities[rigidBody1Index].x -= mContactConstraints[c].massInverseBody1 * linearImpulse.x * mContactConstraints[c].linearLockAxisFactorBody1.x;
-                mRigidBodyComponents.mSplitLinearVelocities[rigidBody1Index].y -= mContactConstraints[c].massInverseBody1 * linearImpulse.y * mContactConstraints[c].linearLockAxisFactorBody1.y;
-                mRigidBodyComponents.mSplitLinearVelocities[rigidBody1Index].z -= mContactConstraints[c].massInverseBody1 * linearImpulse.z * mContactConstraints[c].linearLockAxisFactorBody1.z;
+    const ContactManifoldSolver& manifold = mContactConstraints[contactManifoldIndex];
 
-                mRigidBodyComponents.mSplitAngularVelocities[rigidBody1Index].x -= mContactPoints[contactPointIndex].i1TimesR1CrossN.x * mContactConstraints[c].angularLockAxisFactorBody1.x * deltaLambdaSplit;
-                mRigidBodyComponents.mSplitAngularVelocities[rigidBody1Index].y -= mContactPoints[contactPointIndex].i1TimesR1CrossN.y * mContactConstraints[c].angularLockAxisFactorBody1.y * deltaLambdaSplit;
-                mRigidBodyComponents.mSplitAngularVelocities[rigidBody1Index].z -= mContactPoints[contactPointIndex].i1TimesR1CrossN.z * mContactConstraints[c].angularLockAxisFactorBody1.z * deltaLambdaSplit;
+    batch.contactManifoldIndices[lane] = contactManifoldIndex;
+    batch.contactPointIndices[lane] = contactPointIndex;
+    batch.solverBodyIndexBody1[lane] = manifold.solverBodyIndexBody1;
+    batch.solverBodyIndexBody2[lane] = manifold.solverBodyIndexBody2;
+    batch.linearFactorBody1.set(lane, manifold.massInverseBody1 * manifold.linearLockAxisFactorBody1);
+    batch.linearFactorBody2.set(lane, manifold.massInverseBody2 * manifold.linearLockAxisFactorBody2);
+    batch.nbContacts[lane] = manifold.nbContacts;
+    batch.nbContactSlots = std::max(batch.nbContactSlots, static_cast<uint8>(manifold.nbContacts));
 
-                // Update the velocities of the body 1 by applying the impulse P
-                mRigidBodyComponents.mSplitLinearVelocities[rigidBody2Index].x += mContactConstraints[c].massInverseBody2 * linearImpulse.x * mContactConstraints[c].linearLockAxisFactorBody2.x;
-                mRigidBodyComponents.mSplitLinearVelocities[rigidBody2Index].y += mContactConstraints[c].massInverseBody2 * linearImpulse.y * mContactConstraints[c].linearLockAxisFactorBody2.y;
-                mRigidBodyComponents.mSplitLinearVelocities[rigidBody2Index].z += mContactConstraints[c].massInverseBody2 * linearImpulse.z * mContactConstraints[c].linearLockAxisFactorBody2.z;
+    // For each contact point of the manifold
+    for (int8 i=0; i < manifold.nbContacts; i++) {
 
-                mRigidBodyComponents.mSplitAngularVelocities[rigidBody2Index].x += mContactPoints[contactPointIndex].i2TimesR2CrossN.x * mContactConstraints[c].angularLockAxisFactorBody2.x * deltaLambdaSplit;
-                mRigidBodyComponents.mSplitAngularVelocities[rigidBody2Index].y += mContactPoints[contactPointIndex].i2TimesR2CrossN.y * mContactConstraints[c].angularLockAxisFactorBody2.y * deltaLambdaSplit;
-                mRigidBodyComponents.mSplitAngularVelocities[rigidBody2Index].z += mContactPoints[contactPointIndex].i2TimesR2CrossN.z * mContactConstraints[c].angularLockAxisFactorBody2.z * deltaLambdaSplit;
-            }
+        const ContactPointSolver& contactPoint = mContactPoints[contactPointIndex + i];
 
-            contactPointIndex++;
+        batch.normal[i].set(lane, contactPoint.normal);
+        batch.r1CrossN[i].set(lane, contactPoint.r1.cross(contactPoint.normal));
+        batch.r2CrossN[i].set(lane, contactPoint.r2.cross(contactPoint.normal));
+        batch.angularPenetrationBody1[i].set(lane, manifold.angularLockAxisFactorBody1 * contactPoint.i1TimesR1CrossN);
+        batch.angularPenetrationBody2[i].set(lane, manifold.angularLockAxisFactorBody2 * contactPoint.i2TimesR2CrossN);
+
+        // Compute the bias "b" of the constraint
+        decimal biasPenetrationDepth = 0.0;
+        if (contactPoint.penetrationDepth > SLOP) {
+            biasPenetrationDepth = -(beta/mTimeStep) * (contactPoint.penetrationDepth - SLOP);
+        }
+
+        // With split impulses, the penetration depth is only corrected with the split velocities
+        batch.velocityBias[i][lane] = mIsSplitImpulseActive ? contactPoint.restitutionBias :
+                                                              biasPenetrationDepth + contactPoint.restitutionBias;
+        batch.splitBias[i][lane] = biasPenetrationDepth;
+        batch.inversePenetrationMass[i][lane] = contactPoint.inversePenetrationMass;
+        batch.penetrationImpulse[i][lane] = contactPoint.penetrationImpulse;
+        batch.penetrationSplitImpulse[i][lane] = contactPoint.penetrationSplitImpulse;
+    }
+
+    batch.manifoldNormal.set(lane, manifold.normal);
+    batch.frictionVector1.set(lane, manifold.frictionVector1);
+    batch.frictionVector2.set(lane, manifold.frictionVector2);
+    batch.r1CrossT1.set(lane, manifold.r1CrossT1);
+    batch.r1CrossT2.set(lane, manifold.r1CrossT2);
+    batch.r2CrossT1.set(lane, manifold.r2CrossT1);
+    batch.r2CrossT2.set(lane, manifold.r2CrossT2);
+    batch.angularFriction1Body1.set(lane, manifold.angularLockAxisFactorBody1 * (manifold.inverseInertiaTensorBody1 * manifold.r1CrossT1));
+    batch.angularFriction1Body2.set(lane, manifold.angularLockAxisFactorBody2 * (manifold.inverseInertiaTensorBody2 * manifold.r2CrossT1));
+    batch.angularFriction2Body1.set(lane, manifold.angularLockAxisFactorBody1 * (manifold.inverseInertiaTensorBody1 * manifold.r1CrossT2));
+    batch.angularFriction2Body2.set(lane, manifold.angularLockAxisFactorBody2 * (manifold.inverseInertiaTensorBody2 * manifold.r2CrossT2));
+    batch.angularTwistBody1.set(lane, manifold.angularLockAxisFactorBody1 * (manifold.inverseInertiaTensorBody1 * manifold.normal));
+    batch.angularTwistBody2.set(lane, manifold.angularLockAxisFactorBody2 * (manifold.inverseInertiaTensorBody2 * manifold.normal));
+    batch.inverseFriction1Mass[lane] = manifold.inverseFriction1Mass;
+    batch.inverseFriction2Mass[lane] = manifold.inverseFriction2Mass;
+    batch.inverseTwistFrictionMass[lane] = manifold.inverseTwistFrictionMass;
+    batch.frictionCoefficient[lane] = manifold.frictionCoefficient;
+    batch.friction1Impulse[lane] = manifold.friction1Impulse;
+    batch.friction2Impulse[lane] = manifold.friction2Impulse;
+    batch.frictionTwistImpulse[lane] = manifold.frictionTwistImpulse;
+}
+
+// Solve the contacts
+void ContactSolverSystem::solve() {
+
+    RP3D_PROFILE("ContactSolverSystem::solve()", mProfiler);
+
+    Vector3Lanes v1, w1, v2, w2;
+    decimal frictionLimit[NB_CONTACT_SOLVER_LANES];
+
+    // For each contact batch
+    for (uint32 b=0; b < mNbContactBatches; b++) {
+
+        ContactBatchSolver& batch = mContactBatches[b];
+
+        // Get the constrained velocities of the bodies of the lanes
+        gatherVelocities(batch, mSolverBodies.linearVelocities, mSolverBodies.angularVelocities,
+                         v1, w1, v2, w2);
+
+        // --------- Penetration --------- //
+
+        for (uint32 i=0; i < batch.nbContactSlots; i++) {
+            solvePenetrationConstraints(batch, i, batch.velocityBias[i], batch.penetrationImpulse[i], v1, w1, v2, w2);
+        }
+
+        // Compute the friction limits from the sum of the penetration impulses of the manifolds
+        for (uint32 l=0; l < NB_CONTACT_SOLVER_LANES; l++) {
+            decimal sumPenetrationImpulse = 0.0;
+            for (uint32 i=0; i < batch.nbContactSlots; i++) {
+                sumPenetrationImpulse += batch.penetrationImpulse[i][l];
+            }
+            frictionLimit[l] = batch.frictionCoefficient[l] * sumPenetrationImpulse;
         }
 
         // ------ First friction constraint at the center of the contact manifold ------ //
 
-        // Compute J*v
-        // deltaV = v2 + w2.cross(mContactConstraints[c].r2Friction) - v1 - w1.cross(mContactConstraints[c].r1Friction);
-        Vector3 deltaV(v2.x + w2.y * mContactConstraints[c].r2Friction.z - w2.z * mContactConstraints[c].r2Friction.y - v1.x -
-                       w1.y * mContactConstraints[c].r1Friction.z + w1.z * mContactConstraints[c].r1Friction.y,
-
-                       v2.y + w2.z * mContactConstraints[c].r2Friction.x - w2.x * mContactConstraints[c].r2Friction.z - v1.y -
-                       w1.z * mContactConstraints[c].r1Friction.x + w1.x * mContactConstraints[c].r1Friction.z,
-
-                       v2.z + w2.x * mContactConstraints[c].r2Friction.y - w2.y * mContactConstraints[c].r2Friction.x - v1.z -
-                       w1.x * mContactConstraints[c].r1Friction.y + w1.y * mContactConstraints[c].r1Friction.x);
-        decimal Jv = deltaV.x * mContactConstraints[c].frictionVector1.x +
-                     deltaV.y * mContactConstraints[c].frictionVector1.y +
-                     deltaV.z * mContactConstraints[c].frictionVector1.z;
-
-        // Compute the Lagrange multiplier lambda
-        decimal deltaLambda = -Jv * mContactConstraints[c].inverseFriction1Mass;
-        decimal frictionLimit = mContactConstraints[c].frictionCoefficient * sumPenetrationImpulse;
-        lambdaTemp = mContactConstraints[c].friction1Impulse;
-        mContactConstraints[c].friction1Impulse = std::max(-frictionLimit,
-                                                    std::min(mContactConstraints[c].friction1Impulse +
-                                                             deltaLambda, frictionLimit));
-        deltaLambda = mContactConstraints[c].friction1Impulse - lambdaTemp;
-
-        // Compute the impulse P=J^T * lambda
-        Vector3 angularImpulseBody1(-mContactConstraints[c].r1CrossT1.x * deltaLambda,
-                                    -mContactConstraints[c].r1CrossT1.y * deltaLambda,
-                                    -mContactConstraints[c].r1CrossT1.z * deltaLambda);
-        Vector3 linearImpulseBody2(mContactConstraints[c].frictionVector1.x * deltaLambda,
-                                   mContactConstraints[c].frictionVector1.y * deltaLambda,
-                                   mContactConstraints[c].frictionVector1.z * deltaLambda);
-        Vector3 angularImpulseBody2(mContactConstraints[c].r2CrossT1.x * deltaLambda,
-                                    mContactConstraints[c].r2CrossT1.y * deltaLambda,
-                                    mContactConstraints[c].r2CrossT1.z * deltaLambda);
-
-        // Update the velocities of the body 1 by applying the impulse P
-        mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody1Index].x -= mContactConstraints[c].massInverseBody1 * linearImpulseBody2.x * mContactConstraints[c].linearLockAxisFactorBody1.x;
-        mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody1Index].y -= mContactConstraints[c].massInverseBody1 * linearImpulseBody2.y * mContactConstraints[c].linearLockAxisFactorBody1.y;
-        mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody1Index].z -= mContactConstraints[c].massInverseBody1 * linearImpulseBody2.z * mContactConstraints[c].linearLockAxisFactorBody1.z;
-
-        Vector3 angularVelocity1 = mContactConstraints[c].angularLockAxisFactorBody1 * (mContactConstraints[c].inverseInertiaTensorBody1 * angularImpulseBody1);
-        mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody1Index].x += angularVelocity1.x;
-        mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody1Index].y += angularVelocity1.y;
-        mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody1Index].z += angularVelocity1.z;
-
-        // Update the velocities of the body 2 by applying the impulse P
-        mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody2Index].x += mContactConstraints[c].massInverseBody2 * linearImpulseBody2.x * mContactConstraints[c].linearLockAxisFactorBody2.x;
-        mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody2Index].y += mContactConstraints[c].massInverseBody2 * linearImpulseBody2.y * mContactConstraints[c].linearLockAxisFactorBody2.y;
-        mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody2Index].z += mContactConstraints[c].massInverseBody2 * linearImpulseBody2.z * mContactConstraints[c].linearLockAxisFactorBody2.z;
-
-        Vector3 angularVelocity2 = mContactConstraints[c].angularLockAxisFactorBody2 * (mContactConstraints[c].inverseInertiaTensorBody2 * angularImpulseBody2);
-        mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody2Index].x += angularVelocity2.x;
-        mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody2Index].y += angularVelocity2.y;
-        mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody2Index].z += angularVelocity2.z;
+        solveFrictionConstraints(batch, batch.frictionVector1, batch.r1CrossT1, batch.r2CrossT1, batch.angularFriction1Body1,
+                                 batch.angularFriction1Body2, batch.inverseFriction1Mass, frictionLimit,
+                                 batch.friction1Impulse, v1, w1, v2, w2);
 
         // ------ Second friction constraint at the center of the contact manifold ----- //
 
-        // Compute J*v
-        //deltaV = v2 + w2.cross(mContactConstraints[c].r2Friction) - v1 - w1.cross(mContactConstraints[c].r1Friction);
-        deltaV.x = v2.x + w2.y * mContactConstraints[c].r2Friction.z - w2.z * mContactConstraints[c].r2Friction.y  - v1.x -
-                   w1.y * mContactConstraints[c].r1Friction.z + w1.z * mContactConstraints[c].r1Friction.y;
-        deltaV.y = v2.y + w2.z * mContactConstraints[c].r2Friction.x - w2.x * mContactConstraints[c].r2Friction.z  - v1.y -
-                   w1.z * mContactConstraints[c].r1Friction.x + w1.x * mContactConstraints[c].r1Friction.z;
-        deltaV.z = v2.z + w2.x * mContactConstraints[c].r2Friction.y - w2.y * mContactConstraints[c].r2Friction.x  - v1.z -
-                   w1.x * mContactConstraints[c].r1Friction.y + w1.y * mContactConstraints[c].r1Friction.x;
-        Jv = deltaV.x * mContactConstraints[c].frictionVector2.x + deltaV.y * mContactConstraints[c].frictionVector2.y +
-             deltaV.z * mContactConstraints[c].frictionVector2.z;
-
-        // Compute the Lagrange multiplier lambda
-        deltaLambda = -Jv * mContactConstraints[c].inverseFriction2Mass;
-        frictionLimit = mContactConstraints[c].frictionCoefficient * sumPenetrationImpulse;
-        lambdaTemp = mContactConstraints[c].friction2Impulse;
-        mContactConstraints[c].friction2Impulse = std::max(-frictionLimit,
-                                                    std::min(mContactConstraints[c].friction2Impulse +
-                                                             deltaLambda, frictionLimit));
-        deltaLambda = mContactConstraints[c].friction2Impulse - lambdaTemp;
-
-        // Compute the impulse P=J^T * lambda
-        angularImpulseBody1.x = -mContactConstraints[c].r1CrossT2.x * deltaLambda;
-        angularImpulseBody1.y = -mContactConstraints[c].r1CrossT2.y * deltaLambda;
-        angularImpulseBody1.z = -mContactConstraints[c].r1CrossT2.z * deltaLambda;
-
-        linearImpulseBody2.x = mContactConstraints[c].frictionVector2.x * deltaLambda;
-        linearImpulseBody2.y = mContactConstraints[c].frictionVector2.y * deltaLambda;
-        linearImpulseBody2.z = mContactConstraints[c].frictionVector2.z * deltaLambda;
-
-        angularImpulseBody2.x = mContactConstraints[c].r2CrossT2.x * deltaLambda;
-        angularImpulseBody2.y = mContactConstraints[c].r2CrossT2.y * deltaLambda;
-        angularImpulseBody2.z = mContactConstraints[c].r2CrossT2.z * deltaLambda;
-
-        // Update the velocities of the body 1 by applying the impulse P
-        mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody1Index].x -= mContactConstraints[c].massInverseBody1 * linearImpulseBody2.x * mContactConstraints[c].linearLockAxisFactorBody1.x;
-        mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody1Index].y -= mContactConstraints[c].massInverseBody1 * linearImpulseBody2.y * mContactConstraints[c].linearLockAxisFactorBody1.y;
-        mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody1Index].z -= mContactConstraints[c].massInverseBody1 * linearImpulseBody2.z * mContactConstraints[c].linearLockAxisFactorBody1.z;
-
-        angularVelocity1 = mContactConstraints[c].angularLockAxisFactorBody1 * (mContactConstraints[c].inverseInertiaTensorBody1 * angularImpulseBody1);
-        mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody1Index].x += angularVelocity1.x;
-        mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody1Index].y += angularVelocity1.y;
-        mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody1Index].z += angularVelocity1.z;
-
-        // Update the velocities of the body 2 by applying the impulse P
-        mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody2Index].x += mContactConstraints[c].massInverseBody2 * linearImpulseBody2.x * mContactConstraints[c].linearLockAxisFactorBody2.x;
-        mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody2Index].y += mContactConstraints[c].massInverseBody2 * linearImpulseBody2.y * mContactConstraints[c].linearLockAxisFactorBody2.y;
-        mRigidBodyComponents.mConstrainedLinearVelocities[rigidBody2Index].z += mContactConstraints[c].massInverseBody2 * linearImpulseBody2.z * mContactConstraints[c].linearLockAxisFactorBody2.z;
-
-        angularVelocity2 = mContactConstraints[c].angularLockAxisFactorBody2 * (mContactConstraints[c].inverseInertiaTensorBody2 * angularImpulseBody2);
-        mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody2Index].x += angularVelocity2.x;
-        mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody2Index].y += angularVelocity2.y;
-        mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody2Index].z += angularVelocity2.z;
-
-        // ------ Twist friction constraint at the center of the contact manifol ------ //
-
-        // Compute J*v
-        deltaV = w2 - w1;
-        Jv = deltaV.x * mContactConstraints[c].normal.x + deltaV.y * mContactConstraints[c].normal.y +
-             deltaV.z * mContactConstraints[c].normal.z;
-
-        deltaLambda = -Jv * (mContactConstraints[c].inverseTwistFrictionMass);
-        frictionLimit = mContactConstraints[c].frictionCoefficient * sumPenetrationImpulse;
-        lambdaTemp = mContactConstraints[c].frictionTwistImpulse;
-        mContactConstraints[c].frictionTwistImpulse = std::max(-frictionLimit,
-                                                        std::min(mContactConstraints[c].frictionTwistImpulse
-                                                                 + deltaLambda, frictionLimit));
-        deltaLambda = mContactConstraints[c].frictionTwistImpulse - lambdaTemp;
-
-        // Compute the impulse P=J^T * lambda
-        angularImpulseBody2.x = mContactConstraints[c].normal.x * deltaLambda;
-        angularImpulseBody2.y = mContactConstraints[c].normal.y * deltaLambda;
-        angularImpulseBody2.z = mContactConstraints[c].normal.z * deltaLambda;
-
-        // Update the velocities of the body 1 by applying the impulse P
-        angularVelocity1 = mContactConstraints[c].angularLockAxisFactorBody1 * (mContactConstraints[c].inverseInertiaTensorBody1 * angularImpulseBody2);
-        mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody1Index].x -= angularVelocity1.x;
-        mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody1Index].y -= angularVelocity1.y;
-        mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody1Index].z -= angularVelocity1.z;
-
-        // Update the velocities of the body 1 by applying the impulse P
-        angularVelocity2 = mContactConstraints[c].angularLockAxisFactorBody2 * (mContactConstraints[c].inverseInertiaTensorBody2 * angularImpulseBody2);
-        mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody2Index].x += angularVelocity2.x;
-        mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody2Index].y += angularVelocity2.y;
-        mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody2Index].z += angularVelocity2.z;
+        solveFrictionConstraints(batch, batch.frictionVector2, batch.r1CrossT2, batch.r2CrossT2, batch.angularFriction2Body1,
+                                 batch.angularFriction2Body2, batch.inverseFriction2Mass, frictionLimit,
+                                 batch.friction2Impulse, v1, w1, v2, w2);
+
+        // ------ Twist friction constraint at the center of the contact manifold ------ //
+
+        const Vector3Lanes& n = batch.manifoldNormal;
+        for (uint32 l=0; l < NB_CONTACT_SOLVER_LANES; l++) {
+
+            // Compute J*v = (w2 - w1).dot(n)
+            const decimal Jv = (w2.x[l] - w1.x[l]) * n.x[l] + (w2.y[l] - w1.y[l]) * n.y[l] + (w2.z[l] - w1.z[l]) * n.z[l];
+
+            // Compute the Lagrange multiplier lambda
+            const decimal lambdaTemp = batch.frictionTwistImpulse[l];
+            batch.frictionTwistImpulse[l] = std::max(-frictionLimit[l], std::min(lambdaTemp - Jv * batch.inverseTwistFrictionMass[l],
+                                                                                 frictionLimit[l]));
+            const decimal deltaLambda = batch.frictionTwistImpulse[l] - lambdaTemp;
+
+            // Update the velocities of the bodies by applying the impulse P
+            w1.x[l] -= deltaLambda * batch.angularTwistBody1.x[l];
+            w1.y[l] -= deltaLambda * batch.angularTwistBody1.y[l];
+            w1.z[l] -= deltaLambda * batch.angularTwistBody1.z[l];
+            w2.x[l] += deltaLambda * batch.angularTwistBody2.x[l];
+            w2.y[l] += deltaLambda * batch.angularTwistBody2.y[l];
+            w2.z[l] += deltaLambda * batch.angularTwistBody2.z[l];
+        }
+
+        scatterVelocities(batch, mSolverBodies.linearVelocities, mSolverBodies.angularVelocities,
+                          v1, w1, v2, w2);
+
+        // If the split impulse position correction is active
+        if (mIsSplitImpulseActive) {
+
+            // Split impulse (position correction)
+            gatherVelocities(batch, mSolverBodies.splitLinearVelocities, mSolverBodies.splitAngularVelocities,
+                             v1, w1, v2, w2);
+
+            for (uint32 i=0; i < batch.nbContactSlots; i++) {
+                solvePenetrationConstraints(batch, i, batch.splitBias[i], batch.penetrationSplitImpulse[i], v1, w1, v2, w2);
+            }
+
+            scatterVelocities(batch, mSolverBodies.splitLinearVelocities, mSolverBodies.splitAngularVelocities,
+                              v1, w1, v2, w2);
+        }
     }
 }
 
@@ -767,23 +732,22 @@ void ContactSolverSystem::storeImpulses() {
 
     RP3D_PROFILE("ContactSolver::storeImpulses()", mProfiler);
 
-    uint32 contactPointIndex = 0;
+    // For each lane of each contact batch
+    for (uint32 b=0; b < mNbContactBatches; b++) {
+        const ContactBatchSolver& batch = mContactBatches[b];
+        for (uint32 l=0; l < batch.nbLanes; l++) {
 
-    // For each contact manifold
-    for (uint32 c=0; c<mNbContactManifolds; c++) {
-
-        for (short int i=0; i<mContactConstraints[c].nbContacts; i++) {
-
-            mContactPoints[contactPointIndex].externalContact->setPenetrationImpulse(mContactPoints[contactPointIndex].penetrationImpulse);
+            for (int8 i=0; i < batch.nbContacts[l]; i++) {
+                mContactPoints[batch.contactPointIndices[l] + i].externalContact->setPenetrationImpulse(batch.penetrationImpulse[i][l]);
+            }
 
-            contactPointIndex++;
+            const ContactManifoldSolver& manifold = mContactConstraints[batch.contactManifoldIndices[l]];
+            manifold.externalContactManifold->frictionImpulse1 = batch.friction1Impulse[l];
+            manifold.externalContactManifold->frictionImpulse2 = batch.friction2Impulse[l];
+            manifold.externalContactManifold->frictionTwistImpulse = batch.frictionTwistImpulse[l];
+            manifold.externalContactManifold->frictionVector1 = manifold.frictionVector1;
+            manifold.externalContactManifold->frictionVector2 = manifold.frictionVector2;
         }
-
-        mContactConstraints[c].externalContactManifold->frictionImpulse1 = mContactConstraints[c].friction1Impulse;
-        mContactConstraints[c].externalContactManifold->frictionImpulse2 = mContactConstraints[c].friction2Impulse;
-        mContactConstraints[c].externalContactManifold->frictionTwistImpulse = mContactConstraints[c].frictionTwistImpulse;
-        mContactConstraints[c].externalContactManifold->frictionVector1 = mContactConstraints[c].frictionVector1;
-        mContactConstraints[c].externalContactManifold->frictionVector2 = mContactConstraints[c].frictionVector2;
     }
 }
 
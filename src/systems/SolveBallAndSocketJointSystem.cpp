@@ -26,6 +26,7 @@
 // Libraries
 #include <reactphysics3d/systems/SolveBallAndSocketJointSystem.h>
 #include <reactphysics3d/engine/PhysicsWorld.h>
+#include <reactphysics3d/engine/SolverBodies.h>
 #include <reactphysics3d/body/RigidBody.h>
 #include <cmath>
 
@@ -35,11 +36,12 @@ using namespace reactphysics3d;
 const decimal SolveBallAndSocketJointSystem::BETA = decimal(0.2);
 
 // Constructor
-SolveBallAndSocketJointSystem::SolveBallAndSocketJointSystem(PhysicsWorld& world, RigidBodyComponents& rigidBodyComponents,
+SolveBallAndSocketJointSystem::SolveBallAndSocketJointSystem(PhysicsWorld& world, SolverBodies& solverBodies,
+                                                             RigidBodyComponents& rigidBodyComponents,
                                                              TransformComponents& transformComponents,
                                                              JointComponents& jointComponents,
                                                              BallAndSocketJointComponents& ballAndSocketJointComponents)
-              :mWorld(world), mRigidBodyComponents(rigidBodyComponents), mTransformComponents(transformComponents),
+              :mWorld(world), mSolverBodies(solverBodies), mRigidBodyComponents(rigidBodyComponents), mTransformComponents(transformComponents),
                mJointComponents(jointComponents), mBallAndSocketJointComponents(ballAndSocketJointComponents),
                mTimeStep(0), mIsWarmStartingActive(true) {
 
@@ -64,6 +66,10 @@ void SolveBallAndSocketJointSystem::initBeforeSolve() {
         const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
         const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
 
+        // Get the indices of the bodies in the solver bodies
+        mBallAndSocketJointComponents.mSolverBodyIndexBody1[i] = mSolverBodies.getSolverBodyIndex(componentIndexBody1);
+        mBallAndSocketJointComponents.mSolverBodyIndexBody2[i] = mSolverBodies.getSolverBodyIndex(componentIndexBody2);
+
         assert(!mRigidBodyComponents.getIsEntityDisabled(body1Entity));
         assert(!mRigidBodyComponents.getIsEntityDisabled(body2Entity));
 
@@ -166,20 +172,15 @@ void SolveBallAndSocketJointSystem::warmstart() {
     const uint32 nbJoints = mBallAndSocketJointComponents.getNbEnabledComponents();
     for (uint32 i=0; i < nbJoints; i++) {
 
-        const Entity jointEntity = mBallAndSocketJointComponents.mJointEntities[i];
-        const uint32 jointIndex = mJointComponents.getEntityIndex(jointEntity);
-
-        const Entity body1Entity = mJointComponents.mBody1Entities[jointIndex];
-        const Entity body2Entity = mJointComponents.mBody2Entities[jointIndex];
-
-        const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
-        const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
+        // Get the indices of the bodies in the solver bodies
+        const uint32 solverIndexBody1 = mBallAndSocketJointComponents.mSolverBodyIndexBody1[i];
+        const uint32 solverIndexBody2 = mBallAndSocketJointComponents.mSolverBodyIndexBody2[i];
 
         // Get the velocities
-        Vector3& v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
-        Vector3& v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
-        Vector3& w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
-        Vector3& w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
+        Vector3& v1 = mSolverBodies.linearVelocities[solverIndexBody1];
+        Vector3& v2 = mSolverBodies.linearVelocities[solverIndexBody2];
+        Vector3& w1 = mSolverBodies.angularVelocities[solverIndexBody1];
+        Vector3& w2 = mSolverBodies.angularVelocities[solverIndexBody2];
 
         const Vector3& r1World = mBallAndSocketJointComponents.mR1World[i];
         const Vector3& r2World = mBallAndSocketJointComponents.mR2World[i];
@@ -198,8 +199,8 @@ void SolveBallAndSocketJointSystem::warmstart() {
         angularImpulseBody1 += coneLimitImpulse;
 
         // Apply the impulse to the body 1
-        v1 += mRigidBodyComponents.mInverseMasses[componentIndexBody1] * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
-        w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
+        v1 += mSolverBodies.inverseMasses[solverIndexBody1] * mSolverBodies.linearLockAxisFactors[solverIndexBody1] * linearImpulseBody1;
+        w1 += mSolverBodies.angularLockAxisFactors[solverIndexBody1] * (i1 * angularImpulseBody1);
 
         // Compute the impulse P=J^T * lambda for the body 2
         Vector3 angularImpulseBody2 = -mBallAndSocketJointComponents.mImpulse[i].cross(r2World);
@@ -208,8 +209,8 @@ void SolveBallAndSocketJointSystem::warmstart() {
         angularImpulseBody2 += -coneLimitImpulse;
 
         // Apply the impulse to the body to the body 2
-        v2 += mRigidBodyComponents.mInverseMasses[componentIndexBody2] * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * mBallAndSocketJointComponents.mImpulse[i];
-        w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
+        v2 += mSolverBodies.inverseMasses[solverIndexBody2] * mSolverBodies.linearLockAxisFactors[solverIndexBody2] * mBallAndSocketJointComponents.mImpulse[i];
+        w2 += mSolverBodies.angularLockAxisFactors[solverIndexBody2] * (i2 * angularImpulseBody2);
     }
 }
 
@@ -220,20 +221,15 @@ void SolveBallAndSocketJointSystem::solveVelocityConstraint() {
     const uint32 nbJoints = mBallAndSocketJointComponents.getNbEnabledComponents();
     for (uint32 i=0; i < nbJoints; i++) {
 
-        const Entity jointEntity = mBallAndSocketJointComponents.mJointEntities[i];
-        const uint32 jointIndex = mJointComponents.getEntityIndex(jointEntity);
-
-        const Entity body1Entity = mJointComponents.mBody1Entities[jointIndex];
-        const Entity body2Entity = mJointComponents.mBody2Entities[jointIndex];
-
-        const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
-        const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
+        // Get the indices of the bodies in the solver bodies
+        const uint32 solverIndexBody1 = mBallAndSocketJointComponents.mSolverBodyIndexBody1[i];
+        const uint32 solverIndexBody2 = mBallAndSocketJointComponents.mSolverBodyIndexBody2[i];
 
         // Get the velocities
-        Vector3& v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
-        Vector3& v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
-        Vector3& w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
-        Vector3& w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
+        Vector3& v1 = mSolverBodies.linearVelocities[solverIndexBody1];
+        Vector3& v2 = mSolverBodies.linearVelocities[solverIndexBody2];
+        Vector3& w1 = mSolverBodies.angularVelocities[solverIndexBody1];
+        Vector3& w2 = mSolverBodies.angularVelocities[solverIndexBody2];
 
         const Matrix3x3& i1 = mBallAndSocketJointComponents.mI1[i];
         const Matrix3x3& i2 = mBallAndSocketJointComponents.mI2[i];
@@ -258,13 +254,13 @@ void SolveBallAndSocketJointSystem::solveVelocityConstraint() {
                 const Vector3 angularImpulseBody1 = deltaLambdaConeLimit * mBallAndSocketJointComponents.mConeLimitACrossB[i];
 
                 // Apply the impulse to the body 1
-                w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
+                w1 += mSolverBodies.angularLockAxisFactors[solverIndexBody1] * (i1 * angularImpulseBody1);
 
                 // Compute the impulse P=J^T * lambda for the lower limit constraint of body 2
                 const Vector3 angularImpulseBody2 = -deltaLambdaConeLimit * mBallAndSocketJointComponents.mConeLimitACrossB[i];
 
                 // Apply the impulse to the body 2
-                w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
+                w2 += mSolverBodies.angularLockAxisFactors[solverIndexBody2] * (i2 * angularImpulseBody2);
 
             }
         }
@@ -283,15 +279,15 @@ void SolveBallAndSocketJointSystem::solveVelocityConstraint() {
         const Vector3 angularImpulseBody1 = deltaLambda.cross(mBallAndSocketJointComponents.mR1World[i]);
 
         // Apply the impulse to the body 1
-        v1 += mRigidBodyComponents.mInverseMasses[componentIndexBody1] * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
-        w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
+        v1 += mSolverBodies.inverseMasses[solverIndexBody1] * mSolverBodies.linearLockAxisFactors[solverIndexBody1] * linearImpulseBody1;
+        w1 += mSolverBodies.angularLockAxisFactors[solverIndexBody1] * (i1 * angularImpulseBody1);
 
         // Compute the impulse P=J^T * lambda for the body 2
         const Vector3 angularImpulseBody2 = -deltaLambda.cross(mBallAndSocketJointComponents.mR2World[i]);
 
         // Apply the impulse to the body 2
-        v2 += mRigidBodyComponents.mInverseMasses[componentIndexBody2] * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * deltaLambda;
-        w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
+        v2 += mSolverBodies.inverseMasses[solverIndexBody2] * mSolverBodies.linearLockAxisFactors[solverIndexBody2] * deltaLambda;
+        w2 += mSolverBodies.angularLockAxisFactors[solverIndexBody2] * (i2 * angularImpulseBody2);
     }
 }
 
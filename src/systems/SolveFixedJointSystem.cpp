@@ -26,6 +26,7 @@
 // Libraries
 #include <reactphysics3d/systems/SolveFixedJointSystem.h>
 #include <reactphysics3d/engine/PhysicsWorld.h>
+#include <reactphysics3d/engine/SolverBodies.h>
 #include <reactphysics3d/body/RigidBody.h>
 
 using namespace reactphysics3d;
@@ -34,11 +35,12 @@ using namespace reactphysics3d;
 const decimal SolveFixedJointSystem::BETA = decimal(0.2);
 
 // Constructor
-SolveFixedJointSystem::SolveFixedJointSystem(PhysicsWorld& world, RigidBodyComponents& rigidBodyComponents,
+SolveFixedJointSystem::SolveFixedJointSystem(PhysicsWorld& world, SolverBodies& solverBodies,
+                                             RigidBodyComponents& rigidBodyComponents,
                                              TransformComponents& transformComponents,
                                              JointComponents& jointComponents,
                                              FixedJointComponents& fixedJointComponents)
-              :mWorld(world), mRigidBodyComponents(rigidBodyComponents), mTransformComponents(transformComponents),
+              :mWorld(world), mSolverBodies(solverBodies), mRigidBodyComponents(rigidBodyComponents), mTransformComponents(transformComponents),
                mJointComponents(jointComponents), mFixedJointComponents(fixedJointComponents),
                mTimeStep(0), mIsWarmStartingActive(true) {
 
@@ -63,6 +65,10 @@ void SolveFixedJointSystem::initBeforeSolve() {
         const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
         const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
 
+        // Get the indices of the bodies in the solver bodies
+        mFixedJointComponents.mSolverBodyIndexBody1[i] = mSolverBodies.getSolverBodyIndex(componentIndexBody1);
+        mFixedJointComponents.mSolverBodyIndexBody2[i] = mSolverBodies.getSolverBodyIndex(componentIndexBody2);
+
         assert(!mRigidBodyComponents.getIsEntityDisabled(body1Entity));
         assert(!mRigidBodyComponents.getIsEntityDisabled(body2Entity));
 
@@ -149,25 +155,19 @@ void SolveFixedJointSystem::warmstart() {
     const uint32 nbJoints = mFixedJointComponents.getNbEnabledComponents();
     for (uint32 i=0; i < nbJoints; i++) {
 
-        const Entity jointEntity = mFixedJointComponents.mJointEntities[i];
-        const uint32 jointIndex = mJointComponents.getEntityIndex(jointEntity);
-
-        // Get the bodies entities
-        const Entity body1Entity = mJointComponents.mBody1Entities[jointIndex];
-        const Entity body2Entity = mJointComponents.mBody2Entities[jointIndex];
-
-        const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
-        const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
+        // Get the indices of the bodies in the solver bodies
+        const uint32 solverIndexBody1 = mFixedJointComponents.mSolverBodyIndexBody1[i];
+        const uint32 solverIndexBody2 = mFixedJointComponents.mSolverBodyIndexBody2[i];
 
         // Get the velocities
-        Vector3& v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
-        Vector3& v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
-        Vector3& w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
-        Vector3& w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
+        Vector3& v1 = mSolverBodies.linearVelocities[solverIndexBody1];
+        Vector3& v2 = mSolverBodies.linearVelocities[solverIndexBody2];
+        Vector3& w1 = mSolverBodies.angularVelocities[solverIndexBody1];
+        Vector3& w2 = mSolverBodies.angularVelocities[solverIndexBody2];
 
         // Get the inverse mass of the bodies
-        const decimal inverseMassBody1 = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
-        const decimal inverseMassBody2 = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
+        const decimal inverseMassBody1 = mSolverBodies.inverseMasses[solverIndexBody1];
+        const decimal inverseMassBody2 = mSolverBodies.inverseMasses[solverIndexBody2];
 
         const Vector3& impulseTranslation = mFixedJointComponents.mImpulseTranslation[i];
         const Vector3& impulseRotation = mFixedJointComponents.mImpulseRotation[i];
@@ -185,8 +185,8 @@ void SolveFixedJointSystem::warmstart() {
         const Matrix3x3& i1 = mFixedJointComponents.mI1[i];
 
         // Apply the impulse to the body 1
-        v1 += inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
-        w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
+        v1 += inverseMassBody1 * mSolverBodies.linearLockAxisFactors[solverIndexBody1] * linearImpulseBody1;
+        w1 += mSolverBodies.angularLockAxisFactors[solverIndexBody1] * (i1 * angularImpulseBody1);
 
         // Compute the impulse P=J^T * lambda for the 3 translation constraints for body 2
         Vector3 angularImpulseBody2 = -impulseTranslation.cross(r2World);
@@ -197,8 +197,8 @@ void SolveFixedJointSystem::warmstart() {
         const Matrix3x3& i2 = mFixedJointComponents.mI2[i];
 
         // Apply the impulse to the body 2
-        v2 += inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * impulseTranslation;
-        w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
+        v2 += inverseMassBody2 * mSolverBodies.linearLockAxisFactors[solverIndexBody2] * impulseTranslation;
+        w2 += mSolverBodies.angularLockAxisFactors[solverIndexBody2] * (i2 * angularImpulseBody2);
     }
 }
 
@@ -209,25 +209,19 @@ void SolveFixedJointSystem::solveVelocityConstraint() {
     const uint32 nbJoints = mFixedJointComponents.getNbEnabledComponents();
     for (uint32 i=0; i < nbJoints; i++) {
 
-        const Entity jointEntity = mFixedJointComponents.mJointEntities[i];
-        const uint32 jointIndex = mJointComponents.getEntityIndex(jointEntity);
-
-        // Get the bodies entities
-        const Entity body1Entity = mJointComponents.mBody1Entities[jointIndex];
-        const Entity body2Entity = mJointComponents.mBody2Entities[jointIndex];
-
-        const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
-        const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
+        // Get the indices of the bodies in the solver bodies
+        const uint32 solverIndexBody1 = mFixedJointComponents.mSolverBodyIndexBody1[i];
+        const uint32 solverIndexBody2 = mFixedJointComponents.mSolverBodyIndexBody2[i];
 
         // Get the velocities
-        Vector3& v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
-        Vector3& v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
-        Vector3& w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
-        Vector3& w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
+        Vector3& v1 = mSolverBodies.linearVelocities[solverIndexBody1];
+        Vector3& v2 = mSolverBodies.linearVelocities[solverIndexBody2];
+        Vector3& w1 = mSolverBodies.angularVelocities[solverIndexBody1];
+        Vector3& w2 = mSolverBodies.angularVelocities[solverIndexBody2];
 
         // Get the inverse mass of the bodies
-        decimal inverseMassBody1 = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
-        decimal inverseMassBody2 = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
+        decimal inverseMassBody1 = mSolverBodies.inverseMasses[solverIndexBody1];
+        decimal inverseMassBody2 = mSolverBodies.inverseMasses[solverIndexBody2];
 
         const Vector3& r1World = mFixedJointComponents.mR1World[i];
         const Vector3& r2World = mFixedJointComponents.mR2World[i];
@@ -250,8 +244,8 @@ void SolveFixedJointSystem::solveVelocityConstraint() {
         const Matrix3x3& i1 = mFixedJointComponents.mI1[i];
 
         // Apply the impulse to the body 1
-        v1 += inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
-        w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
+        v1 += inverseMassBody1 * mSolverBodies.linearLockAxisFactors[solverIndexBody1] * linearImpulseBody1;
+        w1 += mSolverBodies.angularLockAxisFactors[solverIndexBody1] * (i1 * angularImpulseBody1);
 
         // Compute the impulse P=J^T * lambda  for body 2
         const Vector3 angularImpulseBody2 = -deltaLambda.cross(r2World);
@@ -259,8 +253,8 @@ void SolveFixedJointSystem::solveVelocityConstraint() {
         const Matrix3x3& i2 = mFixedJointComponents.mI2[i];
 
         // Apply the impulse to the body 2
-        v2 += inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * deltaLambda;
-        w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
+        v2 += inverseMassBody2 * mSolverBodies.linearLockAxisFactors[solverIndexBody2] * deltaLambda;
+        w2 += mSolverBodies.angularLockAxisFactors[solverIndexBody2] * (i2 * angularImpulseBody2);
 
         // --------------- Rotation Constraints --------------- //
 
@@ -278,10 +272,10 @@ void SolveFixedJointSystem::solveVelocityConstraint() {
         angularImpulseBody1 = -deltaLambda2;
 
         // Apply the impulse to the body 1
-        w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
+        w1 += mSolverBodies.angularLockAxisFactors[solverIndexBody1] * (i1 * angularImpulseBody1);
 
         // Apply the impulse to the body 2
-        w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * deltaLambda2);
+        w2 += mSolverBodies.angularLockAxisFactors[solverIndexBody2] * (i2 * deltaLambda2);
     }
 }
 
@@ -26,6 +26,7 @@
 // Libraries
 #include <reactphysics3d/systems/SolveHingeJointSystem.h>
 #include <reactphysics3d/engine/PhysicsWorld.h>
+#include <reactphysics3d/engine/SolverBodies.h>
 #include <reactphysics3d/body/RigidBody.h>
 
 using namespace reactphysics3d;
@@ -34,11 +35,12 @@ using namespace reactphysics3d;
 const decimal SolveHingeJointSystem::BETA = decimal(0.2);
 
 // Constructor
-SolveHingeJointSystem::SolveHingeJointSystem(PhysicsWorld& world, RigidBodyComponents& rigidBodyComponents,
+SolveHingeJointSystem::SolveHingeJointSystem(PhysicsWorld& world, SolverBodies& solverBodies,
+                                             RigidBodyComponents& rigidBodyComponents,
                                                              TransformComponents& transformComponents,
                                                              JointComponents& jointComponents,
                                                              HingeJointComponents& hingeJointComponents)
-              :mWorld(world), mRigidBodyComponents(rigidBodyComponents), mTransformComponents(transformComponents),
+              :mWorld(world), mSolverBodies(solverBodies), mRigidBodyComponents(rigidBodyComponents), mTransformComponents(transformComponents),
                mJointComponents(jointComponents), mHingeJointComponents(hingeJointComponents),
                mTimeStep(0), mIsWarmStartingActive(true) {
 
@@ -63,6 +65,10 @@ void SolveHingeJointSystem::initBeforeSolve() {
         const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
         const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
 
+        // Get the indices of the bodies in the solver bodies
+        mHingeJointComponents.mSolverBodyIndexBody1[i] = mSolverBodies.getSolverBodyIndex(componentIndexBody1);
+        mHingeJointComponents.mSolverBodyIndexBody2[i] = mSolverBodies.getSolverBodyIndex(componentIndexBody2);
+
         assert(!mRigidBodyComponents.getIsEntityDisabled(body1Entity));
         assert(!mRigidBodyComponents.getIsEntityDisabled(body2Entity));
 
@@ -220,25 +226,19 @@ void SolveHingeJointSystem::warmstart() {
     const uint32 nbJoints = mHingeJointComponents.getNbEnabledComponents();
     for (uint32 i=0; i < nbJoints; i++) {
 
-        const Entity jointEntity = mHingeJointComponents.mJointEntities[i];
-        const uint32 jointIndex = mJointComponents.getEntityIndex(jointEntity);
-
-        // Get the bodies entities
-        const Entity body1Entity = mJointComponents.mBody1Entities[jointIndex];
-        const Entity body2Entity = mJointComponents.mBody2Entities[jointIndex];
-
-        const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
-        const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
+        // Get the indices of the bodies in the solver bodies
+        const uint32 solverIndexBody1 = mHingeJointComponents.mSolverBodyIndexBody1[i];
+        const uint32 solverIndexBody2 = mHingeJointComponents.mSolverBodyIndexBody2[i];
 
         // Get the velocities
-        Vector3& v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
-        Vector3& v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
-        Vector3& w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
-        Vector3& w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
+        Vector3& v1 = mSolverBodies.linearVelocities[solverIndexBody1];
+        Vector3& v2 = mSolverBodies.linearVelocities[solverIndexBody2];
+        Vector3& w1 = mSolverBodies.angularVelocities[solverIndexBody1];
+        Vector3& w2 = mSolverBodies.angularVelocities[solverIndexBody2];
 
         // Get the inverse mass and inverse inertia tensors of the bodies
-        const decimal inverseMassBody1 = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
-        const decimal inverseMassBody2 = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
+        const decimal inverseMassBody1 = mSolverBodies.inverseMasses[solverIndexBody1];
+        const decimal inverseMassBody2 = mSolverBodies.inverseMasses[solverIndexBody2];
 
         const Vector3& impulseTranslation = mHingeJointComponents.mImpulseTranslation[i];
         const Vector2& impulseRotation = mHingeJointComponents.mImpulseRotation[i];
@@ -272,8 +272,8 @@ void SolveHingeJointSystem::warmstart() {
         angularImpulseBody1 += motorImpulse;
 
         // Apply the impulse to the body 1
-        v1 += inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
-        w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mHingeJointComponents.mI1[i] * angularImpulseBody1);
+        v1 += inverseMassBody1 * mSolverBodies.linearLockAxisFactors[solverIndexBody1] * linearImpulseBody1;
+        w1 += mSolverBodies.angularLockAxisFactors[solverIndexBody1] * (mHingeJointComponents.mI1[i] * angularImpulseBody1);
 
         // Compute the impulse P=J^T * lambda for the 3 translation constraints of body 2
         Vector3 angularImpulseBody2 = -impulseTranslation.cross(mHingeJointComponents.mR2World[i]);
@@ -288,8 +288,8 @@ void SolveHingeJointSystem::warmstart() {
         angularImpulseBody2 += -motorImpulse;
 
         // Apply the impulse to the body 2
-        v2 += inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * impulseTranslation;
-        w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mHingeJointComponents.mI2[i] * angularImpulseBody2);
+        v2 += inverseMassBody2 * mSolverBodies.linearLockAxisFactors[solverIndexBody2] * impulseTranslation;
+        w2 += mSolverBodies.angularLockAxisFactors[solverIndexBody2] * (mHingeJointComponents.mI2[i] * angularImpulseBody2);
     }
 }
 
@@ -300,25 +300,19 @@ void SolveHingeJointSystem::solveVelocityConstraint() {
     const uint32 nbJoints = mHingeJointComponents.getNbEnabledComponents();
     for (uint32 i=0; i < nbJoints; i++) {
 
-        const Entity jointEntity = mHingeJointComponents.mJointEntities[i];
-        const uint32 jointIndex = mJointComponents.getEntityIndex(jointEntity);
-
-        // Get the bodies entities
-        const Entity body1Entity = mJointComponents.mBody1Entities[jointIndex];
-        const Entity body2Entity = mJointComponents.mBody2Entities[jointIndex];
-
-        const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
-        const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
+        // Get the indices of the bodies in the solver bodies
+        const uint32 solverIndexBody1 = mHingeJointComponents.mSolverBodyIndexBody1[i];
+        const uint32 solverIndexBody2 = mHingeJointComponents.mSolverBodyIndexBody2[i];
 
         // Get the velocities
-        Vector3& v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
-        Vector3& v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
-        Vector3& w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
-        Vector3& w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
+        Vector3& v1 = mSolverBodies.linearVelocities[solverIndexBody1];
+        Vector3& v2 = mSolverBodies.linearVelocities[solverIndexBody2];
+        Vector3& w1 = mSolverBodies.angularVelocities[solverIndexBody1];
+        Vector3& w2 = mSolverBodies.angularVelocities[solverIndexBody2];
 
         // Get the inverse mass and inverse inertia tensors of the bodies
-        decimal inverseMassBody1 = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
-        decimal inverseMassBody2 = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
+        decimal inverseMassBody1 = mSolverBodies.inverseMasses[solverIndexBody1];
+        decimal inverseMassBody2 = mSolverBodies.inverseMasses[solverIndexBody2];
 
         const Matrix3x3& i1 = mHingeJointComponents.mI1[i];
         const Matrix3x3& i2 = mHingeJointComponents.mI2[i];
@@ -350,13 +344,13 @@ void SolveHingeJointSystem::solveVelocityConstraint() {
                 const Vector3 angularImpulseBody1 = -deltaLambdaLower * a1;
 
                 // Apply the impulse to the body 1
-                w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
+                w1 += mSolverBodies.angularLockAxisFactors[solverIndexBody1] * (i1 * angularImpulseBody1);
 
                 // Compute the impulse P=J^T * lambda for the lower limit constraint of body 2
                 const Vector3 angularImpulseBody2 = deltaLambdaLower * a1;
 
                 // Apply the impulse to the body 2
-                w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
+                w2 += mSolverBodies.angularLockAxisFactors[solverIndexBody2] * (i2 * angularImpulseBody2);
             }
 
             // If the upper limit is violated
@@ -375,13 +369,13 @@ void SolveHingeJointSystem::solveVelocityConstraint() {
                 const Vector3 angularImpulseBody1 = deltaLambdaUpper * a1;
 
                 // Apply the impulse to the body 1
-                w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
+                w1 += mSolverBodies.angularLockAxisFactors[solverIndexBody1] * (i1 * angularImpulseBody1);
 
                 // Compute the impulse P=J^T * lambda for the upper limit constraint of body 2
                 const Vector3 angularImpulseBody2 = -deltaLambdaUpper * a1;
 
                 // Apply the impulse to the body 2
-                w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
+                w2 += mSolverBodies.angularLockAxisFactors[solverIndexBody2] * (i2 * angularImpulseBody2);
             }
         }
 
@@ -404,13 +398,13 @@ void SolveHingeJointSystem::solveVelocityConstraint() {
             const Vector3 angularImpulseBody1 = -deltaLambdaMotor * a1;
 
             // Apply the impulse to the body 1
-            w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
+            w1 += mSolverBodies.angularLockAxisFactors[solverIndexBody1] * (i1 * angularImpulseBody1);
 
             // Compute the impulse P=J^T * lambda for the motor of body 2
             const Vector3 angularImpulseBody2 = deltaLambdaMotor * a1;
 
             // Apply the impulse to the body 2
-            w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
+            w2 += mSolverBodies.angularLockAxisFactors[solverIndexBody2] * (i2 * angularImpulseBody2);
         }
 
         // --------------- Joint Rotation Constraints --------------- //
@@ -431,13 +425,13 @@ void SolveHingeJointSystem::solveVelocityConstraint() {
         Vector3 angularImpulseBody1 = -b2CrossA1 * deltaLambdaRotation.x - c2CrossA1 * deltaLambdaRotation.y;
 
         // Apply the impulse to the body 1
-        w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
+        w1 += mSolverBodies.angularLockAxisFactors[solverIndexBody1] * (i1 * angularImpulseBody1);
 
         // Compute the impulse P=J^T * lambda for the 2 rotation constraints of body 2
         Vector3 angularImpulseBody2 = b2CrossA1 * deltaLambdaRotation.x + c2CrossA1 * deltaLambdaRotation.y;
 
         // Apply the impulse to the body 2
-        w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
+        w2 += mSolverBodies.angularLockAxisFactors[solverIndexBody2] * (i2 * angularImpulseBody2);
 
         // --------------- Joint Translation Constraints --------------- //
 
@@ -454,15 +448,15 @@ void SolveHingeJointSystem::solveVelocityConstraint() {
         angularImpulseBody1 = deltaLambdaTranslation.cross(r1World);
 
         // Apply the impulse to the body 1
-        v1 += inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
-        w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
+        v1 += inverseMassBody1 * mSolverBodies.linearLockAxisFactors[solverIndexBody1] * linearImpulseBody1;
+        w1 += mSolverBodies.angularLockAxisFactors[solverIndexBody1] * (i1 * angularImpulseBody1);
 
         // Compute the impulse P=J^T * lambda of body 2
         angularImpulseBody2 = -deltaLambdaTranslation.cross(r2World);
 
         // Apply the impulse to the body 2
-        v2 += inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * deltaLambdaTranslation;
-        w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
+        v2 += inverseMassBody2 * mSolverBodies.linearLockAxisFactors[solverIndexBody2] * deltaLambdaTranslation;
+        w2 += mSolverBodies.angularLockAxisFactors[solverIndexBody2] * (i2 * angularImpulseBody2);
     }
 }
 
@@ -26,6 +26,7 @@
 // Libraries
 #include <reactphysics3d/systems/SolveSliderJointSystem.h>
 #include <reactphysics3d/engine/PhysicsWorld.h>
+#include <reactphysics3d/engine/SolverBodies.h>
 #include <reactphysics3d/body/RigidBody.h>
 
 using namespace reactphysics3d;
@@ -34,11 +35,12 @@ using namespace reactphysics3d;
 const decimal SolveSliderJointSystem::BETA = decimal(0.2);
 
 // Constructor
-SolveSliderJointSystem::SolveSliderJointSystem(PhysicsWorld& world, RigidBodyComponents& rigidBodyComponents,
+SolveSliderJointSystem::SolveSliderJointSystem(PhysicsWorld& world, SolverBodies& solverBodies,
+                                               RigidBodyComponents& rigidBodyComponents,
                                                              TransformComponents& transformComponents,
                                                              JointComponents& jointComponents,
                                                              SliderJointComponents& sliderJointComponents)
-              :mWorld(world), mRigidBodyComponents(rigidBodyComponents), mTransformComponents(transformComponents),
+              :mWorld(world), mSolverBodies(solverBodies), mRigidBodyComponents(rigidBodyComponents), mTransformComponents(transformComponents),
                mJointComponents(jointComponents), mSliderJointComponents(sliderJointComponents),
                mTimeStep(0), mIsWarmStartingActive(true) {
 
@@ -63,6 +65,10 @@ void SolveSliderJointSystem::initBeforeSolve() {
         const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
         const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
 
+        // Get the indices of the bodies in the solver bodies
+        mSliderJointComponents.mSolverBodyIndexBody1[i] = mSolverBodies.getSolverBodyIndex(componentIndexBody1);
+        mSliderJointComponents.mSolverBodyIndexBody2[i] = mSolverBodies.getSolverBodyIndex(componentIndexBody2);
+
         assert(!mRigidBodyComponents.getIsEntityDisabled(body1Entity));
         assert(!mRigidBodyComponents.getIsEntityDisabled(body2Entity));
 
@@ -246,25 +252,19 @@ void SolveSliderJointSystem::warmstart() {
     const uint32 nbJoints = mSliderJointComponents.getNbEnabledComponents();
     for (uint32 i=0; i < nbJoints; i++) {
 
-        const Entity jointEntity = mSliderJointComponents.mJointEntities[i];
-        const uint32 jointIndex = mJointComponents.getEntityIndex(jointEntity);
-
-        // Get the bodies entities
-        const Entity body1Entity = mJointComponents.mBody1Entities[jointIndex];
-        const Entity body2Entity = mJointComponents.mBody2Entities[jointIndex];
-
-        const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
-        const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
+        // Get the indices of the bodies in the solver bodies
+        const uint32 solverIndexBody1 = mSliderJointComponents.mSolverBodyIndexBody1[i];
+        const uint32 solverIndexBody2 = mSliderJointComponents.mSolverBodyIndexBody2[i];
 
         // Get the velocities
-        Vector3& v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
-        Vector3& v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
-        Vector3& w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
-        Vector3& w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
+        Vector3& v1 = mSolverBodies.linearVelocities[solverIndexBody1];
+        Vector3& v2 = mSolverBodies.linearVelocities[solverIndexBody2];
+        Vector3& w1 = mSolverBodies.angularVelocities[solverIndexBody1];
+        Vector3& w2 = mSolverBodies.angularVelocities[solverIndexBody2];
 
         // Get the inverse mass and inverse inertia tensors of the bodies
-        const decimal inverseMassBody1 = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
-        const decimal inverseMassBody2 = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
+        const decimal inverseMassBody1 = mSolverBodies.inverseMasses[solverIndexBody1];
+        const decimal inverseMassBody2 = mSolverBodies.inverseMasses[solverIndexBody2];
 
         const Vector3& n1 = mSliderJointComponents.mN1[i];
         const Vector3& n2 = mSliderJointComponents.mN2[i];
@@ -295,8 +295,8 @@ void SolveSliderJointSystem::warmstart() {
         linearImpulseBody1 += impulseMotor;
 
         // Apply the impulse to the body 1
-        v1 += inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
-        w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mSliderJointComponents.mI1[i] * angularImpulseBody1);
+        v1 += inverseMassBody1 * mSolverBodies.linearLockAxisFactors[solverIndexBody1] * linearImpulseBody1;
+        w1 += mSolverBodies.angularLockAxisFactors[solverIndexBody1] * (mSliderJointComponents.mI1[i] * angularImpulseBody1);
 
         // Compute the impulse P=J^T * lambda for the 2 translation constraints of body 2
         Vector3 linearImpulseBody2 = n1 * impulseTranslation.x + n2 * impulseTranslation.y;
@@ -314,8 +314,8 @@ void SolveSliderJointSystem::warmstart() {
         linearImpulseBody2 += -impulseMotor;
 
         // Apply the impulse to the body 2
-        v2 += inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * linearImpulseBody2;
-        w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mSliderJointComponents.mI2[i] * angularImpulseBody2);
+        v2 += inverseMassBody2 * mSolverBodies.linearLockAxisFactors[solverIndexBody2] * linearImpulseBody2;
+        w2 += mSolverBodies.angularLockAxisFactors[solverIndexBody2] * (mSliderJointComponents.mI2[i] * angularImpulseBody2);
     }
 }
 
@@ -326,21 +326,15 @@ void SolveSliderJointSystem::solveVelocityConstraint() {
     const uint32 nbJoints = mSliderJointComponents.getNbEnabledComponents();
     for (uint32 i=0; i < nbJoints; i++) {
 
-        const Entity jointEntity = mSliderJointComponents.mJointEntities[i];
-        const uint32 jointIndex = mJointComponents.getEntityIndex(jointEntity);
-
-        // Get the bodies entities
-        const Entity body1Entity = mJointComponents.mBody1Entities[jointIndex];
-        const Entity body2Entity = mJointComponents.mBody2Entities[jointIndex];
-
-        const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
-        const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
+        // Get the indices of the bodies in the solver bodies
+        const uint32 solverIndexBody1 = mSliderJointComponents.mSolverBodyIndexBody1[i];
+        const uint32 solverIndexBody2 = mSliderJointComponents.mSolverBodyIndexBody2[i];
 
         // Get the velocities
-        Vector3& v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
-        Vector3& v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
-        Vector3& w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
-        Vector3& w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
+        Vector3& v1 = mSolverBodies.linearVelocities[solverIndexBody1];
+        Vector3& v2 = mSolverBodies.linearVelocities[solverIndexBody2];
+        Vector3& w1 = mSolverBodies.angularVelocities[solverIndexBody1];
+        Vector3& w2 = mSolverBodies.angularVelocities[solverIndexBody2];
 
         const Matrix3x3& i1 = mSliderJointComponents.mI1[i];
         const Matrix3x3& i2 = mSliderJointComponents.mI2[i];
@@ -354,8 +348,8 @@ void SolveSliderJointSystem::solveVelocityConstraint() {
         const Vector3& r1PlusUCrossN2 = mSliderJointComponents.mR1PlusUCrossN2[i];
 
         // Get the inverse mass and inverse inertia tensors of the bodies
-        decimal inverseMassBody1 = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
-        decimal inverseMassBody2 = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
+        decimal inverseMassBody1 = mSolverBodies.inverseMasses[solverIndexBody1];
+        decimal inverseMassBody2 = mSolverBodies.inverseMasses[solverIndexBody2];
 
         const Vector3& r2CrossSliderAxis = mSliderJointComponents.mR2CrossSliderAxis[i];
         const Vector3& r1PlusUCrossSliderAxis = mSliderJointComponents.mR1PlusUCrossSliderAxis[i];
@@ -366,8 +360,8 @@ void SolveSliderJointSystem::solveVelocityConstraint() {
 
         if (mSliderJointComponents.mIsLimitEnabled[i]) {
 
-            Vector3& w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
-            Vector3& w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
+            Vector3& w1 = mSolverBodies.angularVelocities[solverIndexBody1];
+            Vector3& w2 = mSolverBodies.angularVelocities[solverIndexBody2];
 
             const decimal inverseMassMatrixLimit = mSliderJointComponents.mInverseMassMatrixLimit[i];
 
@@ -389,16 +383,16 @@ void SolveSliderJointSystem::solveVelocityConstraint() {
                 const Vector3 angularImpulseBody1 = -deltaLambdaLower * r1PlusUCrossSliderAxis;
 
                 // Apply the impulse to the body 1
-                v1 += inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
-                w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mSliderJointComponents.mI1[i] * angularImpulseBody1);
+                v1 += inverseMassBody1 * mSolverBodies.linearLockAxisFactors[solverIndexBody1] * linearImpulseBody1;
+                w1 += mSolverBodies.angularLockAxisFactors[solverIndexBody1] * (mSliderJointComponents.mI1[i] * angularImpulseBody1);
 
                 // Compute the impulse P=J^T * lambda for the lower limit constraint of body 2
                 const Vector3 linearImpulseBody2 = deltaLambdaLower * sliderAxisWorld;
                 const Vector3 angularImpulseBody2 = deltaLambdaLower * r2CrossSliderAxis;
 
                 // Apply the impulse to the body 2
-                v2 += inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * linearImpulseBody2;
-                w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mSliderJointComponents.mI2[i] * angularImpulseBody2);
+                v2 += inverseMassBody2 * mSolverBodies.linearLockAxisFactors[solverIndexBody2] * linearImpulseBody2;
+                w2 += mSolverBodies.angularLockAxisFactors[solverIndexBody2] * (mSliderJointComponents.mI2[i] * angularImpulseBody2);
             }
 
             // If the upper limit is violated
@@ -419,16 +413,16 @@ void SolveSliderJointSystem::solveVelocityConstraint() {
                 const Vector3 angularImpulseBody1 = deltaLambdaUpper * r1PlusUCrossSliderAxis;
 
                 // Apply the impulse to the body 1
-                v1 += inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
-                w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mSliderJointComponents.mI1[i] * angularImpulseBody1);
+                v1 += inverseMassBody1 * mSolverBodies.linearLockAxisFactors[solverIndexBody1] * linearImpulseBody1;
+                w1 += mSolverBodies.angularLockAxisFactors[solverIndexBody1] * (mSliderJointComponents.mI1[i] * angularImpulseBody1);
 
                 // Compute the impulse P=J^T * lambda for the upper limit constraint of body 2
                 const Vector3 linearImpulseBody2 = -deltaLambdaUpper * sliderAxisWorld;
                 const Vector3 angularImpulseBody2 = -deltaLambdaUpper * r2CrossSliderAxis;
 
                 // Apply the impulse to the body 2
-                v2 += inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * linearImpulseBody2;
-                w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mSliderJointComponents.mI2[i] * angularImpulseBody2);
+                v2 += inverseMassBody2 * mSolverBodies.linearLockAxisFactors[solverIndexBody2] * linearImpulseBody2;
+                w2 += mSolverBodies.angularLockAxisFactors[solverIndexBody2] * (mSliderJointComponents.mI2[i] * angularImpulseBody2);
             }
         }
 
@@ -450,13 +444,13 @@ void SolveSliderJointSystem::solveVelocityConstraint() {
             const Vector3 linearImpulseBody1 = deltaLambdaMotor * sliderAxisWorld;
 
             // Apply the impulse to the body 1
-            v1 += inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
+            v1 += inverseMassBody1 * mSolverBodies.linearLockAxisFactors[solverIndexBody1] * linearImpulseBody1;
 
             // Compute the impulse P=J^T * lambda for the motor of body 2
             const Vector3 linearImpulseBody2 = -deltaLambdaMotor * sliderAxisWorld;
 
             // Apply the impulse to the body 2
-            v2 += inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * linearImpulseBody2;
+            v2 += inverseMassBody2 * mSolverBodies.linearLockAxisFactors[solverIndexBody2] * linearImpulseBody2;
         }
 
         // --------------- Rotation Constraints --------------- //
@@ -466,20 +460,20 @@ void SolveSliderJointSystem::solveVelocityConstraint() {
 
         // Compute the Lagrange multiplier lambda for the 3 rotation constraints
         Vector3 deltaLambda2 = mSliderJointComponents.mInverseMassMatrixRotation[i] *
-                               (-JvRotation - mSliderJointComponents.getBiasRotation(jointEntity));
+                               (-JvRotation - mSliderJointComponents.mBiasRotation[i]);
         mSliderJointComponents.mImpulseRotation[i] += deltaLambda2;
 
         // Compute the impulse P=J^T * lambda for the 3 rotation constraints of body 1
         Vector3 angularImpulseBody1 = -deltaLambda2;
 
         // Apply the impulse to the body 1
-        w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mSliderJointComponents.mI1[i] * angularImpulseBody1);
+        w1 += mSolverBodies.angularLockAxisFactors[solverIndexBody1] * (mSliderJointComponents.mI1[i] * angularImpulseBody1);
 
         // Compute the impulse P=J^T * lambda for the 3 rotation constraints of body 2
         Vector3 angularImpulseBody2 = deltaLambda2;
 
         // Apply the impulse to the body 2
-        w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mSliderJointComponents.mI2[i] * angularImpulseBody2);
+        w2 += mSolverBodies.angularLockAxisFactors[solverIndexBody2] * (mSliderJointComponents.mI2[i] * angularImpulseBody2);
 
         // --------------- Translation Constraints --------------- //
 
@@ -500,16 +494,16 @@ void SolveSliderJointSystem::solveVelocityConstraint() {
                 r1PlusUCrossN2 * deltaLambda.y;
 
         // Apply the impulse to the body 1
-        v1 += inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
-        w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
+        v1 += inverseMassBody1 * mSolverBodies.linearLockAxisFactors[solverIndexBody1] * linearImpulseBody1;
+        w1 += mSolverBodies.angularLockAxisFactors[solverIndexBody1] * (i1 * angularImpulseBody1);
 
         // Compute the impulse P=J^T * lambda for the 2 translation constraints of body 2
         const Vector3 linearImpulseBody2 = -linearImpulseBody1;
         angularImpulseBody2 = r2CrossN1 * deltaLambda.x + r2CrossN2 * deltaLambda.y;
 
         // Apply the impulse to the body 2
-        v2 += inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * linearImpulseBody2;
-        w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
+        v2 += inverseMassBody2 * mSolverBodies.linearLockAxisFactors[solverIndexBody2] * linearImpulseBody2;
+        w2 += mSolverBodies.angularLockAxisFactors[solverIndexBody2] * (i2 * angularImpulseBody2);
     }
 }
 
@@ -33,6 +33,8 @@
 #include <reactphysics3d/collision/shapes/BoxShape.h>
 #include <reactphysics3d/collision/shapes/SphereShape.h>
 #include <reactphysics3d/collision/shapes/CapsuleShape.h>
+#include <reactphysics3d/collision/shapes/CylinderShape.h>
+#include <reactphysics3d/collision/shapes/ConeShape.h>
 #include <reactphysics3d/collision/Collider.h>
 #include <reactphysics3d/engine/PhysicsWorld.h>
 #include <reactphysics3d/containers/Pair.h>
@@ -271,6 +273,67 @@ void DebugRenderer::drawCapsule(const Transform& transform, decimal radius, deci
 	}
 }
 
+// Draw a cylinder
+void DebugRenderer::drawCylinder(const Transform& transform, decimal radius, decimal height, uint32 color) {
+
+    Vector3 topVertices[NB_SECTORS_SPHERE + 1];
+    Vector3 bottomVertices[NB_SECTORS_SPHERE + 1];
+
+    const decimal halfHeight = decimal(0.5) * height;
+    const decimal sectorStep = 2 * PI_RP3D / NB_SECTORS_SPHERE;
+
+    // Vertices of the two caps
+    for (uint32 j = 0; j <= NB_SECTORS_SPHERE; j++) {
+
+        const decimal sectorAngle = j * sectorStep;
+        const decimal x = radius * std::sin(sectorAngle);
+        const decimal z = radius * std::cos(sectorAngle);
+
+        topVertices[j] = transform * Vector3(x, halfHeight, z);
+        bottomVertices[j] = transform * Vector3(x, -halfHeight, z);
+    }
+
+    const Vector3 topCenter = transform * Vector3(0, halfHeight, 0);
+    const Vector3 bottomCenter = transform * Vector3(0, -halfHeight, 0);
+
+    for (uint32 j = 0; j < NB_SECTORS_SPHERE; j++) {
+
+        // Faces of the caps
+        mTriangles.add(DebugTriangle(topCenter, topVertices[j], topVertices[j + 1], color));
+        mTriangles.add(DebugTriangle(bottomCenter, bottomVertices[j + 1], bottomVertices[j], color));
+
+        // Faces of the side
+        mTriangles.add(DebugTriangle(topVertices[j], bottomVertices[j], topVertices[j + 1], color));
+        mTriangles.add(DebugTriangle(topVertices[j + 1], bottomVertices[j], bottomVertices[j + 1], color));
+    }
+}
+
+// Draw a cone (the origin of the cone is its center of mass)
+void DebugRenderer::drawCone(const Transform& transform, decimal radius, decimal height, uint32 color) {
+
+    Vector3 baseVertices[NB_SECTORS_SPHERE + 1];
+
+    const decimal baseY = decimal(-0.25) * height;
+    const decimal sectorStep = 2 * PI_RP3D / NB_SECTORS_SPHERE;
+
+    // Vertices of the base
+    for (uint32 j = 0; j <= NB_SECTORS_SPHERE; j++) {
+
+        const decimal sectorAngle = j * sectorStep;
+        baseVertices[j] = transform * Vector3(radius * std::sin(sectorAngle), baseY, radius * std::cos(sectorAngle));
+    }
+
+    const Vector3 apex = transform * Vector3(0, decimal(0.75) * height, 0);
+    const Vector3 baseCenter = transform * Vector3(0, baseY, 0);
+
+    for (uint32 j = 0; j < NB_SECTORS_SPHERE; j++) {
+
+        // Faces of the base and of the side
+        mTriangles.add(DebugTriangle(baseCenter, baseVertices[j + 1], baseVertices[j], color));
+        mTriangles.add(DebugTriangle(apex, baseVertices[j], baseVertices[j + 1], color));
+    }
+}
+
 // Draw a convex mesh
 void DebugRenderer::drawConvexMesh(const Transform& transform, const ConvexMeshShape* convexMesh, uint32 color) {
 
@@ -369,6 +432,18 @@ void DebugRenderer::drawCollisionShapeOfCollider(const Collider* collider, uint3
             drawCapsule(collider->getLocalToWorldTransform(), capsuleShape->getRadius(), capsuleShape->getHeight(), color);
             break;
         }
+        case CollisionShapeName::CYLINDER:
+        {
+            const CylinderShape* cylinderShape = static_cast<const CylinderShape*>(collider->getCollisionShape());
+            drawCylinder(collider->getLocalToWorldTransform(), cylinderShape->getRadius(), cylinderShape->getHeight(), color);
+            break;
+        }
+        case CollisionShapeName::CONE:
+        {
+            const ConeShape* coneShape = static_cast<const ConeShape*>(collider->getCollisionShape());
+            drawCone(collider->getLocalToWorldTransform(), coneShape->getRadius(), coneShape->getHeight(), color);
+            break;
+        }
         case CollisionShapeName::CONVEX_MESH:
         {
             const ConvexMeshShape*  convexMeshShape = static_cast<const ConvexMeshShape*>(collider->getCollisionShape());
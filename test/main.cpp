@@ -37,7 +37,9 @@
 #include "tests/collision/TestCollisionWorld.h"
 #include "tests/collision/TestAABB.h"
 #include "tests/collision/TestDynamicAABBTree.h"
+#include "tests/collision/TestStaticAABBTree.h"
 #include "tests/collision/TestHalfEdgeStructure.h"
+#include "tests/collision/TestConvexHull.h"
 #include "tests/collision/TestTriangleVertexArray.h"
 #include "tests/containers/TestArray.h"
 #include "tests/containers/TestMap.h"
@@ -45,6 +47,8 @@
 #include "tests/containers/TestDeque.h"
 #include "tests/containers/TestStack.h"
 #include "tests/engine/TestRigidBody.h"
+#include "tests/engine/TestSolverBodies.h"
+#include "tests/engine/TestContactSolver.h"
 
 using namespace reactphysics3d;
 
@@ -78,12 +82,16 @@ int main() {
     testSuite.addTest(new TestRaycast("Raycasting"));
     testSuite.addTest(new TestCollisionWorld("CollisionWorld"));
     testSuite.addTest(new TestDynamicAABBTree("DynamicAABBTree"));
+    testSuite.addTest(new TestStaticAABBTree("StaticAABBTree"));
     testSuite.addTest(new TestHalfEdgeStructure("HalfEdgeStructure"));
+    testSuite.addTest(new TestConvexHull("ConvexHull"));
 
 
     // ---------- Engine tests ---------- //
 
     testSuite.addTest(new TestRigidBody("RigidBody"));
+    testSuite.addTest(new TestSolverBodies("SolverBodies"));
+    testSuite.addTest(new TestContactSolver("ContactSolver"));
 
     // Run the tests
     testSuite.run();
@@ -50,11 +50,13 @@ struct CollisionPointData {
 	Vector3 localPointBody1;
 	Vector3 localPointBody2;
 	decimal penetrationDepth;
+	Vector3 worldNormal;
 
-	CollisionPointData(const Vector3& point1, const Vector3& point2, decimal penDepth) {
+	CollisionPointData(const Vector3& point1, const Vector3& point2, decimal penDepth, const Vector3& normal) {
 		localPointBody1 = point1;
 		localPointBody2 = point2;
 		penetrationDepth = penDepth;
+		worldNormal = normal;
 	}
 
 	bool isContactPointSimilarTo(const Vector3& pointBody1, const Vector3& pointBody2, decimal penDepth, decimal epsilon = 0.001) const {
@@ -185,11 +187,10 @@ class WorldCollisionCallback : public CollisionCallback
         // This method is called when some contacts occur
         virtual void onContact(const CallbackData& callbackData) override {
 
-            CollisionData collisionData;
-
             // For each contact pair
             for (uint32 p=0; p < callbackData.getNbContactPairs(); p++) {
 
+                CollisionData collisionData;
                 ContactPairData contactPairData;
                 ContactPair contactPair = callbackData.getContactPair(p);
 
@@ -201,14 +202,15 @@ class WorldCollisionCallback : public CollisionCallback
 
                     ContactPoint contactPoint = contactPair.getContactPoint(c);
 
-                    CollisionPointData collisionPoint(contactPoint.getLocalPointOnCollider1(), contactPoint.getLocalPointOnCollider2(), contactPoint.getPenetrationDepth());
+                    CollisionPointData collisionPoint(contactPoint.getLocalPointOnCollider1(), contactPoint.getLocalPointOnCollider2(), contactPoint.getPenetrationDepth(),
+                                                      contactPoint.getWorldNormal());
                     contactPairData.contactPoints.push_back(collisionPoint);
                 }
 
                 collisionData.contactPairs.push_back(contactPairData);
-            }
 
-            mCollisionDatas.insert(std::make_pair(getCollisionKeyPair(collisionData.colliders), collisionData));
+                mCollisionDatas.insert(std::make_pair(getCollisionKeyPair(collisionData.colliders), collisionData));
+            }
         }
 };
 
@@ -254,6 +256,59 @@ class WorldOverlapCallback : public OverlapCallback {
 		}
 };
 
+/// Event listener that records the triggers reported during a world update
+class WorldTriggerListener : public EventListener {
+
+    private:
+
+        std::vector<std::pair<Collider*, Collider*>> mTriggerColliders;
+
+    public:
+
+        /// Called when some trigger events occur
+        virtual void onTrigger(const OverlapCallback::CallbackData& callbackData) override {
+
+            // For each overlapping pair
+            for (uint32 i=0; i < callbackData.getNbOverlappingPairs(); i++) {
+
+                OverlapCallback::OverlapPair overlapPair = callbackData.getOverlappingPair(i);
+                if (overlapPair.getEventType() != OverlapCallback::OverlapPair::EventType::OverlapExit) {
+                    mTriggerColliders.push_back(std::make_pair(overlapPair.getCollider1(), overlapPair.getCollider2()));
+                }
+            }
+        }
+
+        void reset() {
+            mTriggerColliders.clear();
+        }
+
+        bool isTriggerOverlapping(Collider* collider1, Collider* collider2) const {
+
+            for (uint32 i=0; i < mTriggerColliders.size(); i++) {
+
+                if ((mTriggerColliders[i].first == collider1 && mTriggerColliders[i].second == collider2) ||
+                    (mTriggerColliders[i].first == collider2 && mTriggerColliders[i].second == collider1)) {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+};
+
+/// Event listener that records the contacts reported during a world update
+class WorldContactListener : public EventListener {
+
+    public:
+
+        WorldCollisionCallback collisionCallback;
+
+        /// Called when some contacts occur
+        virtual void onContact(const CollisionCallback::CallbackData& callbackData) override {
+            collisionCallback.onContact(callbackData);
+        }
+};
+
 // Class TestCollisionWorld
 /**
  * Unit test for the CollisionWorld class.
@@ -502,6 +557,9 @@ class TestCollisionWorld : public Test {
 			testSphereVsCapsuleCollision();
 			testSphereVsConvexMeshCollision();
             testSphereVsConcaveMeshCollision();
+            testSphereVsConcaveMeshConvexEdge();
+            testConvexVsConcaveMeshInternalEdge();
+            testCompressedConcaveMeshWithFreedSource();
 
             testBoxVsBoxCollision();
             testBoxVsConvexMeshCollision();
@@ -512,8 +570,20 @@ class TestCollisionWorld : public Test {
             testCapsuleVsConcaveMeshCollision();
 
             testConvexMeshVsConvexMeshCollision();
+            testConvexMeshVsConvexMeshCollisionEPA();
             testConvexMeshVsCapsuleCollision();
             testConvexMeshVsConcaveMeshCollision();
+
+            testCylinderVsBoxCollision();
+            testConeVsBoxCollision();
+            testCylinderAndConeRestingOnBox();
+            testCylinderVsConcaveMeshCollision();
+
+            testTriggerOverlap();
+            testContactManifoldPersistence();
+            testContactManifoldPersistenceWithCollisionQuery();
+            testCollisionFiltering();
+            testCompoundBody();
         }
 
 		void testNoCollisions() {
@@ -1711,6 +1781,656 @@ class TestCollisionWorld : public Test {
             mConcaveMeshBody->setTransform(initTransform2);
         }
 
+        void testSphereVsConcaveMeshConvexEdge() {
+
+            /********************************************************************************
+            * Test Sphere vs Concave Mesh on a convex edge of the mesh
+            *********************************************************************************/
+
+            // Two triangles forming a ridge along the z axis at (0, 1, z)
+            float ridgeVertices[4 * 3] = {-1, 0, 0,   0, 1, -1,   0, 1, 1,   1, 0, 0};
+            int ridgeIndices[2 * 3] = {0, 2, 1,   3, 1, 2};
+
+            TriangleVertexArray ridgeTriangleVertexArray(4, &(ridgeVertices[0]), 3 * sizeof(float), 2, &(ridgeIndices[0]), 3 * sizeof(int),
+                                                         rp3d::TriangleVertexArray::VertexDataType::VERTEX_FLOAT_TYPE,
+                                                         rp3d::TriangleVertexArray::IndexDataType::INDEX_INTEGER_TYPE);
+            TriangleMesh* ridgeTriangleMesh = mPhysicsCommon.createTriangleMesh();
+            ridgeTriangleMesh->addSubpart(&ridgeTriangleVertexArray);
+            ConcaveMeshShape* ridgeShape = mPhysicsCommon.createConcaveMeshShape(ridgeTriangleMesh);
+            CollisionBody* ridgeBody = mWorld->createCollisionBody(Transform(Vector3(100, 0, 0), Quaternion::identity()));
+            Collider* ridgeCollider = ridgeBody->addCollider(ridgeShape, Transform::identity());
+
+            // The sphere touches the ridge outside of the faces of the two triangles
+            SphereShape* sphereShape = mPhysicsCommon.createSphereShape(decimal(0.5));
+            CollisionBody* sphereBody = mWorld->createCollisionBody(Transform(Vector3(decimal(100.2), decimal(1.4), 0), Quaternion::identity()));
+            Collider* sphereCollider = sphereBody->addCollider(sphereShape, Transform::identity());
+
+            mCollisionCallback.reset();
+            mWorld->testCollision(sphereBody, ridgeBody, mCollisionCallback);
+
+            rp3d_test(mCollisionCallback.areCollidersColliding(sphereCollider, ridgeCollider));
+
+            const CollisionData* collisionData = mCollisionCallback.getCollisionData(sphereCollider, ridgeCollider);
+            rp3d_test(collisionData != nullptr);
+
+            // True if the bodies are swapped in the collision callback response
+            bool swappedBodiesCollisionData = collisionData->getBody1()->getEntity() != sphereBody->getEntity();
+
+            // The ridge is a convex edge so the contact normal is the direction from the ridge to the
+            // sphere center (and not a face normal of one of the triangles)
+            const Vector3 normal = Vector3(decimal(0.2), decimal(0.4), 0).getUnit();
+            Vector3 localSpherePoint = -normal * decimal(0.5);
+            Vector3 localRidgePoint(0, 1, 0);
+            decimal penetrationDepth = decimal(0.5) - std::sqrt(decimal(0.2));
+            rp3d_test(collisionData->hasContactPointSimilarTo(swappedBodiesCollisionData ? localRidgePoint : localSpherePoint,
+                                                         swappedBodiesCollisionData ? localSpherePoint : localRidgePoint,
+                                                         penetrationDepth));
+
+            // The world contact normal goes from body 1 toward body 2
+            rp3d_test(collisionData->getTotalNbContactPoints() == 1);
+            rp3d_test(approxEqual(collisionData->contactPairs[0].contactPoints[0].worldNormal, swappedBodiesCollisionData ? normal : -normal, decimal(0.001)));
+
+            mWorld->destroyCollisionBody(sphereBody);
+            mWorld->destroyCollisionBody(ridgeBody);
+            mPhysicsCommon.destroySphereShape(sphereShape);
+            mPhysicsCommon.destroyConcaveMeshShape(ridgeShape);
+            mPhysicsCommon.destroyTriangleMesh(ridgeTriangleMesh);
+        }
+
+        void testConvexVsConcaveMeshInternalEdge() {
+
+            // Flat square made of two triangles with an internal edge along the diagonal from (-1, 0, -1) to (1, 0, 1)
+            float squareVertices[4 * 3] = {-1, 0, -1,   1, 0, -1,   1, 0, 1,   -1, 0, 1};
+            int squareIndices[2 * 3] = {0, 3, 2,   0, 2, 1};
+
+            TriangleVertexArray squareTriangleVertexArray(4, &(squareVertices[0]), 3 * sizeof(float), 2, &(squareIndices[0]), 3 * sizeof(int),
+                                                          rp3d::TriangleVertexArray::VertexDataType::VERTEX_FLOAT_TYPE,
+                                                          rp3d::TriangleVertexArray::IndexDataType::INDEX_INTEGER_TYPE);
+            TriangleMesh* squareTriangleMesh = mPhysicsCommon.createTriangleMesh();
+            squareTriangleMesh->addSubpart(&squareTriangleVertexArray);
+            ConcaveMeshShape* squareShape = mPhysicsCommon.createConcaveMeshShape(squareTriangleMesh);
+            CollisionBody* squareBody = mWorld->createCollisionBody(Transform(Vector3(200, 0, 0), Quaternion::identity()));
+            Collider* squareCollider = squareBody->addCollider(squareShape, Transform::identity());
+
+            const Vector3 up(0, 1, 0);
+
+            /********************************************************************************
+            * Test Sphere vs Concave Mesh on an internal edge of the mesh
+            *********************************************************************************/
+
+            // The sphere center is above the second triangle, close to the internal edge. The first
+            // triangle is also touched on the internal edge and must report the face normal
+            SphereShape* sphereShape = mPhysicsCommon.createSphereShape(decimal(0.5));
+            CollisionBody* sphereBody = mWorld->createCollisionBody(Transform(Vector3(decimal(200.05), decimal(0.4), decimal(-0.05)), Quaternion::identity()));
+            Collider* sphereCollider = sphereBody->addCollider(sphereShape, Transform::identity());
+
+            mCollisionCallback.reset();
+            mWorld->testCollision(sphereBody, squareBody, mCollisionCallback);
+
+            rp3d_test(mCollisionCallback.areCollidersColliding(sphereCollider, squareCollider));
+
+            const CollisionData* collisionData = mCollisionCallback.getCollisionData(sphereCollider, squareCollider);
+            rp3d_test(collisionData != nullptr);
+            rp3d_test(collisionData->getNbContactPairs() == 1);
+
+            // True if the bodies are swapped in the collision callback response
+            bool swappedBodiesCollisionData = collisionData->getBody1()->getEntity() != sphereBody->getEntity();
+
+            Vector3 localSpherePoint(0, decimal(-0.5), 0);
+            Vector3 localSquarePoint(decimal(0.05), 0, decimal(-0.05));
+            rp3d_test(collisionData->hasContactPointSimilarTo(swappedBodiesCollisionData ? localSquarePoint : localSpherePoint,
+                                                         swappedBodiesCollisionData ? localSpherePoint : localSquarePoint,
+                                                         decimal(0.1)));
+
+            // All the contact normals are the face normal of the mesh
+            for (uint32 i=0; i < collisionData->contactPairs[0].getNbContactPoints(); i++) {
+                rp3d_test(approxEqual(collisionData->contactPairs[0].contactPoints[i].worldNormal, swappedBodiesCollisionData ? up : -up, decimal(0.001)));
+            }
+
+            mWorld->destroyCollisionBody(sphereBody);
+            mPhysicsCommon.destroySphereShape(sphereShape);
+
+            /********************************************************************************
+            * Test Capsule vs Concave Mesh on an internal edge of the mesh
+            *********************************************************************************/
+
+            // The capsule lies on the mesh along the x axis and crosses the internal edge at (0.1, 0, 0.1)
+            CapsuleShape* capsuleShape = mPhysicsCommon.createCapsuleShape(decimal(0.25), decimal(1.0));
+            const Quaternion capsuleOrientation = Quaternion::fromEulerAngles(0, 0, PI_RP3D * decimal(0.5));
+            CollisionBody* capsuleBody = mWorld->createCollisionBody(Transform(Vector3(decimal(200.1), decimal(0.2), decimal(0.1)), capsuleOrientation));
+            Collider* capsuleCollider = capsuleBody->addCollider(capsuleShape, Transform::identity());
+
+            mCollisionCallback.reset();
+            mWorld->testCollision(capsuleBody, squareBody, mCollisionCallback);
+
+            rp3d_test(mCollisionCallback.areCollidersColliding(capsuleCollider, squareCollider));
+
+            collisionData = mCollisionCallback.getCollisionData(capsuleCollider, squareCollider);
+            rp3d_test(collisionData != nullptr);
+            rp3d_test(collisionData->getNbContactPairs() == 1);
+            rp3d_test(collisionData->getTotalNbContactPoints() >= 2);
+
+            swappedBodiesCollisionData = collisionData->getBody1()->getEntity() != capsuleBody->getEntity();
+
+            // There is a contact point under each end of the capsule segment
+            const Vector3 localCapsuleDown = capsuleOrientation.getInverse() * Vector3(0, decimal(-0.25), 0);
+            Vector3 localCapsulePoint1 = Vector3(0, decimal(0.5), 0) + localCapsuleDown;
+            Vector3 localSquarePoint1(decimal(-0.4), 0, decimal(0.1));
+            Vector3 localCapsulePoint2 = Vector3(0, decimal(-0.5), 0) + localCapsuleDown;
+            Vector3 localSquarePoint2(decimal(0.6), 0, decimal(0.1));
+            rp3d_test(collisionData->hasContactPointSimilarTo(swappedBodiesCollisionData ? localSquarePoint1 : localCapsulePoint1,
+                                                         swappedBodiesCollisionData ? localCapsulePoint1 : localSquarePoint1,
+                                                         decimal(0.05)));
+            rp3d_test(collisionData->hasContactPointSimilarTo(swappedBodiesCollisionData ? localSquarePoint2 : localCapsulePoint2,
+                                                         swappedBodiesCollisionData ? localCapsulePoint2 : localSquarePoint2,
+                                                         decimal(0.05)));
+
+            for (uint32 i=0; i < collisionData->contactPairs[0].getNbContactPoints(); i++) {
+                rp3d_test(approxEqual(collisionData->contactPairs[0].contactPoints[i].worldNormal, swappedBodiesCollisionData ? up : -up, decimal(0.001)));
+                rp3d_test(approxEqual(collisionData->contactPairs[0].contactPoints[i].penetrationDepth, decimal(0.05), decimal(0.001)));
+            }
+
+            // The capsule stands on the second triangle close to the internal edge. The first triangle is
+            // only touched by the bottom cap of the capsule on the internal edge and must report the face normal
+            capsuleBody->setTransform(Transform(Vector3(decimal(200.05), decimal(0.7), decimal(-0.05)), Quaternion::identity()));
+
+            mCollisionCallback.reset();
+            mWorld->testCollision(capsuleBody, squareBody, mCollisionCallback);
+
+            rp3d_test(mCollisionCallback.areCollidersColliding(capsuleCollider, squareCollider));
+
+            collisionData = mCollisionCallback.getCollisionData(capsuleCollider, squareCollider);
+            rp3d_test(collisionData != nullptr);
+            rp3d_test(collisionData->getNbContactPairs() == 1);
+
+            swappedBodiesCollisionData = collisionData->getBody1()->getEntity() != capsuleBody->getEntity();
+
+            Vector3 localCapsulePoint(0, decimal(-0.75), 0);
+            rp3d_test(collisionData->hasContactPointSimilarTo(swappedBodiesCollisionData ? localSquarePoint : localCapsulePoint,
+                                                         swappedBodiesCollisionData ? localCapsulePoint : localSquarePoint,
+                                                         decimal(0.05)));
+
+            for (uint32 i=0; i < collisionData->contactPairs[0].getNbContactPoints(); i++) {
+                rp3d_test(approxEqual(collisionData->contactPairs[0].contactPoints[i].worldNormal, swappedBodiesCollisionData ? up : -up, decimal(0.001)));
+            }
+
+            mWorld->destroyCollisionBody(capsuleBody);
+            mPhysicsCommon.destroyCapsuleShape(capsuleShape);
+
+            /********************************************************************************
+            * Test Box vs Concave Mesh on an internal edge of the mesh
+            *********************************************************************************/
+
+            // The bottom face of the box rests on the mesh across the internal edge
+            BoxShape* boxShape = mPhysicsCommon.createBoxShape(Vector3(decimal(0.3), decimal(0.3), decimal(0.3)));
+            const Quaternion boxOrientation = Quaternion::fromEulerAngles(0, PI_RP3D * decimal(0.25), 0);
+            CollisionBody* boxBody = mWorld->createCollisionBody(Transform(Vector3(200, decimal(0.29), 0), boxOrientation));
+            Collider* boxCollider = boxBody->addCollider(boxShape, Transform::identity());
+
+            mCollisionCallback.reset();
+            mWorld->testCollision(boxBody, squareBody, mCollisionCallback);
+
+            rp3d_test(mCollisionCallback.areCollidersColliding(boxCollider, squareCollider));
+
+            collisionData = mCollisionCallback.getCollisionData(boxCollider, squareCollider);
+            rp3d_test(collisionData != nullptr);
+            rp3d_test(collisionData->getNbContactPairs() == 1);
+            rp3d_test(collisionData->getTotalNbContactPoints() == 4);
+
+            swappedBodiesCollisionData = collisionData->getBody1()->getEntity() != boxBody->getEntity();
+
+            // The contact points are the four corners of the bottom face of the box
+            const Vector3 boxCorners[4] = {Vector3(decimal(0.3), decimal(-0.3), decimal(0.3)), Vector3(decimal(-0.3), decimal(-0.3), decimal(0.3)),
+                                           Vector3(decimal(-0.3), decimal(-0.3), decimal(-0.3)), Vector3(decimal(0.3), decimal(-0.3), decimal(-0.3))};
+            for (uint32 i=0; i < 4; i++) {
+                Vector3 localSquarePoint = boxOrientation * boxCorners[i] + Vector3(0, decimal(0.29), 0);
+                localSquarePoint.y = 0;
+                rp3d_test(collisionData->hasContactPointSimilarTo(swappedBodiesCollisionData ? localSquarePoint : boxCorners[i],
+                                                             swappedBodiesCollisionData ? boxCorners[i] : localSquarePoint,
+                                                             decimal(0.01)));
+            }
+
+            for (uint32 i=0; i < collisionData->contactPairs[0].getNbContactPoints(); i++) {
+                rp3d_test(approxEqual(collisionData->contactPairs[0].contactPoints[i].worldNormal, swappedBodiesCollisionData ? up : -up, decimal(0.001)));
+            }
+
+            mWorld->destroyCollisionBody(boxBody);
+            mPhysicsCommon.destroyBoxShape(boxShape);
+
+            mWorld->destroyCollisionBody(squareBody);
+            mPhysicsCommon.destroyConcaveMeshShape(squareShape);
+            mPhysicsCommon.destroyTriangleMesh(squareTriangleMesh);
+        }
+
+        void testCompressedConcaveMeshWithFreedSource() {
+
+            // Mesh with two sub-parts that are flat squares made of two triangles (x in [-1, 1] and in [1, 3])
+            float* vertices[2];
+            int* indices[2];
+            TriangleVertexArray* triangleVertexArrays[2];
+            TriangleMesh* triangleMesh = mPhysicsCommon.createTriangleMesh();
+            for (int p=0; p < 2; p++) {
+
+                const float x = 2.0f * p;
+                vertices[p] = new float[4 * 3] {x - 1, 0, -1,   x + 1, 0, -1,   x + 1, 0, 1,   x - 1, 0, 1};
+                indices[p] = new int[2 * 3] {0, 3, 2,   0, 2, 1};
+                triangleVertexArrays[p] = new TriangleVertexArray(4, vertices[p], 3 * sizeof(float), 2, indices[p], 3 * sizeof(int),
+                                                                  rp3d::TriangleVertexArray::VertexDataType::VERTEX_FLOAT_TYPE,
+                                                                  rp3d::TriangleVertexArray::IndexDataType::INDEX_INTEGER_TYPE);
+                triangleMesh->addSubpart(triangleVertexArrays[p]);
+            }
+
+            ConcaveMeshShape* meshShape = mPhysicsCommon.createConcaveMeshShape(triangleMesh, Vector3(1, 1, 1), true);
+
+            // Overwrite and free the source arrays, the vertex arrays and the triangle mesh
+            for (int p=0; p < 2; p++) {
+                for (int i=0; i < 4 * 3; i++) vertices[p][i] = 1000000.0f;
+                for (int i=0; i < 2 * 3; i++) indices[p][i] = -1;
+                delete[] vertices[p];
+                delete[] indices[p];
+                delete triangleVertexArrays[p];
+            }
+            mPhysicsCommon.destroyTriangleMesh(triangleMesh);
+
+            // The triangles can still be queried
+            rp3d_test(meshShape->getNbSubparts() == 2);
+            rp3d_test(meshShape->getNbTriangles(0) == 2);
+            rp3d_test(meshShape->getNbTriangles(1) == 2);
+            uint32 triangleIndices[3];
+            meshShape->getTriangleVerticesIndices(1, 1, triangleIndices);
+            rp3d_test(triangleIndices[0] == 0 && triangleIndices[1] == 2 && triangleIndices[2] == 1);
+            rp3d_test(meshShape->to_string().find("nbSubparts=2") != std::string::npos);
+
+            CollisionBody* meshBody = mWorld->createCollisionBody(Transform(Vector3(500, 0, 0), Quaternion::identity()));
+            Collider* meshCollider = meshBody->addCollider(meshShape, Transform::identity());
+
+            const Vector3 up(0, 1, 0);
+
+            // Raycast against the second sub-part
+            Ray ray(Vector3(502, 5, decimal(0.5)), Vector3(502, -5, decimal(0.5)));
+            RaycastInfo raycastInfo;
+            rp3d_test(meshCollider->raycast(ray, raycastInfo));
+            rp3d_test(raycastInfo.meshSubpart == 1);
+            rp3d_test(approxEqual(raycastInfo.hitFraction, decimal(0.5), decimal(0.001)));
+            rp3d_test(approxEqual(raycastInfo.worldPoint, Vector3(502, 0, decimal(0.5)), decimal(0.001)));
+            rp3d_test(approxEqual(raycastInfo.worldNormal, up, decimal(0.001)));
+
+            // Collision between a sphere and the first sub-part
+            SphereShape* sphereShape = mPhysicsCommon.createSphereShape(decimal(0.5));
+            CollisionBody* sphereBody = mWorld->createCollisionBody(Transform(Vector3(decimal(500.5), decimal(0.4), decimal(0.2)), Quaternion::identity()));
+            Collider* sphereCollider = sphereBody->addCollider(sphereShape, Transform::identity());
+
+            mCollisionCallback.reset();
+            mWorld->testCollision(sphereBody, meshBody, mCollisionCallback);
+
+            rp3d_test(mCollisionCallback.areCollidersColliding(sphereCollider, meshCollider));
+
+            const CollisionData* collisionData = mCollisionCallback.getCollisionData(sphereCollider, meshCollider);
+            rp3d_test(collisionData != nullptr);
+            rp3d_test(collisionData->getNbContactPairs() == 1);
+
+            bool swappedBodiesCollisionData = collisionData->getBody1()->getEntity() != sphereBody->getEntity();
+
+            Vector3 localSpherePoint(0, decimal(-0.5), 0);
+            Vector3 localMeshPoint(decimal(0.5), 0, decimal(0.2));
+            rp3d_test(collisionData->hasContactPointSimilarTo(swappedBodiesCollisionData ? localMeshPoint : localSpherePoint,
+                                                         swappedBodiesCollisionData ? localSpherePoint : localMeshPoint,
+                                                         decimal(0.1)));
+            decimal maxPenetrationDepth = 0;
+            for (uint32 i=0; i < collisionData->contactPairs[0].getNbContactPoints(); i++) {
+                const CollisionPointData& contactPoint = collisionData->contactPairs[0].contactPoints[i];
+                rp3d_test(approxEqual(contactPoint.worldNormal, swappedBodiesCollisionData ? up : -up, decimal(0.001)));
+                maxPenetrationDepth = std::max(maxPenetrationDepth, contactPoint.penetrationDepth);
+            }
+            rp3d_test(approxEqual(maxPenetrationDepth, decimal(0.1), decimal(0.001)));
+
+            // A shape created from the cooked data of the compressed shape has the same triangles
+            const size_t cookedDataSize = meshShape->getCookedDataSize();
+            std::vector<uint64> cookedData((cookedDataSize + 7) / 8);
+            meshShape->cook(cookedData.data());
+            ConcaveMeshShape* cookedShape = mPhysicsCommon.createConcaveMeshShapeFromCooked(cookedData.data(), cookedDataSize);
+            rp3d_test(cookedShape != nullptr);
+            rp3d_test(cookedShape->getNbSubparts() == 2);
+            rp3d_test(cookedShape->getNbTriangles(1) == 2);
+            cookedShape->getTriangleVerticesIndices(1, 1, triangleIndices);
+            rp3d_test(triangleIndices[0] == 0 && triangleIndices[1] == 2 && triangleIndices[2] == 1);
+
+            CollisionBody* cookedBody = mWorld->createCollisionBody(Transform(Vector3(500, 0, 0), Quaternion::identity()));
+            Collider* cookedCollider = cookedBody->addCollider(cookedShape, Transform::identity());
+            rp3d_test(cookedCollider->raycast(ray, raycastInfo));
+            rp3d_test(raycastInfo.meshSubpart == 1);
+            rp3d_test(approxEqual(raycastInfo.worldPoint, Vector3(502, 0, decimal(0.5)), decimal(0.001)));
+
+            mWorld->destroyCollisionBody(cookedBody);
+            mPhysicsCommon.destroyConcaveMeshShape(cookedShape);
+            mWorld->destroyCollisionBody(sphereBody);
+            mPhysicsCommon.destroySphereShape(sphereShape);
+            mWorld->destroyCollisionBody(meshBody);
+            mPhysicsCommon.destroyConcaveMeshShape(meshShape);
+        }
+
+        void testTriggerOverlap() {
+
+            /********************************************************************************
+            * Test triggers that are only tested for overlap during the world update
+            *********************************************************************************/
+
+            WorldTriggerListener triggerListener;
+            mWorld->setEventListener(&triggerListener);
+
+            // Trigger box zone
+            BoxShape* zoneShape = mPhysicsCommon.createBoxShape(Vector3(2, 2, 2));
+            CollisionBody* zoneBody = mWorld->createCollisionBody(Transform(Vector3(200, 0, 0), Quaternion::identity()));
+            Collider* zoneCollider = zoneBody->addCollider(zoneShape, Transform::identity());
+            zoneCollider->setIsTrigger(true);
+
+            // Sphere and box overlapping the zone
+            SphereShape* sphereShape = mPhysicsCommon.createSphereShape(decimal(0.5));
+            CollisionBody* sphereBody = mWorld->createCollisionBody(Transform(Vector3(decimal(202.3), 0, 0), Quaternion::identity()));
+            Collider* sphereCollider = sphereBody->addCollider(sphereShape, Transform::identity());
+
+            BoxShape* boxShape = mPhysicsCommon.createBoxShape(Vector3(1, 1, 1));
+            CollisionBody* boxBody = mWorld->createCollisionBody(Transform(Vector3(200, decimal(2.5), 0), Quaternion::identity()));
+            Collider* boxCollider = boxBody->addCollider(boxShape, Transform::identity());
+
+            triggerListener.reset();
+            mWorld->update(decimal(1.0) / decimal(60.0));
+            rp3d_test(triggerListener.isTriggerOverlapping(zoneCollider, sphereCollider));
+            rp3d_test(triggerListener.isTriggerOverlapping(zoneCollider, boxCollider));
+
+            // Move the sphere near a corner of the zone (its AABB still overlaps the zone AABB) and the box outside of the zone
+            sphereBody->setTransform(Transform(Vector3(decimal(202.4), decimal(2.4), 0), Quaternion::identity()));
+            boxBody->setTransform(Transform(Vector3(decimal(203.05), decimal(2.5), 0), Quaternion::identity()));
+
+            triggerListener.reset();
+            mWorld->update(decimal(1.0) / decimal(60.0));
+            rp3d_test(!triggerListener.isTriggerOverlapping(zoneCollider, sphereCollider));
+            rp3d_test(!triggerListener.isTriggerOverlapping(zoneCollider, boxCollider));
+
+            mWorld->setEventListener(nullptr);
+            mWorld->destroyCollisionBody(zoneBody);
+            mWorld->destroyCollisionBody(sphereBody);
+            mWorld->destroyCollisionBody(boxBody);
+            mPhysicsCommon.destroyBoxShape(zoneShape);
+            mPhysicsCommon.destroySphereShape(sphereShape);
+            mPhysicsCommon.destroyBoxShape(boxShape);
+        }
+
+        void testContactManifoldPersistence() {
+
+            /********************************************************************************
+            * Test the reuse of the contact manifold of a resting pair between two updates
+            *********************************************************************************/
+
+            PhysicsWorld::WorldSettings settings;
+            settings.isContactManifoldPersistenceEnabled = true;
+            settings.contactManifoldPersistenceDistanceThreshold = decimal(0.01);
+            PhysicsWorld* world = mPhysicsCommon.createPhysicsWorld(settings);
+
+            WorldContactListener contactListener;
+            world->setEventListener(&contactListener);
+
+            BoxShape* groundShape = mPhysicsCommon.createBoxShape(Vector3(10, 1, 10));
+            CollisionBody* groundBody = world->createCollisionBody(Transform::identity());
+            Collider* groundCollider = groundBody->addCollider(groundShape, Transform::identity());
+
+            // Unit box resting on the ground with a penetration depth of 0.02
+            BoxShape* boxShape = mPhysicsCommon.createBoxShape(Vector3(1, 1, 1));
+            CollisionBody* boxBody = world->createCollisionBody(Transform(Vector3(0, decimal(1.98), 0), Quaternion::identity()));
+            Collider* boxCollider = boxBody->addCollider(boxShape, Transform::identity());
+
+            // ----- First update (full narrow-phase) ----- //
+
+            world->update(decimal(1.0) / decimal(60.0));
+
+            const CollisionData* collisionData = contactListener.collisionCallback.getCollisionData(boxCollider, groundCollider);
+            rp3d_test(collisionData != nullptr);
+            rp3d_test(collisionData->getTotalNbContactPoints() == 4);
+            bool swappedBodiesCollisionData = collisionData->getBody1()->getEntity() != boxBody->getEntity();
+            rp3d_test(collisionData->hasContactPointSimilarTo(swappedBodiesCollisionData ? Vector3(1, 1, 1) : Vector3(1, -1, 1),
+                                                              swappedBodiesCollisionData ? Vector3(1, -1, 1) : Vector3(1, 1, 1),
+                                                              decimal(0.02)));
+            const ContactPairData firstContacts = collisionData->contactPairs[0];
+
+            // ----- Small motion: the previous contacts are re-projected ----- //
+
+            boxBody->setTransform(Transform(Vector3(decimal(0.004), decimal(1.978), 0), Quaternion::identity()));
+
+            contactListener.collisionCallback.reset();
+            world->update(decimal(1.0) / decimal(60.0));
+
+            collisionData = contactListener.collisionCallback.getCollisionData(boxCollider, groundCollider);
+            rp3d_test(collisionData != nullptr);
+            rp3d_test(collisionData->getTotalNbContactPoints() == 4);
+
+            // The local points are the ones of the previous frame and the penetration depth is updated
+            for (uint32 c=0; c < firstContacts.contactPoints.size(); c++) {
+                const CollisionPointData& point = firstContacts.contactPoints[c];
+                rp3d_test(collisionData->hasContactPointSimilarTo(point.localPointBody1, point.localPointBody2, decimal(0.022), decimal(0.0005)));
+            }
+
+            // ----- Motion above the threshold: the narrow-phase is computed again ----- //
+
+            boxBody->setTransform(Transform(Vector3(decimal(0.054), decimal(1.978), 0), Quaternion::identity()));
+
+            contactListener.collisionCallback.reset();
+            world->update(decimal(1.0) / decimal(60.0));
+
+            collisionData = contactListener.collisionCallback.getCollisionData(boxCollider, groundCollider);
+            rp3d_test(collisionData != nullptr);
+            rp3d_test(collisionData->getTotalNbContactPoints() == 4);
+
+            // The contact points on the ground follow the new position of the box
+            swappedBodiesCollisionData = collisionData->getBody1()->getEntity() != boxBody->getEntity();
+            rp3d_test(collisionData->hasContactPointSimilarTo(swappedBodiesCollisionData ? Vector3(decimal(1.054), 1, 1) : Vector3(1, -1, 1),
+                                                              swappedBodiesCollisionData ? Vector3(1, -1, 1) : Vector3(decimal(1.054), 1, 1),
+                                                              decimal(0.022), decimal(0.0005)));
+            rp3d_test(!collisionData->hasContactPointSimilarTo(firstContacts.contactPoints[0].localPointBody1,
+                                                               firstContacts.contactPoints[0].localPointBody2, decimal(0.022), decimal(0.0005)));
+
+            world->setEventListener(nullptr);
+            mPhysicsCommon.destroyPhysicsWorld(world);
+            mPhysicsCommon.destroyBoxShape(groundShape);
+            mPhysicsCommon.destroyBoxShape(boxShape);
+        }
+
+        void testContactManifoldPersistenceWithCollisionQuery() {
+
+            /********************************************************************************
+            * Test that a collision query between two updates does not break the reuse of   *
+            * the contact manifolds of the resting pairs                                    *
+            *********************************************************************************/
+
+            PhysicsWorld::WorldSettings settings;
+            settings.isContactManifoldPersistenceEnabled = true;
+            settings.contactManifoldPersistenceDistanceThreshold = decimal(0.01);
+            PhysicsWorld* world = mPhysicsCommon.createPhysicsWorld(settings);
+
+            WorldContactListener contactListener;
+            world->setEventListener(&contactListener);
+
+            BoxShape* groundShape = mPhysicsCommon.createBoxShape(Vector3(20, 1, 20));
+            CollisionBody* groundBody = world->createCollisionBody(Transform::identity());
+            Collider* groundCollider = groundBody->addCollider(groundShape, Transform::identity());
+
+            // Three unit boxes resting on the ground with a penetration depth of 0.02
+            const uint32 nbBoxes = 3;
+            BoxShape* boxShape = mPhysicsCommon.createBoxShape(Vector3(1, 1, 1));
+            CollisionBody* boxBodies[nbBoxes];
+            Collider* boxColliders[nbBoxes];
+            for (uint32 i=0; i < nbBoxes; i++) {
+                boxBodies[i] = world->createCollisionBody(Transform(Vector3(decimal(i) * 5, decimal(1.98), 0), Quaternion::identity()));
+                boxColliders[i] = boxBodies[i]->addCollider(boxShape, Transform::identity());
+            }
+
+            // ----- First update (full narrow-phase) ----- //
+
+            world->update(decimal(1.0) / decimal(60.0));
+
+            ContactPairData firstContacts[nbBoxes];
+            for (uint32 i=0; i < nbBoxes; i++) {
+                const CollisionData* collisionData = contactListener.collisionCallback.getCollisionData(boxColliders[i], groundCollider);
+                rp3d_test(collisionData != nullptr);
+                rp3d_test(collisionData->getTotalNbContactPoints() == 4);
+                firstContacts[i] = collisionData->contactPairs[0];
+            }
+
+            // ----- Collision queries between the two updates ----- //
+
+            for (uint32 i=0; i < nbBoxes; i++) {
+                WorldCollisionCallback queryCallback;
+                world->testCollision(boxBodies[i], queryCallback);
+                rp3d_test(queryCallback.areCollidersColliding(boxColliders[i], groundCollider));
+            }
+
+            // ----- Small motion: the previous contacts of every pair are re-projected ----- //
+
+            for (uint32 i=0; i < nbBoxes; i++) {
+                boxBodies[i]->setTransform(Transform(Vector3(decimal(i) * 5 + decimal(0.004), decimal(1.978), 0), Quaternion::identity()));
+            }
+
+            contactListener.collisionCallback.reset();
+            world->update(decimal(1.0) / decimal(60.0));
+
+            for (uint32 i=0; i < nbBoxes; i++) {
+                const CollisionData* collisionData = contactListener.collisionCallback.getCollisionData(boxColliders[i], groundCollider);
+                rp3d_test(collisionData != nullptr);
+                rp3d_test(collisionData->getTotalNbContactPoints() == 4);
+
+                for (uint32 c=0; c < firstContacts[i].contactPoints.size(); c++) {
+                    const CollisionPointData& point = firstContacts[i].contactPoints[c];
+                    rp3d_test(collisionData->hasContactPointSimilarTo(point.localPointBody1, point.localPointBody2, decimal(0.022), decimal(0.0005)));
+                }
+            }
+
+            world->setEventListener(nullptr);
+            mPhysicsCommon.destroyPhysicsWorld(world);
+            mPhysicsCommon.destroyBoxShape(groundShape);
+            mPhysicsCommon.destroyBoxShape(boxShape);
+        }
+
+        void testCollisionFiltering() {
+
+            /********************************************************************************
+            * Test collision filtering with 64 bits categories and collision groups
+            *********************************************************************************/
+
+            // Five overlapping spheres
+            SphereShape* sphereShape = mPhysicsCommon.createSphereShape(decimal(1.0));
+            CollisionBody* bodies[5];
+            Collider* colliders[5];
+            for (int i=0; i < 5; i++) {
+                bodies[i] = mWorld->createCollisionBody(Transform(Vector3(300 + decimal(0.4) * i, 0, 0), Quaternion::identity()));
+                colliders[i] = bodies[i]->addCollider(sphereShape, Transform::identity());
+            }
+
+            // Colliders 0 and 1 only collide with each other using categories above the first 16 bits
+            colliders[0]->setCollisionCategoryBits(uint64(1) << 40);
+            colliders[0]->setCollideWithMaskBits(uint64(1) << 41);
+            colliders[1]->setCollisionCategoryBits(uint64(1) << 41);
+            colliders[1]->setCollideWithMaskBits(uint64(1) << 40);
+
+            // Colliders 1 and 2 are in the same positive group and always collide (even if their masks do not match)
+            colliders[1]->setCollisionGroup(5);
+            colliders[2]->setCollisionGroup(5);
+
+            // Colliders 3 and 4 are in the same negative group and never collide
+            colliders[3]->setCollisionGroup(-2);
+            colliders[4]->setCollisionGroup(-2);
+
+            rp3d_test(colliders[0]->getCollisionCategoryBits() == (uint64(1) << 40));
+            rp3d_test(colliders[1]->getCollisionGroup() == 5);
+            rp3d_test(colliders[4]->getCollisionGroup() == -2);
+
+            rp3d_test(mWorld->testOverlap(bodies[0], bodies[1]));
+            rp3d_test(!mWorld->testOverlap(bodies[0], bodies[2]));
+            rp3d_test(mWorld->testOverlap(bodies[1], bodies[2]));
+            rp3d_test(mWorld->testOverlap(bodies[2], bodies[3]));
+            rp3d_test(!mWorld->testOverlap(bodies[3], bodies[4]));
+
+            for (int i=0; i < 5; i++) {
+                mWorld->destroyCollisionBody(bodies[i]);
+            }
+            mPhysicsCommon.destroySphereShape(sphereShape);
+        }
+
+        void testCompoundBody() {
+
+            /********************************************************************************
+            * Test a body whose colliders are grouped into a single broad-phase node
+            *********************************************************************************/
+
+            // Body with ten boxes along the x axis (five added before and five after it becomes a compound body)
+            BoxShape* boxShape = mPhysicsCommon.createBoxShape(Vector3(decimal(0.5), decimal(0.5), decimal(0.5)));
+            CollisionBody* compoundBody = mWorld->createCollisionBody(Transform(Vector3(400, 0, 0), Quaternion::identity()));
+            Collider* boxColliders[10];
+            for (int i=0; i < 5; i++) {
+                boxColliders[i] = compoundBody->addCollider(boxShape, Transform(Vector3(decimal(2 * i), 0, 0), Quaternion::identity()));
+            }
+            rp3d_test(!compoundBody->isCompound());
+            compoundBody->setIsCompound(true);
+            rp3d_test(compoundBody->isCompound());
+            for (int i=5; i < 10; i++) {
+                boxColliders[i] = compoundBody->addCollider(boxShape, Transform(Vector3(decimal(2 * i), 0, 0), Quaternion::identity()));
+            }
+
+            // Sphere on the top of the eighth box
+            SphereShape* sphereShape = mPhysicsCommon.createSphereShape(decimal(0.5));
+            CollisionBody* sphereBody = mWorld->createCollisionBody(Transform(Vector3(414, decimal(0.9), 0), Quaternion::identity()));
+            Collider* sphereCollider = sphereBody->addCollider(sphereShape, Transform::identity());
+
+            mWorld->update(decimal(1.0) / decimal(60.0));
+
+            rp3d_test(mWorld->testOverlap(compoundBody, sphereBody));
+            mCollisionCallback.reset();
+            mWorld->testCollision(sphereBody, mCollisionCallback);
+            rp3d_test(mCollisionCallback.areCollidersColliding(boxColliders[7], sphereCollider));
+            rp3d_test(!mCollisionCallback.areCollidersColliding(boxColliders[6], sphereCollider));
+            rp3d_test(!mCollisionCallback.areCollidersColliding(boxColliders[6], boxColliders[7]));
+
+            // Raycast through the world against the colliders of the compound body
+            class ClosestHitCallback : public RaycastCallback {
+
+                public:
+
+                    Collider* collider = nullptr;
+
+                    virtual decimal notifyRaycastHit(const RaycastInfo& info) override {
+                        collider = info.collider;
+                        return info.hitFraction;
+                    }
+            };
+            ClosestHitCallback raycastCallback;
+            mWorld->raycast(Ray(Vector3(406, 10, 0), Vector3(406, -10, 0)), &raycastCallback);
+            rp3d_test(raycastCallback.collider == boxColliders[3]);
+
+            // Move the sphere on the top of the first box
+            sphereBody->setTransform(Transform(Vector3(400, decimal(0.9), 0), Quaternion::identity()));
+            mCollisionCallback.reset();
+            mWorld->testCollision(sphereBody, mCollisionCallback);
+            rp3d_test(mCollisionCallback.areCollidersColliding(boxColliders[0], sphereCollider));
+            rp3d_test(!mCollisionCallback.areCollidersColliding(boxColliders[7], sphereCollider));
+
+            // Remove the first box
+            compoundBody->removeCollider(boxColliders[0]);
+            rp3d_test(!mWorld->testOverlap(compoundBody, sphereBody));
+
+            // Move the compound body such that its second box is below the sphere
+            compoundBody->setTransform(Transform(Vector3(398, 0, 0), Quaternion::identity()));
+            rp3d_test(mWorld->testOverlap(compoundBody, sphereBody));
+
+            // The colliders are put back into the world tree
+            compoundBody->setIsCompound(false);
+            rp3d_test(!compoundBody->isCompound());
+            rp3d_test(mWorld->testOverlap(compoundBody, sphereBody));
+
+            compoundBody->setIsCompound(true);
+            mWorld->destroyCollisionBody(compoundBody);
+            mWorld->destroyCollisionBody(sphereBody);
+            mPhysicsCommon.destroyBoxShape(boxShape);
+            mPhysicsCommon.destroySphereShape(sphereShape);
+        }
+
         void testBoxVsBoxCollision() {
 
             Transform initTransform1 = mBoxBody1->getTransform();
@@ -1866,6 +2586,40 @@ class TestCollisionWorld : public Test {
                                                          swappedBodiesCollisionData ? localBody1Point4 : localBody2Point4,
                                                          penetrationDepth4));
 
+            /********************************************************************************
+            * Test Box vs Box Edge collision                                                *
+            *********************************************************************************/
+
+            // Box 1 is rotated around the z axis and box 2 around the y axis so that
+            // an edge of box 1 (along z) touches an edge of box 2 (along y)
+            Transform transform3(Vector3(11, 20, 50), Quaternion::fromEulerAngles(0, 0, PI_RP3D / 4));
+            Transform transform4(Vector3(11 + 9 * std::sqrt(decimal(2.0)) - decimal(0.1), 20, 50), Quaternion::fromEulerAngles(0, PI_RP3D / 4, 0));
+
+            mBoxBody1->setTransform(transform3);
+            mBoxBody2->setTransform(transform4);
+
+            mCollisionCallback.reset();
+            mWorld->testCollision(mBoxBody1, mBoxBody2, mCollisionCallback);
+
+            rp3d_test(mCollisionCallback.areCollidersColliding(mBoxCollider1, mBoxCollider2));
+
+            // Get collision data
+            collisionData = mCollisionCallback.getCollisionData(mBoxCollider1, mBoxCollider2);
+            rp3d_test(collisionData != nullptr);
+            rp3d_test(collisionData->getNbContactPairs() == 1);
+            rp3d_test(collisionData->getTotalNbContactPoints() == 1);
+
+            // True if the bodies are swapped in the collision callback response
+            swappedBodiesCollisionData = collisionData->getBody1()->getEntity() != mBoxBody1->getEntity();
+
+            // Test contact points
+            Vector3 localBody1Point5(3, -3, -2 * std::sqrt(decimal(2.0)));
+            Vector3 localBody2Point5(-4, 0, -8);
+            decimal penetrationDepth5 = 0.1f;
+            rp3d_test(collisionData->hasContactPointSimilarTo(swappedBodiesCollisionData ? localBody2Point5 : localBody1Point5,
+                                                         swappedBodiesCollisionData ? localBody1Point5 : localBody2Point5,
+                                                         penetrationDepth5));
+
             // reset the init transforms
             mBoxBody1->setTransform(initTransform1);
             mBoxBody2->setTransform(initTransform2);
@@ -2191,6 +2945,106 @@ class TestCollisionWorld : public Test {
             mConvexMeshBody2->setTransform(initTransform2);
         }
 
+        void testConvexMeshVsConvexMeshCollisionEPA() {
+
+            Transform initTransform1 = mConvexMeshBody1->getTransform();
+            Transform initTransform2 = mConvexMeshBody2->getTransform();
+
+            ConvexPolyhedronVsConvexPolyhedronAlgorithm* algorithm = mWorld->getCollisionDispatch().getConvexPolyhedronVsConvexPolyhedronAlgorithm();
+            rp3d_test(algorithm->getMinNbVerticesForEPA() == 0);
+
+            /********************************************************************************
+            * Test Convex Mesh vs Convex Mesh collision with the EPA algorithm               *
+            *********************************************************************************/
+
+            Transform transform1(Vector3(11, 20, 50), Quaternion::identity());
+            Transform transform2(Vector3(4.5, 16, 40), Quaternion::identity());
+
+            mConvexMeshBody1->setTransform(transform1);
+            mConvexMeshBody2->setTransform(transform2);
+
+            // Use the EPA algorithm for the two convex meshes (8 vertices)
+            algorithm->setMinNbVerticesForEPA(8);
+
+            mCollisionCallback.reset();
+            mWorld->testCollision(mCollisionCallback);
+
+            rp3d_test(mCollisionCallback.areCollidersColliding(mConvexMeshCollider1, mConvexMeshCollider2));
+
+            // Get collision data
+            const CollisionData* collisionData = mCollisionCallback.getCollisionData(mConvexMeshCollider1, mConvexMeshCollider2);
+            rp3d_test(collisionData != nullptr);
+            rp3d_test(collisionData->getNbContactPairs() == 1);
+            rp3d_test(collisionData->getTotalNbContactPoints() == 4);
+
+            // True if the bodies are swapped in the collision callback response
+            bool swappedBodiesCollisionData = collisionData->getBody1()->getEntity() != mConvexMeshBody1->getEntity();
+
+            // Test contact points (the face contact is clipped as with the SAT algorithm)
+            Vector3 localBody1Point1(-3, -2, -2);
+            Vector3 localBody2Point1(4, 2, 8);
+            Vector3 localBody1Point2(-3, -2, -3);
+            Vector3 localBody2Point2(4, 2, 7);
+            Vector3 localBody1Point3(-3, -3, -2);
+            Vector3 localBody2Point3(4, 1, 8);
+            Vector3 localBody1Point4(-3, -3, -3);
+            Vector3 localBody2Point4(4, 1, 7);
+            decimal penetrationDepth = 0.5f;
+            rp3d_test(collisionData->hasContactPointSimilarTo(swappedBodiesCollisionData ? localBody2Point1 : localBody1Point1,
+                                                         swappedBodiesCollisionData ? localBody1Point1 : localBody2Point1,
+                                                         penetrationDepth));
+            rp3d_test(collisionData->hasContactPointSimilarTo(swappedBodiesCollisionData ? localBody2Point2 : localBody1Point2,
+                                                         swappedBodiesCollisionData ? localBody1Point2 : localBody2Point2,
+                                                         penetrationDepth));
+            rp3d_test(collisionData->hasContactPointSimilarTo(swappedBodiesCollisionData ? localBody2Point3 : localBody1Point3,
+                                                         swappedBodiesCollisionData ? localBody1Point3 : localBody2Point3,
+                                                         penetrationDepth));
+            rp3d_test(collisionData->hasContactPointSimilarTo(swappedBodiesCollisionData ? localBody2Point4 : localBody1Point4,
+                                                         swappedBodiesCollisionData ? localBody1Point4 : localBody2Point4,
+                                                         penetrationDepth));
+
+            // ----- Test a rotated face contact against the SAT algorithm ----- //
+
+            mConvexMeshBody2->setTransform(Transform(Vector3(6, 25, 46), Quaternion::fromEulerAngles(0.3, 0.5, 0.2)));
+
+            algorithm->setMinNbVerticesForEPA(0);
+
+            mCollisionCallback.reset();
+            mWorld->testCollision(mCollisionCallback);
+
+            rp3d_test(mCollisionCallback.areCollidersColliding(mConvexMeshCollider1, mConvexMeshCollider2));
+            const CollisionData satCollisionData = *(mCollisionCallback.getCollisionData(mConvexMeshCollider1, mConvexMeshCollider2));
+
+            algorithm->setMinNbVerticesForEPA(8);
+
+            mCollisionCallback.reset();
+            mWorld->testCollision(mCollisionCallback);
+
+            rp3d_test(mCollisionCallback.areCollidersColliding(mConvexMeshCollider1, mConvexMeshCollider2));
+            collisionData = mCollisionCallback.getCollisionData(mConvexMeshCollider1, mConvexMeshCollider2);
+            rp3d_test(collisionData != nullptr);
+            rp3d_test(collisionData->getTotalNbContactPoints() == satCollisionData.getTotalNbContactPoints());
+
+            for (const CollisionPointData& satContactPoint : satCollisionData.contactPairs[0].contactPoints) {
+                rp3d_test(collisionData->hasContactPointSimilarTo(satContactPoint.localPointBody1, satContactPoint.localPointBody2,
+                                                             satContactPoint.penetrationDepth, decimal(0.01)));
+            }
+
+            // ----- Test separated convex meshes ----- //
+
+            mConvexMeshBody2->setTransform(Transform(Vector3(30, 20, 50), Quaternion::identity()));
+
+            mCollisionCallback.reset();
+            mWorld->testCollision(mCollisionCallback);
+
+            rp3d_test(!mCollisionCallback.areCollidersColliding(mConvexMeshCollider1, mConvexMeshCollider2));
+
+            // reset the algorithm and the init transforms
+            algorithm->setMinNbVerticesForEPA(0);
+            mConvexMeshBody1->setTransform(initTransform1);
+            mConvexMeshBody2->setTransform(initTransform2);
+        }
+
         void testBoxVsCapsuleCollision() {
 
             Transform initTransform1 = mBoxBody1->getTransform();
@@ -2954,6 +3808,230 @@ class TestCollisionWorld : public Test {
             mCapsuleBody1->setTransform(initTransform1);
             mConcaveMeshBody->setTransform(initTransform2);
         }
+
+        // Return true if all the contact points of the collision data are on a given plane (in local-space
+        // of a given body) and have a given penetration depth
+        bool areContactPointsOnPlane(const CollisionData* collisionData, const CollisionBody* body, const Vector3& planeNormal,
+                                     decimal planeDistance, decimal penetrationDepth, decimal epsilon = decimal(0.01)) const {
+
+            const bool isBody1 = collisionData->getBody1()->getEntity() == body->getEntity();
+            for (const ContactPairData& contactPair : collisionData->contactPairs) {
+                for (const CollisionPointData& contactPoint : contactPair.contactPoints) {
+
+                    const Vector3& localPoint = isBody1 ? contactPoint.localPointBody1 : contactPoint.localPointBody2;
+                    if (!approxEqual(localPoint.dot(planeNormal), planeDistance, epsilon) ||
+                        !approxEqual(contactPoint.penetrationDepth, penetrationDepth, epsilon)) {
+                        return false;
+                    }
+                }
+            }
+
+            return true;
+        }
+
+        void testCylinderVsBoxCollision() {
+
+            Transform initTransform = mBoxBody1->getTransform();
+
+            CylinderShape* cylinderShape = mPhysicsCommon.createCylinderShape(1, 2);
+            CollisionBody* cylinderBody = mWorld->createCollisionBody(Transform::identity());
+            Collider* cylinderCollider = cylinderBody->addCollider(cylinderShape, Transform::identity());
+
+            mBoxBody1->setTransform(Transform(Vector3(10, 20, 50), Quaternion::identity()));
+
+            // ----- Cylinder standing on its bottom cap with a deep penetration (EPA) ----- //
+
+            cylinderBody->setTransform(Transform(Vector3(10.5, 23.9, 50.5), Quaternion::identity()));
+
+            mCollisionCallback.reset();
+            mWorld->testCollision(cylinderBody, mBoxBody1, mCollisionCallback);
+
+            rp3d_test(mCollisionCallback.areCollidersColliding(cylinderCollider, mBoxCollider1));
+            const CollisionData* collisionData = mCollisionCallback.getCollisionData(cylinderCollider, mBoxCollider1);
+            rp3d_test(collisionData != nullptr);
+            rp3d_test(collisionData->getNbContactPairs() == 1);
+
+            // The contact is not reduced to a single point
+            rp3d_test(collisionData->getTotalNbContactPoints() >= 3);
+            rp3d_test(areContactPointsOnPlane(collisionData, cylinderBody, Vector3(0, 1, 0), -1, decimal(0.1)));
+            rp3d_test(areContactPointsOnPlane(collisionData, mBoxBody1, Vector3(0, 1, 0), 3, decimal(0.1)));
+
+            // ----- Cylinder standing on its bottom cap with a shallow penetration (GJK) ----- //
+
+            cylinderBody->setTransform(Transform(Vector3(10.5, 23.98, 50.5), Quaternion::identity()));
+
+            mCollisionCallback.reset();
+            mWorld->testCollision(cylinderBody, mBoxBody1, mCollisionCallback);
+
+            rp3d_test(mCollisionCallback.areCollidersColliding(cylinderCollider, mBoxCollider1));
+            collisionData = mCollisionCallback.getCollisionData(cylinderCollider, mBoxCollider1);
+            rp3d_test(collisionData != nullptr);
+            rp3d_test(collisionData->getTotalNbContactPoints() >= 3);
+            rp3d_test(areContactPointsOnPlane(collisionData, cylinderBody, Vector3(0, 1, 0), -1, decimal(0.02)));
+
+            // ----- Cylinder lying on its side (line contact) ----- //
+
+            cylinderBody->setTransform(Transform(Vector3(10, 23.95, 50), Quaternion::fromEulerAngles(0, 0, PI_RP3D / 2)));
+
+            mCollisionCallback.reset();
+            mWorld->testCollision(cylinderBody, mBoxBody1, mCollisionCallback);
+
+            rp3d_test(mCollisionCallback.areCollidersColliding(cylinderCollider, mBoxCollider1));
+            collisionData = mCollisionCallback.getCollisionData(cylinderCollider, mBoxCollider1);
+            rp3d_test(collisionData != nullptr);
+            rp3d_test(collisionData->getTotalNbContactPoints() == 2);
+            rp3d_test(areContactPointsOnPlane(collisionData, mBoxBody1, Vector3(0, 1, 0), 3, decimal(0.05)));
+
+            // ----- Separated shapes ----- //
+
+            cylinderBody->setTransform(Transform(Vector3(10.5, 24.1, 50.5), Quaternion::identity()));
+
+            mCollisionCallback.reset();
+            mWorld->testCollision(cylinderBody, mBoxBody1, mCollisionCallback);
+            rp3d_test(!mCollisionCallback.areCollidersColliding(cylinderCollider, mBoxCollider1));
+
+            mOverlapCallback.reset();
+            mWorld->testOverlap(cylinderBody, mOverlapCallback);
+            rp3d_test(!mOverlapCallback.hasOverlapWithBody(mBoxBody1));
+
+            cylinderBody->setTransform(Transform(Vector3(10.5, 23.9, 50.5), Quaternion::identity()));
+            mOverlapCallback.reset();
+            mWorld->testOverlap(cylinderBody, mOverlapCallback);
+            rp3d_test(mOverlapCallback.hasOverlapWithBody(mBoxBody1));
+
+            mWorld->destroyCollisionBody(cylinderBody);
+            mPhysicsCommon.destroyCylinderShape(cylinderShape);
+            mBoxBody1->setTransform(initTransform);
+        }
+
+        void testConeVsBoxCollision() {
+
+            Transform initTransform = mBoxBody1->getTransform();
+
+            // The origin of the cone is its center of mass (base at y=-0.5 and apex at y=1.5)
+            ConeShape* coneShape = mPhysicsCommon.createConeShape(1, 2);
+            CollisionBody* coneBody = mWorld->createCollisionBody(Transform::identity());
+            Collider* coneCollider = coneBody->addCollider(coneShape, Transform::identity());
+
+            mBoxBody1->setTransform(Transform(Vector3(10, 20, 50), Quaternion::identity()));
+
+            // ----- Cone standing on its base ----- //
+
+            coneBody->setTransform(Transform(Vector3(10, 23.4, 50), Quaternion::identity()));
+
+            mCollisionCallback.reset();
+            mWorld->testCollision(coneBody, mBoxBody1, mCollisionCallback);
+
+            rp3d_test(mCollisionCallback.areCollidersColliding(coneCollider, mBoxCollider1));
+            const CollisionData* collisionData = mCollisionCallback.getCollisionData(coneCollider, mBoxCollider1);
+            rp3d_test(collisionData != nullptr);
+            rp3d_test(collisionData->getTotalNbContactPoints() >= 3);
+            rp3d_test(areContactPointsOnPlane(collisionData, coneBody, Vector3(0, 1, 0), decimal(-0.5), decimal(0.1)));
+
+            // ----- Cone standing on its apex (single contact point) ----- //
+
+            // The apex is rounded by the margin of the cone which makes the cone slightly shorter
+            const decimal apexPenetrationDepth = decimal(0.1) - coneShape->getMargin() * (std::sqrt(decimal(5.0)) - decimal(1.0));
+
+            coneBody->setTransform(Transform(Vector3(10, 24.4, 50), Quaternion::fromEulerAngles(PI_RP3D, 0, 0)));
+
+            mCollisionCallback.reset();
+            mWorld->testCollision(coneBody, mBoxBody1, mCollisionCallback);
+
+            rp3d_test(mCollisionCallback.areCollidersColliding(coneCollider, mBoxCollider1));
+            collisionData = mCollisionCallback.getCollisionData(coneCollider, mBoxCollider1);
+            rp3d_test(collisionData != nullptr);
+            rp3d_test(collisionData->getTotalNbContactPoints() == 1);
+            rp3d_test(areContactPointsOnPlane(collisionData, mBoxBody1, Vector3(0, 1, 0), 3, apexPenetrationDepth));
+
+            // ----- Separated shapes ----- //
+
+            coneBody->setTransform(Transform(Vector3(10, 23.6, 50), Quaternion::identity()));
+
+            mCollisionCallback.reset();
+            mWorld->testCollision(coneBody, mBoxBody1, mCollisionCallback);
+            rp3d_test(!mCollisionCallback.areCollidersColliding(coneCollider, mBoxCollider1));
+
+            mWorld->destroyCollisionBody(coneBody);
+            mPhysicsCommon.destroyConeShape(coneShape);
+            mBoxBody1->setTransform(initTransform);
+        }
+
+        void testCylinderAndConeRestingOnBox() {
+
+            // Static ground box with its top face at y=1
+            BoxShape* groundShape = mPhysicsCommon.createBoxShape(Vector3(10, 1, 10));
+            CollisionBody* groundBody = mWorld->createCollisionBody(Transform(Vector3(0, -50, 0), Quaternion::identity()));
+            Collider* groundCollider = groundBody->addCollider(groundShape, Transform::identity());
+
+            // The cylinder and the cone have a margin of 4 cm. The origin of the cone is its center of mass
+            // (base at y=-0.25 and apex at y=0.75)
+            CylinderShape* cylinderShape = mPhysicsCommon.createCylinderShape(decimal(0.5), 1);
+            ConeShape* coneShape = mPhysicsCommon.createConeShape(decimal(0.5), 1);
+            CollisionBody* body = mWorld->createCollisionBody(Transform::identity());
+
+            ConvexShape* shapes[2] = {cylinderShape, coneShape};
+            const decimal baseHeights[2] = {decimal(-0.5), decimal(-0.25)};
+
+            for (uint32 s=0; s < 2; s++) {
+
+                Collider* collider = body->addCollider(shapes[s], Transform::identity());
+
+                // ----- Resting on the flat face with a penetration depth inside and beyond the margins ----- //
+
+                for (uint32 i=1; i <= 20; i++) {
+
+                    const decimal penetrationDepth = decimal(i) * decimal(0.0025);
+                    body->setTransform(Transform(Vector3(decimal(0.37), -49 - baseHeights[s] - penetrationDepth, decimal(0.07)), Quaternion::identity()));
+
+                    mCollisionCallback.reset();
+                    mWorld->testCollision(body, groundBody, mCollisionCallback);
+
+                    rp3d_test(mCollisionCallback.areCollidersColliding(collider, groundCollider));
+                    const CollisionData* collisionData = mCollisionCallback.getCollisionData(collider, groundCollider);
+                    rp3d_test(collisionData != nullptr);
+                    if (collisionData == nullptr) continue;
+
+                    rp3d_test(collisionData->getTotalNbContactPoints() >= 3);
+                    rp3d_test(areContactPointsOnPlane(collisionData, body, Vector3(0, 1, 0), baseHeights[s], penetrationDepth, decimal(0.005)));
+                    rp3d_test(areContactPointsOnPlane(collisionData, groundBody, Vector3(0, 1, 0), 1, penetrationDepth, decimal(0.005)));
+                }
+
+                body->removeCollider(collider);
+            }
+
+            mWorld->destroyCollisionBody(body);
+            mWorld->destroyCollisionBody(groundBody);
+            mPhysicsCommon.destroyCylinderShape(cylinderShape);
+            mPhysicsCommon.destroyConeShape(coneShape);
+            mPhysicsCommon.destroyBoxShape(groundShape);
+        }
+
+        void testCylinderVsConcaveMeshCollision() {
+
+            Transform initTransform = mConcaveMeshBody->getTransform();
+
+            CylinderShape* cylinderShape = mPhysicsCommon.createCylinderShape(decimal(0.6), 2);
+            CollisionBody* cylinderBody = mWorld->createCollisionBody(Transform(Vector3(10.2, 20.95, 50.3), Quaternion::identity()));
+            Collider* cylinderCollider = cylinderBody->addCollider(cylinderShape, Transform::identity());
+
+            // The concave mesh is a flat grid of triangles at y=0
+            mConcaveMeshBody->setTransform(Transform(Vector3(10, 20, 50), Quaternion::identity()));
+
+            mCollisionCallback.reset();
+            mWorld->testCollision(cylinderBody, mConcaveMeshBody, mCollisionCallback);
+
+            rp3d_test(mCollisionCallback.areCollidersColliding(cylinderCollider, mConcaveMeshCollider));
+            const CollisionData* collisionData = mCollisionCallback.getCollisionData(cylinderCollider, mConcaveMeshCollider);
+            rp3d_test(collisionData != nullptr);
+            rp3d_test(collisionData->getTotalNbContactPoints() >= 3);
+            rp3d_test(areContactPointsOnPlane(collisionData, cylinderBody, Vector3(0, 1, 0), -1, decimal(0.05)));
+            rp3d_test(areContactPointsOnPlane(collisionData, mConcaveMeshBody, Vector3(0, 1, 0), 0, decimal(0.05)));
+
+            mWorld->destroyCollisionBody(cylinderBody);
+            mPhysicsCommon.destroyCylinderShape(cylinderShape);
+            mConcaveMeshBody->setTransform(initTransform);
+        }
  };
 
 }
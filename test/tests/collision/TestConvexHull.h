@@ -0,0 +1,236 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2022 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef TEST_CONVEX_HULL_H
+#define TEST_CONVEX_HULL_H
+
+// Libraries
+#include <reactphysics3d/reactphysics3d.h>
+#include <vector>
+#include <cmath>
+
+/// Reactphysics3D namespace
+namespace reactphysics3d {
+
+
+// Class TestConvexHull
+/**
+ * Unit test for the creation of a polyhedron mesh from the convex hull of a cloud of points
+ */
+class TestConvexHull : public Test {
+
+    private :
+
+        // ---------- Atributes ---------- //
+
+        PhysicsCommon mPhysicsCommon;
+
+    public :
+
+        // ---------- Methods ---------- //
+
+        /// Constructor
+        TestConvexHull(const std::string& name) : Test(name) {
+
+        }
+
+        /// Destructor
+        virtual ~TestConvexHull() {
+
+        }
+
+        /// Run the tests
+        void run() {
+            testCubeHull();
+            testSphereHull();
+            testNearDuplicatePoints();
+            testDegeneratePoints();
+        }
+
+        /// Return true if all the vertices of a mesh are behind (or on) the planes of all its faces
+        bool isConvex(const PolyhedronMesh* mesh) const {
+
+            for (uint32 f=0; f < mesh->getNbFaces(); f++) {
+
+                const HalfEdgeStructure::Face& face = mesh->getHalfEdgeStructure().getFace(f);
+                const Vector3 normal = mesh->getFaceNormal(f);
+                const Vector3 faceVertex = mesh->getVertex(face.faceVertices[0]);
+
+                for (uint32 v=0; v < mesh->getNbVertices(); v++) {
+                    if (normal.dot(mesh->getVertex(v) - faceVertex) > decimal(0.0001)) return false;
+                }
+            }
+
+            return true;
+        }
+
+        void testCubeHull() {
+
+            // Points on a regular grid inside and on the boundary of a cube of size 2
+            std::vector<Vector3> points;
+            for (int i=0; i <= 4; i++) {
+                for (int j=0; j <= 4; j++) {
+                    for (int k=0; k <= 4; k++) {
+                        points.push_back(Vector3(decimal(-1.0) + decimal(0.5) * i, decimal(-1.0) + decimal(0.5) * j,
+                                                 decimal(-1.0) + decimal(0.5) * k));
+                    }
+                }
+            }
+
+            PolyhedronMesh* mesh = mPhysicsCommon.createConvexHull(points.data(), static_cast<uint32>(points.size()));
+
+            // The coplanar triangles of the hull must have been merged into the six faces of the cube
+            rp3d_test(mesh != nullptr);
+            rp3d_test(mesh->getNbVertices() == 8);
+            rp3d_test(mesh->getNbFaces() == 6);
+            rp3d_test(approxEqual(mesh->getVolume(), decimal(8.0), decimal(0.0001)));
+            rp3d_test(mesh->getCentroid().length() < decimal(0.0001));
+            rp3d_test(isConvex(mesh));
+
+            for (uint32 f=0; f < mesh->getNbFaces(); f++) {
+                rp3d_test(mesh->getHalfEdgeStructure().getFace(f).faceVertices.size() == 4);
+            }
+
+            // The hull can be used to create a convex mesh shape
+            ConvexMeshShape* shape = mPhysicsCommon.createConvexMeshShape(mesh);
+            rp3d_test(shape->getNbVertices() == 8);
+            rp3d_test(shape->getNbFaces() == 6);
+            Vector3 min, max;
+            shape->getLocalBounds(min, max);
+            rp3d_test(approxEqual(min, Vector3(-1, -1, -1), decimal(0.0001)));
+            rp3d_test(approxEqual(max, Vector3(1, 1, 1), decimal(0.0001)));
+
+            mPhysicsCommon.destroyConvexMeshShape(shape);
+            mPhysicsCommon.destroyPolyhedronMesh(mesh);
+        }
+
+        void testSphereHull() {
+
+            // Points distributed on a sphere (Fibonacci spiral) and its center
+            const decimal radius = decimal(2.0);
+            const int nbPoints = 400;
+            std::vector<Vector3> points;
+            points.push_back(Vector3(0, 0, 0));
+            for (int i=0; i < nbPoints; i++) {
+                const decimal y = decimal(1.0) - decimal(2.0) * (decimal(i) + decimal(0.5)) / decimal(nbPoints);
+                const decimal r = std::sqrt(decimal(1.0) - y * y);
+                const decimal angle = decimal(2.39996323) * decimal(i);
+                points.push_back(radius * Vector3(r * std::cos(angle), y, r * std::sin(angle)));
+            }
+
+            // Full hull
+            PolyhedronMesh* fullMesh = mPhysicsCommon.createConvexHull(points.data(), static_cast<uint32>(points.size()));
+            rp3d_test(fullMesh != nullptr);
+            rp3d_test(fullMesh->getNbVertices() == nbPoints);
+            rp3d_test(isConvex(fullMesh));
+
+            const decimal sphereVolume = decimal(4.0) / decimal(3.0) * PI_RP3D * radius * radius * radius;
+            const decimal fullVolume = fullMesh->getVolume();
+            rp3d_test(fullVolume < sphereVolume);
+            rp3d_test(fullVolume > decimal(0.97) * sphereVolume);
+
+            // Simplified hull with a vertex budget
+            const uint32 maxNbVertices = 32;
+            PolyhedronMesh* simplifiedMesh = mPhysicsCommon.createConvexHull(points.data(), static_cast<uint32>(points.size()), maxNbVertices);
+            rp3d_test(simplifiedMesh != nullptr);
+            rp3d_test(simplifiedMesh->getNbVertices() <= maxNbVertices);
+            rp3d_test(simplifiedMesh->getNbFaces() <= 2 * maxNbVertices - 4);
+            rp3d_test(isConvex(simplifiedMesh));
+
+            // The simplified hull is inside the full hull but still a good approximation of it
+            const decimal simplifiedVolume = simplifiedMesh->getVolume();
+            rp3d_test(simplifiedVolume <= fullVolume);
+            rp3d_test(simplifiedVolume > decimal(0.75) * fullVolume);
+
+            // All the vertices of the simplified hull are input points on the sphere
+            for (uint32 v=0; v < simplifiedMesh->getNbVertices(); v++) {
+                rp3d_test(approxEqual(simplifiedMesh->getVertex(v).length(), radius, decimal(0.0001)));
+            }
+
+            mPhysicsCommon.destroyPolyhedronMesh(simplifiedMesh);
+            mPhysicsCommon.destroyPolyhedronMesh(fullMesh);
+        }
+
+        void testNearDuplicatePoints() {
+
+            // Clusters of points jittered by at most 1e-5 around the eight corners of a cube of size 2
+            std::vector<Vector3> points;
+            uint32 seed = 12345;
+            for (int corner=0; corner < 8; corner++) {
+                const Vector3 cornerPoint((corner & 1) ? 1 : -1, (corner & 2) ? 1 : -1, (corner & 4) ? 1 : -1);
+                for (int i=0; i < 10; i++) {
+                    Vector3 jitter;
+                    for (int axis=0; axis < 3; axis++) {
+                        seed = seed * 1664525u + 1013904223u;
+                        jitter[axis] = decimal(2e-5) * (decimal(seed >> 8) / decimal(1 << 24) - decimal(0.5));
+                    }
+                    points.push_back(cornerPoint + jitter);
+                }
+            }
+
+            PolyhedronMesh* mesh = mPhysicsCommon.createConvexHull(points.data(), static_cast<uint32>(points.size()));
+
+            // The near-duplicate points are welded into a single vertex for each corner
+            rp3d_test(mesh != nullptr);
+            if (mesh == nullptr) return;
+            rp3d_test(mesh->getNbVertices() == 8);
+            rp3d_test(mesh->getNbFaces() == 6);
+            rp3d_test(approxEqual(mesh->getVolume(), decimal(8.0), decimal(0.001)));
+            rp3d_test(isConvex(mesh));
+
+            // All the input points are inside the hull (up to the welding tolerance)
+            bool areAllPointsInside = true;
+            for (uint32 f=0; f < mesh->getNbFaces(); f++) {
+
+                const HalfEdgeStructure::Face& face = mesh->getHalfEdgeStructure().getFace(f);
+                const Vector3 normal = mesh->getFaceNormal(f);
+                const Vector3 faceVertex = mesh->getVertex(face.faceVertices[0]);
+
+                for (uint32 i=0; i < points.size(); i++) {
+                    areAllPointsInside &= normal.dot(points[i] - faceVertex) <= decimal(0.0001);
+                }
+            }
+            rp3d_test(areAllPointsInside);
+
+            mPhysicsCommon.destroyPolyhedronMesh(mesh);
+        }
+
+        void testDegeneratePoints() {
+
+            // Coplanar points
+            std::vector<Vector3> points;
+            for (int i=0; i < 10; i++) {
+                points.push_back(Vector3(decimal(i), decimal(i * i), decimal(0.0)));
+            }
+            rp3d_test(mPhysicsCommon.createConvexHull(points.data(), static_cast<uint32>(points.size())) == nullptr);
+
+            // Not enough points
+            rp3d_test(mPhysicsCommon.createConvexHull(points.data(), 3) == nullptr);
+        }
+ };
+
+}
+
+#endif
@@ -34,6 +34,8 @@
 #include <reactphysics3d/collision/shapes/BoxShape.h>
 #include <reactphysics3d/collision/shapes/SphereShape.h>
 #include <reactphysics3d/collision/shapes/CapsuleShape.h>
+#include <reactphysics3d/collision/shapes/CylinderShape.h>
+#include <reactphysics3d/collision/shapes/ConeShape.h>
 #include <reactphysics3d/collision/shapes/ConvexMeshShape.h>
 #include <reactphysics3d/collision/shapes/TriangleShape.h>
 #include <reactphysics3d/collision/shapes/ConcaveMeshShape.h>
@@ -42,7 +44,9 @@
 #include <reactphysics3d/collision/TriangleVertexArray.h>
 #include <reactphysics3d/collision/RaycastInfo.h>
 #include <reactphysics3d/collision/PolygonVertexArray.h>
+#include <reactphysics3d/memory/DefaultAllocator.h>
 #include <vector>
+#include <cmath>
 
 /// Reactphysics3D namespace
 namespace reactphysics3d {
@@ -323,10 +327,19 @@ class TestRaycast : public Test {
             testBox();
             testSphere();
             testCapsule();
+            testCylinder();
+            testCone();
             testConvexMesh();
             testCompound();
             testConcaveMesh();
             testHeightField();
+            testCookedConcaveMesh();
+            testCompressedConcaveMesh();
+            testCompressedConcaveMeshMemory();
+            testScaledSharedConcaveMesh();
+            testHeightFieldPyramid();
+            testHeightFieldUint16();
+            testConcaveMeshHitTriangle();
         }
 
         /// Test the Collider::raycast(), CollisionBody::raycast() and
@@ -991,6 +1004,131 @@ class TestRaycast : public Test {
             rp3d_test(mCallback.isHit);
         }
 
+        void testCylinder() {
+
+            CylinderShape* cylinderShape = mPhysicsCommon.createCylinderShape(2, 6);
+            CollisionBody* body = mWorld->createCollisionBody(mBodyTransform);
+            Collider* collider = body->addCollider(cylinderShape, mShapeTransform);
+
+            // Ray hitting the side of the cylinder
+            Ray raySide(mLocalShapeToWorld * Vector3(5, 1, 0), mLocalShapeToWorld * Vector3(-5, 1, 0));
+            Vector3 hitPoint = mLocalShapeToWorld * Vector3(2, 1, 0);
+            Vector3 hitNormal = mLocalShapeToWorld.getOrientation() * Vector3(1, 0, 0);
+            RaycastInfo raycastInfo;
+            rp3d_test(collider->raycast(raySide, raycastInfo));
+            rp3d_test(raycastInfo.body == body);
+            rp3d_test(raycastInfo.collider == collider);
+            rp3d_test(approxEqual(raycastInfo.hitFraction, decimal(0.3), epsilon));
+            rp3d_test(approxEqual(raycastInfo.worldPoint.x, hitPoint.x, epsilon));
+            rp3d_test(approxEqual(raycastInfo.worldPoint.y, hitPoint.y, epsilon));
+            rp3d_test(approxEqual(raycastInfo.worldPoint.z, hitPoint.z, epsilon));
+            rp3d_test(approxEqual(raycastInfo.worldNormal.x, hitNormal.x, epsilon));
+            rp3d_test(approxEqual(raycastInfo.worldNormal.y, hitNormal.y, epsilon));
+            rp3d_test(approxEqual(raycastInfo.worldNormal.z, hitNormal.z, epsilon));
+
+            // Ray hitting the top cap
+            Ray rayTop(mLocalShapeToWorld * Vector3(0.5, 6, 0.5), mLocalShapeToWorld * Vector3(0.5, -4, 0.5));
+            hitPoint = mLocalShapeToWorld * Vector3(0.5, 3, 0.5);
+            hitNormal = mLocalShapeToWorld.getOrientation() * Vector3(0, 1, 0);
+            rp3d_test(body->raycast(rayTop, raycastInfo));
+            rp3d_test(approxEqual(raycastInfo.hitFraction, decimal(0.3), epsilon));
+            rp3d_test(approxEqual(raycastInfo.worldPoint.x, hitPoint.x, epsilon));
+            rp3d_test(approxEqual(raycastInfo.worldPoint.y, hitPoint.y, epsilon));
+            rp3d_test(approxEqual(raycastInfo.worldPoint.z, hitPoint.z, epsilon));
+            rp3d_test(approxEqual(raycastInfo.worldNormal.x, hitNormal.x, epsilon));
+            rp3d_test(approxEqual(raycastInfo.worldNormal.y, hitNormal.y, epsilon));
+            rp3d_test(approxEqual(raycastInfo.worldNormal.z, hitNormal.z, epsilon));
+
+            // Ray hitting the bottom cap
+            Ray rayBottom(mLocalShapeToWorld * Vector3(1, -5, 0), mLocalShapeToWorld * Vector3(1, 5, 0));
+            hitPoint = mLocalShapeToWorld * Vector3(1, -3, 0);
+            rp3d_test(collider->raycast(rayBottom, raycastInfo));
+            rp3d_test(approxEqual(raycastInfo.hitFraction, decimal(0.2), epsilon));
+            rp3d_test(approxEqual(raycastInfo.worldPoint.x, hitPoint.x, epsilon));
+            rp3d_test(approxEqual(raycastInfo.worldPoint.y, hitPoint.y, epsilon));
+            rp3d_test(approxEqual(raycastInfo.worldPoint.z, hitPoint.z, epsilon));
+
+            // PhysicsWorld::raycast()
+            mCallback.shapeToTest = collider;
+            mCallback.reset();
+            mWorld->raycast(raySide, &mCallback);
+            rp3d_test(mCallback.isHit);
+            rp3d_test(mCallback.raycastInfo.collider == collider);
+            rp3d_test(approxEqual(mCallback.raycastInfo.hitFraction, decimal(0.3), epsilon));
+
+            // Rays that miss the cylinder
+            rp3d_test(!collider->raycast(Ray(mLocalShapeToWorld * Vector3(2.5, 1, 5), mLocalShapeToWorld * Vector3(2.5, 1, -5)), raycastInfo));
+            rp3d_test(!collider->raycast(Ray(mLocalShapeToWorld * Vector3(0, 4, 5), mLocalShapeToWorld * Vector3(0, 4, -5)), raycastInfo));
+            rp3d_test(!collider->raycast(Ray(mLocalShapeToWorld * Vector3(5, 1, 0), mLocalShapeToWorld * Vector3(3, 1, 0)), raycastInfo));
+            rp3d_test(!collider->raycast(Ray(mLocalShapeToWorld * Vector3(0, 0, 0), mLocalShapeToWorld * Vector3(5, 0, 0)), raycastInfo));
+
+            mWorld->destroyCollisionBody(body);
+            mPhysicsCommon.destroyCylinderShape(cylinderShape);
+        }
+
+        void testCone() {
+
+            // The origin of the cone is its center of mass (base at y=-1 and apex at y=3)
+            ConeShape* coneShape = mPhysicsCommon.createConeShape(2, 4);
+            CollisionBody* body = mWorld->createCollisionBody(mBodyTransform);
+            Collider* collider = body->addCollider(coneShape, mShapeTransform);
+
+            // Ray hitting the side of the cone (radius of 1 at y=1)
+            Ray raySide(mLocalShapeToWorld * Vector3(5, 1, 0), mLocalShapeToWorld * Vector3(-5, 1, 0));
+            Vector3 hitPoint = mLocalShapeToWorld * Vector3(1, 1, 0);
+            Vector3 hitNormal = mLocalShapeToWorld.getOrientation() * Vector3(1, decimal(0.5), 0).getUnit();
+            RaycastInfo raycastInfo;
+            rp3d_test(collider->raycast(raySide, raycastInfo));
+            rp3d_test(raycastInfo.body == body);
+            rp3d_test(raycastInfo.collider == collider);
+            rp3d_test(approxEqual(raycastInfo.hitFraction, decimal(0.4), epsilon));
+            rp3d_test(approxEqual(raycastInfo.worldPoint.x, hitPoint.x, epsilon));
+            rp3d_test(approxEqual(raycastInfo.worldPoint.y, hitPoint.y, epsilon));
+            rp3d_test(approxEqual(raycastInfo.worldPoint.z, hitPoint.z, epsilon));
+            rp3d_test(approxEqual(raycastInfo.worldNormal.x, hitNormal.x, epsilon));
+            rp3d_test(approxEqual(raycastInfo.worldNormal.y, hitNormal.y, epsilon));
+            rp3d_test(approxEqual(raycastInfo.worldNormal.z, hitNormal.z, epsilon));
+
+            // Ray hitting the side of the cone near the apex
+            Ray rayTop(mLocalShapeToWorld * Vector3(0.2, 5, 0), mLocalShapeToWorld * Vector3(0.2, -5, 0));
+            hitPoint = mLocalShapeToWorld * Vector3(0.2, 2.6, 0);
+            rp3d_test(body->raycast(rayTop, raycastInfo));
+            rp3d_test(approxEqual(raycastInfo.hitFraction, decimal(0.24), epsilon));
+            rp3d_test(approxEqual(raycastInfo.worldPoint.x, hitPoint.x, epsilon));
+            rp3d_test(approxEqual(raycastInfo.worldPoint.y, hitPoint.y, epsilon));
+            rp3d_test(approxEqual(raycastInfo.worldPoint.z, hitPoint.z, epsilon));
+
+            // Ray hitting the base
+            Ray rayBottom(mLocalShapeToWorld * Vector3(0.5, -3, 0), mLocalShapeToWorld * Vector3(0.5, 2, 0));
+            hitPoint = mLocalShapeToWorld * Vector3(0.5, -1, 0);
+            hitNormal = mLocalShapeToWorld.getOrientation() * Vector3(0, -1, 0);
+            rp3d_test(collider->raycast(rayBottom, raycastInfo));
+            rp3d_test(approxEqual(raycastInfo.hitFraction, decimal(0.4), epsilon));
+            rp3d_test(approxEqual(raycastInfo.worldPoint.x, hitPoint.x, epsilon));
+            rp3d_test(approxEqual(raycastInfo.worldPoint.y, hitPoint.y, epsilon));
+            rp3d_test(approxEqual(raycastInfo.worldPoint.z, hitPoint.z, epsilon));
+            rp3d_test(approxEqual(raycastInfo.worldNormal.x, hitNormal.x, epsilon));
+            rp3d_test(approxEqual(raycastInfo.worldNormal.y, hitNormal.y, epsilon));
+            rp3d_test(approxEqual(raycastInfo.worldNormal.z, hitNormal.z, epsilon));
+
+            // PhysicsWorld::raycast()
+            mCallback.shapeToTest = collider;
+            mCallback.reset();
+            mWorld->raycast(raySide, &mCallback);
+            rp3d_test(mCallback.isHit);
+            rp3d_test(mCallback.raycastInfo.collider == collider);
+            rp3d_test(approxEqual(mCallback.raycastInfo.hitFraction, decimal(0.4), epsilon));
+
+            // Rays that miss the cone (the second one crosses the upper part of the double cone)
+            rp3d_test(!collider->raycast(Ray(mLocalShapeToWorld * Vector3(1.5, 1, 5), mLocalShapeToWorld * Vector3(1.5, 1, -5)), raycastInfo));
+            rp3d_test(!collider->raycast(Ray(mLocalShapeToWorld * Vector3(0, 4, 5), mLocalShapeToWorld * Vector3(0, 4, -5)), raycastInfo));
+            rp3d_test(!collider->raycast(Ray(mLocalShapeToWorld * Vector3(3, -2, 0), mLocalShapeToWorld * Vector3(-3, -2, 0)), raycastInfo));
+            rp3d_test(!collider->raycast(Ray(mLocalShapeToWorld * Vector3(0, 0, 0), mLocalShapeToWorld * Vector3(5, 0, 0)), raycastInfo));
+
+            mWorld->destroyCollisionBody(body);
+            mPhysicsCommon.destroyConeShape(coneShape);
+        }
+
         /// Test the Collider::raycast(), CollisionBody::raycast() and
         /// PhysicsWorld::raycast() methods.
         void testConvexMesh() {
@@ -1569,6 +1707,204 @@ class TestRaycast : public Test {
             rp3d_test(mCallback.isHit);
         }
 
+        /// Test a concave mesh shape created from the cooked data of another concave mesh shape
+        void testCookedConcaveMesh() {
+
+            // Cook the concave mesh shape (the buffer must be aligned on 8 bytes)
+            const size_t cookedDataSize = mConcaveMeshShape->getCookedDataSize();
+            std::vector<uint64> cookedData((cookedDataSize + 7) / 8);
+            mConcaveMeshShape->cook(cookedData.data());
+
+            // Invalid cooked data
+            rp3d_test(mPhysicsCommon.createConcaveMeshShapeFromCooked(cookedData.data(), cookedDataSize - 1) == nullptr);
+            std::vector<uint64> invalidCookedData(cookedData);
+            invalidCookedData[0] = 0;
+            rp3d_test(mPhysicsCommon.createConcaveMeshShapeFromCooked(invalidCookedData.data(), cookedDataSize) == nullptr);
+
+            // Cooked data with an index out of range. The cooked data ends with the vertex indices of the 12
+            // triangles, the 11 nodes of the AABB tree, the triangles of the tree and the 12 convex edges bytes
+            const size_t treeObjectsOffset = cookedDataSize - 12 - 12 * 2 * sizeof(int32);
+            const size_t treeNodesOffset = treeObjectsOffset - 11 * sizeof(StaticTreeNode);
+            const size_t indicesOffset = treeNodesOffset - 12 * 3 * sizeof(uint32);
+
+            invalidCookedData = cookedData;
+            uint32* indices = reinterpret_cast<uint32*>(reinterpret_cast<uchar*>(invalidCookedData.data()) + indicesOffset);
+            indices[5] = 8;
+            rp3d_test(mPhysicsCommon.createConcaveMeshShapeFromCooked(invalidCookedData.data(), cookedDataSize) == nullptr);
+
+            invalidCookedData = cookedData;
+            StaticTreeNode* treeNodes = reinterpret_cast<StaticTreeNode*>(reinterpret_cast<uchar*>(invalidCookedData.data()) + treeNodesOffset);
+            treeNodes[0].children[0] = 0;
+            rp3d_test(mPhysicsCommon.createConcaveMeshShapeFromCooked(invalidCookedData.data(), cookedDataSize) == nullptr);
+            treeNodes[0].children[0] = StaticTreeNode::LEAF_BIT | 12;
+            rp3d_test(mPhysicsCommon.createConcaveMeshShapeFromCooked(invalidCookedData.data(), cookedDataSize) == nullptr);
+
+            invalidCookedData = cookedData;
+            int32* treeObjects = reinterpret_cast<int32*>(reinterpret_cast<uchar*>(invalidCookedData.data()) + treeObjectsOffset);
+            treeObjects[2 * 3 + 1] = 12;
+            rp3d_test(mPhysicsCommon.createConcaveMeshShapeFromCooked(invalidCookedData.data(), cookedDataSize) == nullptr);
+
+            ConcaveMeshShape* cookedShape = mPhysicsCommon.createConcaveMeshShapeFromCooked(cookedData.data(), cookedDataSize);
+            rp3d_test(cookedShape != nullptr);
+            rp3d_test(cookedShape->getNbSubparts() == 1);
+            rp3d_test(cookedShape->getNbTriangles(0) == 12);
+
+            Vector3 min, max, cookedMin, cookedMax;
+            mConcaveMeshShape->getLocalBounds(min, max);
+            cookedShape->getLocalBounds(cookedMin, cookedMax);
+            rp3d_test(min == cookedMin);
+            rp3d_test(max == cookedMax);
+
+            // Cooking the shape created from cooked data must give the same cooked data
+            rp3d_test(cookedShape->getCookedDataSize() == cookedDataSize);
+            std::vector<uint64> recookedData(cookedData.size());
+            cookedShape->cook(recookedData.data());
+            rp3d_test(recookedData == cookedData);
+
+            // Raycast against the shape created from cooked data
+            CollisionBody* body = mWorld->createCollisionBody(mBodyTransform);
+            Collider* collider = body->addCollider(cookedShape, mShapeTransform);
+
+            Vector3 point1 = mLocalShapeToWorld * Vector3(1 , 2, 6);
+            Vector3 point2 = mLocalShapeToWorld * Vector3(1, 2, -4);
+            Ray ray(point1, point2);
+            Vector3 hitPoint = mLocalShapeToWorld * Vector3(1, 2, 4);
+
+            RaycastInfo raycastInfo;
+            rp3d_test(collider->raycast(ray, raycastInfo));
+            rp3d_test(raycastInfo.collider == collider);
+            rp3d_test(approxEqual(raycastInfo.hitFraction, decimal(0.2), epsilon));
+            rp3d_test(approxEqual(raycastInfo.worldPoint.x, hitPoint.x, epsilon));
+            rp3d_test(approxEqual(raycastInfo.worldPoint.y, hitPoint.y, epsilon));
+            rp3d_test(approxEqual(raycastInfo.worldPoint.z, hitPoint.z, epsilon));
+
+            Ray rayMiss(mLocalShapeToWorld * Vector3(5, 2, 6), mLocalShapeToWorld * Vector3(5, 2, -4));
+            rp3d_test(!collider->raycast(rayMiss, raycastInfo));
+
+            mWorld->destroyCollisionBody(body);
+            mPhysicsCommon.destroyConcaveMeshShape(cookedShape);
+        }
+
+        /// Test a concave mesh shape with compressed vertices
+        void testCompressedConcaveMesh() {
+
+            ConcaveMeshShape* compressedShape = mPhysicsCommon.createConcaveMeshShape(mConcaveTriangleMesh, Vector3(1, 1, 1), true);
+            rp3d_test(compressedShape->getNbSubparts() == 1);
+            rp3d_test(compressedShape->getNbTriangles(0) == 12);
+
+            CollisionBody* body = mWorld->createCollisionBody(mBodyTransform);
+            Collider* collider = body->addCollider(compressedShape, mShapeTransform);
+
+            Vector3 point1 = mLocalShapeToWorld * Vector3(1 , 2, 6);
+            Vector3 point2 = mLocalShapeToWorld * Vector3(1, 2, -4);
+            Ray ray(point1, point2);
+            Vector3 hitPoint = mLocalShapeToWorld * Vector3(1, 2, 4);
+
+            RaycastInfo raycastInfo;
+            rp3d_test(collider->raycast(ray, raycastInfo));
+            rp3d_test(raycastInfo.collider == collider);
+            rp3d_test(approxEqual(raycastInfo.hitFraction, decimal(0.2), epsilon));
+            rp3d_test(approxEqual(raycastInfo.worldPoint.x, hitPoint.x, epsilon));
+            rp3d_test(approxEqual(raycastInfo.worldPoint.y, hitPoint.y, epsilon));
+            rp3d_test(approxEqual(raycastInfo.worldPoint.z, hitPoint.z, epsilon));
+
+            // Ray through the side faces of the mesh
+            Ray ray2(mLocalShapeToWorld * Vector3(-10, 1, 1), mLocalShapeToWorld * Vector3(10, 1, 1));
+            Vector3 hitPoint2 = mLocalShapeToWorld * Vector3(-2, 1, 1);
+            rp3d_test(collider->raycast(ray2, raycastInfo));
+            rp3d_test(approxEqual(raycastInfo.worldPoint.x, hitPoint2.x, epsilon));
+            rp3d_test(approxEqual(raycastInfo.worldPoint.y, hitPoint2.y, epsilon));
+            rp3d_test(approxEqual(raycastInfo.worldPoint.z, hitPoint2.z, epsilon));
+
+            Ray rayMiss(mLocalShapeToWorld * Vector3(5, 2, 6), mLocalShapeToWorld * Vector3(5, 2, -4));
+            rp3d_test(!collider->raycast(rayMiss, raycastInfo));
+
+            mWorld->destroyCollisionBody(body);
+            mPhysicsCommon.destroyConcaveMeshShape(compressedShape);
+        }
+
+        /// Test the memory used by the data of a concave mesh shape with compressed vertices
+        void testCompressedConcaveMeshMemory() {
+
+            // Terrain grid of 32 x 32 cells made of two triangles each
+            const int nbCells = 32;
+            const int nbVertices = (nbCells + 1) * (nbCells + 1);
+            const int nbTriangles = nbCells * nbCells * 2;
+            std::vector<float> gridVertices;
+            std::vector<int> gridIndices;
+            for (int i=0; i <= nbCells; i++) {
+                for (int j=0; j <= nbCells; j++) {
+                    gridVertices.push_back(static_cast<float>(i));
+                    gridVertices.push_back(std::sin(0.7f * i) * std::cos(0.5f * j));
+                    gridVertices.push_back(static_cast<float>(j));
+                }
+            }
+            for (int i=0; i < nbCells; i++) {
+                for (int j=0; j < nbCells; j++) {
+                    const int v = i * (nbCells + 1) + j;
+                    const int cellIndices[6] = {v, v + 1, v + nbCells + 2,   v, v + nbCells + 2, v + nbCells + 1};
+                    gridIndices.insert(gridIndices.end(), cellIndices, cellIndices + 6);
+                }
+            }
+
+            TriangleVertexArray gridTriangleVertexArray(nbVertices, gridVertices.data(), 3 * sizeof(float), nbTriangles,
+                                                        gridIndices.data(), 3 * sizeof(int),
+                                                        TriangleVertexArray::VertexDataType::VERTEX_FLOAT_TYPE,
+                                                        TriangleVertexArray::IndexDataType::INDEX_INTEGER_TYPE);
+            TriangleMesh* gridTriangleMesh = mPhysicsCommon.createTriangleMesh();
+            gridTriangleMesh->addSubpart(&gridTriangleVertexArray);
+
+            ConcaveMeshShape* shape = mPhysicsCommon.createConcaveMeshShape(gridTriangleMesh);
+            ConcaveMeshShape* compressedShape = mPhysicsCommon.createConcaveMeshShape(gridTriangleMesh, Vector3(1, 1, 1), true);
+
+            // The compressed vertices (with the indices of the triangles) must use less memory than the source
+            // arrays of the mesh that can be freed after the creation of the compressed shape
+            const size_t sourceSize = gridVertices.size() * sizeof(float) + gridIndices.size() * sizeof(int);
+            rp3d_test(compressedShape->getMeshDataSizeInBytes() > shape->getMeshDataSizeInBytes());
+            rp3d_test(compressedShape->getMeshDataSizeInBytes() - shape->getMeshDataSizeInBytes() < sourceSize);
+
+            mPhysicsCommon.destroyConcaveMeshShape(compressedShape);
+            mPhysicsCommon.destroyConcaveMeshShape(shape);
+            mPhysicsCommon.destroyTriangleMesh(gridTriangleMesh);
+        }
+
+        void testScaledSharedConcaveMesh() {
+
+            // Create a second shape from the same triangle mesh with a different scaling
+            ConcaveMeshShape* scaledShape = mPhysicsCommon.createConcaveMeshShape(mConcaveTriangleMesh, Vector3(2, 1, 3));
+
+            Vector3 min, max;
+            scaledShape->getLocalBounds(min, max);
+            rp3d_test(approxEqual(min.x, -4, epsilon));
+            rp3d_test(approxEqual(min.y, -3, epsilon));
+            rp3d_test(approxEqual(min.z, -12, epsilon));
+            rp3d_test(approxEqual(max.x, 4, epsilon));
+            rp3d_test(approxEqual(max.y, 3, epsilon));
+            rp3d_test(approxEqual(max.z, 12, epsilon));
+
+            CollisionBody* body = mWorld->createCollisionBody(mBodyTransform);
+            Collider* collider = body->addCollider(scaledShape, mShapeTransform);
+
+            // Ray that hits the scaled shape but misses the unscaled one
+            Ray ray(mLocalShapeToWorld * Vector3(3, 2, 20), mLocalShapeToWorld * Vector3(3, 2, 0));
+            Vector3 hitPoint = mLocalShapeToWorld * Vector3(3, 2, 12);
+            RaycastInfo raycastInfo;
+            rp3d_test(collider->raycast(ray, raycastInfo));
+            rp3d_test(approxEqual(raycastInfo.hitFraction, decimal(0.4), epsilon));
+            rp3d_test(approxEqual(raycastInfo.worldPoint.x, hitPoint.x, epsilon));
+            rp3d_test(approxEqual(raycastInfo.worldPoint.y, hitPoint.y, epsilon));
+            rp3d_test(approxEqual(raycastInfo.worldPoint.z, hitPoint.z, epsilon));
+            rp3d_test(!mConcaveMeshCollider->raycast(ray, raycastInfo));
+
+            mWorld->destroyCollisionBody(body);
+            mPhysicsCommon.destroyConcaveMeshShape(scaledShape);
+
+            // The original shape still works after the scaled shape sharing its data is destroyed
+            Ray ray2(mLocalShapeToWorld * Vector3(1, 2, 6), mLocalShapeToWorld * Vector3(1, 2, -4));
+            rp3d_test(mConcaveMeshCollider->raycast(ray2, raycastInfo));
+            rp3d_test(approxEqual(raycastInfo.hitFraction, decimal(0.2), epsilon));
+        }
+
         void testHeightField() {
 
             // ----- Test feedback data ----- //
@@ -1742,6 +2078,126 @@ class TestRaycast : public Test {
             mWorld->raycast(Ray(ray14.point1, ray14.point2, decimal(0.8)), &mCallback);
             rp3d_test(mCallback.isHit);
         }
+
+        /// Test the queries on a height field shape that are accelerated by the min/max height pyramid
+        void testHeightFieldPyramid() {
+
+            // Flat height field with a single spike
+            std::vector<float> heights(40 * 40, 0.0f);
+            heights[30 * 40 + 30] = 10.0f;
+            HeightFieldShape* shape = mPhysicsCommon.createHeightFieldShape(40, 40, 0, 10, heights.data(),
+                                                                            HeightFieldShape::HeightDataType::HEIGHT_FLOAT_TYPE);
+
+            DefaultAllocator allocator;
+            Array<Vector3> triangleVertices(allocator);
+            Array<uint8> trianglesConvexEdges(allocator);
+            Array<uint32> shapeIds(allocator);
+
+            // AABB above the ground and far from the spike
+            shape->computeOverlappingTriangles(AABB(Vector3(-10, -3, -10), Vector3(-9, -2, -9)), triangleVertices,
+                                               trianglesConvexEdges, shapeIds, allocator);
+            rp3d_test(shapeIds.size() == 0);
+
+            // AABB on the ground
+            shape->computeOverlappingTriangles(AABB(Vector3(-10, -5.5, -10), Vector3(-9, -4.5, -9)), triangleVertices,
+                                               trianglesConvexEdges, shapeIds, allocator);
+            rp3d_test(shapeIds.size() > 0);
+            rp3d_test(triangleVertices.size() == shapeIds.size() * 3);
+
+            // AABB on the side of the spike
+            shapeIds.clear();
+            shape->computeOverlappingTriangles(AABB(Vector3(10, 0, 10), Vector3(11, 1, 11)), triangleVertices,
+                                               trianglesConvexEdges, shapeIds, allocator);
+            rp3d_test(shapeIds.size() > 0);
+
+            CollisionBody* body = mWorld->createCollisionBody(Transform::identity());
+            Collider* collider = body->addCollider(shape, Transform::identity());
+
+            // Horizontal ray hitting the side of the spike
+            RaycastInfo raycastInfo;
+            rp3d_test(collider->raycast(Ray(Vector3(-30, 0, 10.4), Vector3(30, 0, 10.4)), raycastInfo));
+            rp3d_test(raycastInfo.worldPoint.x > decimal(9.5) && raycastInfo.worldPoint.x < decimal(10.5));
+
+            // Horizontal ray above the ground and far from the spike
+            rp3d_test(!collider->raycast(Ray(Vector3(-30, 0, -10), Vector3(30, 0, -10)), raycastInfo));
+
+            // Vertical ray hitting the ground
+            rp3d_test(collider->raycast(Ray(Vector3(-10, 10, -10), Vector3(-10, -10, -10)), raycastInfo));
+            rp3d_test(approxEqual(raycastInfo.hitFraction, decimal(0.75), epsilon));
+            rp3d_test(approxEqual(raycastInfo.worldPoint.y, decimal(-5), epsilon));
+
+            // Raise a second spike at (-10.5, 5, -10.5) and update the modified region of the height field
+            heights[9 * 40 + 9] = 10.0f;
+            shape->updateHeights(9, 9, 9, 9);
+            rp3d_test(collider->raycast(Ray(Vector3(-30, 0, -10.6), Vector3(30, 0, -10.6)), raycastInfo));
+            rp3d_test(raycastInfo.worldPoint.x > decimal(-11.5) && raycastInfo.worldPoint.x < decimal(-10.5));
+            shapeIds.clear();
+            shape->computeOverlappingTriangles(AABB(Vector3(-11, 0, -11), Vector3(-10, 1, -10)), triangleVertices,
+                                               trianglesConvexEdges, shapeIds, allocator);
+            rp3d_test(shapeIds.size() > 0);
+
+            // Remove the first spike
+            heights[30 * 40 + 30] = 0.0f;
+            shape->updateHeights(28, 28, 32, 32);
+            rp3d_test(!collider->raycast(Ray(Vector3(-30, 0, 10.4), Vector3(30, 0, 10.4)), raycastInfo));
+
+            mWorld->destroyCollisionBody(body);
+            mPhysicsCommon.destroyHeightFieldShape(shape);
+        }
+
+        /// Test a height field shape with 16-bits unsigned integer height values
+        void testHeightFieldUint16() {
+
+            // Height values 1000 + 0.5 * value, that is 1000 on the ground and 1010 at the top of the spike
+            std::vector<uint16> heights(20 * 20, 0);
+            heights[15 * 20 + 15] = 20;
+            HeightFieldShape* shape = mPhysicsCommon.createHeightFieldShape(20, 20, 1000, 1010, heights.data(),
+                                                                            HeightFieldShape::HeightDataType::HEIGHT_UINT16_TYPE,
+                                                                            1, decimal(0.5), Vector3(1, 1, 1), decimal(1000));
+            rp3d_test(shape->getHeightDataType() == HeightFieldShape::HeightDataType::HEIGHT_UINT16_TYPE);
+            rp3d_test(approxEqual(shape->getHeightAt(0, 0), decimal(1000), epsilon));
+            rp3d_test(approxEqual(shape->getHeightAt(15, 15), decimal(1010), epsilon));
+            rp3d_test(approxEqual(shape->getVertexAt(15, 15).y, decimal(5), epsilon));
+
+            CollisionBody* body = mWorld->createCollisionBody(Transform::identity());
+            Collider* collider = body->addCollider(shape, Transform::identity());
+
+            // Vertical ray hitting the ground
+            RaycastInfo raycastInfo;
+            rp3d_test(collider->raycast(Ray(Vector3(-5, 10, -5), Vector3(-5, -10, -5)), raycastInfo));
+            rp3d_test(approxEqual(raycastInfo.worldPoint.y, decimal(-5), epsilon));
+
+            // Vertical ray hitting the spike near its top (at x=5.5 and z=5.5)
+            rp3d_test(collider->raycast(Ray(Vector3(5.5, 10, 5.4), Vector3(5.5, -10, 5.4)), raycastInfo));
+            rp3d_test(raycastInfo.worldPoint.y > decimal(4) && raycastInfo.worldPoint.y < decimal(5));
+
+            mWorld->destroyCollisionBody(body);
+            mPhysicsCommon.destroyHeightFieldShape(shape);
+        }
+
+        /// Test the triangle index and the normal of the triangle hit by a ray on a concave mesh
+        void testConcaveMeshHitTriangle() {
+
+            ConcaveMeshShape* shape = mPhysicsCommon.createConcaveMeshShape(mConcaveTriangleMesh, Vector3(2, 1, 1));
+            CollisionBody* body = mWorld->createCollisionBody(Transform::identity());
+            Collider* collider = body->addCollider(shape, Transform::identity());
+
+            // Ray hitting the triangle (5, 7, 6) of the top face of the mesh
+            RaycastInfo raycastInfo;
+            rp3d_test(collider->raycast(Ray(Vector3(2, 10, 1), Vector3(2, -10, 1)), raycastInfo));
+            rp3d_test(raycastInfo.meshSubpart == 0);
+            rp3d_test(raycastInfo.triangleIndex == 10);
+            rp3d_test(approxEqual(raycastInfo.hitFraction, decimal(0.35), epsilon));
+            rp3d_test(approxEqual(raycastInfo.worldPoint.x, decimal(2), epsilon));
+            rp3d_test(approxEqual(raycastInfo.worldPoint.y, decimal(3), epsilon));
+            rp3d_test(approxEqual(raycastInfo.worldNormal.y, decimal(1), epsilon));
+
+            // Ray starting after the mesh must not hit it
+            rp3d_test(!collider->raycast(Ray(Vector3(2, 10, 1), Vector3(2, 20, 1)), raycastInfo));
+
+            mWorld->destroyCollisionBody(body);
+            mPhysicsCommon.destroyConcaveMeshShape(shape);
+        }
 };
 
 }
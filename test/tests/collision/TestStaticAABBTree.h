@@ -0,0 +1,211 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2022 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef TEST_STATIC_AABB_TREE_H
+#define TEST_STATIC_AABB_TREE_H
+
+// Libraries
+#include "Test.h"
+#include "TestDynamicAABBTree.h"
+#include <reactphysics3d/collision/broadphase/StaticAABBTree.h>
+#include <reactphysics3d/mathematics/Ray.h>
+#include <vector>
+
+/// Reactphysics3D namespace
+namespace reactphysics3d {
+
+// Class TestStaticAABBTree
+/**
+ * Unit test for the static AABB tree
+ */
+class TestStaticAABBTree : public Test {
+
+    private :
+
+        // ---------- Atributes ---------- //
+
+        DefaultTestTreeAllocator mAllocator;
+
+        DynamicTreeRaycastCallback mRaycastCallback;
+
+        /// Number of boxes along each axis of the grid of objects
+        static const int NB_BOXES_PER_AXIS = 6;
+
+    public :
+
+        // ---------- Methods ---------- //
+
+        /// Constructor
+        TestStaticAABBTree(const std::string& name): Test(name)  {
+
+        }
+
+        bool isOverlapping(int objectIndex, const Array<int>& overlappingObjects) const {
+            return std::find(overlappingObjects.begin(), overlappingObjects.end(), objectIndex) != overlappingObjects.end();
+        }
+
+        /// Return the AABB of the box of the grid at a given position (boxes of size 1 separated by 1)
+        AABB getBoxAABB(int x, int y, int z) const {
+            const Vector3 min(decimal(x * 2), decimal(y * 2), decimal(z * 2));
+            return AABB(min, min + Vector3(1, 1, 1));
+        }
+
+        /// Build a tree with a grid of boxes (the data of each object is its index and its index times two)
+        void buildGridTree(StaticAABBTree& tree) const {
+            for (int x=0; x < NB_BOXES_PER_AXIS; x++) {
+                for (int y=0; y < NB_BOXES_PER_AXIS; y++) {
+                    for (int z=0; z < NB_BOXES_PER_AXIS; z++) {
+                        const int index = static_cast<int>(tree.getNbObjects());
+                        tree.addObject(getBoxAABB(x, y, z), index, index * 2);
+                    }
+                }
+            }
+            tree.build();
+        }
+
+        /// Run the tests
+        void run() {
+
+            testBasicsMethods();
+            testOverlapping();
+            testRaycast();
+        }
+
+        void testBasicsMethods() {
+
+            StaticAABBTree tree(mAllocator);
+            buildGridTree(tree);
+
+            const int nbObjects = NB_BOXES_PER_AXIS * NB_BOXES_PER_AXIS * NB_BOXES_PER_AXIS;
+            rp3d_test(tree.getNbObjects() == nbObjects);
+
+            // Test the data of the objects
+            rp3d_test(tree.getObjectDataInt(0)[0] == 0);
+            rp3d_test(tree.getObjectDataInt(0)[1] == 0);
+            rp3d_test(tree.getObjectDataInt(17)[0] == 17);
+            rp3d_test(tree.getObjectDataInt(17)[1] == 34);
+            rp3d_test(tree.getObjectDataInt(nbObjects - 1)[0] == nbObjects - 1);
+
+            // Test the root AABB
+            const decimal max = decimal(NB_BOXES_PER_AXIS * 2 - 1);
+            rp3d_test(tree.getRootAABB().getMin() == Vector3(0, 0, 0));
+            rp3d_test(tree.getRootAABB().getMax() == Vector3(max, max, max));
+
+            // Test a tree with a single object
+            StaticAABBTree singleTree(mAllocator);
+            singleTree.addObject(getBoxAABB(1, 1, 1), 7, 8);
+            singleTree.build();
+            rp3d_test(singleTree.getNbObjects() == 1);
+            rp3d_test(singleTree.getObjectDataInt(0)[0] == 7);
+            rp3d_test(singleTree.getObjectDataInt(0)[1] == 8);
+
+            Array<int> overlappingObjects(mAllocator);
+            singleTree.reportAllShapesOverlappingWithAABB(AABB(Vector3(2.5, 2.5, 2.5), Vector3(4, 4, 4)), overlappingObjects);
+            rp3d_test(overlappingObjects.size() == 1);
+            overlappingObjects.clear();
+            singleTree.reportAllShapesOverlappingWithAABB(AABB(Vector3(3.5, 3.5, 3.5), Vector3(4, 4, 4)), overlappingObjects);
+            rp3d_test(overlappingObjects.size() == 0);
+        }
+
+        void testOverlapping() {
+
+            StaticAABBTree tree(mAllocator);
+            buildGridTree(tree);
+
+            Array<int> overlappingObjects(mAllocator);
+
+            // AABBs covering a part of the grid must report exactly the boxes they overlap
+            const AABB queries[3] = {AABB(Vector3(-1, -1, -1), Vector3(0.5, 0.5, 0.5)),
+                                     AABB(Vector3(2.5, 0.5, 4.5), Vector3(6.5, 2.5, 8.5)),
+                                     AABB(Vector3(-5, -5, -5), Vector3(30, 30, 30))};
+
+            for (int q=0; q < 3; q++) {
+
+                overlappingObjects.clear();
+                tree.reportAllShapesOverlappingWithAABB(queries[q], overlappingObjects);
+
+                uint32 nbExpectedObjects = 0;
+                bool isReportCorrect = true;
+                for (int x=0; x < NB_BOXES_PER_AXIS; x++) {
+                    for (int y=0; y < NB_BOXES_PER_AXIS; y++) {
+                        for (int z=0; z < NB_BOXES_PER_AXIS; z++) {
+                            const int index = (x * NB_BOXES_PER_AXIS + y) * NB_BOXES_PER_AXIS + z;
+                            const bool isExpected = getBoxAABB(x, y, z).testCollision(queries[q]);
+                            if (isExpected) nbExpectedObjects++;
+                            if (isExpected != isOverlapping(index, overlappingObjects)) isReportCorrect = false;
+                        }
+                    }
+                }
+
+                rp3d_test(isReportCorrect);
+                rp3d_test(overlappingObjects.size() == nbExpectedObjects);
+            }
+
+            // AABB in the gaps between the boxes or outside of the tree
+            overlappingObjects.clear();
+            tree.reportAllShapesOverlappingWithAABB(AABB(Vector3(1.2, 1.2, 1.2), Vector3(1.8, 1.8, 1.8)), overlappingObjects);
+            rp3d_test(overlappingObjects.size() == 0);
+            tree.reportAllShapesOverlappingWithAABB(AABB(Vector3(20, 20, 20), Vector3(21, 21, 21)), overlappingObjects);
+            rp3d_test(overlappingObjects.size() == 0);
+        }
+
+        void testRaycast() {
+
+            StaticAABBTree tree(mAllocator);
+            buildGridTree(tree);
+
+            // Ray along the x axis through the row of boxes at y=0 and z=0
+            mRaycastCallback.reset();
+            Ray ray1(Vector3(-5, 0.5, 0.5), Vector3(30, 0.5, 0.5));
+            tree.raycast(ray1, mRaycastCallback);
+            rp3d_test(mRaycastCallback.mHitNodes.size() == NB_BOXES_PER_AXIS);
+            for (int x=0; x < NB_BOXES_PER_AXIS; x++) {
+                rp3d_test(mRaycastCallback.isHit(x * NB_BOXES_PER_AXIS * NB_BOXES_PER_AXIS));
+            }
+
+            // Ray through the gaps between the boxes
+            mRaycastCallback.reset();
+            Ray ray2(Vector3(-5, 1.5, 1.5), Vector3(30, 1.5, 1.5));
+            tree.raycast(ray2, mRaycastCallback);
+            rp3d_test(mRaycastCallback.mHitNodes.size() == 0);
+
+            // Ray stopping before the second box
+            mRaycastCallback.reset();
+            Ray ray3(Vector3(0.5, 0.5, -5), Vector3(0.5, 0.5, 30), decimal(6.5) / decimal(35.0));
+            tree.raycast(ray3, mRaycastCallback);
+            rp3d_test(mRaycastCallback.mHitNodes.size() == 1);
+            rp3d_test(mRaycastCallback.isHit(0));
+
+            // Ray missing the whole tree
+            mRaycastCallback.reset();
+            Ray ray4(Vector3(-5, 20, 0.5), Vector3(30, 20, 0.5));
+            tree.raycast(ray4, mRaycastCallback);
+            rp3d_test(mRaycastCallback.mHitNodes.size() == 0);
+        }
+ };
+
+}
+
+#endif
@@ -51,6 +51,8 @@ class TestTriangleVertexArray : public Test {
         TriangleVertexArray* mTriangleVertexArray1;
         TriangleVertexArray* mTriangleVertexArray2;
 
+        PhysicsCommon mPhysicsCommon;
+
         Vector3 mVertex0;
         Vector3 mVertex1;
         Vector3 mVertex2;
@@ -181,10 +183,15 @@ class TestTriangleVertexArray : public Test {
             rp3d_test(approxEqual(triangle1Vertices[1], mVertex3, decimal(0.0000001)));
             rp3d_test(approxEqual(triangle1Vertices[2], mVertex1, decimal(0.0000001)));
 
-            // Get triangle normals
+            // Get triangle normals (computed the first time they are requested)
+            rp3d_test(!mTriangleVertexArray1->areVerticesNormalsAvailable());
+            Vector3 vertex0Normal;
+            mTriangleVertexArray1->getNormal(0, &vertex0Normal);
+            rp3d_test(mTriangleVertexArray1->areVerticesNormalsAvailable());
 
             Vector3 triangle0Normals[3];
             mTriangleVertexArray1->getTriangleVerticesNormals(0, triangle0Normals);
+            rp3d_test(approxEqual(triangle0Normals[0], vertex0Normal, decimal(0.000001)));
 
             Vector3 triangle1Normals[3];
             mTriangleVertexArray1->getTriangleVerticesNormals(1, triangle1Normals);
@@ -251,6 +258,54 @@ class TestTriangleVertexArray : public Test {
             rp3d_test(approxEqual(triangle1Normals[0], mNormal0, decimal(0.000001)));
             rp3d_test(approxEqual(triangle1Normals[1], mNormal3, decimal(0.000001)));
             rp3d_test(approxEqual(triangle1Normals[2], mNormal1, decimal(0.000001)));
+
+            testLazyVerticesNormals();
+        }
+
+        /// Test that a concave mesh does not compute the vertices normals it does not use
+        void testLazyVerticesNormals() {
+
+            // Flat quad made of two triangles without vertices normals
+            const float vertices[] = {-10, 0, -10,  10, 0, -10,  10, 0, 10,  -10, 0, 10};
+            const uint32 indices[] = {0, 2, 1,  0, 3, 2};
+
+            TriangleVertexArray* triangleArray = new TriangleVertexArray(4, static_cast<const void*>(vertices), 3 * sizeof(float),
+                                                                         2, static_cast<const void*>(indices), 3 * sizeof(uint32),
+                                                                         TriangleVertexArray::VertexDataType::VERTEX_FLOAT_TYPE,
+                                                                         TriangleVertexArray::IndexDataType::INDEX_INTEGER_TYPE);
+            TriangleMesh* triangleMesh = mPhysicsCommon.createTriangleMesh();
+            triangleMesh->addSubpart(triangleArray);
+            ConcaveMeshShape* meshShape = mPhysicsCommon.createConcaveMeshShape(triangleMesh);
+
+            PhysicsWorld* world = mPhysicsCommon.createPhysicsWorld();
+            CollisionBody* meshBody = world->createCollisionBody(Transform::identity());
+            meshBody->addCollider(meshShape, Transform::identity());
+
+            SphereShape* sphereShape = mPhysicsCommon.createSphereShape(1);
+            CollisionBody* sphereBody = world->createCollisionBody(Transform(Vector3(1, decimal(0.9), 2), Quaternion::identity()));
+            sphereBody->addCollider(sphereShape, Transform::identity());
+
+            BoxShape* boxShape = mPhysicsCommon.createBoxShape(Vector3(1, 1, 1));
+            CollisionBody* boxBody = world->createCollisionBody(Transform(Vector3(-3, decimal(0.9), 1), Quaternion::identity()));
+            boxBody->addCollider(boxShape, Transform::identity());
+
+            // Compute the collisions and a raycast against the mesh
+            world->update(decimal(1.0) / decimal(60.0));
+            rp3d_test(world->testOverlap(meshBody, sphereBody));
+            rp3d_test(world->testOverlap(meshBody, boxBody));
+
+            RaycastInfo raycastInfo;
+            rp3d_test(meshBody->raycast(Ray(Vector3(2, 10, 2), Vector3(2, -10, 2)), raycastInfo));
+
+            // The vertices normals are never needed, they must not have been computed
+            rp3d_test(!triangleArray->areVerticesNormalsAvailable());
+
+            mPhysicsCommon.destroyPhysicsWorld(world);
+            mPhysicsCommon.destroyConcaveMeshShape(meshShape);
+            mPhysicsCommon.destroySphereShape(sphereShape);
+            mPhysicsCommon.destroyBoxShape(boxShape);
+            mPhysicsCommon.destroyTriangleMesh(triangleMesh);
+            delete triangleArray;
         }
 
 };
@@ -0,0 +1,270 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2022 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef TEST_CONTACT_SOLVER_H
+#define TEST_CONTACT_SOLVER_H
+
+// Libraries
+#include <reactphysics3d/reactphysics3d.h>
+
+/// Reactphysics3D namespace
+namespace reactphysics3d {
+
+// Class TestContactSolver
+/**
+ * Unit test for the contact solver. The contact manifolds are solved in batches of
+ * NB_CONTACT_SOLVER_LANES manifolds, those tests check that simulations with different
+ * batch layouts converge to the expected resting configurations.
+ */
+class TestContactSolver : public Test {
+
+    private :
+
+        // ---------- Atributes ---------- //
+
+        PhysicsCommon mPhysicsCommon;
+
+        BoxShape* mGroundShape;
+        BoxShape* mBoxShape;
+        BoxShape* mPlankShape;
+
+        /// Time step of the simulations
+        const decimal mTimeStep = decimal(1.0) / decimal(60.0);
+
+    public :
+
+        // ---------- Methods ---------- //
+
+        /// Constructor
+        TestContactSolver(const std::string& name) : Test(name) {
+
+            mGroundShape = mPhysicsCommon.createBoxShape(Vector3(20, 1, 20));
+            mBoxShape = mPhysicsCommon.createBoxShape(Vector3(decimal(0.5), decimal(0.5), decimal(0.5)));
+            mPlankShape = mPhysicsCommon.createBoxShape(Vector3(3, decimal(0.25), 1));
+        }
+
+        /// Destructor
+        virtual ~TestContactSolver() {
+
+            mPhysicsCommon.destroyBoxShape(mGroundShape);
+            mPhysicsCommon.destroyBoxShape(mBoxShape);
+            mPhysicsCommon.destroyBoxShape(mPlankShape);
+        }
+
+        /// Run the tests
+        void run() {
+
+            testStack(ContactsPositionCorrectionTechnique::SPLIT_IMPULSES);
+            testStack(ContactsPositionCorrectionTechnique::BAUMGARTE_CONTACTS);
+            testPartialBatch();
+            testBodyWithSeveralManifolds();
+            testSharedKinematicBody();
+            testLockAxis();
+        }
+
+        /// Create a rigid body with a box collider
+        RigidBody* createBody(PhysicsWorld* world, BoxShape* shape, const Vector3& position, BodyType type = BodyType::DYNAMIC) {
+
+            RigidBody* body = world->createRigidBody(Transform(position, Quaternion::identity()));
+            body->addCollider(shape, Transform::identity());
+            body->setType(type);
+
+            return body;
+        }
+
+        /// Create a static ground whose top face is the plane y=0
+        RigidBody* createGround(PhysicsWorld* world) {
+            return createBody(world, mGroundShape, Vector3(0, -1, 0), BodyType::STATIC);
+        }
+
+        /// Run the simulation during a given number of steps
+        void simulate(PhysicsWorld* world, int nbSteps) {
+
+            for (int i=0; i < nbSteps; i++) {
+                world->update(mTimeStep);
+            }
+        }
+
+        /// Return true if a body rests at a given position
+        bool isRestingAt(RigidBody* body, const Vector3& position, decimal maxVelocity = decimal(0.05)) {
+
+            return approxEqual(body->getTransform().getPosition(), position, decimal(0.05)) &&
+                   body->getLinearVelocity().length() < maxVelocity &&
+                   body->getAngularVelocity().length() < maxVelocity;
+        }
+
+        /// Return true if two orientations rotate the x and y axes to the same directions
+        bool approxEqualOrientations(const Quaternion& orientation1, const Quaternion& orientation2, decimal epsilon) {
+
+            return approxEqual(orientation1 * Vector3(1, 0, 0), orientation2 * Vector3(1, 0, 0), epsilon) &&
+                   approxEqual(orientation1 * Vector3(0, 1, 0), orientation2 * Vector3(0, 1, 0), epsilon);
+        }
+
+        /// Stack of boxes resting under gravity on a static ground
+        void testStack(ContactsPositionCorrectionTechnique positionCorrectionTechnique) {
+
+            PhysicsWorld* world = mPhysicsCommon.createPhysicsWorld();
+            world->setContactsPositionCorrectionTechnique(positionCorrectionTechnique);
+
+            createGround(world);
+
+            const int nbBoxes = 5;
+            RigidBody* boxes[nbBoxes];
+            for (int i=0; i < nbBoxes; i++) {
+                boxes[i] = createBody(world, mBoxShape, Vector3(0, decimal(0.5) + i, 0));
+            }
+
+            simulate(world, 180);
+
+            // The stack does not collapse (a tall stack keeps wobbling slightly)
+            for (int i=0; i < nbBoxes; i++) {
+                rp3d_test(isRestingAt(boxes[i], Vector3(0, decimal(0.5) + i, 0), decimal(0.5)));
+                rp3d_test(approxEqualOrientations(boxes[i]->getTransform().getOrientation(), Quaternion::identity(), decimal(0.05)));
+            }
+
+            mPhysicsCommon.destroyPhysicsWorld(world);
+        }
+
+        /// Number of contact manifolds that is not a multiple of the number of solver lanes
+        void testPartialBatch() {
+
+            PhysicsWorld* world = mPhysicsCommon.createPhysicsWorld();
+
+            createGround(world);
+
+            // Each box touches the static ground with its own manifold
+            const int nbBoxes = 2 * NB_CONTACT_SOLVER_LANES + 3;
+            RigidBody* boxes[nbBoxes];
+            for (int i=0; i < nbBoxes; i++) {
+                boxes[i] = createBody(world, mBoxShape, Vector3(decimal(-18.0) + 2 * (i % 10), decimal(0.6), decimal(-10.0) + 4 * (i / 10)));
+            }
+
+            simulate(world, 120);
+
+            for (int i=0; i < nbBoxes; i++) {
+                const Vector3 initialPosition(decimal(-18.0) + 2 * (i % 10), decimal(0.5), decimal(-10.0) + 4 * (i / 10));
+                rp3d_test(isRestingAt(boxes[i], initialPosition));
+            }
+
+            mPhysicsCommon.destroyPhysicsWorld(world);
+        }
+
+        /// Dynamic bodies that are part of several contact manifolds
+        void testBodyWithSeveralManifolds() {
+
+            PhysicsWorld* world = mPhysicsCommon.createPhysicsWorld();
+
+            createGround(world);
+
+            // A plank resting on three boxes: the plank is in three manifolds and each box in two
+            RigidBody* boxes[3];
+            for (int i=0; i < 3; i++) {
+                boxes[i] = createBody(world, mBoxShape, Vector3(decimal(-2.0) + 2 * i, decimal(0.5), 0));
+            }
+            RigidBody* plank = createBody(world, mPlankShape, Vector3(0, decimal(1.3), 0));
+
+            simulate(world, 180);
+
+            for (int i=0; i < 3; i++) {
+                rp3d_test(isRestingAt(boxes[i], Vector3(decimal(-2.0) + 2 * i, decimal(0.5), 0)));
+            }
+            rp3d_test(isRestingAt(plank, Vector3(0, decimal(1.25), 0)));
+            rp3d_test(approxEqualOrientations(plank->getTransform().getOrientation(), Quaternion::identity(), decimal(0.01)));
+
+            mPhysicsCommon.destroyPhysicsWorld(world);
+        }
+
+        /// Kinematic body in contact with more bodies than the number of solver lanes
+        void testSharedKinematicBody() {
+
+            PhysicsWorld* world = mPhysicsCommon.createPhysicsWorld();
+
+            // Platform moving upward at constant velocity
+            RigidBody* platform = createBody(world, mGroundShape, Vector3(0, -1, 0), BodyType::KINEMATIC);
+            platform->setLinearVelocity(Vector3(0, 1, 0));
+
+            const int nbBoxes = NB_CONTACT_SOLVER_LANES + 1;
+            RigidBody* boxes[nbBoxes];
+            for (int i=0; i < nbBoxes; i++) {
+                boxes[i] = createBody(world, mBoxShape, Vector3(decimal(-8.0) + 2 * i, decimal(0.5), 0));
+            }
+
+            simulate(world, 60);
+
+            // The contacts do not change the velocity of the kinematic platform
+            rp3d_test(platform->getLinearVelocity() == Vector3(0, 1, 0));
+            rp3d_test(platform->getAngularVelocity() == Vector3::zero());
+            const decimal platformTop = platform->getTransform().getPosition().y + 1;
+            rp3d_test(approxEqual(platformTop, decimal(1.0), decimal(0.01)));
+
+            // The boxes are carried by the platform
+            for (int i=0; i < nbBoxes; i++) {
+                const Vector3 boxPosition = boxes[i]->getTransform().getPosition();
+                rp3d_test(approxEqual(boxPosition, Vector3(decimal(-8.0) + 2 * i, platformTop + decimal(0.5), 0), decimal(0.05)));
+                rp3d_test(approxEqual(boxes[i]->getLinearVelocity(), Vector3(0, 1, 0), decimal(0.05)));
+            }
+
+            mPhysicsCommon.destroyPhysicsWorld(world);
+        }
+
+        /// Body with locked translation and rotation axes sliding on the ground
+        void testLockAxis() {
+
+            PhysicsWorld* world = mPhysicsCommon.createPhysicsWorld();
+
+            createGround(world);
+
+            const Quaternion orientation = Quaternion::fromEulerAngles(0, decimal(0.3), 0);
+            RigidBody* box = world->createRigidBody(Transform(Vector3(0, decimal(0.5), 0), orientation));
+            box->addCollider(mBoxShape, Transform::identity());
+            box->setLinearLockAxisFactor(Vector3(1, 1, 0));
+            box->setAngularLockAxisFactor(Vector3(0, 0, 0));
+            box->setLinearVelocity(Vector3(3, 0, 0));
+
+            // Other box in the same batch that is free to move
+            RigidBody* freeBox = createBody(world, mBoxShape, Vector3(0, decimal(0.5), 5));
+            freeBox->setLinearVelocity(Vector3(3, 0, 0));
+
+            simulate(world, 120);
+
+            // The friction has stopped the box without moving it along the locked axis nor rotating it
+            const Vector3 position = box->getTransform().getPosition();
+            rp3d_test(position.x > decimal(0.5));
+            rp3d_test(approxEqual(position.y, decimal(0.5), decimal(0.05)));
+            rp3d_test(position.z == decimal(0.0));
+            rp3d_test(approxEqualOrientations(box->getTransform().getOrientation(), orientation, decimal(0.0001)));
+            rp3d_test(box->getLinearVelocity().length() < decimal(0.05));
+
+            // The free box has been stopped by friction as well
+            rp3d_test(freeBox->getTransform().getPosition().x > decimal(0.5));
+            rp3d_test(freeBox->getLinearVelocity().length() < decimal(0.05));
+
+            mPhysicsCommon.destroyPhysicsWorld(world);
+        }
+};
+
+}
+
+#endif
@@ -146,6 +146,7 @@ class TestRigidBody : public Test {
             testGettersSetters();
             testMassPropertiesMethods();
             testApplyForcesAndTorques();
+            testContinuousCollisionDetection();
         }
 
         void testGettersSetters() {
@@ -311,6 +312,86 @@ class TestRigidBody : public Test {
             mRigidBody3->resetForce();
             mRigidBody3->resetTorque();
         }
+
+        void testContinuousCollisionDetection() {
+
+            PhysicsWorld::WorldSettings settings;
+            settings.gravity = Vector3::zero();
+            PhysicsWorld* world = mPhysicsCommon.createPhysicsWorld(settings);
+
+            // Thin static wall at x = 5
+            RigidBody* wall = world->createRigidBody(Transform(Vector3(5, 0, 0), Quaternion::identity()));
+            wall->setType(BodyType::STATIC);
+            BoxShape* wallShape = mPhysicsCommon.createBoxShape(Vector3(decimal(0.05), 10, 10));
+            wall->addCollider(wallShape, Transform::identity());
+
+            // Two small spheres moving much farther than their radius during a step
+            SphereShape* sphereShape = mPhysicsCommon.createSphereShape(decimal(0.1));
+            RigidBody* bullet = world->createRigidBody(Transform::identity());
+            bullet->addCollider(sphereShape, Transform::identity());
+            bullet->setLinearVelocity(Vector3(200, 0, 0));
+            RigidBody* bulletCCD = world->createRigidBody(Transform(Vector3(0, 5, 0), Quaternion::identity()));
+            bulletCCD->addCollider(sphereShape, Transform::identity());
+            bulletCCD->setLinearVelocity(Vector3(200, 0, 0));
+
+            rp3d_test(!bulletCCD->isContinuousCollisionDetectionEnabled());
+            bulletCCD->enableContinuousCollisionDetection(true);
+            rp3d_test(bulletCCD->isContinuousCollisionDetectionEnabled());
+
+            for (int i=0; i < 10; i++) {
+                world->update(decimal(1.0 / 60.0));
+            }
+
+            // Without continuous collision detection the sphere tunnels through the wall
+            rp3d_test(bullet->getTransform().getPosition().x > decimal(5.0));
+
+            // With continuous collision detection the sphere is stopped by the wall
+            rp3d_test(bulletCCD->getTransform().getPosition().x < decimal(5.0));
+
+            // Thin static bar at x = 5 grazed by a sphere whose center passes above the bar
+            RigidBody* bar = world->createRigidBody(Transform(Vector3(5, 20, 0), Quaternion::identity()));
+            bar->setType(BodyType::STATIC);
+            BoxShape* barShape = mPhysicsCommon.createBoxShape(Vector3(decimal(0.05), decimal(0.5), 10));
+            bar->addCollider(barShape, Transform::identity());
+            RigidBody* grazingBullet = world->createRigidBody(Transform(Vector3(0, decimal(20.55), 0), Quaternion::identity()));
+            grazingBullet->addCollider(sphereShape, Transform::identity());
+            grazingBullet->setLinearVelocity(Vector3(200, 0, 0));
+            grazingBullet->enableContinuousCollisionDetection(true);
+
+            // Static concave mesh wall (a square made of two triangles facing +x) at x = -5
+            float wallVertices[4 * 3] = {0, -1, -1,   0, 1, -1,   0, 1, 1,   0, -1, 1};
+            int wallIndices[2 * 3] = {0, 1, 2,   0, 2, 3};
+            TriangleVertexArray wallTriangleVertexArray(4, &(wallVertices[0]), 3 * sizeof(float), 2, &(wallIndices[0]), 3 * sizeof(int),
+                                                        rp3d::TriangleVertexArray::VertexDataType::VERTEX_FLOAT_TYPE,
+                                                        rp3d::TriangleVertexArray::IndexDataType::INDEX_INTEGER_TYPE);
+            TriangleMesh* wallTriangleMesh = mPhysicsCommon.createTriangleMesh();
+            wallTriangleMesh->addSubpart(&wallTriangleVertexArray);
+            ConcaveMeshShape* meshWallShape = mPhysicsCommon.createConcaveMeshShape(wallTriangleMesh);
+            RigidBody* meshWall = world->createRigidBody(Transform(Vector3(-5, 30, 0), Quaternion::identity()));
+            meshWall->setType(BodyType::STATIC);
+            meshWall->addCollider(meshWallShape, Transform::identity());
+            RigidBody* meshBullet = world->createRigidBody(Transform(Vector3(0, 30, 0), Quaternion::identity()));
+            meshBullet->addCollider(sphereShape, Transform::identity());
+            meshBullet->setLinearVelocity(Vector3(-200, 0, 0));
+            meshBullet->enableContinuousCollisionDetection(true);
+
+            for (int i=0; i < 10; i++) {
+                world->update(decimal(1.0 / 60.0));
+            }
+
+            // The swept sphere hits the edge of the bar even if its center misses it
+            rp3d_test(grazingBullet->getTransform().getPosition().x < decimal(5.0));
+
+            // The swept sphere hits the triangles of the concave mesh
+            rp3d_test(meshBullet->getTransform().getPosition().x > decimal(-5.0));
+
+            mPhysicsCommon.destroyPhysicsWorld(world);
+            mPhysicsCommon.destroyBoxShape(wallShape);
+            mPhysicsCommon.destroyBoxShape(barShape);
+            mPhysicsCommon.destroyConcaveMeshShape(meshWallShape);
+            mPhysicsCommon.destroyTriangleMesh(wallTriangleMesh);
+            mPhysicsCommon.destroySphereShape(sphereShape);
+        }
  };
 
 }
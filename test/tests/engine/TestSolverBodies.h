@@ -0,0 +1,279 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2022 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef TEST_SOLVER_BODIES_H
+#define TEST_SOLVER_BODIES_H
+
+// Libraries
+#include <reactphysics3d/reactphysics3d.h>
+#include <reactphysics3d/engine/SolverBodies.h>
+#include <reactphysics3d/engine/Islands.h>
+#include <reactphysics3d/components/RigidBodyComponents.h>
+#include <reactphysics3d/memory/DefaultAllocator.h>
+
+/// Reactphysics3D namespace
+namespace reactphysics3d {
+
+// Class TestSolverBodies
+/**
+ * Unit test for the SolverBodies structure used by the velocity solver.
+ */
+class TestSolverBodies : public Test {
+
+    private :
+
+        // ---------- Atributes ---------- //
+
+        DefaultAllocator mAllocator;
+        PhysicsCommon mPhysicsCommon;
+
+        RigidBodyComponents mRigidBodyComponents;
+
+        Entity mDynamicEntity1;
+        Entity mDynamicEntity2;
+        Entity mDynamicEntity3;
+        Entity mStaticEntity1;
+        Entity mStaticEntity2;
+
+        Vector3 mWorldPosition;
+
+    public :
+
+        // ---------- Methods ---------- //
+
+        /// Constructor
+        TestSolverBodies(const std::string& name)
+            : Test(name), mRigidBodyComponents(mAllocator), mDynamicEntity1(0, 0), mDynamicEntity2(1, 0),
+              mDynamicEntity3(2, 0), mStaticEntity1(3, 0), mStaticEntity2(4, 0), mWorldPosition(0, 0, 0) {
+
+            mRigidBodyComponents.addComponent(mDynamicEntity1, false, RigidBodyComponents::RigidBodyComponent(nullptr, BodyType::DYNAMIC, mWorldPosition));
+            mRigidBodyComponents.addComponent(mDynamicEntity2, false, RigidBodyComponents::RigidBodyComponent(nullptr, BodyType::DYNAMIC, mWorldPosition));
+            mRigidBodyComponents.addComponent(mDynamicEntity3, false, RigidBodyComponents::RigidBodyComponent(nullptr, BodyType::DYNAMIC, mWorldPosition));
+            mRigidBodyComponents.addComponent(mStaticEntity1, false, RigidBodyComponents::RigidBodyComponent(nullptr, BodyType::STATIC, mWorldPosition));
+            mRigidBodyComponents.addComponent(mStaticEntity2, false, RigidBodyComponents::RigidBodyComponent(nullptr, BodyType::STATIC, mWorldPosition));
+
+            mRigidBodyComponents.setMassInverse(mDynamicEntity1, decimal(0.5));
+            mRigidBodyComponents.setMassInverse(mDynamicEntity2, decimal(0.25));
+            mRigidBodyComponents.setMassInverse(mDynamicEntity3, decimal(2.0));
+            mRigidBodyComponents.setMassInverse(mStaticEntity1, decimal(0.0));
+            mRigidBodyComponents.setMassInverse(mStaticEntity2, decimal(0.0));
+
+            mRigidBodyComponents.setConstrainedLinearVelocity(mDynamicEntity1, Vector3(1, 2, 3));
+            mRigidBodyComponents.setConstrainedAngularVelocity(mDynamicEntity1, Vector3(4, 5, 6));
+            mRigidBodyComponents.setLinearLockAxisFactor(mDynamicEntity3, Vector3(1, 0, 1));
+            mRigidBodyComponents.setAngularLockAxisFactor(mDynamicEntity3, Vector3(0, 1, 0));
+        }
+
+        /// Destructor
+        virtual ~TestSolverBodies() {
+
+            mRigidBodyComponents.removeComponent(mDynamicEntity1);
+            mRigidBodyComponents.removeComponent(mDynamicEntity2);
+            mRigidBodyComponents.removeComponent(mDynamicEntity3);
+            mRigidBodyComponents.removeComponent(mStaticEntity1);
+            mRigidBodyComponents.removeComponent(mStaticEntity2);
+        }
+
+        /// Run the tests
+        void run() {
+
+            testCreate();
+            testAddBodyNotInIslands();
+            testStoreVelocities();
+            testJointsWithStaticBody();
+        }
+
+        /// Create two islands that share the first static body
+        void createIslands(Islands& islands) {
+
+            islands.addIsland(0);
+            islands.addBodyToIsland(mDynamicEntity1);
+            islands.addBodyToIsland(mStaticEntity1);
+            islands.addBodyToIsland(mDynamicEntity2);
+
+            islands.addIsland(0);
+            islands.addBodyToIsland(mDynamicEntity3);
+            islands.addBodyToIsland(mStaticEntity1);
+        }
+
+        void testCreate() {
+
+            Islands islands(mAllocator);
+            createIslands(islands);
+
+            SolverBodies solverBodies(mAllocator, mRigidBodyComponents);
+            solverBodies.create(islands);
+
+            // The static body shared by the two islands is only stored once
+            rp3d_test(solverBodies.getNbBodies() == 4);
+
+            // The bodies are stored in the order of the islands
+            const uint32 dynamicIndex1 = mRigidBodyComponents.getEntityIndex(mDynamicEntity1);
+            const uint32 dynamicIndex2 = mRigidBodyComponents.getEntityIndex(mDynamicEntity2);
+            const uint32 dynamicIndex3 = mRigidBodyComponents.getEntityIndex(mDynamicEntity3);
+            const uint32 staticIndex1 = mRigidBodyComponents.getEntityIndex(mStaticEntity1);
+
+            rp3d_test(solverBodies.rigidBodyComponentIndices[0] == dynamicIndex1);
+            rp3d_test(solverBodies.rigidBodyComponentIndices[1] == staticIndex1);
+            rp3d_test(solverBodies.rigidBodyComponentIndices[2] == dynamicIndex2);
+            rp3d_test(solverBodies.rigidBodyComponentIndices[3] == dynamicIndex3);
+
+            rp3d_test(solverBodies.getSolverBodyIndex(dynamicIndex1) == 0);
+            rp3d_test(solverBodies.getSolverBodyIndex(staticIndex1) == 1);
+            rp3d_test(solverBodies.getSolverBodyIndex(dynamicIndex2) == 2);
+            rp3d_test(solverBodies.getSolverBodyIndex(dynamicIndex3) == 3);
+            rp3d_test(solverBodies.getNbBodies() == 4);
+
+            // The state of the bodies is copied from the components
+            rp3d_test(solverBodies.linearVelocities[0] == Vector3(1, 2, 3));
+            rp3d_test(solverBodies.angularVelocities[0] == Vector3(4, 5, 6));
+            rp3d_test(approxEqual(solverBodies.inverseMasses[0], decimal(0.5)));
+            rp3d_test(approxEqual(solverBodies.inverseMasses[1], decimal(0.0)));
+            rp3d_test(approxEqual(solverBodies.inverseMasses[2], decimal(0.25)));
+            rp3d_test(approxEqual(solverBodies.inverseMasses[3], decimal(2.0)));
+            rp3d_test(solverBodies.linearLockAxisFactors[3] == Vector3(1, 0, 1));
+            rp3d_test(solverBodies.angularLockAxisFactors[3] == Vector3(0, 1, 0));
+
+            solverBodies.clear();
+            rp3d_test(solverBodies.getNbBodies() == 0);
+        }
+
+        void testAddBodyNotInIslands() {
+
+            Islands islands(mAllocator);
+            createIslands(islands);
+
+            SolverBodies solverBodies(mAllocator, mRigidBodyComponents);
+            solverBodies.create(islands);
+
+            rp3d_test(solverBodies.getNbBodies() == 4);
+
+            // A body that is not in any island is added the first time it is requested
+            const uint32 staticIndex2 = mRigidBodyComponents.getEntityIndex(mStaticEntity2);
+            rp3d_test(solverBodies.getSolverBodyIndex(staticIndex2) == 4);
+            rp3d_test(solverBodies.getNbBodies() == 5);
+            rp3d_test(solverBodies.rigidBodyComponentIndices[4] == staticIndex2);
+            rp3d_test(approxEqual(solverBodies.inverseMasses[4], decimal(0.0)));
+
+            // It is not added a second time
+            rp3d_test(solverBodies.getSolverBodyIndex(staticIndex2) == 4);
+            rp3d_test(solverBodies.getNbBodies() == 5);
+
+            solverBodies.clear();
+
+            // The next frame starts without the bodies of the previous frame
+            Islands islands2(mAllocator);
+            islands2.addIsland(0);
+            islands2.addBodyToIsland(mDynamicEntity2);
+            solverBodies.create(islands2);
+
+            rp3d_test(solverBodies.getNbBodies() == 1);
+            rp3d_test(solverBodies.getSolverBodyIndex(mRigidBodyComponents.getEntityIndex(mDynamicEntity2)) == 0);
+            rp3d_test(solverBodies.getSolverBodyIndex(staticIndex2) == 1);
+
+            solverBodies.clear();
+        }
+
+        void testStoreVelocities() {
+
+            Islands islands(mAllocator);
+            createIslands(islands);
+
+            SolverBodies solverBodies(mAllocator, mRigidBodyComponents);
+            solverBodies.create(islands);
+
+            const uint32 solverIndex1 = solverBodies.getSolverBodyIndex(mRigidBodyComponents.getEntityIndex(mDynamicEntity1));
+            const uint32 solverIndex3 = solverBodies.getSolverBodyIndex(mRigidBodyComponents.getEntityIndex(mDynamicEntity3));
+
+            solverBodies.linearVelocities[solverIndex1] = Vector3(-1, -2, -3);
+            solverBodies.angularVelocities[solverIndex1] = Vector3(-4, -5, -6);
+            solverBodies.splitLinearVelocities[solverIndex3] = Vector3(7, 8, 9);
+            solverBodies.splitAngularVelocities[solverIndex3] = Vector3(10, 11, 12);
+
+            // The velocities are only written into the components when they are stored
+            rp3d_test(mRigidBodyComponents.getConstrainedLinearVelocity(mDynamicEntity1) == Vector3(1, 2, 3));
+
+            solverBodies.storeVelocities();
+            solverBodies.clear();
+
+            rp3d_test(mRigidBodyComponents.getConstrainedLinearVelocity(mDynamicEntity1) == Vector3(-1, -2, -3));
+            rp3d_test(mRigidBodyComponents.getConstrainedAngularVelocity(mDynamicEntity1) == Vector3(-4, -5, -6));
+            rp3d_test(mRigidBodyComponents.getSplitLinearVelocity(mDynamicEntity3) == Vector3(7, 8, 9));
+            rp3d_test(mRigidBodyComponents.getSplitAngularVelocity(mDynamicEntity3) == Vector3(10, 11, 12));
+            rp3d_test(mRigidBodyComponents.getConstrainedLinearVelocity(mDynamicEntity2) == Vector3(0, 0, 0));
+            rp3d_test(mRigidBodyComponents.getConstrainedLinearVelocity(mStaticEntity2) == Vector3(0, 0, 0));
+
+            // Restore the initial velocities
+            mRigidBodyComponents.setConstrainedLinearVelocity(mDynamicEntity1, Vector3(1, 2, 3));
+            mRigidBodyComponents.setConstrainedAngularVelocity(mDynamicEntity1, Vector3(4, 5, 6));
+            mRigidBodyComponents.setSplitLinearVelocity(mDynamicEntity3, Vector3(0, 0, 0));
+            mRigidBodyComponents.setSplitAngularVelocity(mDynamicEntity3, Vector3(0, 0, 0));
+        }
+
+        void testJointsWithStaticBody() {
+
+            PhysicsWorld* world = mPhysicsCommon.createPhysicsWorld();
+
+            // Static body shared by two joints of two different islands
+            const Vector3 anchorPoint(0, 10, 0);
+            RigidBody* staticBody = world->createRigidBody(Transform(anchorPoint, Quaternion::identity()));
+            staticBody->setType(BodyType::STATIC);
+
+            // Pendulum attached to the static body with a ball-and-socket joint
+            RigidBody* pendulumBody = world->createRigidBody(Transform(Vector3(2, 10, 0), Quaternion::identity()));
+            BallAndSocketJointInfo ballAndSocketJointInfo(staticBody, pendulumBody, anchorPoint);
+            Joint* ballAndSocketJoint = world->createJoint(ballAndSocketJointInfo);
+
+            // Body attached to the static body with a fixed joint
+            RigidBody* fixedBody = world->createRigidBody(Transform(Vector3(-3, 10, 0), Quaternion::identity()));
+            FixedJointInfo fixedJointInfo(staticBody, fixedBody, anchorPoint);
+            Joint* fixedJoint = world->createJoint(fixedJointInfo);
+
+            for (int i=0; i < 60; i++) {
+                world->update(decimal(1.0) / decimal(60.0));
+            }
+
+            // The pendulum has fallen but stays at the same distance from the anchor point
+            const Vector3 pendulumPosition = pendulumBody->getTransform().getPosition();
+            rp3d_test(pendulumPosition.y < decimal(9.0));
+            rp3d_test(approxEqual((pendulumPosition - anchorPoint).length(), decimal(2.0), decimal(0.05)));
+
+            // The body with the fixed joint does not fall
+            rp3d_test(approxEqual(fixedBody->getTransform().getPosition(), Vector3(-3, 10, 0), decimal(0.05)));
+
+            // The static body does not move
+            rp3d_test(staticBody->getTransform().getPosition() == anchorPoint);
+            rp3d_test(staticBody->getLinearVelocity() == Vector3::zero());
+            rp3d_test(staticBody->getAngularVelocity() == Vector3::zero());
+
+            world->destroyJoint(ballAndSocketJoint);
+            world->destroyJoint(fixedJoint);
+            mPhysicsCommon.destroyPhysicsWorld(world);
+        }
+};
+
+}
+
+#endif